@@ -0,0 +1,159 @@
+/**
+ * @file bench_analog.c
+ * @brief Host benchmark: raw to mV conversion with the 33 point calibration
+ * table (analog_cali_mcu.h) against one calibration scheme call per sample
+ * and against a 4096 entry LUT
+ * @version 0.1
+ * @date 2026-10-19
+ *
+ * @copyright Copyright (c) 2026
+ *
+ */
+
+/*==================[inclusions]=============================================*/
+#include <stdio.h>
+#include <stdlib.h>
+#include <stdbool.h>
+#include <time.h>
+#include "analog_cali_mcu.h"
+/*==================[macros and definitions]=================================*/
+#define SAMPLES			4096	/*!< Every raw code once */
+#define REPEAT			2000
+#define RUNS			5		/*!< Best of RUNS (the host is shared) */
+#define ERROR_TERMS		3
+/*==================[internal data declaration]==============================*/
+/**
+ * @brief Stand-in of the IDF curve fitting scheme: linear fit (eFuse
+ * coefficients) minus an error polynomial evaluated with 64 bit integers.
+ * The structure of the computation is the one of adc_cali_raw_to_voltage(),
+ * the coefficients are illustrative (a few mV of curvature at 12 dB).
+ */
+typedef struct {
+	uint32_t coeff_a;					/*!< Slope, scaled by coeff_a_scaling */
+	uint32_t coeff_a_scaling;
+	int32_t coeff_b;					/*!< Offset (mV) */
+	uint64_t error_coeff[ERROR_TERMS][2];	/*!< Error polynomial: coefficient, divisor */
+	int8_t error_sign[ERROR_TERMS];
+} bench_cali_t;
+/*==================[internal data definition]===============================*/
+static bench_cali_t cali = {
+	.coeff_a = 806,
+	.coeff_a_scaling = 1000,
+	.coeff_b = 12,
+	.error_coeff = {{3801417550380255ULL, 10000000000000000ULL}, {6020352420772ULL, 10000000000000000ULL},
+		{12442478488ULL, 10000000000000000ULL}},
+	.error_sign = {-1, -1, 1},
+};
+static bench_cali_t *volatile cali_p = &cali;	/*!< Coefficients unknown at compile time (eFuse) */
+static uint16_t raw[SAMPLES];
+static uint16_t mv[SAMPLES];
+static uint16_t table[ADC_CALI_TABLE_POINTS];
+static uint16_t lut[ADC_CALI_RAW_MAX + 1];
+static int errors = 0;
+/*==================[internal functions definition]==========================*/
+static void Check(bool ok, const char *what){
+	if(!ok){
+		printf("  FAIL: %s\n", what);
+		errors++;
+	}
+}
+
+static double TimeNs(void){
+	struct timespec t;
+	clock_gettime(CLOCK_MONOTONIC, &t);
+	return t.tv_sec * 1e9 + t.tv_nsec;
+}
+
+/* adc_cali_raw_to_voltage() stand-in (not inlined, as the IDF call) */
+static __attribute__((noinline)) int CaliRawToVoltage(const bench_cali_t *c, int raw_count, int *voltage){
+	uint64_t v_cali_1 = (uint64_t)raw_count * c->coeff_a / c->coeff_a_scaling + c->coeff_b;
+	uint64_t variable = 1, term;
+	int32_t error = 0;
+
+	for(uint8_t i = 0; i < ERROR_TERMS; i++){
+		term = variable * c->error_coeff[i][0] / c->error_coeff[i][1];
+		error += (int32_t)term * c->error_sign[i];
+		variable *= v_cali_1;
+	}
+	*voltage = (int32_t)v_cali_1 - error;
+	return 0;
+}
+
+static double Convert(int path){
+	double start, best = 0, ns;
+	int voltage;
+
+	for(uint8_t run = 0; run < RUNS; run++){
+		start = TimeNs();
+		for(uint32_t n = 0; n < REPEAT; n++){
+			switch(path){
+			case 0:
+				for(uint16_t i = 0; i < SAMPLES; i++){
+					CaliRawToVoltage(cali_p, raw[i], &voltage);
+					mv[i] = voltage;
+				}
+				break;
+			case 1:
+				for(uint16_t i = 0; i < SAMPLES; i++){
+					mv[i] = AnalogCaliTableRead(table, raw[i]);
+				}
+				break;
+			default:
+				for(uint16_t i = 0; i < SAMPLES; i++){
+					mv[i] = lut[raw[i]];
+				}
+				break;
+			}
+			/* The results are used: keep every repetition */
+			__asm__ volatile("" : : "g"(mv) : "memory");
+		}
+		ns = (TimeNs() - start) / ((double)REPEAT * SAMPLES);
+		best = ((run == 0) || (ns < best)) ? ns : best;
+	}
+	return best;
+}
+/*==================[external functions definition]==========================*/
+int main(void){
+	double call, interp, full;
+	int voltage, error, error_max = 0;
+
+	for(uint8_t i = 0; i < ADC_CALI_TABLE_POINTS; i++){
+		CaliRawToVoltage(&cali, AnalogCaliTableRaw(i), &voltage);
+		table[i] = voltage;
+	}
+	for(uint16_t i = 0; i <= ADC_CALI_RAW_MAX; i++){
+		CaliRawToVoltage(&cali, i, &voltage);
+		lut[i] = voltage;
+		error = abs((int)AnalogCaliTableRead(table, i) - voltage);
+		error_max = (error > error_max) ? error : error_max;
+	}
+	/* Raw codes in a shuffled order: no help from the access pattern */
+	srand(1);
+	for(uint16_t i = 0; i < SAMPLES; i++){
+		raw[i] = i;
+	}
+	for(uint16_t i = SAMPLES - 1; i > 0; i--){
+		uint16_t j = rand() % (i + 1), t = raw[i];
+		raw[i] = raw[j];
+		raw[j] = t;
+	}
+
+	printf("ADC raw to mV, %d samples x %d (best of %d runs)\n", SAMPLES, REPEAT, RUNS);
+	call = Convert(0);
+	interp = Convert(1);
+	full = Convert(2);
+	printf("  %-30s %6.2f ns/sample %6d bytes\n", "calibration call per sample", call, 0);
+	printf("  %-30s %6.2f ns/sample %6d bytes (%.1fx)\n", "33 point table, interpolated", interp,
+		(int)sizeof(table), call / interp);
+	printf("  %-30s %6.2f ns/sample %6d bytes (%.1fx)\n", "4096 entry LUT", full, (int)sizeof(lut), call / full);
+	printf("  table error against the calibration call: %d mV max\n", error_max);
+
+	/* The scheme truncates to whole mV: up to 1 mV at the table points and 1 mV at the sample */
+	Check(error_max <= 2, "table within 2 mV of the calibration call");
+	Check(interp < call, "table faster than the calibration call");
+	Check(sizeof(table) * 64 <= sizeof(lut), "table 64 times smaller than the LUT");
+	printf("%s (%d errors)\n", errors ? "FAILED" : "OK", errors);
+	return errors != 0;
+}
+
+/*==================[end of file]============================================*/
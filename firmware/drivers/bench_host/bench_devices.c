@@ -0,0 +1,163 @@
+/**
+ * @file bench_devices.c
+ * @brief Host check: the unmodified device drivers against device models on
+ * the host backend, with the virtual time of each operation
+ * @version 0.1
+ * @date 2026-10-19
+ *
+ * @copyright Copyright (c) 2026
+ *
+ */
+
+/*==================[inclusions]=============================================*/
+#include <stdio.h>
+#include <stdlib.h>
+#include "host_mcu.h"
+#include "device_models.h"
+#include "hx711.h"
+#include "hc_sr04.h"
+#include "mpu6050.h"
+#include "ili9341.h"
+/*==================[macros and definitions]=================================*/
+#define HX711_SCK		GPIO_20
+#define HX711_DOUT		GPIO_21
+#define HC_SR04_ECHO	GPIO_3
+#define HC_SR04_TRIGGER	GPIO_2
+#define LCD_DC			GPIO_9
+#define LCD_RST			GPIO_18
+#define LCD_SPI			SPI_1
+/*==================[internal data definition]===============================*/
+static hx711_model_t hx711 = {
+	.sck = HX711_SCK,
+	.dout = HX711_DOUT,
+	.conversion_us = 12500,
+};
+static hc_sr04_model_t hc_sr04 = {
+	.echo = HC_SR04_ECHO,
+	.trigger = HC_SR04_TRIGGER,
+};
+static mpu6050_model_t mpu6050;
+static ili9341_model_t lcd;
+static int errors = 0;
+/*==================[internal functions definition]==========================*/
+static void Check(bool ok, const char *what){
+	if(!ok){
+		printf("  FAIL: %s\n", what);
+		errors++;
+	}
+}
+
+static void Report(const char *op, uint64_t start_ns){
+	printf("  %-34s %10.1f us\n", op, (HostTimeNs() - start_ns) / 1e3);
+}
+
+static void BenchHx711(void){
+	const int32_t samples[] = {0x123456, -0x10000, 0x7FFFFF, -0x800000};
+	uint64_t start;
+	uint32_t value, expected;
+
+	printf("HX711 (PD_SCK bit-banged, 80 SPS)\n");
+	Hx711ModelInit(&hx711);
+	start = HostTimeNs();
+	HX711_Init(128, HX711_SCK, HX711_DOUT);
+	Report("HX711_Init (first conversion)", start);
+	for(uint8_t i = 0; i < sizeof(samples) / sizeof(samples[0]); i++){
+		hx711.value = samples[i];
+		start = HostTimeNs();
+		value = HX711_read();
+		Report("HX711_read", start);
+		/* The driver drops the 6 LSBs and offsets to unsigned */
+		expected = (((uint32_t)samples[i] & 0xFFFFFF) >> 6) ^ 0x800000;
+		Check(value == expected, "HX711_read value");
+		Check(hx711.gain_pulses == 25, "HX711 gain pulses (channel A, 128)");
+	}
+	hx711.value = 0x1000;
+	start = HostTimeNs();
+	value = HX711_readAverage(8);
+	Report("HX711_readAverage(8)", start);
+	Check(value == ((0x1000 >> 6) ^ 0x800000), "HX711_readAverage value");
+}
+
+static void BenchHcSr04(void){
+	const uint16_t distances[] = {10, 57, 150, 290};
+	uint64_t start;
+	uint16_t cm;
+
+	printf("HC-SR04 (trigger + echo polling)\n");
+	HcSr04ModelInit(&hc_sr04);
+	HcSr04Init(HC_SR04_ECHO, HC_SR04_TRIGGER);
+	for(uint8_t i = 0; i < sizeof(distances) / sizeof(distances[0]); i++){
+		hc_sr04.distance_cm = distances[i];
+		start = HostTimeNs();
+		cm = HcSr04ReadDistanceInCentimeters();
+		Report("HcSr04ReadDistanceInCentimeters", start);
+		printf("    model %3u cm, driver %3u cm\n", distances[i], cm);
+		/* 10 us polling and the 59 us/cm scale of the driver */
+		Check(abs((int)cm - (int)distances[i]) <= 1 + distances[i] / 30, "HC-SR04 distance");
+		/* Let the echo end before the next ping */
+		HostRunUs(60000);
+	}
+	Check(hc_sr04.pings == sizeof(distances) / sizeof(distances[0]), "HC-SR04 triggers");
+}
+
+static void BenchMpu6050(void){
+	const int16_t accel[3] = {1200, -16384, 300};
+	const int16_t gyro[3] = {-5, 131, 32767};
+	int16_t ax, ay, az, gx, gy, gz;
+	uint64_t start;
+
+	printf("MPU6050 (I2C 400 kHz)\n");
+	Mpu6050ModelInit(&mpu6050);
+	Mpu6050ModelMotion(&mpu6050, accel, gyro);
+	I2C_initialize(I2C_MASTER_FREQ_HZ);
+	start = HostTimeNs();
+	MPU6050_initialize();
+	Report("MPU6050_initialize", start);
+	Check((mpu6050.regs[MPU6050_RA_PWR_MGMT_1] & 0x40) == 0, "MPU6050 sleep disabled");
+	Check(MPU6050_testConnection(), "MPU6050_testConnection");
+	start = HostTimeNs();
+	MPU6050_getMotion6(&ax, &ay, &az, &gx, &gy, &gz);
+	Report("MPU6050_getMotion6", start);
+	Check((ax == accel[0]) && (ay == accel[1]) && (az == accel[2]), "MPU6050 acceleration");
+	Check((gx == gyro[0]) && (gy == gyro[1]) && (gz == gyro[2]), "MPU6050 rotation");
+}
+
+static void BenchIli9341(void){
+	uint64_t start;
+
+	printf("ILI9341 (SPI 20 MHz)\n");
+	Ili9341ModelInit(&lcd, LCD_SPI);
+	lcd.dc = LCD_DC;
+	start = HostTimeNs();
+	ILI9341Init(LCD_SPI, LCD_DC, LCD_RST);
+	Report("ILI9341Init (white fill)", start);
+	Check(Ili9341ModelPixel(&lcd, 0, 0) == ILI9341_WHITE, "ILI9341 white fill (first pixel)");
+	Check(Ili9341ModelPixel(&lcd, MODEL_LCD_WIDTH - 1, MODEL_LCD_HEIGHT - 1) == ILI9341_WHITE,
+		"ILI9341 white fill (last pixel)");
+	start = HostTimeNs();
+	ILI9341Fill(ILI9341_BLUE);
+	Report("ILI9341Fill", start);
+	start = HostTimeNs();
+	ILI9341DrawFilledRectangle(10, 20, 49, 59, ILI9341_RED);
+	Report("ILI9341DrawFilledRectangle 40x40", start);
+	Check(Ili9341ModelPixel(&lcd, 10, 20) == ILI9341_RED, "ILI9341 rectangle corner");
+	Check(Ili9341ModelPixel(&lcd, 49, 59) == ILI9341_RED, "ILI9341 rectangle corner");
+	Check(Ili9341ModelPixel(&lcd, 50, 59) == ILI9341_BLUE, "ILI9341 rectangle border");
+	start = HostTimeNs();
+	ILI9341DrawPixel(100, 200, ILI9341_RED);
+	Report("ILI9341DrawPixel", start);
+	Check(Ili9341ModelPixel(&lcd, 100, 200) == ILI9341_RED, "ILI9341 pixel");
+	Check(Ili9341ModelPixel(&lcd, 101, 200) == ILI9341_BLUE, "ILI9341 pixel neighbour");
+}
+/*==================[external functions definition]==========================*/
+int main(void){
+	BenchHx711();
+	BenchHcSr04();
+	BenchMpu6050();
+	BenchIli9341();
+	printf("Virtual time: %.3f ms\n", HostTimeNs() / 1e6);
+	printf("%s (%d errors)\n", errors ? "FAILED" : "OK", errors);
+	return errors != 0;
+}
+
+/*==================[end of file]============================================*/
@@ -0,0 +1,394 @@
+/**
+ * @file bench_event_loop.c
+ * @brief Host benchmark: jobs of examen.c and Proyecto_final.c as one task per
+ * job and as handlers of the event loop (event_loop_mcu.h), RAM and wake up
+ * latency
+ * @version 0.1
+ * @date 2026-10-19
+ *
+ * @copyright Copyright (c) 2026
+ *
+ */
+
+/*==================[inclusions]=============================================*/
+#include <stdio.h>
+#include <stdlib.h>
+#include "host_mcu.h"
+#include "gpio_mcu.h"
+#include "timer_mcu.h"
+#include "uart_mcu.h"
+#include "analog_io_mcu.h"
+#include "hc_sr04.h"
+#include "monitor_mcu.h"
+#include "event_loop_mcu.h"
+#include "device_models.h"
+/*==================[macros and definitions]=================================*/
+#define ECHO				GPIO_3
+#define TRIGGER				GPIO_2
+#define SWITCH				GPIO_4
+#define DISTANCE_CM			200
+#define US_PER_CM			58		/*!< Echo time per cm */
+#define TRIGGER_US			10		/*!< Trigger pulse */
+#define ECHO_DEBOUNCE_MS	1		/*!< Echo edges window (echoes from 17 cm) */
+
+/* examen.c: distance every 500 ms, accelerometer every 10 ms */
+#define TASK_DISTANCE		0
+#define TASK_ACCEL			1
+#define DISTANCE_PERIOD_US	500000
+#define ACCEL_PERIOD_US		10000
+#define ACCEL_WORK_US		60		/*!< 3 ADC conversions and the fall check */
+#define EXAMEN_STACKS		(2048 + 2048)
+/* Proyecto_final.c: control and user interface every 50 ms */
+#define CONTROL_PERIOD_US	50000
+#define UI_PERIOD_US		50000
+#define PROYECTO_STACKS		(2048 + 512)
+
+#define TICK_US				10000	/*!< CONFIG_FREERTOS_HZ = 100 */
+#define TASK_TCB_BYTES		350		/*!< FreeRTOS TCB (about, ESP-IDF 5 on the C6) */
+#define LOOP_BYTES			480		/*!< sizeof(event_loop_t) on the C6 (32 bit pointers, 32 byte lines) */
+#define HANDLER_BYTES		80		/*!< sizeof(event_loop_handler_t) on the C6 */
+#define RUN_MS				5000
+
+/**
+ * @brief Simulated task of the same priority as the others, notified by a
+ * timer ISR
+ */
+typedef struct {
+	uint8_t id;					/*!< Monitor id */
+	void (*job)(void);			/*!< One activation */
+	volatile uint32_t notified;	/*!< Task notification value */
+	uint32_t notify_time;		/*!< First pending notification (us) */
+	uint64_t latency;			/*!< Total wake up latency (us) */
+	uint32_t runs;				/*!< Activations */
+} sim_task_t;
+
+/**
+ * @brief Echo measurement state of the distance handler
+ */
+typedef struct {
+	uint32_t start;				/*!< Rising edge of the echo (us) */
+	uint16_t cm;				/*!< Last distance */
+	uint32_t echoes;			/*!< Echoes measured */
+} echo_t;
+
+/**
+ * @brief Events received by the user interface handler
+ */
+typedef struct {
+	uint32_t timers;			/*!< Periodic runs */
+	uint32_t presses;			/*!< Switch presses */
+	uint32_t releases;			/*!< Switch releases */
+	uint32_t received;			/*!< UART receptions */
+} ui_t;
+/*==================[internal data definition]===============================*/
+static hc_sr04_model_t sonar = {.echo = ECHO, .trigger = TRIGGER, .distance_cm = DISTANCE_CM};
+static uint16_t accel_wave[3] = {1500, 1500, 1500};
+static const adc_ch_t accel_channels[3] = {CH1, CH2, CH3};
+static uint16_t distance_cm;
+
+static void JobDistance(void);
+static void JobAccel(void);
+static sim_task_t tasks[] = {
+	{.id = TASK_DISTANCE, .job = JobDistance},
+	{.id = TASK_ACCEL, .job = JobAccel},
+};
+#define TASK_QTY	(sizeof(tasks) / sizeof(tasks[0]))
+static sim_task_t *running = NULL;	/*!< Task running at the program level */
+static bool preempting = false;		/*!< Tick running a task */
+
+static event_loop_t examen_loop, proyecto_loop, coroutine_loop;
+static echo_t echo;
+static ui_t ui;
+static uint32_t steps;
+static int errors = 0;
+/*==================[internal functions definition]==========================*/
+static void Check(bool ok, const char *what){
+	if(!ok){
+		printf("  FAIL: %s\n", what);
+		errors++;
+	}
+}
+
+/* Accelerometer: scan and fall check (same code in both versions) */
+static void JobAccel(void){
+	uint16_t mv[3];
+
+	AnalogInputScan(accel_channels, 3, mv);
+	AnalogScanToMv(accel_channels, 3, mv);
+	HostRunUs(ACCEL_WORK_US);
+}
+
+/* Distance, task version: the blocking driver */
+static void JobDistance(void){
+	distance_cm = HcSr04ReadDistanceInCentimeters();
+}
+
+/* One activation: ulTaskNotifyTake(pdTRUE, ...) and the job */
+static void Activation(sim_task_t *t){
+	t->latency += MonitorTimeUs() - t->notify_time;
+	t->runs++;
+	t->notified = 0;
+	MonitorBegin(t->id);
+	t->job();
+	MonitorEnd(t->id);
+}
+
+/* Timer ISR: vTaskNotifyGiveFromISR() with yield (the idle CPU switches at once) */
+static void FuncTimer(void *param){
+	sim_task_t *t = param;
+
+	MonitorNotify(t->id);
+	if(t->notified++ == 0){
+		t->notify_time = MonitorTimeUs();
+	}
+	HostWake();
+}
+
+/* Tick ISR: time slicing, the notified tasks preempt the running one (the
+ * jobs they run are short and don't wait on the virtual clock) */
+static void FuncTick(void *param){
+	if((running == NULL) || preempting){
+		return;
+	}
+	preempting = true;
+	for(uint8_t i = 0; i < TASK_QTY; i++){
+		if((&tasks[i] != running) && tasks[i].notified){
+			Activation(&tasks[i]);
+		}
+	}
+	preempting = false;
+}
+
+/* Scheduler and idle task: notified tasks run in turns */
+static void TasksRunMs(uint32_t ms){
+	uint64_t end = HostTimeNs() + ms * 1000000ULL;
+	bool ran;
+
+	while(HostTimeNs() < end){
+		ran = false;
+		for(uint8_t i = 0; i < TASK_QTY; i++){
+			if(tasks[i].notified){
+				running = &tasks[i];
+				Activation(&tasks[i]);
+				running = NULL;
+				ran = true;
+			}
+		}
+		if(!ran){
+			HostWaitNs(end - HostTimeNs());
+		}
+	}
+}
+
+/* Echo edges (gpio_event_mcu.h dispatcher), with the time of their interrupt:
+ * the echo width is posted to the distance handler */
+static void EchoEdge(gpio_event_t *event, void *param){
+	event_loop_handler_t *h = param;
+	echo_t *e = h->param;
+
+	if(event->type == GPIO_EVENT_PRESS){
+		e->start = event->time;
+	} else if(event->type == GPIO_EVENT_RELEASE){
+		EventLoopPost(h, EVENT_LOOP_USER, event->time - e->start);
+	}
+}
+
+/* Distance, event loop version: runs to completion, no echo sampling */
+static void Distance(event_loop_handler_t *h, const event_loop_event_t *event){
+	echo_t *e = h->param;
+
+	switch(event->type){
+		case EVENT_LOOP_TIMER:
+			GPIOOn(TRIGGER);
+			EventLoopSleep(h, TRIGGER_US);
+			break;
+		case EVENT_LOOP_WAKE:
+			GPIOOff(TRIGGER);
+			break;
+		case EVENT_LOOP_USER:
+			e->cm = event->data / US_PER_CM;
+			e->echoes++;
+			break;
+		default:
+			break;
+	}
+}
+
+static void Accel(event_loop_handler_t *h, const event_loop_event_t *event){
+	JobAccel();
+}
+
+static void Control(event_loop_handler_t *h, const event_loop_event_t *event){
+	HostRunUs(ACCEL_WORK_US);
+}
+
+static void Interface(event_loop_handler_t *h, const event_loop_event_t *event){
+	ui_t *u = h->param;
+
+	switch(event->type){
+		case EVENT_LOOP_TIMER:
+			u->timers++;
+			break;
+		case EVENT_LOOP_GPIO:
+			if(EVENT_LOOP_GPIO_TYPE(event->data) == GPIO_EVENT_PRESS){
+				u->presses++;
+			} else if(EVENT_LOOP_GPIO_TYPE(event->data) == GPIO_EVENT_RELEASE){
+				u->releases++;
+			}
+			break;
+		case EVENT_LOOP_DRIVER:
+			u->received++;
+			break;
+		default:
+			break;
+	}
+}
+
+/* Coroutine: one step per resume (EVENT_LOOP_SLEEP_US() and EVENT_LOOP_WAIT_UNTIL()) */
+static void Steps(event_loop_handler_t *h, const event_loop_event_t *event){
+	uint32_t *s = h->param;
+
+	EVENT_LOOP_BEGIN(h);
+	(*s)++;
+	EVENT_LOOP_SLEEP_US(h, 100);
+	(*s)++;
+	EVENT_LOOP_WAIT_UNTIL(h, event->type == EVENT_LOOP_USER);
+	(*s)++;
+	EVENT_LOOP_END(h);
+}
+
+static void SwitchDown(void *param){
+	HostGPIODrive(SWITCH, false);
+}
+
+static void SwitchUp(void *param){
+	HostGPIODrive(SWITCH, true);
+}
+
+static void Receive(void *param){
+	HostUartInject(UART_CONNECTOR, (const uint8_t *)"1", 1);
+}
+
+/* Target sizes: the host ones have 64 bit pointers and 64 byte cache lines */
+static uint32_t LoopRam(uint8_t handlers){
+	return EVENT_LOOP_TASK_STACK + TASK_TCB_BYTES + LOOP_BYTES + handlers * HANDLER_BYTES;
+}
+
+static void PrintMonitor(uint8_t id){
+	char line[MONITOR_LINE_SIZE];
+
+	MonitorFormat(id, line, sizeof(line));
+	printf("  %s", line);
+}
+/*==================[external functions definition]==========================*/
+int main(void){
+	monitor_stats_t accel_task, distance_task;
+	const event_loop_stats_t *accel_loop;
+	uint32_t tasks_ram, loop_ram, runs;
+	int tick;
+	timer_config_t timer_distance = {.timer = TIMER_A, .period = DISTANCE_PERIOD_US, .func_p = FuncTimer, .param_p = &tasks[0]};
+	timer_config_t timer_accel = {.timer = TIMER_B, .period = ACCEL_PERIOD_US, .func_p = FuncTimer, .param_p = &tasks[1]};
+	event_loop_handler_t distance = {.name = "distance", .func = Distance, .param = &echo, .period_us = DISTANCE_PERIOD_US};
+	event_loop_handler_t accel = {.name = "accel", .func = Accel, .period_us = ACCEL_PERIOD_US};
+	event_loop_handler_t control = {.name = "control", .func = Control, .period_us = CONTROL_PERIOD_US};
+	event_loop_handler_t interface = {.name = "interface", .func = Interface, .param = &ui, .period_us = UI_PERIOD_US};
+	event_loop_handler_t coroutine = {.name = "coroutine", .func = Steps, .param = &steps, .period_us = 1000};
+	gpio_event_config_t key = {.pin = SWITCH, .active_low = true};
+	gpio_event_config_t echo_edges = {.pin = ECHO, .debounce_ms = ECHO_DEBOUNCE_MS, .func_p = EchoEdge, .param_p = &distance};
+	serial_config_t uart = {.port = UART_CONNECTOR, .baud_rate = 9600, .func_p = EventLoopCallback, .param_p = &interface};
+
+	HcSr04Init(ECHO, TRIGGER);
+	HcSr04ModelInit(&sonar);
+	for(uint8_t i = 0; i < 3; i++){
+		HostAnalogWaveform(accel_channels[i], &accel_wave[i], 1, 1000, true);
+	}
+
+	printf("examen, one task per job (same priority, %u us tick), %u s\n", TICK_US, RUN_MS / 1000);
+	MonitorInit(TASK_DISTANCE, "distance", DISTANCE_PERIOD_US);
+	MonitorInit(TASK_ACCEL, "accel", ACCEL_PERIOD_US);
+	tick = HostSchedule((uint64_t)TICK_US * 1000, (uint64_t)TICK_US * 1000, FuncTick, NULL);
+	TimerInit(&timer_distance);
+	TimerInit(&timer_accel);
+	TimerStart(TIMER_B);
+	TimerStart(TIMER_A);
+	TasksRunMs(RUN_MS);
+	TimerStop(TIMER_A);
+	TimerStop(TIMER_B);
+	HostCancel(tick);
+	MonitorGet(TASK_DISTANCE, &distance_task);
+	MonitorGet(TASK_ACCEL, &accel_task);
+	PrintMonitor(TASK_DISTANCE);
+	PrintMonitor(TASK_ACCEL);
+	printf("  distance %u cm\n", distance_cm);
+	/* The driver counts 10 us polls at 59 us/cm */
+	Check(abs((int)distance_cm - DISTANCE_CM) <= DISTANCE_CM / 20, "task distance");
+	Check(accel_task.runs >= RUN_MS * 1000 / ACCEL_PERIOD_US - 1, "task accel runs");
+
+	printf("examen, event loop (distance from the echo edge times), %u s\n", RUN_MS / 1000);
+	EventLoopInit(&examen_loop);
+	EventLoopAdd(&examen_loop, &distance);
+	EventLoopAdd(&examen_loop, &accel);
+	Check(GPIOEventSubscribe(&echo_edges), "echo subscription");
+	runs = EventLoopRunUs(&examen_loop, RUN_MS * 1000);
+	EventLoopPrint(&examen_loop);
+	accel_loop = &accel.stats;
+	Check(runs == accel_loop->runs + distance.stats.runs, "loop runs");
+	printf("  distance %u cm, %lu echoes\n", echo.cm, (unsigned long)echo.echoes);
+	Check(abs((int)echo.cm - DISTANCE_CM) <= 1, "loop distance");
+	Check(echo.echoes >= RUN_MS * 1000 / DISTANCE_PERIOD_US - 1, "loop echoes");
+	Check(accel_loop->runs >= RUN_MS * 1000 / ACCEL_PERIOD_US - 1, "loop accel runs");
+	Check((accel_loop->overruns == 0) && (distance.stats.overruns == 0), "loop overruns");
+	Check(examen_loop.dropped == 0, "loop dropped events");
+
+	printf("examen wake up latency of accel: tasks max %lu us avg %.1f us, loop max %lu us avg %.1f us\n",
+		(unsigned long)accel_task.latency_max, (double)tasks[1].latency / tasks[1].runs,
+		(unsigned long)accel_loop->latency_max, (double)accel_loop->latency / accel_loop->runs);
+	Check(accel_loop->latency_max < accel_task.latency_max, "loop latency below tasks latency");
+	tasks_ram = EXAMEN_STACKS + 2 * TASK_TCB_BYTES;
+	loop_ram = LoopRam(2);
+	printf("examen RAM: tasks %lu bytes, loop %lu bytes (%.0f %%)\n", (unsigned long)tasks_ram,
+		(unsigned long)loop_ram, 100.0 * loop_ram / tasks_ram);
+	Check(loop_ram < tasks_ram, "examen loop RAM");
+
+	printf("Proyecto_final, event loop: switch events and UART reception, 1 s\n");
+	GPIOInit(SWITCH, GPIO_INPUT);
+	HostGPIODrive(SWITCH, true);
+	UartInit(&uart);
+	EventLoopInit(&proyecto_loop);
+	EventLoopAdd(&proyecto_loop, &control);
+	EventLoopAdd(&proyecto_loop, &interface);
+	Check(EventLoopSubscribeGPIO(&interface, &key), "GPIO subscription");
+	HostSchedule(200000000ULL, 0, SwitchDown, NULL);
+	HostSchedule(400000000ULL, 0, SwitchUp, NULL);
+	HostSchedule(600000000ULL, 0, Receive, NULL);
+	EventLoopRunUs(&proyecto_loop, 1000000);
+	EventLoopPrint(&proyecto_loop);
+	Check((control.stats.runs == 20) && (ui.timers == 20), "periodic runs");
+	Check((ui.presses == 1) && (ui.releases == 1), "switch events");
+	Check(ui.received == 1, "UART reception");
+	/* Same period: the interface waits for control to end */
+	Check((interface.stats.latency_max <= ACCEL_WORK_US) && (proyecto_loop.dropped == 0), "event latency and drops");
+	tasks_ram = PROYECTO_STACKS + 2 * TASK_TCB_BYTES;
+	loop_ram = LoopRam(2);
+	printf("Proyecto_final RAM: tasks %lu bytes, loop %lu bytes (%.0f %%)\n", (unsigned long)tasks_ram,
+		(unsigned long)loop_ram, 100.0 * loop_ram / tasks_ram);
+	Check(loop_ram < tasks_ram, "Proyecto_final loop RAM");
+	printf("  (target sizes of the loop state, host: %u + %u bytes per handler)\n",
+		(unsigned)sizeof(event_loop_t), (unsigned)sizeof(event_loop_handler_t));
+
+	printf("Coroutine: sleep and wait for an event\n");
+	EventLoopInit(&coroutine_loop);
+	EventLoopAdd(&coroutine_loop, &coroutine);
+	EventLoopRunUs(&coroutine_loop, 1500);
+	Check(steps == 2, "coroutine resumed after the sleep");
+	EventLoopRunUs(&coroutine_loop, 1000);
+	Check(steps == 2, "coroutine waits for its event");
+	EventLoopPost(&coroutine, EVENT_LOOP_USER, 0);
+	EventLoopRunUs(&coroutine_loop, 10);
+	Check((steps == 3) && (coroutine.pt == 0), "coroutine ended");
+
+	printf("%s (%d errors)\n", errors ? "FAILED" : "OK", errors);
+	return errors != 0;
+}
+
+/*==================[end of file]============================================*/
@@ -0,0 +1,256 @@
+/**
+ * @file bench_flash_log.c
+ * @brief Host check: flash log (flash_log_mcu.h) fed by a 1 kHz, 6 channel
+ * IMU timer ISR on file backed partitions
+ * @version 0.1
+ * @date 2026-10-19
+ *
+ * @copyright Copyright (c) 2026
+ *
+ */
+
+/*==================[inclusions]=============================================*/
+#include <stdio.h>
+#include <string.h>
+#include <fcntl.h>
+#include <unistd.h>
+#include "host_mcu.h"
+#include "timer_mcu.h"
+#include "uart_mcu.h"
+#include "flash_log_mcu.h"
+/*==================[macros and definitions]=================================*/
+#define IMU_PERIOD_US	1000
+#define IMU_CHANNELS	6
+#define IMU_SECONDS		10
+#define IMU_RECORDS		(IMU_SECONDS * 1000000 / IMU_PERIOD_US)
+#define TYPE_IMU		1
+#define LOG_SIZE		(512 * 1024)
+#define SMALL_SIZE		(4 * FLASH_LOG_SECTOR_SIZE)
+#define EXPORT_FILE		"flash_log_export.bin"
+#define EXPORT_UART_FILE	"flash_log_export_uart.bin"
+#define EXPORT_BAUD		921600
+/*==================[internal data definition]===============================*/
+static flash_log_t log_imu;
+static flash_log_t log_small;
+static uint32_t samples = 0;
+static int errors = 0;
+/*==================[internal functions definition]==========================*/
+static void Check(bool ok, const char *what){
+	if(!ok){
+		printf("  FAIL: %s\n", what);
+		errors++;
+	}
+}
+
+/* Deterministic IMU sample n: accelerometer and gyroscope, 3 axes each */
+static void ImuSample(uint32_t n, int16_t sample[IMU_CHANNELS]){
+	for(uint8_t c = 0; c < IMU_CHANNELS; c++){
+		sample[c] = (int16_t)(n * (c + 1) * 37 + c * 1000);
+	}
+}
+
+/* Timer ISR: read the IMU and log the sample */
+static void FuncTimerImu(void *param){
+	int16_t sample[IMU_CHANNELS];
+
+	ImuSample(samples++, sample);
+	FlashLogWrite(param, TYPE_IMU, sample, sizeof(sample));
+}
+
+/* Writer task: moves the records to flash every ms */
+static void RunWriter(flash_log_t *log, uint32_t ms){
+	for(uint32_t i = 0; i < ms; i++){
+		HostRunUs(1000);
+		FlashLogRun(log);
+	}
+}
+
+/* Read the log back: contiguous sequence numbers from first, IMU samples and
+ * time stamps (period, 0: not checked). Returns the number of records. */
+static uint32_t ReadBack(const flash_log_t *log, uint32_t first, uint32_t period, bool *ok){
+	flash_log_cursor_t cursor;
+	const flash_log_record_t *record;
+	int16_t sample[IMU_CHANNELS];
+	uint32_t count = 0, time = 0;
+
+	*ok = true;
+	FlashLogFirst(log, &cursor);
+	while((record = FlashLogNext(log, &cursor)) != NULL){
+		ImuSample(record->seq, sample);
+		*ok &= (record->seq == first + count) && (record->type == TYPE_IMU) && (record->len == sizeof(sample));
+		*ok &= (memcmp(FLASH_LOG_PAYLOAD(record), sample, sizeof(sample)) == 0);
+		*ok &= (count == 0) || (period == 0) || (record->time - time == period);
+		time = record->time;
+		count++;
+	}
+	return count;
+}
+
+static void SendFile(const uint8_t *data, uint32_t len, void *param){
+	fwrite(data, 1, len, param);
+}
+
+static void BenchImu(void){
+	timer_config_t timer = {.timer = TIMER_A, .period = IMU_PERIOD_US, .func_p = FuncTimerImu, .param_p = &log_imu};
+	uint64_t start;
+	uint32_t count;
+	bool ok;
+
+	printf("IMU 6 x int16 at 1 kHz, %d s\n", IMU_SECONDS);
+	Check(FlashLogInit(&log_imu, "datalog", false), "FlashLogInit");
+	TimerInit(&timer);
+	start = HostTimeUs();
+	TimerStart(TIMER_A);
+	while(samples < IMU_RECORDS){
+		RunWriter(&log_imu, 1);
+	}
+	TimerStop(TIMER_A);
+	FlashLogRun(&log_imu);
+	FlashLogFlush(&log_imu);
+	FlashLogPrint(&log_imu);
+	printf("  %lu bytes of flash in %.1f s\n", (unsigned long)(log_imu.head * FLASH_LOG_SECTOR_SIZE + log_imu.offset),
+		(HostTimeUs() - start) / 1e6);
+	Check((log_imu.records == IMU_RECORDS) && (log_imu.dropped == 0), "all the samples logged");
+	Check(log_imu.ring_max < FLASH_LOG_RING_SIZE / 2, "ring holds the samples taken during the erases");
+	count = ReadBack(&log_imu, 0, IMU_PERIOD_US, &ok);
+	Check((count == IMU_RECORDS) && ok, "readback: sequence, samples and time stamps");
+}
+
+static void BenchRecovery(void){
+	int16_t sample[IMU_CHANNELS];
+	uint32_t offset, count, start;
+	bool ok;
+
+	printf("Recovery after a reset\n");
+	offset = log_imu.offset;
+	Check(FlashLogInit(&log_imu, "datalog", false), "FlashLogInit");
+	Check((log_imu.seq == IMU_RECORDS) && (log_imu.offset == offset), "log continued after the last record");
+	ImuSample(IMU_RECORDS, sample);
+	FlashLogWrite(&log_imu, TYPE_IMU, sample, sizeof(sample));
+	FlashLogRun(&log_imu);
+	FlashLogFlush(&log_imu);
+	/* Reset while the next record was written: its CRC is not programmed */
+	ImuSample(IMU_RECORDS + 1, sample);
+	FlashLogWrite(&log_imu, TYPE_IMU, sample, sizeof(sample));
+	FlashLogRun(&log_imu);
+	start = log_imu.head * FLASH_LOG_SECTOR_SIZE + log_imu.offset - log_imu.pending;
+	HostFlashProgram(HostFlashFind("datalog", NULL), start, log_imu.buffer, log_imu.pending - sizeof(uint32_t));
+	Check(FlashLogInit(&log_imu, "datalog", false), "FlashLogInit");
+	Check((log_imu.bad == 1) && (log_imu.seq == IMU_RECORDS + 1), "torn record found");
+	count = ReadBack(&log_imu, 0, 0, &ok);
+	Check((count == IMU_RECORDS + 1) && ok, "torn record skipped");
+}
+
+static void BenchWrap(void){
+	int16_t sample[IMU_CHANNELS];
+	uint32_t count, first, min = UINT32_MAX, max = 0;
+	const flash_log_sector_t *header;
+	flash_log_cursor_t cursor;
+	uint8_t *flash;
+	bool ok;
+
+	printf("Small partition (4 sectors): drop when full\n");
+	flash = HostFlashFind("small", NULL);
+	Check(FlashLogInit(&log_small, "small", false), "FlashLogInit");
+	for(uint32_t n = 0; n < 1000; n++){
+		ImuSample(n, sample);
+		FlashLogWrite(&log_small, TYPE_IMU, sample, sizeof(sample));
+		FlashLogRun(&log_small);
+	}
+	FlashLogFlush(&log_small);
+	Check(log_small.full && (log_small.records + log_small.dropped == 1000), "full: new records dropped");
+	Check(log_small.records == 4 * ((FLASH_LOG_SECTOR_SIZE - sizeof(flash_log_sector_t)) / 28), "every sector filled");
+
+	printf("Small partition (4 sectors): wrap\n");
+	Check(FlashLogErase(&log_small), "FlashLogErase");
+	Check(FlashLogInit(&log_small, "small", true), "FlashLogInit");
+	for(uint32_t n = 0; n < 4000; n++){
+		ImuSample(n, sample);
+		FlashLogWrite(&log_small, TYPE_IMU, sample, sizeof(sample));
+		FlashLogRun(&log_small);
+	}
+	FlashLogFlush(&log_small);
+	FlashLogPrint(&log_small);
+	FlashLogFirst(&log_small, &cursor);
+	first = FlashLogNext(&log_small, &cursor)->seq;
+	count = ReadBack(&log_small, first, 0, &ok);
+	Check(ok && (first + count == 4000), "newest records kept, oldest overwritten");
+	for(uint8_t i = 0; i < 4; i++){
+		header = (const flash_log_sector_t *)(flash + i * FLASH_LOG_SECTOR_SIZE);
+		min = (header->erase_count < min) ? header->erase_count : min;
+		max = (header->erase_count > max) ? header->erase_count : max;
+	}
+	printf("  erase count per sector: %lu to %lu\n", (unsigned long)min, (unsigned long)max);
+	Check(max - min <= 1, "even wear");
+}
+
+/* Same bytes in both files */
+static bool SameFile(FILE *a, FILE *b){
+	uint8_t buf_a[1024], buf_b[1024];
+	size_t len_a, len_b;
+
+	do{
+		len_a = fread(buf_a, 1, sizeof(buf_a), a);
+		len_b = fread(buf_b, 1, sizeof(buf_b), b);
+		if((len_a != len_b) || memcmp(buf_a, buf_b, len_a)){
+			return false;
+		}
+	} while(len_a);
+	return true;
+}
+
+static void BenchExport(void){
+	serial_config_t uart = {.port = UART_CONNECTOR, .baud_rate = EXPORT_BAUD, .func_p = UART_NO_INT, .param_p = NULL};
+	FILE *f = fopen(EXPORT_FILE, "wb");
+	FILE *f_uart;
+	uint32_t bytes, bytes_uart;
+	uint64_t start;
+	int fd;
+
+	printf("Export to %s\n", EXPORT_FILE);
+	if(f == NULL){
+		Check(false, "export file");
+		return;
+	}
+	bytes = FlashLogExport(&log_imu, SendFile, f);
+	fclose(f);
+	printf("  %lu bytes\n", (unsigned long)bytes);
+	Check(bytes > IMU_RECORDS * 28, "export stream");
+
+	/* Over UART: far bigger than the TX FIFO, no byte may be dropped */
+	printf("Export over UART (%d bit/s)\n", EXPORT_BAUD);
+	fd = open(EXPORT_UART_FILE, O_CREAT | O_TRUNC | O_WRONLY, 0644);
+	UartInit(&uart);
+	HostUartOpen(UART_CONNECTOR, HOST_NO_FD, fd);
+	start = HostTimeNs();
+	bytes_uart = FlashLogExportUart(&log_imu, UART_CONNECTOR);
+	HostUartOpen(UART_CONNECTOR, HOST_NO_FD, HOST_NO_FD);
+	close(fd);
+	printf("  %lu bytes in %.2f s\n", (unsigned long)bytes_uart, (HostTimeNs() - start) / 1e9);
+	f = fopen(EXPORT_FILE, "rb");
+	f_uart = fopen(EXPORT_UART_FILE, "rb");
+	Check((bytes_uart == bytes) && (f != NULL) && (f_uart != NULL) && SameFile(f, f_uart), "UART export stream");
+	if(f != NULL){
+		fclose(f);
+	}
+	if(f_uart != NULL){
+		fclose(f_uart);
+	}
+}
+/*==================[external functions definition]==========================*/
+int main(void){
+	/* Fresh partitions */
+	unlink("flash_log.bin");
+	unlink("flash_log_small.bin");
+	HostFlashPartition("datalog", "flash_log.bin", LOG_SIZE);
+	HostFlashPartition("small", "flash_log_small.bin", SMALL_SIZE);
+
+	BenchImu();
+	BenchRecovery();
+	BenchWrap();
+	BenchExport();
+	printf("%s (%d errors)\n", errors ? "FAILED" : "OK", errors);
+	return errors != 0;
+}
+
+/*==================[end of file]============================================*/
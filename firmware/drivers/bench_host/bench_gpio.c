@@ -0,0 +1,198 @@
+/**
+ * @file bench_gpio.c
+ * @brief Host check: GPIO ports (gpio_port_mcu.h) and the LED driver on top
+ * of them, against a recorder of the pin changes, and GPIO bundle writes
+ * (gpio_fast_out_mcu.h) against one gpio_mcu call per pin
+ * @version 0.1
+ * @date 2026-10-19
+ *
+ * @copyright Copyright (c) 2026
+ *
+ */
+
+/*==================[inclusions]=============================================*/
+#include <stdio.h>
+#include "host_mcu.h"
+#include "gpio_mcu.h"
+#include "gpio_port_mcu.h"
+#include "led.h"
+/*==================[macros and definitions]=================================*/
+#define RECORD_SIZE		64
+#define PORT_QTY		4
+#define BUS_QTY			8		/*!< Pins of the bus written as a bundle */
+#define BUS_WRITES		256		/*!< Values written to the bus */
+/*==================[internal data declaration]==============================*/
+/**
+ * @brief Change of an output seen by the recorder
+ */
+typedef struct {
+	uint64_t time;			/*!< Virtual time (ns) */
+	gpio_t pin;				/*!< GPIO */
+	bool level;				/*!< New level */
+} record_t;
+/*==================[internal data definition]===============================*/
+static record_t record[RECORD_SIZE];
+static uint8_t record_qty;
+static const gpio_t port_pins[PORT_QTY] = {GPIO_0, GPIO_1, GPIO_2, GPIO_3};
+static const gpio_t other_pins[GPIO_PORT_MAX_PINS] = {GPIO_18, GPIO_19, GPIO_20, GPIO_21, GPIO_22, GPIO_23, GPIO_6, GPIO_7};
+static const gpio_t bus_pins[BUS_QTY] = {GPIO_0, GPIO_1, GPIO_2, GPIO_3, GPIO_18, GPIO_19, GPIO_20, GPIO_21};
+static int errors = 0;
+/*==================[internal functions definition]==========================*/
+static void Check(bool ok, const char *what){
+	if(!ok){
+		printf("  FAIL: %s\n", what);
+		errors++;
+	}
+}
+
+static void FuncRecord(gpio_t pin, bool level, void *param){
+	if(record_qty < RECORD_SIZE){
+		record[record_qty++] = (record_t){.time = HostTimeNs(), .pin = pin, .level = level};
+	}
+}
+
+static void Record(const gpio_t *pins, uint8_t pin_qty){
+	for(uint8_t i = 0; i < pin_qty; i++){
+		HostGPIOWatch(pins[i], FuncRecord, NULL);
+	}
+	record_qty = 0;
+}
+
+/* Port value read back from the pins */
+static uint8_t PinsValue(const gpio_t *pins, uint8_t pin_qty){
+	uint8_t value = 0;
+
+	for(uint8_t i = 0; i < pin_qty; i++){
+		value |= HostGPIOLevel(pins[i]) << i;
+	}
+	return value;
+}
+
+/* Changes recorded with the same virtual time */
+static bool SameTime(uint8_t first, uint8_t qty){
+	for(uint8_t i = first + 1; i < first + qty; i++){
+		if(record[i].time != record[first].time){
+			return false;
+		}
+	}
+	return true;
+}
+
+static void BenchPort(gpio_port_t *port, const gpio_t *pins, bool bundle){
+	uint8_t first;
+
+	Check(PinsValue(pins, PORT_QTY) == 0, "pins cleared by GPIOPortInit");
+	Record(pins, PORT_QTY);
+	GPIOPortWrite(port, 0x5, 0x1);
+	Check(PinsValue(pins, PORT_QTY) == 0x1, "masked write: bit 0 set, bit 2 kept low");
+	Check(record_qty == 1, "masked write: only the changed pin is written");
+	GPIOPortSet(port, 0xA);
+	Check(PinsValue(pins, PORT_QTY) == 0xB, "set bits 1 and 3");
+	Check((record_qty == 3) && (SameTime(1, 2) == bundle), "set: one access (bundle) or one per pin");
+	GPIOPortClear(port, 0x3);
+	Check(PinsValue(pins, PORT_QTY) == 0x8, "clear bits 0 and 1");
+	first = record_qty;
+	GPIOPortToggle(port, 0xF);
+	Check(PinsValue(pins, PORT_QTY) == 0x7, "toggle all the bits");
+	Check(GPIOPortState(port) == 0x7, "state: last value written");
+	Check(record_qty - first == 4, "toggle: every pin changes once");
+	GPIOPortWrite(port, 0xF0, 0xF0);
+	Check(PinsValue(pins, PORT_QTY) == 0x7, "bits beyond the port are ignored");
+	GPIOPortWrite(port, 0xF, 0x0);
+	for(uint8_t i = 0; i < PORT_QTY; i++){
+		HostGPIOWatch(pins[i], NULL, NULL);
+	}
+}
+
+static void BenchPorts(void){
+	gpio_port_t port, other;
+
+	printf("GPIO port: dedicated bundle\n");
+	Check(GPIOPortInit(&port, port_pins, PORT_QTY), "4 pins fit in the dedicated channels");
+	BenchPort(&port, port_pins, true);
+
+	printf("GPIO port: gpio_mcu fallback (no free channels)\n");
+	Check(!GPIOPortInit(&other, other_pins, PORT_QTY + 1), "5 more pins don't fit in 8 channels");
+	BenchPort(&other, other_pins, false);
+	GPIOBundleDeinit(&port.bundle);
+	GPIOBundleDeinit(&other.bundle);
+}
+
+static void BenchLeds(void){
+	static const gpio_t leds[] = {GPIO_5, GPIO_10, GPIO_11};	/* LED_3, LED_2, LED_1 */
+
+	printf("LEDs on a port\n");
+	LedsInit();
+	Record(leds, 3);
+	LedOn(LED_1);
+	Check(HostGPIOLevel(GPIO_11) && (record_qty == 1), "LED_1 on GPIO_11");
+	LedsMask(LED_2 | LED_3);
+	Check((PinsValue(leds, 3) == 0x3) && (record_qty == 4), "mask: LED_1 off, LED_2 and LED_3 on");
+	LedToggle(LED_3);
+	Check(PinsValue(leds, 3) == 0x2, "toggle LED_3");
+	Check(!LedOn(LED_1 | LED_2), "more than one LED is rejected");
+	LedsOffAll();
+	Check(PinsValue(leds, 3) == 0, "all off");
+}
+
+/* Write every value of an 8 bit counter in Gray code (one pin changes) and
+ * in binary (up to 8 pins change): virtual time and skew between the first
+ * and the last pin change of a write */
+static void BenchBusWrite(gpio_bundle_t *bundle, const char *name, uint64_t *time, uint64_t *skew){
+	uint64_t start;
+	uint32_t value;
+	bool ok = true;
+
+	*skew = 0;
+	Record(bus_pins, BUS_QTY);
+	start = HostTimeNs();
+	for(uint16_t i = 0; i < 2 * BUS_WRITES; i++){
+		value = (i < BUS_WRITES) ? i : ((i ^ (i >> 1)) & (BUS_WRITES - 1));
+		record_qty = 0;
+		if(bundle != NULL){
+			GPIOBundleWrite(bundle, BUS_WRITES - 1, value);
+		} else{
+			for(uint8_t pin = 0; pin < BUS_QTY; pin++){
+				GPIOState(bus_pins[pin], (value >> pin) & 1);
+			}
+		}
+		ok &= (PinsValue(bus_pins, BUS_QTY) == value);
+		if((record_qty > 1) && (record[record_qty - 1].time - record[0].time > *skew)){
+			*skew = record[record_qty - 1].time - record[0].time;
+		}
+	}
+	*time = (HostTimeNs() - start) / (2 * BUS_WRITES);
+	printf("  %-18s %6llu ns/write %6llu ns max skew\n", name, (unsigned long long)*time,
+		(unsigned long long)*skew);
+	Check(ok, "bus pins follow every value written");
+	for(uint8_t pin = 0; pin < BUS_QTY; pin++){
+		HostGPIOWatch(bus_pins[pin], NULL, NULL);
+	}
+}
+
+static void BenchBundle(void){
+	gpio_bundle_t bundle;
+	uint64_t bundle_time, bundle_skew, pin_time, pin_skew;
+
+	printf("GPIO bus of %d pins: bundle write vs one GPIOState() per pin (%d ns per access)\n", BUS_QTY,
+		HOST_GPIO_ACCESS_NS);
+	Check(GPIOBundleInit(&bundle, bus_pins, BUS_QTY, GPIO_OUTPUT), "bus on dedicated channels");
+	BenchBusWrite(&bundle, "GPIOBundleWrite", &bundle_time, &bundle_skew);
+	BenchBusWrite(NULL, "GPIOState per pin", &pin_time, &pin_skew);
+	printf("  bundle: %.1fx faster\n", (double)pin_time / bundle_time);
+	Check(bundle_time <= 2 * HOST_GPIO_ACCESS_NS, "bundle: set and clear accesses only");
+	Check(pin_time == BUS_QTY * HOST_GPIO_ACCESS_NS, "per pin: one access per pin");
+	Check(bundle_skew <= HOST_GPIO_ACCESS_NS, "bundle: pins set (cleared) together");
+	Check(pin_skew == (BUS_QTY - 1) * HOST_GPIO_ACCESS_NS, "per pin: intermediate values on the bus");
+	GPIOBundleDeinit(&bundle);
+}
+/*==================[external functions definition]==========================*/
+int main(void){
+	BenchPorts();
+	BenchBundle();
+	BenchLeds();
+	printf("%s (%d errors)\n", errors ? "FAILED" : "OK", errors);
+	return errors != 0;
+}
+
+/*==================[end of file]============================================*/
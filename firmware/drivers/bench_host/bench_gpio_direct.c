@@ -0,0 +1,155 @@
+/**
+ * @file bench_gpio_direct.c
+ * @brief Host benchmark: ns per toggle of the inline register functions
+ * (gpio_direct_mcu.h) against the gpio_mcu call chain (GPIOOn/GPIOOff ->
+ * gpio_set_level), both writing a register file stand-in
+ * @version 0.1
+ * @date 2026-10-19
+ *
+ * @copyright Copyright (c) 2026
+ *
+ */
+
+/*==================[inclusions]=============================================*/
+#include <stdio.h>
+#include <time.h>
+#include <stdint.h>
+#include <stdbool.h>
+/*==================[macros and definitions]=================================*/
+/**
+ * @brief GPIO register stand-in: plain memory, so writes to the set/clear
+ * registers are not reflected in out (enough to time the accesses)
+ */
+typedef struct {
+	volatile uint32_t val;
+} bench_reg_t;
+
+/**
+ * @brief GPIO register block stand-in (registers used by gpio_direct_mcu.h)
+ */
+typedef struct {
+	bench_reg_t out;
+	bench_reg_t out_w1ts;
+	bench_reg_t out_w1tc;
+	bench_reg_t in;
+} bench_gpio_dev_t;
+
+static bench_gpio_dev_t bench_gpio;
+
+#define GPIO_DIRECT_HW		(&bench_gpio)
+#include "gpio_direct_mcu.h"
+
+#define TOGGLES			(1 << 24)
+#define RUNS			5		/*!< Best of RUNS (the host is shared) */
+#define PIN				GPIO_20
+#define GPIO_IS_VALID_OUTPUT(pin)	(((pin) < GPIO_QTY) && ((pin) != GPIO_14))
+/*==================[internal data declaration]==============================*/
+/**
+ * @brief Pin entry of the gpio_mcu table
+ */
+typedef struct {
+	uint64_t pin;
+	bool state;
+} bench_io_t;
+/*==================[internal data definition]===============================*/
+static bench_io_t gpio_list[GPIO_QTY];
+static uint32_t pin_mask;			/*!< Mask kept in RAM, as in hx711.c */
+static int errors = 0;
+/*==================[internal functions definition]==========================*/
+static void Check(bool ok, const char *what){
+	if(!ok){
+		printf("  FAIL: %s\n", what);
+		errors++;
+	}
+}
+
+static double TimeNs(void){
+	struct timespec t;
+	clock_gettime(CLOCK_MONOTONIC, &t);
+	return t.tv_sec * 1e9 + t.tv_nsec;
+}
+
+/* gpio_set_level() of the IDF: argument check, HAL, set/clear register */
+static __attribute__((noinline)) int BenchSetLevel(uint64_t pin, uint32_t level){
+	if(!GPIO_IS_VALID_OUTPUT(pin)){
+		return -1;
+	}
+	if(level){
+		bench_gpio.out_w1ts.val = 1UL << pin;
+	} else{
+		bench_gpio.out_w1tc.val = 1UL << pin;
+	}
+	return 0;
+}
+
+/* GPIOOn()/GPIOOff() of gpio_mcu.c: table lookup and gpio_set_level() */
+static __attribute__((noinline)) void BenchGPIOOn(gpio_t pin){
+	gpio_list[pin].state = true;
+	BenchSetLevel(gpio_list[pin].pin, gpio_list[pin].state);
+}
+
+static __attribute__((noinline)) void BenchGPIOOff(gpio_t pin){
+	gpio_list[pin].state = false;
+	BenchSetLevel(gpio_list[pin].pin, gpio_list[pin].state);
+}
+
+static double Toggle(int path){
+	double start, best = 0, ns;
+	gpio_t pin = PIN;
+
+	for(uint8_t run = 0; run < RUNS; run++){
+		start = TimeNs();
+		switch(path){
+		case 0:
+			for(uint32_t i = 0; i < TOGGLES; i++){
+				BenchGPIOOn(pin);
+				BenchGPIOOff(pin);
+			}
+			break;
+		case 1:
+			for(uint32_t i = 0; i < TOGGLES; i++){
+				GPIODirectOn(pin);
+				GPIODirectOff(pin);
+			}
+			break;
+		default:
+			for(uint32_t i = 0; i < TOGGLES; i++){
+				GPIODirectSetMask(pin_mask);
+				GPIODirectClearMask(pin_mask);
+			}
+			break;
+		}
+		ns = (TimeNs() - start) / (2 * TOGGLES);
+		best = ((run == 0) || (ns < best)) ? ns : best;
+	}
+	return best;
+}
+/*==================[external functions definition]==========================*/
+int main(void){
+	double mcu, direct, mask;
+
+	for(uint8_t i = 0; i < GPIO_QTY; i++){
+		gpio_list[i].pin = i;
+	}
+	pin_mask = GPIO_DIRECT_MASK(PIN);
+
+	printf("GPIO toggle on a register file stand-in (best of %d runs)\n", RUNS);
+	mcu = Toggle(0);
+	direct = Toggle(1);
+	mask = Toggle(2);
+	printf("  %-34s %6.2f ns/toggle\n", "GPIOOn/GPIOOff (gpio_set_level)", mcu);
+	printf("  %-34s %6.2f ns/toggle (%.1fx)\n", "GPIODirectOn/GPIODirectOff", direct, mcu / direct);
+	printf("  %-34s %6.2f ns/toggle (%.1fx)\n", "GPIODirectSetMask/ClearMask (RAM)", mask, mcu / mask);
+
+	GPIODirectOn(PIN);
+	Check(bench_gpio.out_w1ts.val == (1UL << PIN), "GPIODirectOn writes the set register");
+	GPIODirectOff(PIN);
+	Check(bench_gpio.out_w1tc.val == (1UL << PIN), "GPIODirectOff writes the clear register");
+	bench_gpio.in.val = (1UL << PIN) | 1;
+	Check(GPIODirectRead(PIN) && (GPIODirectReadMask(pin_mask) == pin_mask), "GPIODirectRead masks the input register");
+	Check(direct < mcu, "inline register writes are faster than the gpio_mcu calls");
+	printf("%s (%d errors)\n", errors ? "FAILED" : "OK", errors);
+	return errors != 0;
+}
+
+/*==================[end of file]============================================*/
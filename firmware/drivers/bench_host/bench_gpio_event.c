@@ -0,0 +1,172 @@
+/**
+ * @file bench_gpio_event.c
+ * @brief Host check: debounced GPIO events (gpio_event_mcu.h) for contact
+ * bounce traces driven with HostGPIODrive()
+ * @version 0.1
+ * @date 2026-10-19
+ *
+ * @copyright Copyright (c) 2026
+ *
+ */
+
+/*==================[inclusions]=============================================*/
+#include <stdio.h>
+#include "host_mcu.h"
+#include "gpio_mcu.h"
+#include "gpio_event_mcu.h"
+/*==================[macros and definitions]=================================*/
+#define SWITCH			GPIO_4
+#define DEBOUNCE_US		(GPIO_EVENT_DEBOUNCE_MS * 1000)
+#define LONG_PRESS_US	(GPIO_EVENT_LONG_PRESS_MS * 1000)
+#define EVENTS_SIZE		32
+#define PRESSED			false	/*!< Switch to ground with pull-up */
+#define RELEASED		true
+/*==================[internal data declaration]==============================*/
+/**
+ * @brief Level change of a trace
+ */
+typedef struct {
+	uint32_t time;			/*!< From the start of the trace (us) */
+	bool level;				/*!< Pin level */
+} edge_t;
+
+/**
+ * @brief Event seen by the subscriber
+ */
+typedef struct {
+	gpio_event_type_t type;	/*!< Event type */
+	uint32_t time;			/*!< Event time, from the start of the trace (us) */
+	uint32_t delivered;		/*!< Delivery time, from the start of the trace (us) */
+} seen_t;
+/*==================[internal data definition]===============================*/
+static seen_t seen[EVENTS_SIZE];
+static uint8_t seen_qty;
+static uint32_t trace_start;
+static int errors = 0;
+
+/* Press with 6 bounces in 1.5 ms, release 200 ms later with 4 bounces */
+static const edge_t bouncy_click[] = {
+	{0, PRESSED}, {200, RELEASED}, {450, PRESSED}, {700, RELEASED}, {1000, PRESSED}, {1200, RELEASED},
+	{1500, PRESSED},
+	{200000, RELEASED}, {200300, PRESSED}, {200500, RELEASED}, {201000, PRESSED}, {201400, RELEASED},
+};
+
+/* 150 us spike (ESD, crosstalk): shorter than the debounce window */
+static const edge_t glitch[] = {
+	{0, PRESSED}, {150, RELEASED},
+};
+
+/* Worn contact: bounces for 30 ms, longer than the debounce window */
+static const edge_t chatter[] = {
+	{0, PRESSED}, {3000, RELEASED}, {6000, PRESSED}, {11000, RELEASED}, {17000, PRESSED}, {24000, RELEASED},
+	{30000, PRESSED},
+	{300000, RELEASED},
+};
+
+/* Two bouncy clicks 150 ms apart */
+static const edge_t double_click[] = {
+	{0, PRESSED}, {300, RELEASED}, {600, PRESSED},
+	{80000, RELEASED}, {80400, PRESSED}, {80700, RELEASED},
+	{230000, PRESSED}, {230200, RELEASED}, {230500, PRESSED},
+	{310000, RELEASED},
+};
+
+/* Held for 1.5 s */
+static const edge_t long_press[] = {
+	{0, PRESSED}, {500, RELEASED}, {900, PRESSED},
+	{1500000, RELEASED},
+};
+/*==================[internal functions definition]==========================*/
+static void Check(bool ok, const char *what){
+	if(!ok){
+		printf("  FAIL: %s\n", what);
+		errors++;
+	}
+}
+
+static void FuncEvent(gpio_event_t *event, void *param){
+	if(seen_qty < EVENTS_SIZE){
+		seen[seen_qty++] = (seen_t){
+			.type = event->type,
+			.time = event->time - trace_start,
+			.delivered = (uint32_t)HostTimeUs() - trace_start,
+		};
+	}
+}
+
+/* Drive the trace and let the last window and long press expire */
+static void Drive(const char *name, const edge_t *trace, uint8_t edge_qty){
+	static const char *names[] = {"press", "release", "long press", "double click"};
+
+	seen_qty = 0;
+	trace_start = (uint32_t)HostTimeUs();
+	for(uint8_t i = 0; i < edge_qty; i++){
+		HostRunUs(trace_start + trace[i].time - (uint32_t)HostTimeUs());
+		HostGPIODrive(SWITCH, trace[i].level);
+	}
+	HostRunUs(LONG_PRESS_US + DEBOUNCE_US);
+	printf("%s (%d edges):", name, edge_qty);
+	for(uint8_t i = 0; i < seen_qty; i++){
+		printf(" %s@%lu", names[seen[i].type], (unsigned long)seen[i].time);
+	}
+	printf("\n");
+}
+
+static bool Seen(uint8_t i, gpio_event_type_t type, uint32_t time){
+	return (i < seen_qty) && (seen[i].type == type) && (seen[i].time == time);
+}
+
+/* Press/release events are delivered one window after the first edge */
+static bool Delivered(void){
+	for(uint8_t i = 0; i < seen_qty; i++){
+		if(((seen[i].type == GPIO_EVENT_PRESS) || (seen[i].type == GPIO_EVENT_RELEASE)) &&
+			(seen[i].delivered - seen[i].time != DEBOUNCE_US)){
+			return false;
+		}
+	}
+	return true;
+}
+/*==================[external functions definition]==========================*/
+int main(void){
+	gpio_event_config_t config = {
+		.pin = SWITCH,
+		.active_low = true,
+		.long_press_ms = GPIO_EVENT_LONG_PRESS_MS,
+		.double_click_ms = GPIO_EVENT_DOUBLE_CLICK_MS,
+		.func_p = FuncEvent,
+	};
+
+	GPIOInit(SWITCH, GPIO_INPUT);
+	Check(GPIOEventSubscribe(&config), "subscription");
+
+	Drive("bouncy click", bouncy_click, sizeof(bouncy_click) / sizeof(edge_t));
+	Check((seen_qty == 2) && Seen(0, GPIO_EVENT_PRESS, 0) && Seen(1, GPIO_EVENT_RELEASE, 200000),
+		"bouncy click: one press and one release, at their first edges");
+	Check(Delivered(), "bouncy click: delivered one debounce window after the first edge");
+
+	Drive("glitch", glitch, sizeof(glitch) / sizeof(edge_t));
+	Check(seen_qty == 0, "glitch: no events");
+
+	Drive("chatter", chatter, sizeof(chatter) / sizeof(edge_t));
+	Check((seen_qty >= 2) && (seen_qty % 2 == 0) && Seen(seen_qty - 1, GPIO_EVENT_RELEASE, 300000),
+		"chatter: press/release pairs, ends released");
+	Check((seen_qty >= 2) && (seen[seen_qty - 2].type == GPIO_EVENT_PRESS) &&
+		(seen[seen_qty - 2].time <= 30000), "chatter: pressed once the contact settles");
+
+	Drive("double click", double_click, sizeof(double_click) / sizeof(edge_t));
+	Check((seen_qty == 5) && Seen(0, GPIO_EVENT_PRESS, 0) && Seen(1, GPIO_EVENT_RELEASE, 80000) &&
+		Seen(2, GPIO_EVENT_PRESS, 230000) && Seen(3, GPIO_EVENT_DOUBLE_CLICK, 230000) &&
+		Seen(4, GPIO_EVENT_RELEASE, 310000), "double click: second press 150 ms after the release");
+
+	Drive("long press", long_press, sizeof(long_press) / sizeof(edge_t));
+	Check((seen_qty == 3) && Seen(0, GPIO_EVENT_PRESS, 0) && Seen(1, GPIO_EVENT_LONG_PRESS, LONG_PRESS_US) &&
+		Seen(2, GPIO_EVENT_RELEASE, 1500000), "long press: reported long_press_ms after the first edge");
+	Check(seen[1].delivered == LONG_PRESS_US, "long press: delivered on time");
+
+	Check(GPIOEventDropped() == 0, "no edges dropped");
+	Check(GPIORead(SWITCH) == RELEASED, "switch released at the end");
+	printf("%s (%d errors)\n", errors ? "FAILED" : "OK", errors);
+	return errors != 0;
+}
+
+/*==================[end of file]============================================*/
@@ -0,0 +1,148 @@
+/**
+ * @file bench_memory.c
+ * @brief Host check: arenas and pools (arena_mcu.h), and the memory used by
+ * the FFT and the ILI9341 driver taken from them
+ * @version 0.1
+ * @date 2026-10-19
+ *
+ * @copyright Copyright (c) 2026
+ *
+ */
+
+/*==================[inclusions]=============================================*/
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <math.h>
+#include "host_mcu.h"
+#include "device_models.h"
+#include "arena_mcu.h"
+#include "ili9341.h"
+#include "fft.h"
+/*==================[macros and definitions]=================================*/
+#define LCD_DC			GPIO_9
+#define LCD_RST			GPIO_18
+#define LCD_SPI			SPI_1
+#define FFT_LENGHT		1024
+/*==================[internal data definition]===============================*/
+static uint64_t arena_memory[32];		/* 256 bytes, ARENA_ALIGN aligned */
+static uint64_t pool_memory[12];		/* 4 blocks of 24 bytes */
+static arena_t arena;
+static pool_t pool;
+static ili9341_model_t lcd;
+static fft_plan_t plan;
+static float signal[FFT_LENGHT];
+static float fft_ref[FFT_LENGHT / 2];
+static float fft_plan[FFT_LENGHT / 2];
+static int errors = 0;
+/*==================[internal functions definition]==========================*/
+static void Check(bool ok, const char *what){
+	if(!ok){
+		printf("  FAIL: %s\n", what);
+		errors++;
+	}
+}
+
+static void BenchArena(void){
+	uint8_t *a, *b, *c;
+	uint32_t mark;
+
+	printf("Arena\n");
+	ArenaInit(&arena, "test", arena_memory, sizeof(arena_memory), false);
+	a = ArenaAlloc(&arena, 3);
+	b = ArenaAlloc(&arena, 5);
+	Check((a == (uint8_t *)arena_memory) && (b == a + ARENA_ALIGN), "allocations rounded to ARENA_ALIGN");
+	mark = ArenaMark(&arena);
+	c = ArenaAlloc(&arena, 200);
+	Check(c == a + 2 * ARENA_ALIGN, "allocation after the mark");
+	Check(ArenaAlloc(&arena, 100) == NULL, "arena full");
+	Check(arena.fails == 1, "failed allocations counted");
+	ArenaReset(&arena, mark);
+	Check(arena.used == 2 * ARENA_ALIGN, "reset to the mark");
+	Check(ArenaAlloc(&arena, 100) == c, "memory reused after the reset");
+	Check(arena.peak == 2 * ARENA_ALIGN + 200, "high-water mark");
+	ArenaReset(&arena, 0);
+	Check(arena.used == 0, "reset to 0");
+}
+
+static void BenchPool(void){
+	void *blocks[4], *block;
+	bool distinct = true;
+
+	printf("Pool\n");
+	PoolInit(&pool, "test", pool_memory, 20, 4, false);
+	Check(pool.block_size == 24, "block size rounded to ARENA_ALIGN");
+	for(uint8_t i = 0; i < 4; i++){
+		blocks[i] = PoolAlloc(&pool);
+		for(uint8_t j = 0; j < i; j++){
+			distinct &= (blocks[i] != blocks[j]);
+		}
+		distinct &= (blocks[i] != NULL);
+	}
+	Check(distinct, "4 distinct blocks");
+	Check(PoolAlloc(&pool) == NULL, "pool exhausted");
+	Check(pool.fails == 1, "failed allocations counted");
+	PoolFree(&pool, blocks[2]);
+	block = PoolAlloc(&pool);
+	Check(block == blocks[2], "freed block reused");
+	for(uint8_t i = 0; i < 4; i++){
+		PoolFree(&pool, blocks[i]);
+	}
+	Check((pool.used == 0) && (pool.peak == 4), "usage and high-water mark");
+}
+
+static void BenchFft(void){
+	uint32_t used;
+	float max_err = 0, max_ref = 0;
+
+	printf("FFT (%d points)\n", FFT_LENGHT);
+	Check((arena_dsp.base == NULL) && (arena_scratch.base == NULL), "arenas taken on the first use");
+	for(uint16_t i = 0; i < FFT_LENGHT; i++){
+		signal[i] = 1000 * sinf(2 * M_PI * 37.3f * i / FFT_LENGHT) + 50;
+	}
+	FFTInit();
+	FFTMagnitude(signal, fft_ref, FFT_LENGHT);
+	Check(arena_scratch.used == 0, "FFTMagnitude releases its work buffers");
+	Check(arena_scratch.peak == 3 * FFT_LENGHT * sizeof(float), "FFTMagnitude work buffers");
+	Check(FFTPlanInit(&plan, FFT_LENGHT), "FFTPlanInit");
+	used = arena_dsp.used;
+	Check(used == FFT_LENGHT * sizeof(float) + FFT_LENGHT / 2 * sizeof(uint16_t), "plan tables");
+	FFTPlanMagnitude(&plan, signal, fft_plan);
+	for(uint16_t j = 0; j < FFT_LENGHT / 2; j++){
+		max_err = fmaxf(max_err, fabsf(fft_ref[j] - fft_plan[j]));
+		max_ref = fmaxf(max_ref, fabsf(fft_ref[j]));
+	}
+	Check(max_err < 1e-4f * max_ref, "FFTPlanMagnitude matches FFTMagnitude");
+	Check(FFTPlanInit(&plan, FFT_LENGHT / 2) && (arena_dsp.used == used), "shorter plan reuses its tables");
+	Check(FFTPlanInit(&plan, FFT_LENGHT) && (arena_dsp.used == used), "plan reinitialized");
+	/* Work buffers that don't fit: all zeros, counted as a failure */
+	ArenaAlloc(&arena_scratch, CONFIG_MCU_ARENA_SCRATCH_SIZE - FFT_LENGHT * sizeof(float));
+	FFTPlanMagnitude(&plan, signal, fft_plan);
+	Check((fft_plan[37] == 0) && (arena_scratch.fails == 1), "scratch arena full");
+	ArenaReset(&arena_scratch, 0);
+}
+
+static void BenchIli9341(void){
+	printf("ILI9341 (pixel buffers from pool_dma)\n");
+	Check(pool_dma.base == NULL, "pool taken on the first use");
+	Ili9341ModelInit(&lcd, LCD_SPI);
+	lcd.dc = LCD_DC;
+	ILI9341Init(LCD_SPI, LCD_DC, LCD_RST);
+	ILI9341DrawFilledRectangle(10, 20, 49, 59, ILI9341_RED);
+	ILI9341DrawString(60, 20, "Arena", &font_30, ILI9341_BLACK, ILI9341_WHITE);
+	Check(Ili9341ModelPixel(&lcd, 10, 20) == ILI9341_RED, "ILI9341 rectangle corner");
+	Check(pool_dma.block_size >= 256, "pool_dma block holds a pixel buffer");
+	Check((pool_dma.used == 0) && (pool_dma.peak == 1), "one block per call, released");
+}
+/*==================[external functions definition]==========================*/
+int main(void){
+	BenchArena();
+	BenchPool();
+	BenchFft();
+	BenchIli9341();
+	MemoryPrint();
+	printf("%s (%d errors)\n", errors ? "FAILED" : "OK", errors);
+	return errors != 0;
+}
+
+/*==================[end of file]============================================*/
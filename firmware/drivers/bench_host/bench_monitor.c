@@ -0,0 +1,181 @@
+/**
+ * @file bench_monitor.c
+ * @brief Host check: runtime monitor (monitor_mcu.h) on tasks run by a
+ * simulated preemptive scheduler on the virtual clock
+ * @version 0.1
+ * @date 2026-10-19
+ *
+ * @copyright Copyright (c) 2026
+ *
+ */
+
+/*==================[inclusions]=============================================*/
+#include <stdio.h>
+#include <string.h>
+#include <math.h>
+#include "host_mcu.h"
+#include "timer_mcu.h"
+#include "uart_mcu.h"
+#include "monitor_mcu.h"
+#include "stats_mcu.h"
+/*==================[macros and definitions]=================================*/
+#define TASK_ADC		0
+#define TASK_UI			1
+#define ADC_PERIOD_US	4000
+#define UI_PERIOD_US	20000
+#define STACK_SIZE		2048
+#define SLICE_US		50		/*!< Scheduling granularity (preemption points) */
+
+/**
+ * @brief Simulated task: woken up by a timer, runs work_us of virtual time
+ * and uses stack_used bytes of its stack
+ */
+typedef struct {
+	uint8_t id;					/*!< Monitor id */
+	uint8_t priority;			/*!< Priority (higher preempts lower) */
+	uint32_t work_us;			/*!< Run time of an activation */
+	uint32_t extra_us;			/*!< Extra run time of the next activation */
+	uint32_t stack_used;		/*!< Stack used by an activation (bytes) */
+	volatile uint32_t notified;	/*!< Task notification value */
+	uint8_t stack[STACK_SIZE];	/*!< Stack (grows downwards) */
+} sim_task_t;
+/*==================[internal data definition]===============================*/
+static sim_task_t tasks[] = {
+	{.id = TASK_ADC, .priority = 5, .work_us = 300, .stack_used = 600},
+	{.id = TASK_UI, .priority = 3, .work_us = 2000, .stack_used = 900},
+};
+#define TASK_QTY	(sizeof(tasks) / sizeof(tasks[0]))
+static int errors = 0;
+/*==================[internal functions definition]==========================*/
+static void Check(bool ok, const char *what){
+	if(!ok){
+		printf("  FAIL: %s\n", what);
+		errors++;
+	}
+}
+
+/* Timer ISR: vTaskNotifyGiveFromISR() */
+static void FuncTimer(void *param){
+	sim_task_t *t = param;
+
+	MonitorNotify(t->id);
+	t->notified++;
+}
+
+static void Schedule(uint8_t above);
+
+/* One activation: ulTaskNotifyTake(pdTRUE, ...) and the work, preemptible
+ * every SLICE_US */
+static void Activation(sim_task_t *t){
+	uint32_t work = t->work_us + t->extra_us, slice;
+
+	t->notified = 0;
+	t->extra_us = 0;
+	MonitorBegin(t->id);
+	memset(t->stack + STACK_SIZE - t->stack_used, 0, t->stack_used);
+	for(uint32_t done = 0; done < work; done += slice){
+		slice = (work - done < SLICE_US) ? work - done : SLICE_US;
+		HostRunUs(slice);
+		Schedule(t->priority);
+	}
+	MonitorEnd(t->id);
+}
+
+/* Run the notified tasks with priority above the given one, highest first */
+static void Schedule(uint8_t above){
+	sim_task_t *next;
+
+	do{
+		next = NULL;
+		for(uint8_t i = 0; i < TASK_QTY; i++){
+			if(tasks[i].notified && (tasks[i].priority > above) &&
+				((next == NULL) || (tasks[i].priority > next->priority))){
+				next = &tasks[i];
+			}
+		}
+		if(next != NULL){
+			Activation(next);
+		}
+	} while(next != NULL);
+}
+
+/* Scheduler and idle task for a while */
+static void RunMs(uint32_t ms){
+	uint64_t end = HostTimeUs() + ms * 1000ULL;
+
+	while(HostTimeUs() < end){
+		Schedule(0);
+		HostRunUs(SLICE_US);
+	}
+}
+
+static void Print(uint8_t id){
+	char line[MONITOR_LINE_SIZE];
+
+	MonitorFormat(id, line, sizeof(line));
+	printf("  %s", line);
+}
+/*==================[external functions definition]==========================*/
+int main(void){
+	monitor_stats_t adc, ui;
+	stats_t uart_stats;
+	timer_config_t timer_adc = {.timer = TIMER_A, .period = ADC_PERIOD_US, .func_p = FuncTimer, .param_p = &tasks[0]};
+	timer_config_t timer_ui = {.timer = TIMER_B, .period = UI_PERIOD_US, .func_p = FuncTimer, .param_p = &tasks[1]};
+	serial_config_t uart = {.port = UART_PC, .baud_rate = 115200, .func_p = NULL, .param_p = NULL};
+
+	for(uint8_t i = 0; i < TASK_QTY; i++){
+		memset(tasks[i].stack, MONITOR_STACK_FILL, STACK_SIZE);
+	}
+	MonitorInit(TASK_ADC, "adc", ADC_PERIOD_US);
+	MonitorInit(TASK_UI, "ui", UI_PERIOD_US);
+	MonitorStack(TASK_ADC, tasks[0].stack, STACK_SIZE);
+	MonitorStack(TASK_UI, tasks[1].stack, STACK_SIZE);
+	TimerInit(&timer_adc);
+	TimerInit(&timer_ui);
+	TimerStart(TIMER_A);
+	TimerStart(TIMER_B);
+
+	printf("Nominal load (adc 300 us / 4 ms, ui 2 ms / 20 ms), 2 s\n");
+	RunMs(2000);
+	MonitorGet(TASK_ADC, &adc);
+	MonitorGet(TASK_UI, &ui);
+	Print(TASK_ADC);
+	Print(TASK_UI);
+	Check(fabsf(adc.load - 7.5f) < 0.2f, "adc load");
+	Check(fabsf(ui.load - 10.0f) < 0.5f, "ui load (preempted by adc)");
+	Check((adc.runs >= 499) && (adc.run_max == 300) && (adc.latency_max == 0), "adc runs, run time and latency");
+	Check(ui.latency_max <= 300, "ui latency (adc runs first)");
+	Check((adc.overruns == 0) && (adc.misses == 0) && (ui.overruns == 0) && (ui.misses == 0), "no overruns nor misses");
+	Check((adc.stack_free == STACK_SIZE - 600) && (ui.stack_free == STACK_SIZE - 900), "stack high-water marks");
+
+	printf("ui overloaded: one 45 ms activation and a deeper stack, 1 s\n");
+	MonitorWindow();
+	tasks[1].extra_us = 43000;
+	tasks[1].stack_used = 1800;
+	RunMs(10);
+	tasks[1].stack_used = 900;
+	RunMs(990);
+	MonitorGet(TASK_ADC, &adc);
+	MonitorGet(TASK_UI, &ui);
+	Print(TASK_ADC);
+	Print(TASK_UI);
+	Check((ui.overruns == 2) && (ui.misses >= 1), "ui overruns (notified while busy) and deadline misses");
+	Check(ui.run_max >= 45000, "ui max run time");
+	Check(ui.stack_free == STACK_SIZE - 1800, "ui stack high-water mark");
+	Check((adc.overruns == 0) && (adc.misses == 0), "adc not affected (higher priority)");
+	Check(fabsf(adc.load - 7.5f) < 0.2f, "adc load");
+
+	printf("Report over UART_PC:\n");
+	fflush(stdout);
+	UartInit(&uart);
+	MonitorSend(UART_PC);
+	MonitorGet(TASK_UI, &ui);
+	Check(ui.load < 0.5f, "new report window");
+	StatsGet(STATS_UART(UART_PC), &uart_stats, false);
+	Check(uart_stats.errors == 0, "no report byte dropped at the TX FIFO");
+
+	printf("%s (%d errors)\n", errors ? "FAILED" : "OK", errors);
+	return errors != 0;
+}
+
+/*==================[end of file]============================================*/
@@ -0,0 +1,304 @@
+/**
+ * @file bench_pipeline.c
+ * @brief Host check of the dataflow pipeline (pipeline_mcu.h): ECG chain
+ * ADC -> IIR filters -> decimator -> FFT -> UART telemetry fed by a timer ISR,
+ * and data integrity with back-pressure on a polled source chain
+ * @version 0.1
+ * @date 2026-10-19
+ *
+ * @copyright Copyright (c) 2026
+ *
+ */
+
+/*==================[inclusions]=============================================*/
+#include <stdio.h>
+#include <string.h>
+#include <math.h>
+#include "host_mcu.h"
+#include "pipeline_mcu.h"
+#include "analog_io_mcu.h"
+#include "timer_mcu.h"
+#include "uart_mcu.h"
+#include "delay_mcu.h"
+#include "iir_filter.h"
+#include "multirate.h"
+#include "fft.h"
+/*==================[macros and definitions]=================================*/
+#define ECG_SAMPLES		231
+#define SAMPLE_FREC		250			/*!< ADC sample frequency (Hz) */
+#define ECG_BPM			(60.0f * SAMPLE_FREC / ECG_SAMPLES)
+#define DECIM			2
+#define DECIM_TAPS		31
+#define FFT_SIZE		1024
+#define ADC_BLOCK		32
+#define DECIM_BLOCK		64
+#define RUN_S			45
+#define BLOCKED_MS		2000		/*!< Worker blocked: ADC overruns */
+#define BPM_MAX			32
+
+#define COUNT_TOTAL		100000
+#define COUNT_BLOCK		16
+#define SINK_BLOCK		8
+/*==================[internal data definition]===============================*/
+/* ECG of proyecto_2_ej_4_ECG (one beat), 8 bit */
+static const uint8_t ecg[ECG_SAMPLES] = {
+	76, 77, 78, 77, 79, 86, 81, 76, 84, 93, 85, 80,
+	89, 95, 89, 85, 93, 98, 94, 88, 98, 105, 96, 91,
+	99, 105, 101, 96, 102, 106, 101, 96, 100, 107, 101,
+	94, 100, 104, 100, 91, 99, 103, 98, 91, 96, 105, 95,
+	88, 95, 100, 94, 85, 93, 99, 92, 84, 91, 96, 87, 80,
+	83, 92, 86, 78, 84, 89, 79, 73, 81, 83, 78, 70, 80, 82,
+	79, 69, 80, 82, 81, 70, 75, 81, 77, 74, 79, 83, 82, 72,
+	80, 87, 79, 76, 85, 95, 87, 81, 88, 93, 88, 84, 87, 94,
+	86, 82, 85, 94, 85, 82, 85, 95, 86, 83, 92, 99, 91, 88,
+	94, 98, 95, 90, 97, 105, 104, 94, 98, 114, 117, 124, 144,
+	180, 210, 236, 253, 227, 171, 99, 49, 34, 29, 43, 69, 89,
+	89, 90, 98, 107, 104, 98, 104, 110, 102, 98, 103, 111, 101,
+	94, 103, 108, 102, 95, 97, 106, 100, 92, 101, 103, 100, 94, 98,
+	103, 96, 90, 98, 103, 97, 90, 99, 104, 95, 90, 99, 104, 100, 93,
+	100, 106, 101, 93, 101, 105, 103, 96, 105, 112, 105, 99, 103, 108,
+	99, 96, 102, 106, 99, 90, 92, 100, 87, 80, 82, 88, 77, 69, 75, 79,
+	74, 67, 71, 78, 72, 67, 73, 81, 77, 71, 75, 84, 79, 77, 77, 76, 76,
+};
+static uint16_t ecg_raw[ECG_SAMPLES];
+
+/* ECG chain */
+static pipeline_t ecg_pipeline;
+static ring_buffer_t adc_rb, filter_rb, decim_rb, fft_rb;
+static uint16_t adc_storage[4 * ADC_BLOCK];
+static float filter_storage[4 * DECIM_BLOCK];
+static float decim_storage[FFT_SIZE];
+static float fft_storage[FFT_SIZE / 2];
+static multirate_decim_t decimator;
+static float decim_coeffs[DECIM_TAPS], decim_delay[DECIM_TAPS];
+static fft_plan_t plan;
+static float bpm[BPM_MAX];
+static uint8_t bpm_qty = 0;
+
+/* Integrity chain */
+static pipeline_t count_pipeline;
+static ring_buffer_t count_rb, copy_rb;
+static uint32_t count_storage[4 * COUNT_BLOCK];
+static uint32_t copy_storage[2 * COUNT_BLOCK];
+static uint32_t count_next = 0, sink_next = 0, sink_errors = 0;
+static bool sink_busy = false;
+
+static int errors = 0;
+/*==================[internal functions definition]==========================*/
+static void Check(bool ok, const char *what){
+	if(!ok){
+		printf("  FAIL: %s\n", what);
+		errors++;
+	}
+}
+
+/* ECG chain stages */
+static bool Filter(const void *in, void *out, void *param){
+	const uint16_t *samples = in;
+	float *filtered = out;
+
+	for(uint8_t i = 0; i < ADC_BLOCK; i++){
+		filtered[i] = samples[i];
+	}
+	HiPassFilter(filtered, filtered, ADC_BLOCK);
+	LowPassFilter(filtered, filtered, ADC_BLOCK);
+	return true;
+}
+
+static bool Decimate(const void *in, void *out, void *param){
+	MultirateDecim(&decimator, in, out, DECIM_BLOCK);
+	return true;
+}
+
+static bool Spectrum(const void *in, void *out, void *param){
+	FFTPlanMagnitude(&plan, in, out);
+	return true;
+}
+
+/* Heart rate: FFT peak between 40 and 120 bpm */
+static bool Telemetry(const void *in, void *out, void *param){
+	const float *mag = in;
+	float df = (float)SAMPLE_FREC / DECIM / FFT_SIZE;
+	uint16_t first = 40.0f / 60 / df, last = 120.0f / 60 / df, peak = first;
+
+	for(uint16_t i = first; i <= last; i++){
+		if(mag[i] > mag[peak]){
+			peak = i;
+		}
+	}
+	if(bpm_qty < BPM_MAX){
+		bpm[bpm_qty++] = peak * df * 60;
+	}
+	UartSendString(UART_PC, ">BPM:");
+	UartSendString(UART_PC, (char *)UartItoa(peak * df * 60, 10));
+	UartSendString(UART_PC, "\r\n");
+	return true;
+}
+
+static pipeline_stage_t adc = {.name = "adc", .process = NULL, .out_block = ADC_BLOCK};
+static pipeline_stage_t filter = {.name = "filtro", .process = Filter, .in_block = ADC_BLOCK, .out_block = ADC_BLOCK};
+static pipeline_stage_t decim = {.name = "decimador", .process = Decimate, .in_block = DECIM_BLOCK,
+	.out_block = DECIM_BLOCK / DECIM};
+static pipeline_stage_t fft = {.name = "fft", .process = Spectrum, .in_block = FFT_SIZE, .out_block = FFT_SIZE / 2};
+static pipeline_stage_t telemetry = {.name = "telemetria", .process = Telemetry, .in_block = FFT_SIZE / 2};
+
+static void AdcIsr(void *param){
+	uint16_t value;
+
+	AnalogInputReadSingle(CH1, &value);
+	PipelinePush(&adc, &value);
+}
+
+/* Integrity chain stages */
+static bool Count(const void *in, void *out, void *param){
+	uint32_t *values = out;
+
+	if(count_next >= COUNT_TOTAL){
+		return false;
+	}
+	for(uint8_t i = 0; i < COUNT_BLOCK; i++){
+		values[i] = count_next++;
+	}
+	return true;
+}
+
+static bool Copy(const void *in, void *out, void *param){
+	memcpy(out, in, COUNT_BLOCK * sizeof(uint32_t));
+	return true;
+}
+
+static bool Sink(const void *in, void *out, void *param){
+	const uint32_t *values = in;
+
+	if(sink_busy){
+		return false;
+	}
+	for(uint8_t i = 0; i < SINK_BLOCK; i++){
+		sink_errors += (values[i] != sink_next++);
+	}
+	return true;
+}
+
+static pipeline_stage_t counter = {.name = "contador", .process = Count, .out_block = COUNT_BLOCK};
+static pipeline_stage_t copy = {.name = "copia", .process = Copy, .in_block = COUNT_BLOCK, .out_block = COUNT_BLOCK};
+static pipeline_stage_t sink = {.name = "sumidero", .process = Sink, .in_block = SINK_BLOCK};
+
+/* Worker: runs the pipeline when the ADC source notifies (every ADC_BLOCK
+ * samples), checked every ms of virtual time */
+static void Worker(uint64_t until_ns){
+	static uint32_t notified = 0;
+
+	while(HostTimeNs() < until_ns){
+		DelayUs(1000);
+		if(ecg_pipeline.notifications != notified){
+			notified = ecg_pipeline.notifications;
+			PipelineRun(&ecg_pipeline);
+		}
+	}
+}
+
+static void TestEcg(void){
+	timer_config_t timer = {
+		.timer = TIMER_A,
+		.period = 1000000 / SAMPLE_FREC,
+		.func_p = AdcIsr,
+		.param_p = NULL,
+	};
+	serial_config_t uart = {
+		.port = UART_PC,
+		.baud_rate = 115200,
+		.func_p = UART_NO_INT,
+		.param_p = NULL,
+	};
+	uint32_t samples, overruns;
+
+	for(uint16_t i = 0; i < ECG_SAMPLES; i++){
+		ecg_raw[i] = ecg[i] * 16;
+	}
+	HostAnalogWaveform(CH1, ecg_raw, ECG_SAMPLES, SAMPLE_FREC, true);
+	HiPassInit(SAMPLE_FREC, 0.5f, ORDER_2);
+	LowPassInit(SAMPLE_FREC, 35.0f, ORDER_4);
+	MultirateLowPassDesign(decim_coeffs, DECIM_TAPS, SAMPLE_FREC / (2.0f * DECIM), SAMPLE_FREC, MULTIRATE_WIND_HANN);
+	MultirateDecimInit(&decimator, decim_coeffs, decim_delay, DECIM_TAPS, DECIM);
+	FFTPlanInit(&plan, FFT_SIZE);
+	UartInit(&uart);
+
+	PipelineInit(&ecg_pipeline);
+	PipelineAdd(&ecg_pipeline, &adc);
+	PipelineAdd(&ecg_pipeline, &filter);
+	PipelineAdd(&ecg_pipeline, &decim);
+	PipelineAdd(&ecg_pipeline, &fft);
+	PipelineAdd(&ecg_pipeline, &telemetry);
+	Check(PipelineConnect(&adc, &filter, &adc_rb, adc_storage, 4 * ADC_BLOCK, sizeof(uint16_t)) &&
+		PipelineConnect(&filter, &decim, &filter_rb, filter_storage, 4 * DECIM_BLOCK, sizeof(float)) &&
+		PipelineConnect(&decim, &fft, &decim_rb, decim_storage, FFT_SIZE, sizeof(float)) &&
+		PipelineConnect(&fft, &telemetry, &fft_rb, fft_storage, FFT_SIZE / 2, sizeof(float)), "ECG connections");
+	Check(!PipelineConnect(&adc, &telemetry, &fft_rb, fft_storage, FFT_SIZE / 2, sizeof(float)), "double connection rejected");
+
+	TimerInit(&timer);
+	TimerStart(TIMER_A);
+	Worker(RUN_S * 1000000000ULL);
+	samples = adc.stats.runs;
+	printf("ECG chain: %lu samples in %d s, %u FFT blocks\n", (unsigned long)samples, RUN_S, bpm_qty);
+	PipelinePrint(&ecg_pipeline);
+	Check(samples == RUN_S * SAMPLE_FREC, "ADC samples");
+	Check(adc.stats.overruns == 0, "no overruns while the worker keeps up");
+	Check(filter.stats.runs == samples / ADC_BLOCK, "filter blocks");
+	Check(decim.stats.runs == filter.stats.runs / 2, "decimator blocks");
+	Check(fft.stats.runs == decim.stats.runs * DECIM_BLOCK / DECIM / FFT_SIZE, "FFT blocks");
+	Check(telemetry.stats.runs == fft.stats.runs, "telemetry blocks");
+	Check(filter.stats.depth_max <= 2 * ADC_BLOCK, "ADC buffer depth");
+	for(uint8_t i = 0; i < bpm_qty; i++){
+		printf("  %.1f bpm (expected %.1f)\n", bpm[i], ECG_BPM);
+		/* First block: filters settling */
+		Check((i == 0) || (fabsf(bpm[i] - ECG_BPM) <= 60.0f * SAMPLE_FREC / DECIM / FFT_SIZE), "heart rate");
+	}
+
+	/* Worker blocked: the ADC buffer fills up and the source drops samples */
+	HostRunUs(BLOCKED_MS * 1000);
+	overruns = adc.stats.overruns;
+	Worker(HostTimeNs() + 1000000000ULL);
+	TimerStop(TIMER_A);
+	printf("  worker blocked %d ms: %lu samples dropped\n", BLOCKED_MS, (unsigned long)overruns);
+	Check(overruns == BLOCKED_MS * SAMPLE_FREC / 1000 - 4 * ADC_BLOCK + (samples % ADC_BLOCK), "ADC overruns");
+	Check(adc.stats.overruns == overruns, "pipeline recovers after the stall");
+}
+
+static void TestIntegrity(void){
+	uint32_t buffered;
+
+	PipelineInit(&count_pipeline);
+	PipelineAdd(&count_pipeline, &counter);
+	PipelineAdd(&count_pipeline, &copy);
+	PipelineAdd(&count_pipeline, &sink);
+	Check(!PipelineConnect(&counter, &copy, &count_rb, count_storage, 24, sizeof(uint32_t)), "size not power of two rejected");
+	Check(!PipelineConnect(&counter, &copy, &count_rb, count_storage, COUNT_BLOCK / 2, sizeof(uint32_t)), "block larger than buffer rejected");
+	Check(PipelineConnect(&counter, &copy, &count_rb, count_storage, 4 * COUNT_BLOCK, sizeof(uint32_t)) &&
+		PipelineConnect(&copy, &sink, &copy_rb, copy_storage, 2 * COUNT_BLOCK, sizeof(uint32_t)), "connections");
+
+	/* Sink busy: the buffers fill up and the upstream stages stop */
+	sink_busy = true;
+	PipelineRun(&count_pipeline);
+	buffered = count_next;
+	Check(buffered == 6 * COUNT_BLOCK, "back-pressure stops the source");
+	Check((counter.stats.stalls > 0) && (copy.stats.stalls > 0), "stalls counted");
+	Check(PipelineRun(&count_pipeline) == 0, "nothing runs while the sink is busy");
+
+	sink_busy = false;
+	PipelineRun(&count_pipeline);
+	printf("Integrity chain: %lu elements, %lu buffered while the sink was busy\n", (unsigned long)sink_next,
+		(unsigned long)buffered);
+	PipelinePrint(&count_pipeline);
+	Check((sink_next == COUNT_TOTAL) && (sink_errors == 0), "order and integrity");
+	Check(sink.stats.runs == COUNT_TOTAL / SINK_BLOCK, "sink blocks");
+	Check((RingBufferCount(&count_rb) == 0) && (RingBufferCount(&copy_rb) == 0), "buffers empty at the end");
+}
+/*==================[external functions definition]==========================*/
+int main(void){
+	TestEcg();
+	TestIntegrity();
+	printf("%s (%d errors)\n", errors ? "FAILED" : "OK", errors);
+	return errors != 0;
+}
+
+/*==================[end of file]============================================*/
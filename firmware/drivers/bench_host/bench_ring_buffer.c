@@ -0,0 +1,246 @@
+/**
+ * @file bench_ring_buffer.c
+ * @brief Host stress test of the ring buffers (ring_buffer_mcu.h): producer
+ * and consumer threads check order and integrity of every element, then the
+ * cost per element is measured for batch sizes 1 to 256
+ * @version 0.1
+ * @date 2026-10-19
+ *
+ * @copyright Copyright (c) 2026
+ *
+ */
+
+/*==================[inclusions]=============================================*/
+#include <stdio.h>
+#include <string.h>
+#include <time.h>
+#include <pthread.h>
+#include <sched.h>
+#include "ring_buffer_mcu.h"
+/*==================[macros and definitions]=================================*/
+#define SPSC_SIZE		1024
+#define SPSC_ELEMENTS	5000000
+#define MP_SIZE			256
+#define MP_PRODUCERS	4
+#define MP_ELEMENTS		500000		/*!< Per producer */
+#define BENCH_SIZE		1024
+#define BENCH_ELEMENTS	(1 << 24)
+#define BATCH_MAX		256
+
+/**
+ * @brief MPSC element
+ */
+typedef struct {
+	uint32_t producer;
+	uint32_t seq;
+} mp_elem_t;
+/*==================[internal data definition]===============================*/
+static uint32_t spsc_storage[SPSC_SIZE];
+static ring_buffer_t spsc;
+static mp_elem_t mp_storage[MP_SIZE];
+static uint32_t mp_seq[MP_SIZE];
+static ring_buffer_mp_t mp;
+static uint32_t bench_storage[BENCH_SIZE];
+static int errors = 0;
+/*==================[internal functions definition]==========================*/
+static void Check(bool ok, const char *what){
+	if(!ok){
+		printf("  FAIL: %s\n", what);
+		errors++;
+	}
+}
+
+static double TimeNs(void){
+	struct timespec t;
+	clock_gettime(CLOCK_MONOTONIC, &t);
+	return t.tv_sec * 1e9 + t.tv_nsec;
+}
+
+/* Producer: cycles through push, bulk write and zero-copy reserve/commit.
+ * Threads yield the CPU when the buffer is full/empty (the host can have a
+ * single core). */
+static void* SpscProducer(void *param){
+	uint32_t next = 0, last, batch[37], len, *run;
+
+	while(next < SPSC_ELEMENTS){
+		last = next;
+		switch(next % 3){
+			case 0:
+				if(RingBufferPush(&spsc, &next)){
+					next++;
+				}
+				break;
+			case 1:
+				len = 1 + next % 37;
+				if(len > SPSC_ELEMENTS - next){
+					len = SPSC_ELEMENTS - next;
+				}
+				for(uint32_t i = 0; i < len; i++){
+					batch[i] = next + i;
+				}
+				next += RingBufferWrite(&spsc, batch, len);
+				break;
+			default:
+				len = 1 + next % 300;
+				if(len > SPSC_ELEMENTS - next){
+					len = SPSC_ELEMENTS - next;
+				}
+				run = RingBufferWriteReserve(&spsc, &len);
+				for(uint32_t i = 0; i < len; i++){
+					run[i] = next + i;
+				}
+				RingBufferWriteCommit(&spsc, len);
+				next += len;
+				break;
+		}
+		if(next == last){
+			sched_yield();
+		}
+	}
+	return NULL;
+}
+
+/* Consumer: cycles through pop, bulk read and zero-copy peek/release */
+static void* SpscConsumer(void *param){
+	uint32_t next = 0, last, value, batch[53], len, bad = 0;
+	const uint32_t *run;
+
+	while(next < SPSC_ELEMENTS){
+		last = next;
+		switch(next % 3){
+			case 0:
+				if(RingBufferPop(&spsc, &value)){
+					bad += (value != next++);
+				}
+				break;
+			case 1:
+				len = RingBufferRead(&spsc, batch, 1 + next % 53);
+				for(uint32_t i = 0; i < len; i++){
+					bad += (batch[i] != next++);
+				}
+				break;
+			default:
+				len = 1 + next % 200;
+				run = RingBufferReadPeek(&spsc, &len);
+				for(uint32_t i = 0; i < len; i++){
+					bad += (run[i] != next++);
+				}
+				RingBufferReadRelease(&spsc, len);
+				break;
+		}
+		if(next == last){
+			sched_yield();
+		}
+	}
+	*(uint32_t *)param = bad;
+	return NULL;
+}
+
+static void* MpProducer(void *param){
+	mp_elem_t e = {.producer = (uint32_t)(uintptr_t)param, .seq = 0};
+
+	while(e.seq < MP_ELEMENTS){
+		if(RingBufferMpPush(&mp, &e)){
+			e.seq++;
+		} else{
+			sched_yield();
+		}
+	}
+	return NULL;
+}
+
+static void TestSpsc(void){
+	pthread_t producer, consumer;
+	uint32_t bad = 0;
+	double start;
+
+	Check(!RingBufferInit(&spsc, spsc_storage, 1000, sizeof(uint32_t)), "size not power of two rejected");
+	Check(RingBufferInit(&spsc, spsc_storage, SPSC_SIZE, sizeof(uint32_t)), "init");
+	start = TimeNs();
+	pthread_create(&consumer, NULL, SpscConsumer, &bad);
+	pthread_create(&producer, NULL, SpscProducer, NULL);
+	pthread_join(producer, NULL);
+	pthread_join(consumer, NULL);
+	printf("  SPSC: %d elements, 2 threads, %.1f ns per element\n", SPSC_ELEMENTS, (TimeNs() - start) / SPSC_ELEMENTS);
+	Check(bad == 0, "SPSC order and integrity");
+	Check(RingBufferCount(&spsc) == 0, "SPSC empty at the end");
+}
+
+static void TestMpsc(void){
+	pthread_t producers[MP_PRODUCERS];
+	uint32_t next[MP_PRODUCERS] = {0}, total = 0, bad = 0;
+	mp_elem_t e;
+	double start;
+
+	Check(RingBufferMpInit(&mp, mp_storage, mp_seq, MP_SIZE, sizeof(mp_elem_t)), "MPSC init");
+	start = TimeNs();
+	for(uintptr_t p = 0; p < MP_PRODUCERS; p++){
+		pthread_create(&producers[p], NULL, MpProducer, (void *)p);
+	}
+	while(total < MP_PRODUCERS * MP_ELEMENTS){
+		if(RingBufferMpPop(&mp, &e)){
+			/* Each producer's elements arrive in order */
+			if((e.producer >= MP_PRODUCERS) || (e.seq != next[e.producer])){
+				bad++;
+			} else{
+				next[e.producer]++;
+			}
+			total++;
+		} else{
+			sched_yield();
+		}
+	}
+	for(uint8_t p = 0; p < MP_PRODUCERS; p++){
+		pthread_join(producers[p], NULL);
+	}
+	printf("  MPSC: %d producers x %d elements, %.1f ns per element\n", MP_PRODUCERS, MP_ELEMENTS,
+		(TimeNs() - start) / (MP_PRODUCERS * MP_ELEMENTS));
+	Check(bad == 0, "MPSC per producer order and integrity");
+	Check(!RingBufferMpPop(&mp, &e) && (RingBufferMpCount(&mp) == 0), "MPSC empty at the end");
+
+	/* Full: exactly MP_SIZE elements fit */
+	e.producer = 0;
+	for(e.seq = 0; RingBufferMpPush(&mp, &e); e.seq++);
+	Check(e.seq == MP_SIZE, "MPSC capacity");
+}
+
+/* Single thread write/read of batches: cost of the buffer operations */
+static void Bench(void){
+	uint32_t batch[BATCH_MAX] = {0};
+	ring_buffer_t rb;
+	double start, push, bulk;
+
+	RingBufferInit(&rb, bench_storage, BENCH_SIZE, sizeof(uint32_t));
+	printf("  batch   push/pop ns   write/read ns   (per element)\n");
+	for(uint32_t size = 1; size <= BATCH_MAX; size *= 2){
+		start = TimeNs();
+		for(uint32_t n = 0; n < BENCH_ELEMENTS; n += size){
+			for(uint32_t i = 0; i < size; i++){
+				RingBufferPush(&rb, &batch[i]);
+			}
+			for(uint32_t i = 0; i < size; i++){
+				RingBufferPop(&rb, &batch[i]);
+			}
+		}
+		push = (TimeNs() - start) / BENCH_ELEMENTS;
+		start = TimeNs();
+		for(uint32_t n = 0; n < BENCH_ELEMENTS; n += size){
+			RingBufferWrite(&rb, batch, size);
+			RingBufferRead(&rb, batch, size);
+		}
+		bulk = (TimeNs() - start) / BENCH_ELEMENTS;
+		printf("  %5u   %11.2f   %13.2f\n", size, push, bulk);
+	}
+	Check(RingBufferCount(&rb) == 0, "benchmark buffer empty");
+}
+/*==================[external functions definition]==========================*/
+int main(void){
+	printf("Ring buffer\n");
+	TestSpsc();
+	TestMpsc();
+	Bench();
+	printf("%s (%d errors)\n", errors ? "FAILED" : "OK", errors);
+	return errors != 0;
+}
+
+/*==================[end of file]============================================*/
@@ -0,0 +1,164 @@
+/**
+ * @file bench_stats.c
+ * @brief Host check: performance counters of the drivers (stats_mcu.h) for
+ * SPI (ILI9341), I2C (MPU6050), UART, ADC and timer traffic
+ * @version 0.1
+ * @date 2026-10-19
+ *
+ * @copyright Copyright (c) 2026
+ *
+ */
+
+/*==================[inclusions]=============================================*/
+#include <stdio.h>
+#include "host_mcu.h"
+#include "device_models.h"
+#include "timer_mcu.h"
+#include "uart_mcu.h"
+#include "analog_io_mcu.h"
+#include "stats_mcu.h"
+#include "mpu6050.h"
+#include "ili9341.h"
+/*==================[macros and definitions]=================================*/
+#define LCD_DC			GPIO_9
+#define LCD_RST			GPIO_18
+#define LCD_SPI			SPI_1
+#define LCD_BYTES		(MODEL_LCD_WIDTH * MODEL_LCD_HEIGHT * 2)
+#define ISR_US			20		/*!< Run time of the timer callback */
+/*==================[internal data definition]===============================*/
+static mpu6050_model_t mpu6050;
+static ili9341_model_t lcd;
+static int errors = 0;
+/*==================[internal functions definition]==========================*/
+static void Check(bool ok, const char *what){
+	if(!ok){
+		printf("  FAIL: %s\n", what);
+		errors++;
+	}
+}
+
+static void Print(stats_id_t id){
+	char line[STATS_LINE_SIZE];
+	stats_t stats;
+
+	StatsGet(id, &stats, false);
+	StatsFormat(&stats, id, line, sizeof(line));
+	printf("  %s", line);
+}
+
+static void FuncTimer(void *param){
+	HostRunUs(ISR_US);
+}
+
+static void BenchSpi(void){
+	stats_t spi;
+
+	printf("SPI: ILI9341Fill (20 MHz)\n");
+	Ili9341ModelInit(&lcd, LCD_SPI);
+	lcd.dc = LCD_DC;
+	ILI9341Init(LCD_SPI, LCD_DC, LCD_RST);
+	StatsReset();
+	ILI9341Fill(ILI9341_BLUE);
+	Print(STATS_SPI(LCD_SPI));
+	StatsGet(STATS_SPI(LCD_SPI), &spi, false);
+	Check(spi.bytes >= LCD_BYTES, "bytes of a full screen");
+	Check(spi.transactions >= spi.bytes / 256, "transactions of at most 256 bytes");
+	Check(spi.time_max == 256 * 8 * 50, "max time: 256 bytes at 20 MHz");
+	Check(spi.time_total == (uint64_t)spi.bytes * 8 * 50, "total time: bus time of every byte");
+	Check(spi.errors == 0, "no errors");
+}
+
+static void BenchI2C(void){
+	int16_t ax, ay, az, gx, gy, gz;
+	uint8_t data[2];
+	stats_t i2c;
+
+	printf("I2C: MPU6050_getMotion6 (400 kHz) and a missing device\n");
+	Mpu6050ModelInit(&mpu6050);
+	I2C_initialize(I2C_MASTER_FREQ_HZ);
+	MPU6050_initialize();
+	StatsReset();
+	MPU6050_getMotion6(&ax, &ay, &az, &gx, &gy, &gz);
+	I2C_readBytes(0x50, 0, sizeof(data), data, 0);
+	Print(STATS_I2C);
+	StatsGet(STATS_I2C, &i2c, true);
+	Check((i2c.transactions == 2) && (i2c.bytes == 14) && (i2c.errors == 1), "transactions, bytes and NACKs");
+	Check(i2c.time_max == (2 + 1 + 14) * 9 * 2500, "max time: 14 byte read at 400 kHz");
+}
+
+static void BenchUart(void){
+	uint8_t data[300] = {0};
+	stats_t uart;
+
+	printf("UART: 300 bytes received, 256 byte buffer\n");
+	StatsReset();
+	HostUartInject(UART_CONNECTOR, data, sizeof(data));
+	UartReadBuffer(UART_CONNECTOR, data, 100);
+	Print(STATS_UART(UART_CONNECTOR));
+	StatsGet(STATS_UART(UART_CONNECTOR), &uart, true);
+	Check(uart.errors == sizeof(data) - HOST_UART_RX_SIZE, "dropped bytes");
+	Check(uart.depth_max == HOST_UART_RX_SIZE, "receive buffer high-water mark");
+	Check((uart.transactions == 1) && (uart.bytes == 100), "read");
+}
+
+static void BenchAdc(void){
+	const adc_ch_t channels[] = {CH1, CH2};
+	uint16_t values[2];
+	stats_t ch1, ch2;
+
+	printf("ADC: 10 scans of CH1 and CH2\n");
+	StatsReset();
+	for(uint8_t i = 0; i < 10; i++){
+		AnalogInputScan(channels, 2, values);
+	}
+	AnalogInputReadSingle(CH1, values);
+	StatsGet(STATS_ADC(CH1), &ch1, false);
+	StatsGet(STATS_ADC(CH2), &ch2, false);
+	Check((ch1.transactions == 11) && (ch2.transactions == 10), "conversions per channel");
+	Check(ch1.bytes == 11 * sizeof(uint16_t), "bytes");
+}
+
+static void BenchTimer(void){
+	timer_config_t timer = {.timer = TIMER_B, .period = 1000, .func_p = FuncTimer, .param_p = NULL};
+	stats_t isr;
+
+	printf("Timer: 1 ms period, %d us callback, 100 ms\n", ISR_US);
+	TimerInit(&timer);
+	TimerStart(TIMER_B);
+	HostRunUs(100000);
+	TimerStop(TIMER_B);
+	Print(STATS_TIMER(TIMER_B));
+	StatsGet(STATS_TIMER(TIMER_B), &isr, false);
+	Check(isr.transactions == 100, "ISR count");
+	Check((isr.time_max == ISR_US * 1000) && (isr.time_total == 100 * ISR_US * 1000ULL), "ISR run time");
+}
+
+static void BenchReport(void){
+	serial_config_t uart = {.port = UART_PC, .baud_rate = 115200, .func_p = NULL, .param_p = NULL};
+	stats_t stats;
+	uint8_t lines;
+
+	printf("Report over UART_PC (active instances, reset):\n");
+	fflush(stdout);
+	UartInit(&uart);
+	lines = StatsSend(UART_PC, true);
+	Check(lines == 3, "ADC CH1, CH2 and TIMER_B lines");
+	StatsGet(STATS_TIMER(TIMER_B), &stats, false);
+	Check(stats.transactions == 0, "counters reset");
+	StatsGet(STATS_UART(UART_PC), &stats, false);
+	Check(stats.transactions == lines, "report counted in the next window");
+	Check(stats.errors == 0, "no report byte dropped at the TX FIFO");
+}
+/*==================[external functions definition]==========================*/
+int main(void){
+	BenchSpi();
+	BenchI2C();
+	BenchUart();
+	BenchAdc();
+	BenchTimer();
+	BenchReport();
+	printf("%s (%d errors)\n", errors ? "FAILED" : "OK", errors);
+	return errors != 0;
+}
+
+/*==================[end of file]============================================*/
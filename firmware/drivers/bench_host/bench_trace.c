@@ -0,0 +1,263 @@
+/**
+ * @file bench_trace.c
+ * @brief Host check of the event tracer (trace_mcu.h): timer and GPIO ISRs,
+ * SPI/I2C/UART transactions and task events recorded by the drivers of the
+ * host backend, ring buffer overflow and the UART stream
+ * @version 0.1
+ * @date 2026-10-19
+ *
+ * @copyright Copyright (c) 2026
+ *
+ */
+
+/*==================[inclusions]=============================================*/
+#include <stdio.h>
+#include <string.h>
+#include <time.h>
+#include <fcntl.h>
+#include <unistd.h>
+#include "host_mcu.h"
+#include "device_models.h"
+#include "trace_mcu.h"
+#include "timer_mcu.h"
+#include "gpio_mcu.h"
+#include "spi_mcu.h"
+#include "i2c_mcu.h"
+#include "uart_mcu.h"
+#include "delay_mcu.h"
+/*==================[macros and definitions]=================================*/
+#define TASK_ID			0
+#define TASK_PERIOD_US	1000
+#define FAST_PERIOD_US	250
+#define GPIO_IRQ		GPIO_5
+#define ITERATIONS		20
+#define SPI_BYTES		64
+#define SPI_BITRATE		1000000
+#define COST_EVENTS		10000000
+#define TRACE_FILE		"trace.bin"
+/*==================[internal data definition]===============================*/
+static trace_event_t events[TRACE_BUFFER_SIZE];
+static mpu6050_model_t mpu6050;
+static volatile uint32_t pending = 0;
+static uint32_t fast_count = 0, gpio_count = 0;
+static int errors = 0;
+/*==================[internal functions definition]==========================*/
+static void Check(bool ok, const char *what){
+	if(!ok){
+		printf("  FAIL: %s\n", what);
+		errors++;
+	}
+}
+
+static double TimeNs(void){
+	struct timespec t;
+	clock_gettime(CLOCK_MONOTONIC, &t);
+	return t.tv_sec * 1e9 + t.tv_nsec;
+}
+
+static void TaskTimerIsr(void *param){
+	pending++;
+	TraceTaskNotify(TASK_ID);
+}
+
+static void FastTimerIsr(void *param){
+	fast_count++;
+}
+
+static void GpioIsr(void *param){
+	gpio_count++;
+}
+
+static void GpioToggle(void *param){
+	static bool level = true;
+
+	level = !level;
+	HostGPIODrive(GPIO_IRQ, level);
+}
+
+/* Task body: waits for the timer notification and talks to the devices */
+static void Task(void){
+	uint8_t tx[SPI_BYTES] = {0}, accel[6];
+	uint32_t taken;
+
+	while(pending == 0){
+		DelayUs(10);
+	}
+	taken = pending;
+	pending = 0;
+	TraceTaskTake(TASK_ID, taken);
+	TraceSpanStart(TASK_ID);
+	SpiWrite(SPI_1, tx, SPI_BYTES);
+	I2C_readBytes(0x68, 0x3B, sizeof(accel), accel, 0);
+	I2C_readBytes(0x50, 0x00, 1, accel, 0);
+	UartSendString(UART_CONNECTOR, "ok\r\n");
+	TraceSpanEnd(TASK_ID);
+}
+
+static uint32_t Count(uint32_t qty, uint8_t type, int id){
+	uint32_t n = 0;
+	for(uint32_t i = 0; i < qty; i++){
+		n += (events[i].type == type) && ((id < 0) || (events[i].id == id));
+	}
+	return n;
+}
+
+static void CheckEvents(uint32_t qty){
+	int depth[256] = {0};
+	uint32_t spi_start = 0;
+	bool ordered = true, paired = true, spi_time = true, i2c_ack = true;
+
+	for(uint32_t i = 0; i < qty; i++){
+		trace_event_t *e = &events[i];
+		if((i > 0) && ((int32_t)(e->time - events[i - 1].time) < 0)){
+			ordered = false;
+		}
+		switch(e->type){
+			case TRACE_ISR_ENTER:
+				depth[e->id]++;
+				break;
+			case TRACE_ISR_EXIT:
+				paired &= (--depth[e->id] == 0);
+				break;
+			case TRACE_SPI_START:
+				spi_start = e->time;
+				break;
+			case TRACE_SPI_END:
+				/* 64 bytes at 1 Mbps: 512 us of bus time (ISRs can add some) */
+				spi_time &= (e->time - spi_start) >= SPI_BYTES * 8 * 1000;
+				spi_time &= (e->time - spi_start) < SPI_BYTES * 8 * 1000 + 50000;
+				break;
+			case TRACE_I2C_END:
+				i2c_ack &= (e->arg == (e->id == 0x68));
+				break;
+		}
+	}
+	Check(ordered, "events in time order");
+	Check(paired, "ISR enter/exit pairs");
+	Check(spi_time, "SPI transaction time");
+	Check(i2c_ack, "I2C ACK (0x68) / NACK (0x50)");
+}
+/*==================[external functions definition]==========================*/
+int main(void){
+	timer_config_t task_timer = {
+		.timer = TIMER_A,
+		.period = TASK_PERIOD_US,
+		.func_p = TaskTimerIsr,
+		.param_p = NULL,
+	};
+	timer_config_t fast_timer = {
+		.timer = TIMER_B,
+		.period = FAST_PERIOD_US,
+		.func_p = FastTimerIsr,
+		.param_p = NULL,
+	};
+	spi_mcu_config_t spi = {
+		.device = SPI_1,
+		.clk_mode = MODE0,
+		.bitrate = SPI_BITRATE,
+		.transfer_mode = SPI_POLLING,
+		.func_p = NULL,
+		.param_p = NULL,
+	};
+	serial_config_t uart = {
+		.port = UART_CONNECTOR,
+		.baud_rate = 115200,
+		.func_p = UART_NO_INT,
+		.param_p = NULL,
+	};
+	serial_config_t uart_pc = {
+		.port = UART_PC,
+		.baud_rate = 115200,
+		.func_p = UART_NO_INT,
+		.param_p = NULL,
+	};
+	trace_header_t header;
+	trace_event_t streamed;
+	uint32_t qty, lost, head, sent;
+	double start;
+	int fd;
+
+	Mpu6050ModelInit(&mpu6050);
+	SpiInit(&spi);
+	UartInit(&uart);
+	UartInit(&uart_pc);
+	I2C_initialize(I2C_MASTER_FREQ_HZ);
+	GPIOInit(GPIO_IRQ, GPIO_INPUT);
+	GPIOActivInt(GPIO_IRQ, GpioIsr, true, NULL);
+	HostSchedule(300000, 300000, GpioToggle, NULL);
+	TimerInit(&task_timer);
+	TimerInit(&fast_timer);
+
+	printf("Trace: %d events buffer\n", TRACE_BUFFER_SIZE);
+	TraceStart();
+	TimerStart(TIMER_A);
+	TimerStart(TIMER_B);
+	for(uint8_t i = 0; i < ITERATIONS; i++){
+		Task();
+	}
+	TimerStop(TIMER_A);
+	TimerStop(TIMER_B);
+	TraceStop();
+
+	qty = TraceCopy(events, TRACE_BUFFER_SIZE, &lost);
+	printf("  %u events, %u lost, %.3f ms\n", qty, lost, HostTimeNs() / 1e6);
+	Check((qty > 0) && (lost == 0), "no overflow in the short run");
+	Check(Count(qty, TRACE_ISR_ENTER, TRACE_ISR_TIMER(TIMER_A)) == ITERATIONS, "TIMER_A ISRs");
+	Check(Count(qty, TRACE_ISR_ENTER, TRACE_ISR_TIMER(TIMER_B)) == fast_count, "TIMER_B ISRs");
+	Check(Count(qty, TRACE_ISR_ENTER, TRACE_ISR_GPIO(GPIO_IRQ)) == gpio_count, "GPIO ISRs");
+	Check(gpio_count > 0, "GPIO interrupts");
+	Check(Count(qty, TRACE_TASK_NOTIFY, TASK_ID) == ITERATIONS, "task notifies");
+	Check(Count(qty, TRACE_TASK_TAKE, TASK_ID) == ITERATIONS, "task takes");
+	Check(Count(qty, TRACE_SPI_START, SPI_1) == ITERATIONS, "SPI transactions");
+	Check(Count(qty, TRACE_I2C_START, -1) == 2 * ITERATIONS, "I2C transactions");
+	Check(Count(qty, TRACE_UART_END, UART_CONNECTOR) == ITERATIONS, "UART transfers");
+	CheckEvents(qty);
+
+	/* UART stream: far bigger than the TX FIFO, no byte may be dropped */
+	fd = open(TRACE_FILE, O_CREAT | O_TRUNC | O_RDWR, 0644);
+	HostUartOpen(UART_PC, HOST_NO_FD, fd);
+	sent = TraceFlush(UART_PC);
+	HostUartOpen(UART_PC, HOST_NO_FD, HOST_NO_FD);
+	lseek(fd, 0, SEEK_SET);
+	Check(read(fd, &header, sizeof(header)) == sizeof(header), "stream header");
+	Check((memcmp(header.magic, TRACE_MAGIC, 4) == 0) && (header.event_size == sizeof(trace_event_t)) &&
+		(header.count == sent) && (header.lost == lost), "stream header fields");
+	for(uint32_t i = 0; i < sent; i++){
+		if((read(fd, &streamed, sizeof(streamed)) != sizeof(streamed)) || memcmp(&streamed, &events[i], sizeof(streamed))){
+			Check(false, "streamed events");
+			break;
+		}
+	}
+	close(fd);
+	printf("  %u events streamed to %s\n", sent, TRACE_FILE);
+
+	/* Stopped: nothing is recorded */
+	TraceMark(1, 1);
+	Check(TraceCopy(events, TRACE_BUFFER_SIZE, NULL) == qty, "no events after TraceStop()");
+
+	/* Flight recorder: the last TRACE_BUFFER_SIZE events are kept */
+	TraceStart();
+	for(uint32_t i = 0; i < 3 * TRACE_BUFFER_SIZE + 5; i++){
+		TraceMark(2, i);
+	}
+	TraceStop();
+	head = 3 * TRACE_BUFFER_SIZE + 5;
+	qty = TraceCopy(events, TRACE_BUFFER_SIZE, &lost);
+	Check((qty == TRACE_BUFFER_SIZE) && (lost == head - TRACE_BUFFER_SIZE), "overflow accounting");
+	Check((events[0].arg == (uint16_t)(head - TRACE_BUFFER_SIZE)) && (events[qty - 1].arg == (uint16_t)(head - 1)),
+		"oldest events overwritten");
+
+	/* Recording cost (host) */
+	TraceStart();
+	start = TimeNs();
+	for(uint32_t i = 0; i < COST_EVENTS; i++){
+		TraceEvent(TRACE_MARK, 3, i);
+	}
+	printf("  TraceEvent: %.1f ns per event (host)\n", (TimeNs() - start) / COST_EVENTS);
+	TraceStop();
+
+	printf("%s (%d errors)\n", errors ? "FAILED" : "OK", errors);
+	return errors != 0;
+}
+
+/*==================[end of file]============================================*/
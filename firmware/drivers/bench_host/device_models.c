@@ -0,0 +1,204 @@
+/**
+ * @file device_models.c
+ * @brief Host device models for the drivers/devices drivers
+ * @version 0.1
+ * @date 2026-10-19
+ *
+ * @copyright Copyright (c) 2026
+ *
+ */
+
+/*==================[inclusions]=============================================*/
+#include "device_models.h"
+#include <stddef.h>
+#include <string.h>
+/*==================[macros and definitions]=================================*/
+#define NS_PER_US				1000
+#define HX711_BITS				24
+#define HC_SR04_TRIGGER_NS		(10 * NS_PER_US)	/*!< Minimum trigger pulse */
+#define HC_SR04_BURST_NS		(200 * NS_PER_US)	/*!< 8 cycles at 40 kHz */
+#define HC_SR04_US_PER_CM		58
+#define MPU6050_ADDR			0x68
+#define MPU6050_ACCEL_XOUT_H	0x3B
+#define MPU6050_GYRO_XOUT_H		0x43
+#define MPU6050_PWR_MGMT_1		0x6B
+#define MPU6050_WHO_AM_I		0x75
+#define ILI9341_CASET			0x2A
+#define ILI9341_PASET			0x2B
+#define ILI9341_RAMWR			0x2C
+/*==================[internal functions definition]==========================*/
+static void Hx711Ready(void *param){
+	hx711_model_t *m = param;
+
+	m->shift = (uint32_t)m->value & 0xFFFFFF;
+	m->pulses = 0;
+	m->conversions++;
+	HostGPIODrive(m->dout, false);
+}
+
+static void Hx711Sck(gpio_t pin, bool level, void *param){
+	hx711_model_t *m = param;
+
+	if(!level){
+		return;
+	}
+	if(m->pulses < HX711_BITS){
+		/* Data bit shifted out on the rising edge */
+		HostGPIODrive(m->dout, (m->shift >> (HX711_BITS - 1 - m->pulses)) & 1);
+	} else if(m->pulses == HX711_BITS){
+		/* First gain pulse: DOUT high until the next conversion */
+		HostGPIODrive(m->dout, true);
+		HostSchedule((uint64_t)m->conversion_us * NS_PER_US, 0, Hx711Ready, m);
+	}
+	m->pulses++;
+	if(m->pulses > HX711_BITS){
+		m->gain_pulses = m->pulses;
+	}
+}
+
+static void HcSr04EchoStart(void *param){
+	hc_sr04_model_t *m = param;
+
+	HostGPIODrive(m->echo, true);
+}
+
+static void HcSr04EchoEnd(void *param){
+	hc_sr04_model_t *m = param;
+
+	HostGPIODrive(m->echo, false);
+}
+
+static void HcSr04Trigger(gpio_t pin, bool level, void *param){
+	hc_sr04_model_t *m = param;
+
+	if(level){
+		m->trigger_start = HostTimeNs();
+		return;
+	}
+	if(HostTimeNs() - m->trigger_start < HC_SR04_TRIGGER_NS){
+		return;
+	}
+	m->pings++;
+	HostSchedule(HC_SR04_BURST_NS, 0, HcSr04EchoStart, m);
+	HostSchedule(HC_SR04_BURST_NS + (uint64_t)m->distance_cm * HC_SR04_US_PER_CM * NS_PER_US,
+		0, HcSr04EchoEnd, m);
+}
+
+static void Ili9341Pixel(ili9341_model_t *m, uint16_t color){
+	if((m->x < MODEL_LCD_WIDTH) && (m->y < MODEL_LCD_HEIGHT)){
+		m->fb[m->y * MODEL_LCD_WIDTH + m->x] = color;
+	}
+	m->pixels++;
+	if(++m->x > m->x1){
+		m->x = m->x0;
+		if(++m->y > m->y1){
+			m->y = m->y0;
+		}
+	}
+}
+
+static void Ili9341Transfer(spi_dev_t device, const uint8_t *tx, uint8_t *rx, uint32_t len, void *param){
+	ili9341_model_t *m = param;
+
+	if(tx == NULL){
+		return;
+	}
+	if(!HostGPIOLevel(m->dc)){
+		/* Command: the last byte selects the following data */
+		m->cmd = tx[len - 1];
+		m->param_qty = 0;
+		m->half = false;
+		if(m->cmd == ILI9341_RAMWR){
+			m->x = m->x0;
+			m->y = m->y0;
+		}
+		return;
+	}
+	for(uint32_t i = 0; i < len; i++){
+		switch(m->cmd){
+			case ILI9341_CASET:
+			case ILI9341_PASET:
+				if(m->param_qty < 4){
+					m->params[m->param_qty++] = tx[i];
+				}
+				if(m->param_qty == 4){
+					uint16_t start = (m->params[0] << 8) | m->params[1];
+					uint16_t end = (m->params[2] << 8) | m->params[3];
+					if(m->cmd == ILI9341_CASET){
+						m->x0 = start;
+						m->x1 = end;
+					} else{
+						m->y0 = start;
+						m->y1 = end;
+					}
+				}
+				break;
+			case ILI9341_RAMWR:
+				if(m->half){
+					Ili9341Pixel(m, (m->high << 8) | tx[i]);
+				} else{
+					m->high = tx[i];
+				}
+				m->half = !m->half;
+				break;
+			default:
+				break;
+		}
+	}
+}
+/*==================[external functions definition]==========================*/
+void Hx711ModelInit(hx711_model_t *m){
+	m->pulses = HX711_BITS + 1;
+	m->gain_pulses = 0;
+	m->conversions = 0;
+	HostGPIODrive(m->dout, true);
+	HostGPIOWatch(m->sck, Hx711Sck, m);
+	HostSchedule((uint64_t)m->conversion_us * NS_PER_US, 0, Hx711Ready, m);
+}
+
+void HcSr04ModelInit(hc_sr04_model_t *m){
+	m->pings = 0;
+	HostGPIODrive(m->echo, false);
+	HostGPIOWatch(m->trigger, HcSr04Trigger, m);
+}
+
+void Mpu6050ModelInit(mpu6050_model_t *m){
+	memset(m->regs, 0, sizeof(m->regs));
+	m->regs[MPU6050_PWR_MGMT_1] = 0x40;		/* Reset value: sleep */
+	m->regs[MPU6050_WHO_AM_I] = MPU6050_ADDR;
+	m->i2c.addr = MPU6050_ADDR;
+	m->i2c.regs = m->regs;
+	m->i2c.read = NULL;
+	m->i2c.write = NULL;
+	m->i2c.param = m;
+	HostI2CModel(&m->i2c);
+}
+
+void Mpu6050ModelMotion(mpu6050_model_t *m, const int16_t accel[3], const int16_t gyro[3]){
+	for(uint8_t i = 0; i < 3; i++){
+		m->regs[MPU6050_ACCEL_XOUT_H + 2 * i] = (uint16_t)accel[i] >> 8;
+		m->regs[MPU6050_ACCEL_XOUT_H + 2 * i + 1] = (uint16_t)accel[i] & 0xFF;
+		m->regs[MPU6050_GYRO_XOUT_H + 2 * i] = (uint16_t)gyro[i] >> 8;
+		m->regs[MPU6050_GYRO_XOUT_H + 2 * i + 1] = (uint16_t)gyro[i] & 0xFF;
+	}
+}
+
+void Ili9341ModelInit(ili9341_model_t *m, spi_dev_t device){
+	memset(m->fb, 0, sizeof(m->fb));
+	m->x0 = m->x = 0;
+	m->y0 = m->y = 0;
+	m->x1 = MODEL_LCD_WIDTH - 1;
+	m->y1 = MODEL_LCD_HEIGHT - 1;
+	m->cmd = 0;
+	m->half = false;
+	m->pixels = 0;
+	m->spi.transfer = Ili9341Transfer;
+	m->spi.param = m;
+	HostSpiModel(device, &m->spi);
+}
+
+uint16_t Ili9341ModelPixel(const ili9341_model_t *m, uint16_t x, uint16_t y){
+	return m->fb[y * MODEL_LCD_WIDTH + x];
+}
+
+/*==================[end of file]============================================*/
@@ -0,0 +1,104 @@
+/**
+ * @file device_models.h
+ * @brief Host device models for the drivers/devices drivers: HX711, HC-SR04,
+ * MPU6050 and ILI9341
+ * @version 0.1
+ * @date 2026-10-19
+ *
+ * @copyright Copyright (c) 2026
+ *
+ */
+#ifndef DEVICE_MODELS_H
+#define DEVICE_MODELS_H
+
+/*==================[inclusions]=============================================*/
+#include <stdbool.h>
+#include <stdint.h>
+#include "host_mcu.h"
+/*==================[macros]=================================================*/
+#define MODEL_LCD_WIDTH		240
+#define MODEL_LCD_HEIGHT	320
+/*==================[typedef]================================================*/
+/**
+ * @brief HX711 load cell ADC: 24 bit samples shifted out MSB first on PD_SCK
+ */
+typedef struct {
+	gpio_t sck;					/*!< PD_SCK pin (MCU output) */
+	gpio_t dout;				/*!< DOUT pin (MCU input) */
+	int32_t value;				/*!< Next sample (24 bit, two's complement) */
+	uint32_t conversion_us;		/*!< Conversion time (12500: 80 SPS) */
+	uint32_t shift;				/*!< Sample being shifted out */
+	uint8_t pulses;				/*!< PD_SCK pulses since the sample was ready */
+	uint8_t gain_pulses;		/*!< Pulses of the last read (25: A128, 26: B32, 27: A64) */
+	uint32_t conversions;		/*!< Conversions done */
+} hx711_model_t;
+
+/**
+ * @brief HC-SR04 ultrasonic sensor: echo pulse of 58 us/cm after the trigger
+ */
+typedef struct {
+	gpio_t echo;				/*!< ECHO pin (MCU input) */
+	gpio_t trigger;				/*!< TRIGGER pin (MCU output) */
+	uint16_t distance_cm;		/*!< Simulated distance */
+	uint64_t trigger_start;		/*!< Rising edge of the trigger (ns) */
+	uint32_t pings;				/*!< Valid triggers (>= 10 us) */
+} hc_sr04_model_t;
+
+/**
+ * @brief MPU6050 register file
+ */
+typedef struct {
+	uint8_t regs[256];			/*!< Registers */
+	host_i2c_model_t i2c;		/*!< I2C model */
+} mpu6050_model_t;
+
+/**
+ * @brief ILI9341 display: column/page address set and memory write
+ */
+typedef struct {
+	gpio_t dc;					/*!< DC pin (low: command) */
+	uint16_t fb[MODEL_LCD_WIDTH * MODEL_LCD_HEIGHT];	/*!< Frame memory (RGB565) */
+	uint8_t cmd;				/*!< Last command */
+	uint8_t params[4];			/*!< Command parameters */
+	uint8_t param_qty;			/*!< Received parameters */
+	uint16_t x0, x1, y0, y1;	/*!< Write window */
+	uint16_t x, y;				/*!< Write position */
+	uint8_t high;				/*!< Pixel high byte */
+	bool half;					/*!< High byte received */
+	uint32_t pixels;			/*!< Pixels written */
+	host_spi_model_t spi;		/*!< SPI model */
+} ili9341_model_t;
+/*==================[external functions declaration]=========================*/
+/**
+ * @brief Attach a HX711 model to its pins (first sample after conversion_us)
+ */
+void Hx711ModelInit(hx711_model_t *m);
+
+/**
+ * @brief Attach a HC-SR04 model to its pins
+ */
+void HcSr04ModelInit(hc_sr04_model_t *m);
+
+/**
+ * @brief Attach a MPU6050 model (address 0x68) to the I2C bus
+ */
+void Mpu6050ModelInit(mpu6050_model_t *m);
+
+/**
+ * @brief Set the accelerometer and gyroscope outputs of a MPU6050 model
+ */
+void Mpu6050ModelMotion(mpu6050_model_t *m, const int16_t accel[3], const int16_t gyro[3]);
+
+/**
+ * @brief Attach an ILI9341 model to a SPI device
+ */
+void Ili9341ModelInit(ili9341_model_t *m, spi_dev_t device);
+
+/**
+ * @brief Frame memory pixel of an ILI9341 model
+ */
+uint16_t Ili9341ModelPixel(const ili9341_model_t *m, uint16_t x, uint16_t y);
+
+#endif /* DEVICE_MODELS_H */
+
+/*==================[end of file]============================================*/
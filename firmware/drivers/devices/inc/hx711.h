@@ -17,6 +17,7 @@
  * |   Date	    | Description                                    						|
  * |:----------:|:----------------------------------------------------------------------|
  * | 30/01/2024 | Document creation		                         						|
+ * | 19/10/2026 | Clock and data lines accessed through gpio_direct_mcu					|
  * 
  **/
 
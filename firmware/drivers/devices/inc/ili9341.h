@@ -33,6 +33,7 @@
  * |   Date	    | Description                                    |
  * |:----------:|:-----------------------------------------------|
  * | 18/01/2024 | Document creation		                         |
+ * | 19/10/2026 | Pixel buffers from pool_dma (arena_mcu.h)      |
  *
  */
 
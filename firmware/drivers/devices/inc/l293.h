@@ -31,6 +31,7 @@
  * |   Date	    | Description                                    |
  * |:----------:|:-----------------------------------------------|
  * | 17/05/2024 | Document creation		                         |
+ * | 19/10/2026 | Direction pins written through a GPIO port    |
  *
  */
 
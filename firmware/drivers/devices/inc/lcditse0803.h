@@ -30,6 +30,7 @@
  * |   Date	    | Description                                    						|
  * |:----------:|:----------------------------------------------------------------------|
  * | 23/10/2023 | Document creation		                         						|
+ * | 19/10/2026 | BCD and select lines written through a GPIO port	           			|
  * 
  **/
 
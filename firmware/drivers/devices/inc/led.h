@@ -18,6 +18,7 @@
  * |   Date	    | Description                                    						|
  * |:----------:|:----------------------------------------------------------------------|
  * | 23/10/2023 | Document creation		                         						|
+ * | 19/10/2026 | LEDs written through a GPIO port	                         			|
  * 
  **/
 
@@ -19,6 +19,7 @@
  * |   Date	    | Description                                    						|
  * |:----------:|:----------------------------------------------------------------------|
  * | 23/10/2023 | Document creation		                         						|
+ * | 19/10/2026 | Debounced switch events (SwitchActivEvent)  							|
  * 
  **/
 
@@ -58,6 +59,19 @@ int8_t SwitchesRead(void);
  */
 void SwitchActivInt(switch_t tec, void *ptrIntFunc, void *args);
 
+/**
+ * @brief Subscribes a callback to the debounced events of a particular key 
+ * (press, release, long press and double click, see gpio_event_mcu).
+ * 
+ * @note The callback runs in task context: void func(gpio_event_t *event, void *args)
+ * 
+ * @param tec Selected switch
+ * @param ptrEventFunc Pointer to callback function
+ * @param args Pointer to callback function parameters
+ * @return true Callback subscribed
+ */
+bool SwitchActivEvent(switch_t tec, void *ptrEventFunc, void *args);
+
 /** @} doxygen end group definition */
 /** @} doxygen end group definition */
 /** @} doxygen end group definition */
@@ -12,6 +12,7 @@
 #include "hx711.h"
 
 #include <delay_mcu.h>
+#include <gpio_direct_mcu.h>
 
 /*==================[macros and definitions]=================================*/
 
@@ -23,6 +24,8 @@ float SCALE;	                 /*!<  Used to return weight in grams, kg, ounces,
 
 gpio_t internal_pd_sck;
 gpio_t internal_dout;
+static uint32_t pd_sck_mask;	/*!< PD_SCK register mask */
+static uint32_t dout_mask;		/*!< DOUT register mask */
 
 /*==================[internal functions declaration]=========================*/
 
@@ -32,9 +35,9 @@ uint8_t shiftIn(void)
 
     for (uint8_t i = 0; i < 8; ++i)
     {
-    	GPIOOn(internal_pd_sck);//PD_SCK_SET_HIGH;
-        value |= GPIORead(internal_dout) << (7 - i);
-        GPIOOff(internal_pd_sck);//PD_SCK_SET_LOW;
+    	GPIODirectSetMask(pd_sck_mask);//PD_SCK_SET_HIGH;
+        value |= (GPIODirectReadMask(dout_mask) != 0) << (7 - i);
+        GPIODirectClearMask(pd_sck_mask);//PD_SCK_SET_LOW;
     }
     return value;
 }
@@ -48,6 +51,8 @@ void HX711_Init(uint8_t gain, gpio_t pd_sck, gpio_t dout)
 {
 	internal_pd_sck = pd_sck;
 	internal_dout = dout;
+	pd_sck_mask = GPIO_DIRECT_MASK(pd_sck);
+	dout_mask = GPIO_DIRECT_MASK(dout);
 	GPIOInit(pd_sck, GPIO_OUTPUT);//PD_SCK_SET_OUTPUT;
 	GPIOInit(dout, GPIO_INPUT);//DOUT_SET_INPUT;
     HX711_setGain(gain);
@@ -56,7 +61,7 @@ void HX711_Init(uint8_t gain, gpio_t pd_sck, gpio_t dout)
 
 int HX711_isReady(void)
 {
-    return (GPIORead(internal_dout)) == 0;
+    return GPIODirectReadMask(dout_mask) == 0;
 }
 
 void HX711_setGain(uint8_t gain)
@@ -86,29 +91,29 @@ uint32_t HX711_read(void)
     unsigned long count;
     unsigned char i;
 
-    GPIOOn(internal_dout);//DOUT_SET_HIGH;
+    GPIODirectSetMask(dout_mask);//DOUT_SET_HIGH;
 
     DelayUs(1);
 
-    GPIOOff(internal_pd_sck);//PD_SCK_SET_LOW;
+    GPIODirectClearMask(pd_sck_mask);//PD_SCK_SET_LOW;
     DelayUs(1);
 
     count=0;
-    while(GPIORead(internal_dout));
+    while(GPIODirectReadMask(dout_mask));
     for(i=0;i<24;i++)
     {
-    	 GPIOOn(internal_pd_sck);//PD_SCK_SET_HIGH;
+    	 GPIODirectSetMask(pd_sck_mask);//PD_SCK_SET_HIGH;
     	 DelayUs(1);
         count=count<<1;
-        GPIOOff(internal_pd_sck);//PD_SCK_SET_LOW;
+        GPIODirectClearMask(pd_sck_mask);//PD_SCK_SET_LOW;
         DelayUs(1);
-        if(GPIORead(internal_dout))
+        if(GPIODirectReadMask(dout_mask))
             count++;
     }
     count = count>>6;
-    GPIOOn(internal_pd_sck);//PD_SCK_SET_HIGH;
+    GPIODirectSetMask(pd_sck_mask);//PD_SCK_SET_HIGH;
     DelayUs(1);
-    GPIOOff(internal_pd_sck);//PD_SCK_SET_LOW;
+    GPIODirectClearMask(pd_sck_mask);//PD_SCK_SET_LOW;
     DelayUs(1);
     count ^= 0x800000;
     return(count);
@@ -125,7 +130,7 @@ uint32_t HX711_readAverage(uint8_t times)
 	return sum / times;
 }
 
-double HX711_getValue(uint8_t times)
+double HX711_get_value(uint8_t times)
 {
 	return HX711_readAverage(times) - OFFSET;
 }
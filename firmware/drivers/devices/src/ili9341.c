@@ -15,6 +15,7 @@
 #include "spi_mcu.h"
 #include "gpio_mcu.h"
 #include "delay_mcu.h"
+#include "arena_mcu.h"
 /*==================[macros and definitions]=================================*/
 #define NULL 0
 
@@ -23,6 +24,9 @@
 #define MSK_BIT16 0x8000			/*!< 16th bit mask */
 #define MSK_BIT8 0x80				/*!< 8th bit mask */
 #define MAX_VALUE_SIZE 256			/*!< Maximum length of a data array to prevent excessive use of memory */
+#if CONFIG_MCU_POOL_DMA_BLOCK_SIZE < MAX_VALUE_SIZE
+#error "pool_dma blocks must hold MAX_VALUE_SIZE bytes (Drivers -> Memory arenas)"
+#endif
 #define LEFT -1						/*!< Horizontal grow direction */
 #define RIGHT 1						/*!< Horizontal grow direction */
 #define DOWN 1						/*!< Vertical grow direction */
@@ -235,8 +239,11 @@ void Fill(uint16_t x0, uint16_t y0, uint16_t x1, uint16_t y1, uint16_t color){
 	static uint16_t i;
 	static int32_t bytes_count;
 	static int16_t x_dist, y_dist;
-	static uint8_t pixel[MAX_VALUE_SIZE];
+	uint8_t *pixel = PoolAlloc(&pool_dma);	/* DMA capable, one block per call */
 
+	if (pixel == NULL){
+		return;
+	}
 	x_dist = x1 - x0;
 	y_dist = y1 - y0;
 	if (x0 > x1){
@@ -265,6 +272,7 @@ void Fill(uint16_t x0, uint16_t y0, uint16_t x1, uint16_t y1, uint16_t color){
 	}
 	lcd_cmd_t lcd_pixel = {NULL, bytes_count, pixel};
 	WriteLCD(&lcd_pixel);
+	PoolFree(&pool_dma, pixel);
 }
 
 /*==================[external functions definition]==========================*/
@@ -354,8 +362,11 @@ void ILI9341DrawChar(uint16_t x, uint16_t y, char data, Font_t* font, uint16_t f
 	static uint32_t char_row;
 	static uint16_t lcd_x, lcd_y;
 	static int32_t bytes_count, bytes_row;
-	static uint8_t pixel[MAX_VALUE_SIZE];
+	uint8_t *pixel = PoolAlloc(&pool_dma);	/* DMA capable, one block per call */
 
+	if (pixel == NULL){
+		return;
+	}
 	/* Set coordinates */
 	lcd_x = x;
 	lcd_y = y;
@@ -409,6 +420,7 @@ void ILI9341DrawChar(uint16_t x, uint16_t y, char data, Font_t* font, uint16_t f
 	/* Send the rest of the buffer */
 	lcd_cmd_t lcd_pixels = {NULL, bytes_count, pixel};
 	WriteLCD(&lcd_pixels);
+	PoolFree(&pool_dma, pixel);
 }
 
 void ILI9341DrawIcon(uint16_t x, uint16_t y, icon_t icon, icon_font_t* icon_font, uint16_t foreground, uint16_t background){
@@ -416,8 +428,11 @@ void ILI9341DrawIcon(uint16_t x, uint16_t y, icon_t icon, icon_font_t* icon_font
 	static uint32_t char_row;
 	static uint16_t lcd_x, lcd_y;
 	static int32_t bytes_count, bytes_row;
-	static uint8_t pixel[MAX_VALUE_SIZE];
+	uint8_t *pixel = PoolAlloc(&pool_dma);	/* DMA capable, one block per call */
 
+	if (pixel == NULL){
+		return;
+	}
 	/* Set coordinates */
 	lcd_x = x;
 	lcd_y = y;
@@ -471,6 +486,7 @@ void ILI9341DrawIcon(uint16_t x, uint16_t y, icon_t icon, icon_font_t* icon_font
 	/* Send the rest of the buffer */
 	lcd_cmd_t lcd_pixels = {NULL, bytes_count, pixel};
 	WriteLCD(&lcd_pixels);
+	PoolFree(&pool_dma, pixel);
 }
 
 void ILI9341DrawInt(uint16_t x, uint16_t y, uint32_t num, uint8_t dig, Font_t* font, uint16_t foreground, uint16_t background){
@@ -802,8 +818,11 @@ void ILI9341DrawFilledTriangle(int16_t x0, int16_t y0, int16_t x1, int16_t y1, i
 void ILI9341DrawPicture(uint16_t x, uint16_t y, uint16_t width, uint16_t height, const uint8_t* pic){
 	static uint16_t i, j;
 	static int32_t bytes_count;
-	static uint8_t pixel[MAX_VALUE_SIZE];
+	uint8_t *pixel = PoolAlloc(&pool_dma);	/* DMA capable, one block per call */
 
+	if (pixel == NULL){
+		return;
+	}
 	SetCursorPosition(x, y, x + width - 1, y + height - 1);
 
 	/* Number of bytes to write. We have to write 2 bytes/pixel */
@@ -828,6 +847,7 @@ void ILI9341DrawPicture(uint16_t x, uint16_t y, uint16_t width, uint16_t height,
 	}
 	lcd_cmd_t lcd_pixel = {NULL, bytes_count, pixel};
 	WriteLCD(&lcd_pixel);
+	PoolFree(&pool_dma, pixel);
 }
 
 uint8_t ILI9341DeInit(void){
@@ -11,7 +11,7 @@
 
 /*==================[inclusions]=============================================*/
 #include "l293.h"
-#include "gpio_mcu.h"
+#include "gpio_port_mcu.h"
 #include "pwm_mcu.h"
 /*==================[macros and definitions]=================================*/
 #define MAX_F_SPEED 	100		/*!< Max foward speed  */
@@ -24,6 +24,12 @@
 #define EN_3_4			GPIO_19
 #define A_3				GPIO_18
 #define A_4				GPIO_9
+#define MOTOR_1_MASK	0x03	/*!< Port bits 0..1: 1A, 2A */
+#define MOTOR_2_MASK	0x0C	/*!< Port bits 2..3: 3A, 4A */
+#define MOTOR_1_FWD		0x01	/*!< 1A high, 2A low */
+#define MOTOR_1_BWD		0x02	/*!< 1A low, 2A high */
+#define MOTOR_2_FWD		0x04	/*!< 3A high, 4A low */
+#define MOTOR_2_BWD		0x08	/*!< 3A low, 4A high */
 /*==================[typedef]================================================*/
 
 /*==================[internal data declaration]==============================*/
@@ -31,6 +37,8 @@
 /*==================[internal functions declaration]=========================*/
 
 /*==================[internal data definition]===============================*/
+static const gpio_t direction_pins[] = {A_1, A_2, A_3, A_4};
+static gpio_port_t direction_port;
 
 /*==================[internal functions definition]==========================*/
 
@@ -40,10 +48,7 @@
 uint8_t L293Init(void){
 	PWMInit(PWM_0, EN_1_2, PWM_FREQ);
 	PWMInit(PWM_1, EN_3_4, PWM_FREQ);
-	GPIOInit(A_1, GPIO_OUTPUT);
-	GPIOInit(A_2, GPIO_OUTPUT);
-	GPIOInit(A_3, GPIO_OUTPUT);
-	GPIOInit(A_4, GPIO_OUTPUT);
+	GPIOPortInit(&direction_port, direction_pins, sizeof(direction_pins) / sizeof(direction_pins[0]));
 
 	return 1;
 }
@@ -55,39 +60,33 @@ uint8_t L293SetSpeed(l293_motor_t motor, int8_t speed){
 	case MOTOR_1:
 		if(speed == 0){
 			PWMSetDutyCycle(PWM_0, speed);
-			GPIOOff(A_1);
-			GPIOOff(A_2);
+			GPIOPortClear(&direction_port, MOTOR_1_MASK);
 		}
 		if(speed > 0){
 			if (speed > MAX_F_SPEED) speed = MAX_F_SPEED;
 			PWMSetDutyCycle(PWM_0, speed);
-			GPIOOn(A_1);
-			GPIOOff(A_2);
+			GPIOPortWrite(&direction_port, MOTOR_1_MASK, MOTOR_1_FWD);
 		}
 		if(speed < 0){
 			if (speed < MAX_B_SPEED) speed = MAX_B_SPEED;
 			PWMSetDutyCycle(PWM_0, -speed);
-			GPIOOn(A_1);
-			GPIOOff(A_2);
+			GPIOPortWrite(&direction_port, MOTOR_1_MASK, MOTOR_1_BWD);
 		}
 		break;
 	case MOTOR_2:
 		if(speed == 0){
 			PWMSetDutyCycle(PWM_1, speed);
-			GPIOOff(A_3);
-			GPIOOff(A_4);
+			GPIOPortClear(&direction_port, MOTOR_2_MASK);
 		}
 		if(speed > 0){
 			if (speed > MAX_F_SPEED) speed = MAX_F_SPEED;
 			PWMSetDutyCycle(PWM_1, speed);
-			GPIOOn(A_3);
-			GPIOOff(A_4);
+			GPIOPortWrite(&direction_port, MOTOR_2_MASK, MOTOR_2_FWD);
 		}
 		if(speed < 0){
 			if (speed < MAX_B_SPEED) speed = MAX_B_SPEED;
 			PWMSetDutyCycle(PWM_1, -speed);
-			GPIOOn(A_3);
-			GPIOOff(A_4);
+			GPIOPortWrite(&direction_port, MOTOR_2_MASK, MOTOR_2_BWD);
 		}
 		break;
 	default:
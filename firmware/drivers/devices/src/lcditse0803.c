@@ -11,7 +11,7 @@
 
 /*==================[inclusions]=============================================*/
 #include "lcditse0803.h"
-#include "gpio_mcu.h"
+#include "gpio_port_mcu.h"
 /*==================[macros and definitions]=================================*/
 #define GPIO_BCD_1	GPIO_20
 #define GPIO_BCD_2	GPIO_21
@@ -20,31 +20,38 @@
 #define GPIO_SEL_1	GPIO_19
 #define GPIO_SEL_2	GPIO_18
 #define GPIO_SEL_3	GPIO_9
+#define BCD_MASK	0x0F		/* port bits 0..3: BCD_1..BCD_4 */
+#define SEL_1		(1 << 4)	/* port bit 4: SEL_1 (hundreds) */
+#define SEL_2		(1 << 5)	/* port bit 5: SEL_2 (tens) */
+#define SEL_3		(1 << 6)	/* port bit 6: SEL_3 (units) */
+#define SEL_MASK	(SEL_1 | SEL_2 | SEL_3)
 /*==================[internal data definition]===============================*/
 static uint16_t actual_value = 0; /*variable that saves the value to be shown in the display LCD*/
+static const gpio_t lcd_pins[] = {GPIO_BCD_1, GPIO_BCD_2, GPIO_BCD_3, GPIO_BCD_4,
+								  GPIO_SEL_1, GPIO_SEL_2, GPIO_SEL_3};
+static gpio_port_t lcd_port;
 /*==================[internal functions declaration]=========================*/
 /** @brief Aux function to load a digit to the LCD Display
  *
  */
 bool LcdItsE0803BCDtoPin(uint8_t value){
-	GPIOState(GPIO_BCD_1, (value & (1<<0))>>0);
-	GPIOState(GPIO_BCD_2, (value & (1<<1))>>1);
-	GPIOState(GPIO_BCD_3, (value & (1<<2))>>2);
-	GPIOState(GPIO_BCD_4, (value & (1<<3))>>3);
+	GPIOPortWrite(&lcd_port, BCD_MASK, value);
 	return true;
 }
+
+/** @brief Aux function to load a digit and latch it in one of the displays
+ * 
+ * BCD lines and latch enable are written together (the latch is transparent
+ * while SEL is high and holds the digit on the falling edge).
+ */
+static void LcdItsE0803Digit(uint8_t value, uint8_t sel){
+	GPIOPortWrite(&lcd_port, BCD_MASK | SEL_MASK, (value & BCD_MASK) | sel);
+	GPIOPortClear(&lcd_port, sel);
+}
 /*==================[external functions definition]==========================*/
 bool LcdItsE0803Init(void){
-	/* Configuration of pins of data*/
-	GPIOInit(GPIO_BCD_1, GPIO_OUTPUT);
-	GPIOInit(GPIO_BCD_2, GPIO_OUTPUT);
-	GPIOInit(GPIO_BCD_3, GPIO_OUTPUT);
-	GPIOInit(GPIO_BCD_4, GPIO_OUTPUT);
-
-	/* Configuration of pins of control*/
-	GPIOInit(GPIO_SEL_1, GPIO_OUTPUT);
-	GPIOInit(GPIO_SEL_2, GPIO_OUTPUT);
-	GPIOInit(GPIO_SEL_3, GPIO_OUTPUT);
+	/* Configuration of pins of data and control */
+	GPIOPortInit(&lcd_port, lcd_pins, sizeof(lcd_pins) / sizeof(lcd_pins[0]));
 
 	actual_value=0;
 	LcdItsE0803Write(actual_value);
@@ -61,19 +68,13 @@ bool LcdItsE0803Write(uint16_t value) {
 		units = (value-(hundreds*100)-(tens*10));
 
 		/* Write hundreds */
-		LcdItsE0803BCDtoPin(hundreds);
-		GPIOOn(GPIO_SEL_1);
-		GPIOOff(GPIO_SEL_1);
+		LcdItsE0803Digit(hundreds, SEL_1);
 
 		/* Write tens */
-		LcdItsE0803BCDtoPin(tens);
-		GPIOOn(GPIO_SEL_2);
-		GPIOOff(GPIO_SEL_2);
+		LcdItsE0803Digit(tens, SEL_2);
 
 		/* Write units */
-		LcdItsE0803BCDtoPin(units);
-		GPIOOn(GPIO_SEL_3);
-		GPIOOff(GPIO_SEL_3);
+		LcdItsE0803Digit(units, SEL_3);
 		return true; /* return 1 for values lower than 999 */
 	}
 	else
@@ -85,17 +86,9 @@ uint16_t LcdItsE0803Read(void){
 }
 
 void LcdItsE0803Off(void){
-	LcdItsE0803BCDtoPin(0x0F);
-	GPIOOn(GPIO_SEL_1);
-	GPIOOff(GPIO_SEL_1);
-
-	LcdItsE0803BCDtoPin(0x0F);
-	GPIOOn(GPIO_SEL_2);
-	GPIOOff(GPIO_SEL_2);
-
-	LcdItsE0803BCDtoPin(0x0F);
-	GPIOOn(GPIO_SEL_3);
-	GPIOOff(GPIO_SEL_3);
+	LcdItsE0803Digit(0x0F, SEL_1);
+	LcdItsE0803Digit(0x0F, SEL_2);
+	LcdItsE0803Digit(0x0F, SEL_3);
 }
 
 bool LcdItsE0803DeInit(void){
@@ -11,109 +11,68 @@
 
 /*==================[inclusions]=============================================*/
 #include "led.h"
-#include "gpio_mcu.h"
+#include "gpio_port_mcu.h"
 /*==================[macros and definitions]=================================*/
 #define GPIO_LED1 GPIO_11
 #define GPIO_LED2 GPIO_10
 #define GPIO_LED3 GPIO_5
+#define LEDS_ALL (LED_1 | LED_2 | LED_3)
 /*==================[internal data declaration]==============================*/
 
 /*==================[internal functions declaration]=========================*/
 
 /*==================[internal data definition]===============================*/
-
+/** Port bits follow led_t: b0: LED_3, b1: LED_2, b2: LED_1 */
+static const gpio_t leds_pins[] = {GPIO_LED3, GPIO_LED2, GPIO_LED1};
+static gpio_port_t leds_port;
 /*==================[external data definition]===============================*/
 
 /*==================[internal functions definition]==========================*/
-
+static bool LedIsValid(led_t led){
+	return (led == LED_1) || (led == LED_2) || (led == LED_3);
+}
 /*==================[external functions definition]==========================*/
 
 uint8_t LedsInit(void){
-	/** Configuration of the GPIO */
-	GPIOInit(GPIO_LED1, GPIO_OUTPUT);
-	GPIOInit(GPIO_LED2, GPIO_OUTPUT);
-	GPIOInit(GPIO_LED3, GPIO_OUTPUT);
-
-	/** Turn off leds*/
-	GPIOOff(GPIO_LED1);
-	GPIOOff(GPIO_LED2);
-	GPIOOff(GPIO_LED3);
+	/** Configuration of the GPIO (leds are turned off) */
+	GPIOPortInit(&leds_port, leds_pins, sizeof(leds_pins) / sizeof(leds_pins[0]));
 
 	return true;
 }
 
 /** \brief Function to turn on a specific led */
 uint8_t LedOn(led_t led){
-	uint8_t result = false;
-	switch (led){
-	case LED_1:
-		GPIOOn(GPIO_LED1);
-		result = true;
-		break;
-	case LED_2:
-		GPIOOn(GPIO_LED2);
-		result = true;
-		break;
-	case LED_3:
-		GPIOOn(GPIO_LED3);
-		result = true;
-		break;
+	if(!LedIsValid(led)){
+		return false;
 	}
-	return result;
+	GPIOPortSet(&leds_port, led);
+	return true;
 }
 
 uint8_t LedOff(led_t led){
-	uint8_t result = false;
-	switch (led){
-	case LED_1:
-		GPIOOff(GPIO_LED1);
-		result = true;
-		break;
-	case LED_2:
-		GPIOOff(GPIO_LED2);
-		result = true;
-		break;
-	case LED_3:
-		GPIOOff(GPIO_LED3);
-		result = true;
-		break;
+	if(!LedIsValid(led)){
+		return false;
 	}
-	return result;
+	GPIOPortClear(&leds_port, led);
+	return true;
 }
 
 uint8_t LedToggle(led_t led){
-	uint8_t result = false;
-
-	switch (led){
-	case LED_1:
-		GPIOToggle(GPIO_LED1);
-		result = true;
-		break;
-	case LED_2:
-		GPIOToggle(GPIO_LED2);
-		result = true;
-		break;
-	case LED_3:
-		GPIOToggle(GPIO_LED3);
-		result = true;
-		break;
+	if(!LedIsValid(led)){
+		return false;
 	}
-
-	return result;
+	GPIOPortToggle(&leds_port, led);
+	return true;
 }
 
 uint8_t LedsOffAll(void){
-	GPIOOff(GPIO_LED1);
-	GPIOOff(GPIO_LED2);
-	GPIOOff(GPIO_LED3);
+	GPIOPortClear(&leds_port, LEDS_ALL);
 	
 	return true;
 }
 
 uint8_t LedsMask(uint8_t mask){
-	GPIOState(GPIO_LED1, (mask & LED_1) >> 2);
-	GPIOState(GPIO_LED2, (mask & LED_2) >> 1);
-	GPIOState(GPIO_LED3, (mask & LED_3));
+	GPIOPortWrite(&leds_port, LEDS_ALL, mask);
 	return true;
 }
 
@@ -12,6 +12,7 @@
 /*==================[inclusions]=============================================*/
 #include "switch.h"
 #include "gpio_mcu.h"
+#include "gpio_event_mcu.h"
 /*==================[macros and definitions]=================================*/
 #define GPIO_SWITCH1 GPIO_4
 #define GPIO_SWITCH2 GPIO_15
@@ -54,4 +55,26 @@ void SwitchActivInt(switch_t sw, void *ptr_int_func, void *args){
 		break;
 	}
 }
+
+bool SwitchActivEvent(switch_t sw, void *ptr_event_func, void *args){
+	gpio_event_config_t event_config = {
+		.active_low = true,
+		.debounce_ms = GPIO_EVENT_DEBOUNCE_MS,
+		.long_press_ms = GPIO_EVENT_LONG_PRESS_MS,
+		.double_click_ms = GPIO_EVENT_DOUBLE_CLICK_MS,
+		.func_p = ptr_event_func,
+		.param_p = args,
+	};
+	switch(sw){
+		case SWITCH_1:
+			event_config.pin = GPIO_SWITCH1;
+		break;
+		case SWITCH_2:
+			event_config.pin = GPIO_SWITCH2;
+		break;
+		default:
+			return false;
+	}
+	return GPIOEventSubscribe(&event_config);
+}
 /*==================[end of file]============================================*/
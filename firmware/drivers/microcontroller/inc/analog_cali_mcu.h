@@ -0,0 +1,69 @@
+#ifndef ANALOG_CALI_MCU_H
+#define ANALOG_CALI_MCU_H
+/** \addtogroup Drivers_Programable Drivers Programable
+ ** @{ */
+/** \addtogroup Drivers_Microcontroller Drivers microcontroller
+ ** @{ */
+/** \addtogroup Analog_IO Analog IO
+ ** @{ */
+
+/** \brief ADC calibration table: raw counts to mV by linear interpolation.
+ *
+ * The calibration curve of a channel is sampled every 2^ADC_CALI_SEG_BITS raw
+ * counts into ADC_CALI_TABLE_POINTS points (in mV), so a conversion is one
+ * table segment lookup and an integer interpolation instead of a call to the
+ * calibration scheme. Used by analog_io_mcu.c, header only so it can be
+ * benchmarked on the host.
+ *
+ * @section changelog
+ *
+ * |   Date	    | Description                                    						|
+ * |:----------:|:----------------------------------------------------------------------|
+ * | 19/10/2026 | Document creation		                         						|
+ *
+ **/
+
+/*==================[inclusions]=============================================*/
+#include <stdint.h>
+#include "analog_io_mcu.h"
+/*==================[macros]=================================================*/
+#define ADC_CALI_SEG_BITS	7		/*!< log2(raw counts per table segment) */
+#define ADC_CALI_RAW_MAX	4095	/*!< Max raw value (12 bit) */
+/*==================[typedef]================================================*/
+
+/*==================[external data declaration]==============================*/
+
+/*==================[external functions declaration]=========================*/
+/**
+ * @brief Raw count of a calibration table point
+ *
+ * @param point Table point (0 to ADC_CALI_TABLE_POINTS - 1)
+ * @return int Raw count where the calibration curve is sampled
+ */
+static inline int AnalogCaliTableRaw(uint8_t point){
+	int raw = point << ADC_CALI_SEG_BITS;
+
+	return (raw > ADC_CALI_RAW_MAX) ? ADC_CALI_RAW_MAX : raw;
+}
+
+/**
+ * @brief Convert a raw count to mV
+ *
+ * @param table Calibration table of the channel (ADC_CALI_TABLE_POINTS points)
+ * @param raw Raw count (up to ADC_CALI_RAW_MAX)
+ * @return uint16_t Value in mV
+ */
+static inline uint16_t AnalogCaliTableRead(const uint16_t *table, uint16_t raw){
+	uint16_t seg = raw >> ADC_CALI_SEG_BITS;
+	uint16_t frac = raw & ((1 << ADC_CALI_SEG_BITS) - 1);
+	int32_t delta = (int32_t)table[seg + 1] - table[seg];
+
+	return table[seg] + ((delta * frac + (1 << (ADC_CALI_SEG_BITS - 1))) >> ADC_CALI_SEG_BITS);
+}
+
+/** @} doxygen end group definition */
+/** @} doxygen end group definition */
+/** @} doxygen end group definition */
+#endif /* ANALOG_CALI_MCU_H */
+
+/*==================[end of file]============================================*/
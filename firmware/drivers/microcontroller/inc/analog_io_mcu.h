@@ -14,6 +14,11 @@
  * @note The ESP-EDU have 4 analog inputs and 1 analog output, but the designated pin for 
  * the latter is shared with analog output 0 (CH0).
  *
+ * Single reads return raw counts (0 to 4095). AnalogInputInit() samples the
+ * calibration curve of each channel once into a small table, so AnalogRawToMv()
+ * converts whole buffers to mV with integer interpolation instead of calling
+ * the calibration scheme per sample.
+ *
  * @author Albano Peñalva
  *
  * @section changelog
@@ -21,6 +26,7 @@
  * |   Date	    | Description                                    						|
  * |:----------:|:----------------------------------------------------------------------|
  * | 24/02/2024 | Document creation		                         						|
+ * | 19/10/2026 | Channel scan and table based raw to mV conversion						|
  * 
  **/
 
@@ -40,6 +46,8 @@ typedef enum adc_mode {
 } adc_mode_t;
 
 #define DAC	0    			/*!< DAC pin. Override CH0 declaration*/
+#define ADC_CH_QTY	4		/*!< Number of analog inputs */
+#define ADC_CALI_TABLE_POINTS	33	/*!< Calibration table points per channel (one every 128 raw counts) */
 /*==================[typedef]================================================*/
 /**
  * @brief Analog inputs config structure
@@ -75,11 +83,40 @@ void AnalogOutputInit(void);
  * @brief Read single channel.
  * 
  * @param channel Channel selected
- * @param value Read variable pointer (in mV)
+ * @param value Read variable pointer (raw counts, see AnalogRawToMv)
  * @return null
  */
 void AnalogInputReadSingle(adc_ch_t channel, uint16_t *value);
 
+/**
+ * @brief Read a list of channels (single read mode).
+ * 
+ * @param channels Channels to read (each one initialized with AnalogInputInit)
+ * @param qty Number of channels
+ * @param values Read values array, values[i] is channels[i] (raw counts)
+ */
+void AnalogInputScan(const adc_ch_t *channels, uint8_t qty, uint16_t *values);
+
+/**
+ * @brief Convert a buffer of raw counts of one channel to mV using its
+ * calibration table.
+ * 
+ * @param channel Channel the samples were read from
+ * @param raw Raw counts
+ * @param mv Converted values (in mV). Can be the same buffer as raw
+ * @param len Number of samples
+ */
+void AnalogRawToMv(adc_ch_t channel, const uint16_t *raw, uint16_t *mv, uint16_t len);
+
+/**
+ * @brief Convert in place the values returned by AnalogInputScan() to mV.
+ * 
+ * @param channels Channels list used for the scan
+ * @param qty Number of channels
+ * @param values Raw counts in, mV out
+ */
+void AnalogScanToMv(const adc_ch_t *channels, uint8_t qty, uint16_t *values);
+
 /**
  * @brief Start convertion for ADC module in continuous mode
  * 
@@ -0,0 +1,193 @@
+#ifndef ARENA_MCU_H
+#define ARENA_MCU_H
+/** \addtogroup Drivers_Programable Drivers Programable
+ ** @{ */
+/** \addtogroup Drivers_Microcontroller Drivers microcontroller
+ ** @{ */
+/** \addtogroup ARENA Arena
+ ** @{ */
+
+/** \brief Static arenas and fixed block pools for driver and middleware
+ * buffers.
+ *
+ * - Arena (arena_t): bump allocator over one block of memory. Allocation is a
+ *   pointer increment; memory is given back by resetting the arena to a mark
+ *   taken before (ArenaMark() / ArenaReset()), so transient buffers are
+ *   released in scopes instead of freed one by one.
+ * - Pool (pool_t): fixed size blocks with a free list. PoolAlloc() and
+ *   PoolFree() take constant time and can be called from ISRs.
+ *
+ * The memory of an arena or a pool is taken from the heap the first time it is
+ * used, in a single allocation that is never freed: it doesn't fragment the
+ * heap, and a subsystem that is never used doesn't take memory. DMA capable
+ * arenas and pools (ARENA_DMA) are taken from internal DMA capable memory.
+ *
+ * System arenas and pools, sized through menuconfig (Drivers -> Memory arenas):
+ * - arena_dsp: long lived signal processing buffers (FFT plans).
+ * - arena_scratch: transient buffers, reset at the end of each call (FFT work
+ *   buffers). Used by one task at a time.
+ * - pool_dma: DMA capable blocks for SPI and ADC transfers (ILI9341 pixels).
+ *
+ * Every arena and pool keeps its high-water mark and the number of failed
+ * allocations; MemoryPrint() prints the ones in use.
+ *
+ * @code
+ * uint32_t mark = ArenaMark(&arena_scratch);
+ * float *work = ArenaAlloc(&arena_scratch, 2 * n * sizeof(float));
+ * ...
+ * ArenaReset(&arena_scratch, mark);
+ * @endcode
+ *
+ * @note The first allocation of an arena or a pool must be done from a task.
+ *
+ * @section changelog
+ *
+ * |   Date	    | Description                                    						|
+ * |:----------:|:----------------------------------------------------------------------|
+ * | 19/10/2026 | Document creation		                         						|
+ *
+ **/
+
+/*==================[inclusions]=============================================*/
+#include <stdbool.h>
+#include <stdint.h>
+#ifndef MCU_HOST
+#include "sdkconfig.h"
+#endif
+/*==================[macros]=================================================*/
+#define ARENA_ALIGN			8		/*!< Alignment of the arena allocations (bytes) */
+#define ARENA_DMA			true	/*!< Memory must be DMA capable */
+
+#ifndef CONFIG_MCU_ARENA_DSP_SIZE
+#define CONFIG_MCU_ARENA_DSP_SIZE		16384	/*!< arena_dsp size (menuconfig) */
+#endif
+#ifndef CONFIG_MCU_ARENA_SCRATCH_SIZE
+#define CONFIG_MCU_ARENA_SCRATCH_SIZE	24576	/*!< arena_scratch size (menuconfig) */
+#endif
+#ifndef CONFIG_MCU_POOL_DMA_BLOCK_SIZE
+#define CONFIG_MCU_POOL_DMA_BLOCK_SIZE	256		/*!< pool_dma block size (menuconfig) */
+#endif
+#ifndef CONFIG_MCU_POOL_DMA_BLOCKS
+#define CONFIG_MCU_POOL_DMA_BLOCKS		4		/*!< pool_dma blocks (menuconfig) */
+#endif
+
+/** @brief Static initializer of an arena */
+#define ARENA_INITIALIZER(arena_name, arena_size, arena_dma)	\
+	{.name = (arena_name), .size = (arena_size), .dma = (arena_dma)}
+
+/** @brief Static initializer of a pool */
+#define POOL_INITIALIZER(pool_name, pool_block_size, pool_blocks, pool_dma)	\
+	{.name = (pool_name), .block_size = (pool_block_size), .blocks = (pool_blocks), .dma = (pool_dma)}
+/*==================[typedef]================================================*/
+/**
+ * @brief Arena
+ */
+typedef struct arena_s {
+	const char *name;			/*!< Name (MemoryPrint()) */
+	uint32_t size;				/*!< Size (bytes) */
+	bool dma;					/*!< DMA capable memory */
+	uint8_t *base;				/*!< Memory (NULL until the first allocation) */
+	uint32_t used;				/*!< Bytes allocated */
+	uint32_t peak;				/*!< High-water mark (bytes) */
+	uint32_t fails;				/*!< Failed allocations */
+	struct arena_s *next;		/*!< Next arena in use */
+} arena_t;
+
+/**
+ * @brief Pool of fixed size blocks
+ */
+typedef struct pool_s {
+	const char *name;			/*!< Name (MemoryPrint()) */
+	uint32_t block_size;		/*!< Block size (bytes, rounded up to ARENA_ALIGN) */
+	uint32_t blocks;			/*!< Number of blocks */
+	bool dma;					/*!< DMA capable memory */
+	uint8_t *base;				/*!< Memory (NULL until the first allocation) */
+	void *free_list;			/*!< First free block */
+	uint32_t used;				/*!< Blocks allocated */
+	uint32_t peak;				/*!< High-water mark (blocks) */
+	uint32_t fails;				/*!< Failed allocations */
+	struct pool_s *next;		/*!< Next pool in use */
+} pool_t;
+/*==================[external data declaration]==============================*/
+extern arena_t arena_dsp;		/*!< Long lived signal processing buffers */
+extern arena_t arena_scratch;	/*!< Transient buffers (scope reset) */
+extern pool_t pool_dma;			/*!< DMA capable transfer buffers */
+/*==================[external functions declaration]=========================*/
+/**
+ * @brief Initialize an arena over memory provided by the caller
+ *
+ * @param arena Arena
+ * @param name Name
+ * @param memory Memory (ARENA_ALIGN aligned), NULL: taken from the heap on the
+ * first allocation
+ * @param size Size (bytes)
+ * @param dma DMA capable memory (only for memory taken from the heap)
+ */
+void ArenaInit(arena_t *arena, const char *name, void *memory, uint32_t size, bool dma);
+
+/**
+ * @brief Allocate from an arena (ARENA_ALIGN aligned)
+ *
+ * @param arena Arena
+ * @param size Bytes
+ * @return void* Memory, NULL if the arena is full
+ */
+void* ArenaAlloc(arena_t *arena, uint32_t size);
+
+/**
+ * @brief Current position of an arena, to release what is allocated after it
+ *
+ * @param arena Arena
+ * @return uint32_t Mark for ArenaReset()
+ */
+uint32_t ArenaMark(const arena_t *arena);
+
+/**
+ * @brief Release everything allocated after a mark
+ *
+ * @param arena Arena
+ * @param mark Mark returned by ArenaMark() (0: release everything)
+ */
+void ArenaReset(arena_t *arena, uint32_t mark);
+
+/**
+ * @brief Initialize a pool over memory provided by the caller
+ *
+ * @param pool Pool
+ * @param name Name
+ * @param memory Memory (blocks * block size, ARENA_ALIGN aligned), NULL: taken
+ * from the heap on the first allocation
+ * @param block_size Block size (bytes)
+ * @param blocks Number of blocks
+ * @param dma DMA capable memory (only for memory taken from the heap)
+ */
+void PoolInit(pool_t *pool, const char *name, void *memory, uint32_t block_size, uint32_t blocks, bool dma);
+
+/**
+ * @brief Allocate a block (ISR safe once the pool is in use)
+ *
+ * @param pool Pool
+ * @return void* Block, NULL if there are no free blocks
+ */
+void* PoolAlloc(pool_t *pool);
+
+/**
+ * @brief Free a block (ISR safe)
+ *
+ * @param pool Pool
+ * @param block Block returned by PoolAlloc() (NULL: nothing is done)
+ */
+void PoolFree(pool_t *pool, void *block);
+
+/**
+ * @brief Print size, usage and high-water mark of the arenas and pools in use
+ * (printf)
+ */
+void MemoryPrint(void);
+
+/** @} doxygen end group definition */
+/** @} doxygen end group definition */
+/** @} doxygen end group definition */
+#endif /* ARENA_MCU_H */
+
+/*==================[end of file]============================================*/
@@ -0,0 +1,314 @@
+#ifndef EVENT_LOOP_MCU_H
+#define EVENT_LOOP_MCU_H
+/** \addtogroup Drivers_Programable Drivers Programable
+ ** @{ */
+/** \addtogroup Drivers_Microcontroller Drivers microcontroller
+ ** @{ */
+/** \addtogroup EVENT_LOOP Event loop
+ ** @{ */
+
+/** \brief Cooperative event loop: the periodic jobs of an application run as
+ * handlers of one task, on one stack.
+ *
+ * Instead of one task per job (each one with its stack, its TCB and a context
+ * switch per activation), every job is a handler of the loop: a function
+ * called with the event that woke it up, that runs to completion and returns.
+ * Handlers are woken up by:
+ * - Their periodic timer (period_us) or a one-shot sleep (EventLoopSleep()),
+ *   kept by the loop itself: one esp_timer is armed at the next expiry.
+ * - Events posted to the loop queue from ISRs, driver callbacks and tasks:
+ *   EventLoopPost(), EventLoopCallback() (for the func_p / param_p callbacks
+ *   of the drivers: timers, UART reception, GPIO interrupts) and GPIO events
+ *   (EventLoopSubscribeGPIO(), gpio_event_mcu.h).
+ *
+ * The queue is a lock-free multiple producer ring buffer (ring_buffer_mcu.h).
+ * When several handlers are ready, the one with the earliest deadline runs
+ * first: the time it became ready (timer expiry or post time) plus its
+ * deadline_us. With deadline_us = 0 they run in the order they became ready.
+ *
+ * A handler that has to wait in the middle of its job (e.g. for an echo
+ * pulse, a conversion or a transfer) is written as a stackless coroutine
+ * (protothread): EVENT_LOOP_BEGIN() / EVENT_LOOP_END() around its body and
+ * EVENT_LOOP_SLEEP_US() / EVENT_LOOP_WAIT_UNTIL() where it waits. The
+ * handler returns at each wait and the next event resumes it after the wait,
+ * so the other handlers run meanwhile instead of a busy-wait:
+ *
+ * @code
+ * static void Measure(event_loop_handler_t *h, const event_loop_event_t *event){
+ *     EVENT_LOOP_BEGIN(h);
+ *     GPIOOn(TRIGGER);
+ *     EVENT_LOOP_SLEEP_US(h, 10);
+ *     GPIOOff(TRIGGER);
+ *     EVENT_LOOP_WAIT_UNTIL(h, GPIORead(ECHO));   // checked on each event
+ *     ...
+ *     EVENT_LOOP_END(h);
+ * }
+ * @endcode
+ *
+ * @note Local variables of a coroutine are lost at each wait: keep the state
+ * in static variables or in the handler parameter. A coroutine can't wait
+ * inside a switch statement.
+ *
+ * Every handler keeps statistics (runs, run time, wake up latency, overruns
+ * and deadline misses) and the loop counts the dropped events and the queue
+ * high-water mark. EventLoopPrint() prints them.
+ *
+ * @note GPIO events are debounced by the dispatcher task of gpio_event_mcu.h,
+ * that posts them to the loop.
+ *
+ * @note In host builds (MCU_HOST) there is no loop task: the program calls
+ * EventLoopRunUs(), which runs the loop for a while of the virtual clock.
+ *
+ * @section changelog
+ *
+ * |   Date	    | Description                                    						|
+ * |:----------:|:----------------------------------------------------------------------|
+ * | 19/10/2026 | Document creation		                         						|
+ *
+ **/
+
+/*==================[inclusions]=============================================*/
+#include <stdbool.h>
+#include <stdint.h>
+#include "ring_buffer_mcu.h"
+#include "gpio_event_mcu.h"
+/*==================[macros]=================================================*/
+#define EVENT_LOOP_MAX_HANDLERS		8		/*!< Max handlers of a loop */
+#ifndef EVENT_LOOP_QUEUE_SIZE
+#define EVENT_LOOP_QUEUE_SIZE		8		/*!< Posted events queue size (power of two) */
+#endif
+#define EVENT_LOOP_TASK_STACK		2048	/*!< Default loop task stack size (bytes) */
+#define EVENT_LOOP_TASK_PRIORITY	5		/*!< Default loop task priority */
+
+#define EVENT_LOOP_GPIO_DATA(pin, type)	(((uint32_t)(pin) << 8) | (type))	/*!< Data of an EVENT_LOOP_GPIO event */
+#define EVENT_LOOP_GPIO_PIN(data)		((gpio_t)((data) >> 8))				/*!< GPIO of an EVENT_LOOP_GPIO event */
+#define EVENT_LOOP_GPIO_TYPE(data)		((gpio_event_type_t)((data) & 0xFF))	/*!< gpio_event_type_t of an EVENT_LOOP_GPIO event */
+
+/**
+ * @brief Start of the body of a coroutine handler
+ */
+#define EVENT_LOOP_BEGIN(h)			switch((h)->pt){ case 0:
+
+/**
+ * @brief End of the body of a coroutine handler: the next event starts it
+ * again from EVENT_LOOP_BEGIN()
+ */
+#define EVENT_LOOP_END(h)			} (h)->pt = 0
+
+/**
+ * @brief Return, the next event of the handler resumes it here
+ */
+#define EVENT_LOOP_YIELD(h)			do{ (h)->pt = __LINE__; return; case __LINE__:; } while(0)
+
+/**
+ * @brief Wait until cond is true (cond is checked now and on each event of
+ * the handler, it can use the event)
+ */
+#define EVENT_LOOP_WAIT_UNTIL(h, cond)	do{ (h)->pt = __LINE__; __attribute__((fallthrough)); case __LINE__: if(!(cond)) return; } while(0)
+
+/**
+ * @brief Wait us microseconds (the other handlers run meanwhile)
+ */
+#define EVENT_LOOP_SLEEP_US(h, us)	do{ EventLoopSleep((h), (us)); EVENT_LOOP_WAIT_UNTIL((h), !(h)->sleeping); } while(0)
+/*==================[typedef]================================================*/
+/**
+ * @brief Event types
+ */
+typedef enum {
+	EVENT_LOOP_TIMER = 0,	/*!< Periodic timer of the handler expired */
+	EVENT_LOOP_WAKE,		/*!< EventLoopSleep() time expired */
+	EVENT_LOOP_GPIO,		/*!< GPIO event (data: EVENT_LOOP_GPIO_DATA()) */
+	EVENT_LOOP_DRIVER,		/*!< Driver callback (EventLoopCallback()) */
+	EVENT_LOOP_USER			/*!< Application event (EventLoopPost()) */
+} event_loop_type_t;
+
+/**
+ * @brief Event
+ */
+typedef struct {
+	event_loop_type_t type;		/*!< Type */
+	uint32_t data;				/*!< Data (meaning depends on the type) */
+	uint32_t time;				/*!< Time it was posted or expired (us) */
+} event_loop_event_t;
+
+/**
+ * @brief Handler statistics
+ */
+typedef struct {
+	uint32_t runs;			/*!< Calls to the handler */
+	uint32_t overruns;		/*!< Periods skipped: the timer expired again before the handler ran */
+	uint32_t misses;		/*!< Runs that ended after their deadline (deadline_us != 0) */
+	uint32_t latency_max;	/*!< Max time from ready to run (us) */
+	uint64_t latency;		/*!< Total time from ready to run (us) */
+	uint32_t time_max;		/*!< Max run time (us) */
+	uint64_t time;			/*!< Total run time (us) */
+} event_loop_stats_t;
+
+typedef struct event_loop_s event_loop_t;
+typedef struct event_loop_handler_s event_loop_handler_t;
+
+/**
+ * @brief Handler function
+ *
+ * @param handler Handler
+ * @param event Event that woke it up
+ */
+typedef void (*event_loop_func_t)(event_loop_handler_t *handler, const event_loop_event_t *event);
+
+/**
+ * @brief Handler
+ */
+struct event_loop_handler_s {
+	const char *name;			/*!< Name (statistics) */
+	event_loop_func_t func;		/*!< Handler function */
+	void *param;				/*!< Handler parameter */
+	uint32_t period_us;			/*!< Timer period (0: no periodic timer) */
+	uint32_t deadline_us;		/*!< Relative deadline (0: order of arrival, deadlines not checked) */
+	/* Set by the loop */
+	event_loop_t *loop;			/*!< Loop of the handler */
+	uint16_t pt;				/*!< Coroutine resume point (EVENT_LOOP_BEGIN()) */
+	bool sleeping;				/*!< EventLoopSleep() pending */
+	uint32_t next;				/*!< Next periodic expiry (us) */
+	uint32_t wake;				/*!< EventLoopSleep() expiry (us) */
+	event_loop_stats_t stats;	/*!< Statistics */
+};
+
+/**
+ * @brief Posted event, in the queue
+ */
+typedef struct {
+	event_loop_handler_t *handler;	/*!< Destination */
+	event_loop_event_t event;		/*!< Event */
+} event_loop_item_t;
+
+/**
+ * @brief Event loop
+ */
+struct event_loop_s {
+	event_loop_handler_t *handlers[EVENT_LOOP_MAX_HANDLERS];	/*!< Handlers */
+	uint8_t qty;				/*!< Number of handlers */
+	ring_buffer_mp_t queue;		/*!< Posted events (ISRs, callbacks and tasks) */
+	event_loop_item_t storage[EVENT_LOOP_QUEUE_SIZE];	/*!< Queue storage */
+	uint32_t seq[EVENT_LOOP_QUEUE_SIZE];				/*!< Queue sequence numbers */
+	event_loop_item_t ready[EVENT_LOOP_QUEUE_SIZE];		/*!< Events taken from the queue, not run yet */
+	uint8_t ready_qty;			/*!< Number of ready events */
+	volatile uint32_t dropped;	/*!< Events dropped (queue full) */
+	uint32_t depth_max;			/*!< Max posted events waiting */
+	void *task;					/*!< Loop task (TaskHandle_t) */
+	void *timer;				/*!< Timer of the next expiry (esp_timer_handle_t) */
+};
+/*==================[external data declaration]==============================*/
+
+/*==================[external functions declaration]=========================*/
+/**
+ * @brief Time base of the loop
+ *
+ * @return uint32_t Time (us, host backend: virtual clock)
+ */
+uint32_t EventLoopTimeUs(void);
+
+/**
+ * @brief Initialize an empty loop
+ *
+ * @param loop Loop
+ */
+void EventLoopInit(event_loop_t *loop);
+
+/**
+ * @brief Add a handler. Its periodic timer (if any) expires one period later.
+ *
+ * @param loop Loop
+ * @param handler Handler, with name, func, param, period_us and deadline_us set
+ * @return true: OK, false: too many handlers
+ */
+bool EventLoopAdd(event_loop_t *loop, event_loop_handler_t *handler);
+
+/**
+ * @brief Post an event to a handler (ISR or task)
+ *
+ * @param handler Handler (added to a loop)
+ * @param type Event type
+ * @param data Event data
+ * @return true: OK, false: queue full, event dropped
+ */
+bool EventLoopPost(event_loop_handler_t *handler, event_loop_type_t type, uint32_t data);
+
+/**
+ * @brief Driver callback that posts an EVENT_LOOP_DRIVER event (ISR or task),
+ * e.g. timer_config_t or serial_config_t func_p, with the handler as param_p
+ *
+ * @param handler Handler (event_loop_handler_t *)
+ */
+void EventLoopCallback(void *handler);
+
+/**
+ * @brief Subscribe a handler to the events of a GPIO (gpio_event_mcu.h): they
+ * are posted as EVENT_LOOP_GPIO events
+ *
+ * @param handler Handler (added to a loop)
+ * @param config Subscription (func_p and param_p are set by this function)
+ * @return true: OK, false: no free subscriptions
+ */
+bool EventLoopSubscribeGPIO(event_loop_handler_t *handler, gpio_event_config_t *config);
+
+/**
+ * @brief Wake up a handler with an EVENT_LOOP_WAKE event after a while
+ * (coroutines: EVENT_LOOP_SLEEP_US())
+ *
+ * @param handler Handler
+ * @param us Time (us)
+ */
+void EventLoopSleep(event_loop_handler_t *handler, uint32_t us);
+
+/**
+ * @brief Run the ready handlers, earliest deadline first, until none is ready
+ *
+ * @param loop Loop
+ * @return uint32_t Number of handler runs
+ */
+uint32_t EventLoopRun(event_loop_t *loop);
+
+/**
+ * @brief Time to the next timer expiry
+ *
+ * @param loop Loop
+ * @param us Time to the next expiry (us, 0: expired)
+ * @return true: OK, false: no timers armed
+ */
+bool EventLoopNextTimer(const event_loop_t *loop, uint32_t *us);
+
+#ifdef MCU_HOST
+/**
+ * @brief Run the loop for a while of the virtual clock: the loop waits for
+ * its timers and posted events in HostWaitNs()
+ *
+ * @param loop Loop
+ * @param us Time (us)
+ * @return uint32_t Number of handler runs
+ */
+uint32_t EventLoopRunUs(event_loop_t *loop, uint32_t us);
+#else
+/**
+ * @brief Create the loop task and its timer
+ *
+ * @param loop Loop
+ * @param stack Stack size (bytes, EVENT_LOOP_TASK_STACK)
+ * @param priority Task priority (EVENT_LOOP_TASK_PRIORITY)
+ * @return true: OK, false: task or timer not created
+ */
+bool EventLoopStart(event_loop_t *loop, uint32_t stack, uint8_t priority);
+#endif
+
+/**
+ * @brief Print the statistics of every handler and of the queue (printf)
+ *
+ * @param loop Loop
+ */
+void EventLoopPrint(const event_loop_t *loop);
+
+/** @} doxygen end group definition */
+/** @} doxygen end group definition */
+/** @} doxygen end group definition */
+#endif /* EVENT_LOOP_MCU_H */
+
+/*==================[end of file]============================================*/
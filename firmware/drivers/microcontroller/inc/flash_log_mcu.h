@@ -0,0 +1,283 @@
+#ifndef FLASH_LOG_MCU_H
+#define FLASH_LOG_MCU_H
+/** \addtogroup Drivers_Programable Drivers Programable
+ ** @{ */
+/** \addtogroup Drivers_Microcontroller Drivers microcontroller
+ ** @{ */
+/** \addtogroup FLASH_LOG Flash log
+ ** @{ */
+
+/** \brief Append-only binary data logger on a flash partition.
+ *
+ * Records (a type, a payload of up to FLASH_LOG_MAX_PAYLOAD bytes, a sequence
+ * number, a microsecond time stamp and a CRC-32) are appended to a dedicated
+ * data partition:
+ *
+ * - Producers (tasks or ISRs) call FlashLogWrite(): the record is copied to a
+ *   RAM ring buffer and time stamped. Nothing is written to flash here.
+ * - A background task (FlashLogStart()) moves the records from the ring to
+ *   flash, in whole pages (FLASH_LOG_PAGE_SIZE). When the producers are
+ *   idle for FLASH_LOG_FLUSH_MS the partial page is written too.
+ * - The partition is used as a circular log of sectors. Each sector starts
+ *   with a header (sequence number, erase count, first record number, CRC),
+ *   so the sectors are erased in turn (even wear) and the log survives resets:
+ *   FlashLogInit() finds the last sector and the end of the log. A record
+ *   cut by a reset fails its CRC and is skipped.
+ * - When the partition is full the oldest sector is erased (wrap = true) or
+ *   new records are dropped (wrap = false).
+ *
+ * Readback is zero-copy: the partition is memory mapped (esp_partition_mmap())
+ * and FlashLogFirst() / FlashLogNext() return pointers to the records in
+ * flash. FlashLogExport() streams the used sectors, oldest first, as raw
+ * blocks (FlashLogExportUart() over UART; for BLE pass a function that calls
+ * BleSendBuffer()). drivers/tools/flash_log_decode.py converts the stream to
+ * CSV.
+ *
+ * The partition is declared in the partitions.csv of the project, e.g.:
+ * @code
+ * # Name,   Type, SubType, Offset,  Size
+ * datalog,  data, 0x40,    ,        1M
+ * @endcode
+ *
+ * Throughput: a 1 kHz, 6 channel IMU (12 byte payload, 28 byte records) logs
+ * 28 KB/s, one sector erase every ~150 ms. The RAM ring holds the records
+ * produced while a sector is erased (~45 ms).
+ *
+ * @note While flash is erased or written the cache is disabled: ISRs that
+ * must run meanwhile have to be in IRAM (or enable flash auto suspend).
+ *
+ * @note In host builds (MCU_HOST) the partition is a file
+ * (HostFlashPartition()) and there is no background task: the program calls
+ * FlashLogRun() and FlashLogFlush().
+ *
+ * @section changelog
+ *
+ * |   Date	    | Description                                    						|
+ * |:----------:|:----------------------------------------------------------------------|
+ * | 19/10/2026 | Document creation		                         						|
+ *
+ **/
+
+/*==================[inclusions]=============================================*/
+#include <stdbool.h>
+#include <stdint.h>
+#include "uart_mcu.h"
+#include "ring_buffer_mcu.h"
+/*==================[macros]=================================================*/
+#ifndef FLASH_LOG_RING_SIZE
+#define FLASH_LOG_RING_SIZE		4096	/*!< RAM ring buffer (bytes, power of two) */
+#endif
+#define FLASH_LOG_SECTOR_SIZE	4096	/*!< Flash erase unit (bytes) */
+#define FLASH_LOG_PAGE_SIZE		256		/*!< Flash write unit (bytes) */
+#define FLASH_LOG_MAX_PAYLOAD	236		/*!< Max payload of a record (bytes) */
+#define FLASH_LOG_FLUSH_MS		500		/*!< Idle time before the partial page is written */
+#define FLASH_LOG_MAGIC			0x474F4C46	/*!< "FLOG": sector header and export stream */
+#define FLASH_LOG_VERSION		1		/*!< Record format version */
+
+/** @brief Payload of a record */
+#define FLASH_LOG_PAYLOAD(record)	((const uint8_t *)(record) + sizeof(flash_log_record_t))
+/*==================[typedef]================================================*/
+/**
+ * @brief Record header in flash, followed by the payload and the CRC-32 of
+ * header and payload. Records are 4 byte aligned.
+ */
+typedef struct {
+	uint16_t len;				/*!< Payload bytes (0xFFFF: end of the sector) */
+	uint16_t type;				/*!< Record type (application defined) */
+	uint32_t seq;				/*!< Sequence number */
+	uint32_t time;				/*!< Time stamp (us) */
+} flash_log_record_t;
+
+/**
+ * @brief Sector header
+ */
+typedef struct {
+	uint32_t magic;				/*!< FLASH_LOG_MAGIC */
+	uint32_t seq;				/*!< Sector sequence number (increases with each sector opened) */
+	uint32_t erase_count;		/*!< Times the sector was erased */
+	uint32_t first;				/*!< Sequence number of the first record */
+	uint32_t crc;				/*!< CRC-32 of the previous fields */
+} flash_log_sector_t;
+
+/**
+ * @brief Export stream header, followed by the used part of each sector
+ * (uint32_t length and the bytes, starting with the sector header), oldest
+ * first
+ */
+typedef struct {
+	uint32_t magic;				/*!< FLASH_LOG_MAGIC */
+	uint16_t version;			/*!< FLASH_LOG_VERSION */
+	uint16_t sector_size;		/*!< FLASH_LOG_SECTOR_SIZE */
+	uint32_t sectors;			/*!< Sectors in the stream */
+	uint32_t first;				/*!< Sequence number of the first record */
+	uint32_t next;				/*!< Sequence number of the next record to be logged */
+} flash_log_export_t;
+
+/**
+ * @brief Read cursor
+ */
+typedef struct {
+	uint32_t sector;			/*!< Current sector */
+	uint32_t offset;			/*!< Offset of the next record in the sector */
+	uint32_t left;				/*!< Sectors left after the current one */
+} flash_log_cursor_t;
+
+/**
+ * @brief Export output function
+ *
+ * @param data Bytes
+ * @param len Number of bytes
+ * @param param Parameter
+ */
+typedef void (*flash_log_send_t)(const uint8_t *data, uint32_t len, void *param);
+
+/**
+ * @brief Flash log
+ */
+typedef struct {
+	const void *partition;		/*!< Partition (esp_partition_t) */
+	const uint8_t *map;			/*!< Read-only mapping of the partition */
+	uint32_t map_handle;		/*!< Mapping handle (esp_partition_mmap_handle_t) */
+	uint32_t sectors;			/*!< Sectors in the partition */
+	bool wrap;					/*!< Full: erase the oldest sector (true) or drop (false) */
+	/* Write position */
+	uint32_t head;				/*!< Sector being written */
+	uint32_t oldest;			/*!< Oldest sector */
+	uint32_t offset;			/*!< End of the log in the head sector */
+	uint32_t sector_seq;		/*!< Sequence number of the head sector */
+	uint32_t seq;				/*!< Sequence number of the next record */
+	bool full;					/*!< Partition full (wrap = false) */
+	/* RAM ring and page buffer */
+	ring_buffer_t ring;			/*!< Records waiting to be written */
+	uint8_t ring_data[FLASH_LOG_RING_SIZE];	/*!< Ring storage */
+	flash_log_record_t entry;	/*!< Header of the record being moved */
+	bool entry_ready;			/*!< entry read from the ring */
+	uint8_t buffer[2 * FLASH_LOG_PAGE_SIZE] __attribute__((aligned(4)));	/*!< Records not written yet */
+	uint32_t pending;			/*!< Bytes in buffer (they end at offset) */
+	void *task;					/*!< Background task (TaskHandle_t) */
+	/* Statistics */
+	uint32_t records;			/*!< Records written since FlashLogInit() */
+	uint32_t dropped;			/*!< Records dropped (ring or partition full) */
+	uint32_t bad;				/*!< Records with a wrong CRC found */
+	uint32_t erases;			/*!< Sectors erased since FlashLogInit() */
+	uint32_t errors;			/*!< Flash erase or write errors */
+	uint32_t ring_max;			/*!< Max bytes waiting in the ring */
+} flash_log_t;
+/*==================[external data declaration]==============================*/
+
+/*==================[external functions declaration]=========================*/
+/**
+ * @brief Open the log of a data partition, continuing after its last record
+ *
+ * @param log Log
+ * @param label Partition label (host: HostFlashPartition())
+ * @param wrap true: when full erase the oldest sector, false: drop new records
+ * @return true: OK, false: partition not found, too small or not mapped
+ */
+bool FlashLogInit(flash_log_t *log, const char *label, bool wrap);
+
+/**
+ * @brief Append a record (task or ISR, one producer at a time)
+ *
+ * @param log Log
+ * @param type Record type
+ * @param data Payload
+ * @param len Payload bytes (up to FLASH_LOG_MAX_PAYLOAD)
+ * @return true: OK, false: dropped (ring full or invalid length)
+ */
+bool FlashLogWrite(flash_log_t *log, uint16_t type, const void *data, uint16_t len);
+
+/**
+ * @brief Move the records in the ring to flash (whole pages)
+ *
+ * @param log Log
+ * @return uint32_t Records moved
+ */
+uint32_t FlashLogRun(flash_log_t *log);
+
+/**
+ * @brief Write the partial page (records moved by FlashLogRun() and not
+ * written yet)
+ *
+ * @param log Log
+ */
+void FlashLogFlush(flash_log_t *log);
+
+/**
+ * @brief Erase the whole log
+ *
+ * @param log Log
+ * @return true: OK, false: erase error
+ */
+bool FlashLogErase(flash_log_t *log);
+
+/**
+ * @brief Cursor at the oldest record
+ *
+ * @note Records still in the ring or in the page buffer are not read: call
+ * FlashLogFlush() first (host) or stop the producers.
+ *
+ * @param log Log
+ * @param cursor Cursor
+ */
+void FlashLogFirst(const flash_log_t *log, flash_log_cursor_t *cursor);
+
+/**
+ * @brief Next record (zero-copy: pointer to the mapped flash). Records with a
+ * wrong CRC are skipped.
+ *
+ * @param log Log
+ * @param cursor Cursor
+ * @return const flash_log_record_t* Record (FLASH_LOG_PAYLOAD()), NULL at the
+ * end of the log
+ */
+const flash_log_record_t* FlashLogNext(const flash_log_t *log, flash_log_cursor_t *cursor);
+
+/**
+ * @brief Stream the log (flash_log_export_t and the used part of the sectors,
+ * oldest first)
+ *
+ * @param log Log
+ * @param send Output function
+ * @param param Parameter of the output function
+ * @return uint32_t Bytes sent
+ */
+uint32_t FlashLogExport(flash_log_t *log, flash_log_send_t send, void *param);
+
+/**
+ * @brief Stream the log over UART (FlashLogExport())
+ *
+ * @note Blocks until every byte is queued (UartWriteBuffer()): about 3 s per
+ * 256 KB at 921600 bit/s.
+ *
+ * @param log Log
+ * @param port UART port (initialized)
+ * @return uint32_t Bytes sent
+ */
+uint32_t FlashLogExportUart(flash_log_t *log, uart_mcu_port_t port);
+
+#ifndef MCU_HOST
+/**
+ * @brief Create the background task that writes the records to flash
+ *
+ * @param log Log
+ * @param stack Stack size (bytes)
+ * @param priority Task priority (below the producers)
+ * @return true: OK, false: task not created
+ */
+bool FlashLogStart(flash_log_t *log, uint32_t stack, uint8_t priority);
+#endif
+
+/**
+ * @brief Print the state and statistics of the log (printf)
+ *
+ * @param log Log
+ */
+void FlashLogPrint(const flash_log_t *log);
+
+/** @} doxygen end group definition */
+/** @} doxygen end group definition */
+/** @} doxygen end group definition */
+#endif /* FLASH_LOG_MCU_H */
+
+/*==================[end of file]============================================*/
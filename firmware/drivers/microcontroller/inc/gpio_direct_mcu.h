@@ -0,0 +1,155 @@
+#ifndef GPIO_DIRECT_MCU_H
+#define GPIO_DIRECT_MCU_H
+/** \addtogroup Drivers_Programable Drivers Programable
+ ** @{ */
+/** \addtogroup Drivers_Microcontroller Drivers microcontroller
+ ** @{ */
+/** \addtogroup GIOP_DIRECT GPIO Direct
+ ** @{ */
+
+/** \brief Inline GPIO functions that access the GPIO registers directly.
+ *
+ * Header only fast path for bit-banging loops (HX711, HC-SR04, etc). Each
+ * function is a single load/store on the GPIO set/clear/input registers: no
+ * pin table lookup, no argument checking and no function call. When the pin
+ * is a constant the mask is resolved at compile time.
+ *
+ * Pins must be configured first with GPIOInit() (gpio_mcu remains the safe
+ * path).
+ *
+ * @note GPIOToggle() keeps its own copy of the pin state, don't mix it with
+ * these functions on the same pin.
+ *
+ * @note GPIO_DIRECT_HW can be defined before including this file to point
+ * the functions to another register block (with out, out_w1ts, out_w1tc and
+ * in registers). Otherwise host builds (MCU_HOST) go through the host
+ * backend GPIO model.
+ *
+ * @section changelog
+ *
+ * |   Date	    | Description                                    						|
+ * |:----------:|:----------------------------------------------------------------------|
+ * | 19/10/2026 | Document creation		                         						|
+ *
+ **/
+
+/*==================[inclusions]=============================================*/
+#include <stdbool.h>
+#include <stdint.h>
+#include "gpio_mcu.h"
+#if defined(MCU_HOST) && !defined(GPIO_DIRECT_HW)
+#include "host_mcu.h"
+#define GPIO_DIRECT_HOST					/*!< Host backend GPIO model */
+#elif !defined(GPIO_DIRECT_HW)
+#include "soc/gpio_struct.h"
+#define GPIO_DIRECT_HW		(&GPIO)		/*!< GPIO register block */
+#endif
+/*==================[macros]=================================================*/
+#define GPIO_DIRECT_MASK(pin)	(1UL << (pin))	/*!< Register mask of a GPIO */
+/*==================[typedef]================================================*/
+
+/*==================[external data declaration]==============================*/
+
+/*==================[external functions declaration]=========================*/
+/**
+ * @brief Set to high all the GPIOs in mask
+ *
+ * @param mask GPIOs mask (see GPIO_DIRECT_MASK)
+ */
+static inline void GPIODirectSetMask(uint32_t mask){
+#ifdef GPIO_DIRECT_HOST
+	HostGPIOWriteMask(mask, true);
+#else
+	GPIO_DIRECT_HW->out_w1ts.val = mask;
+#endif
+}
+
+/**
+ * @brief Set to low all the GPIOs in mask
+ *
+ * @param mask GPIOs mask (see GPIO_DIRECT_MASK)
+ */
+static inline void GPIODirectClearMask(uint32_t mask){
+#ifdef GPIO_DIRECT_HOST
+	HostGPIOWriteMask(mask, false);
+#else
+	GPIO_DIRECT_HW->out_w1tc.val = mask;
+#endif
+}
+
+/**
+ * @brief Read the input level of all the GPIOs in mask
+ *
+ * @param mask GPIOs mask (see GPIO_DIRECT_MASK)
+ * @return uint32_t Input levels (masked)
+ */
+static inline uint32_t GPIODirectReadMask(uint32_t mask){
+#ifdef GPIO_DIRECT_HOST
+	return HostGPIOReadMask(mask);
+#else
+	return GPIO_DIRECT_HW->in.val & mask;
+#endif
+}
+
+/**
+ * @brief Change GPIO state to high
+ *
+ * @param pin GPIO number
+ */
+static inline void GPIODirectOn(gpio_t pin){
+	GPIODirectSetMask(GPIO_DIRECT_MASK(pin));
+}
+
+/**
+ * @brief Change GPIO state to low
+ *
+ * @param pin GPIO number
+ */
+static inline void GPIODirectOff(gpio_t pin){
+	GPIODirectClearMask(GPIO_DIRECT_MASK(pin));
+}
+
+/**
+ * @brief Change GPIO state
+ *
+ * @param pin GPIO number
+ * @param state GPIO state (true: high - false: low)
+ */
+static inline void GPIODirectState(gpio_t pin, bool state){
+	if(state){
+		GPIODirectOn(pin);
+	} else{
+		GPIODirectOff(pin);
+	}
+}
+
+/**
+ * @brief Invert GPIO state
+ *
+ * @param pin GPIO number
+ */
+static inline void GPIODirectToggle(gpio_t pin){
+#ifdef GPIO_DIRECT_HOST
+	GPIODirectState(pin, !HostGPIOReadOutMask(GPIO_DIRECT_MASK(pin)));
+#else
+	GPIODirectState(pin, !(GPIO_DIRECT_HW->out.val & GPIO_DIRECT_MASK(pin)));
+#endif
+}
+
+/**
+ * @brief Reads GPIO state
+ *
+ * @param pin GPIO number
+ * @return true GPIO input high
+ * @return false GPIO input low
+ */
+static inline bool GPIODirectRead(gpio_t pin){
+	return GPIODirectReadMask(GPIO_DIRECT_MASK(pin)) != 0;
+}
+
+/** @} doxygen end group definition */
+/** @} doxygen end group definition */
+/** @} doxygen end group definition */
+#endif /* GPIO_DIRECT_MCU_H */
+
+/*==================[end of file]============================================*/
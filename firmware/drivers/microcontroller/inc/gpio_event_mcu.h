@@ -0,0 +1,106 @@
+#ifndef GPIO_EVENT_MCU_H
+#define GPIO_EVENT_MCU_H
+/** \addtogroup Drivers_Programable Drivers Programable
+ ** @{ */
+/** \addtogroup Drivers_Microcontroller Drivers microcontroller
+ ** @{ */
+/** \addtogroup GIOP_EVENT GPIO Events
+ ** @{ */
+
+/** \brief Debounced GPIO event dispatcher.
+ *
+ * GPIO interrupts only take a timestamp of the edge, push {pin, time} to a
+ * lock-free queue and mask the pin interrupt, so a bouncing contact produces
+ * one interrupt and one task wake-up. A dispatcher task waits for
+ * the debounce window of the pin (counted from the first edge), samples the
+ * stable level, re-enables the interrupt and delivers the events to the
+ * subscribed callbacks (in task context, not in ISR context). The host
+ * backend runs the same state machine on the virtual clock.
+ *
+ * Events: press, release, long press and double click.
+ *
+ * @section changelog
+ *
+ * |   Date	    | Description                                    						|
+ * |:----------:|:----------------------------------------------------------------------|
+ * | 19/10/2026 | Document creation		                         						|
+ *
+ **/
+
+/*==================[inclusions]=============================================*/
+#include <stdbool.h>
+#include <stdint.h>
+#include "gpio_mcu.h"
+/*==================[macros]=================================================*/
+#define GPIO_EVENT_MAX_SUBSCRIBERS	8		/*!< Max number of subscriptions */
+#define GPIO_EVENT_QUEUE_SIZE		32		/*!< Edges queue size (power of two) */
+#define GPIO_EVENT_TASK_STACK		2048	/*!< Dispatcher task stack size */
+#define GPIO_EVENT_TASK_PRIORITY	10		/*!< Dispatcher task priority */
+#define GPIO_EVENT_DEBOUNCE_MS		20		/*!< Default debounce window */
+#define GPIO_EVENT_LONG_PRESS_MS	1000	/*!< Default long press time */
+#define GPIO_EVENT_DOUBLE_CLICK_MS	300		/*!< Default double click window */
+/*==================[typedef]================================================*/
+/**
+ * @brief GPIO event types
+ *
+ */
+typedef enum {
+	GPIO_EVENT_PRESS = 0,	/*!< Pin changed to its active level */
+	GPIO_EVENT_RELEASE,		/*!< Pin changed to its inactive level */
+	GPIO_EVENT_LONG_PRESS,	/*!< Pin held in its active level for long_press_ms */
+	GPIO_EVENT_DOUBLE_CLICK	/*!< Second press within double_click_ms of the previous release */
+} gpio_event_type_t;
+
+/**
+ * @brief GPIO event
+ *
+ */
+typedef struct {
+	gpio_t pin;					/*!< GPIO number */
+	gpio_event_type_t type;		/*!< Event type */
+	bool level;					/*!< Debounced pin level */
+	uint32_t time;				/*!< Time of the first edge of the event (in us) */
+} gpio_event_t;
+
+/**
+ * @brief GPIO event subscription
+ *
+ */
+typedef struct {
+	gpio_t pin;					/*!< GPIO number (must be initialized as input) */
+	bool active_low;			/*!< true: press is a low level (switches with pull-up) */
+	uint16_t debounce_ms;		/*!< Debounce window (0: GPIO_EVENT_DEBOUNCE_MS) */
+	uint16_t long_press_ms;		/*!< Long press time (0: no long press events) */
+	uint16_t double_click_ms;	/*!< Double click window (0: no double click events) */
+	void *func_p;				/*!< Callback: void func(gpio_event_t *event, void *param) */
+	void *param_p;				/*!< Pointer to callback function parameters */
+} gpio_event_config_t;
+
+/*==================[external data declaration]==============================*/
+
+/*==================[external functions declaration]=========================*/
+/**
+ * @brief Subscribe a callback to the events of a GPIO.
+ *
+ * @note The first call creates the dispatcher task. A pin can have several
+ * subscribers, the pin configuration is taken from the first one.
+ *
+ * @param config Subscription
+ * @return true Subscription added
+ * @return false No free subscriptions
+ */
+bool GPIOEventSubscribe(gpio_event_config_t *config);
+
+/**
+ * @brief Number of edges dropped because the queue was full
+ *
+ * @return uint32_t Dropped edges
+ */
+uint32_t GPIOEventDropped(void);
+
+/** @} doxygen end group definition */
+/** @} doxygen end group definition */
+/** @} doxygen end group definition */
+#endif /* GPIO_EVENT_MCU_H */
+
+/*==================[end of file]============================================*/
@@ -8,6 +8,17 @@
  ** @{ */
 
 /** \brief GPIO driver to use gpio ouputs with faster functions than gpio_mcu.
+ * 
+ * Pins are grouped in bundles routed to the CPU dedicated GPIO channels, so 
+ * all the pins of a bundle are written or sampled with a single instruction.
+ * Several independent input and/or output bundles can coexist.
+ * 
+ * Example: the DOUT lines of several HX711 in an input bundle are sampled 
+ * together with GPIOBundleRead(), bit n being the level of pin_list[n].
+ * 
+ * @note ESP32-C6 has 8 dedicated input and 8 dedicated output channels, shared 
+ * by all bundles. If a bundle doesn't fit, it falls back to gpio_mcu functions
+ * (same API, one call per pin).
  * 
  * @author Albano Peñalva
  *
@@ -16,6 +27,7 @@
  * |   Date	    | Description                                    						|
  * |:----------:|:----------------------------------------------------------------------|
  * | 20/11/2023 | Document creation		                         						|
+ * | 19/10/2026 | Multiple input/output bundles, masked operations      				|
  * 
  **/
 
@@ -24,25 +36,101 @@
 #include <stdint.h>
 #include "gpio_mcu.h"
 /*==================[macros]=================================================*/
-
+#define GPIO_BUNDLE_MAX_PINS	8	/*!< Max number of pins in a bundle */
+#define GPIO_FAST_MAX_PINS		16	/*!< Max number of pins for GPIOFastInit() */
 /*==================[typedef]================================================*/
-
+/**
+ * @brief GPIO bundle
+ * 
+ */
+typedef struct {
+	gpio_t pins[GPIO_BUNDLE_MAX_PINS];	/*!< Bundle pins (pins[n] is bit n) */
+	uint8_t pin_qty;					/*!< Number of pins in the bundle */
+	io_t io;							/*!< Bundle direction */
+	uint32_t state;						/*!< Output state (last value written) */
+	void *handle;						/*!< Dedicated GPIO bundle (NULL if not available) */
+} gpio_bundle_t;
 /*==================[external data declaration]==============================*/
 
 /*==================[external functions declaration]=========================*/
+/**
+ * @brief Bundle initialization. Output bundles are cleared.
+ * 
+ * @param bundle Bundle to initialize
+ * @param pin_list Pins of the bundle (pin_list[0] is bit 0)
+ * @param pin_qty Number of pins (up to GPIO_BUNDLE_MAX_PINS)
+ * @param io Bundle direction
+ * @return true if the bundle uses dedicated GPIO channels
+ * @return false if the bundle uses gpio_mcu functions
+ */
+bool GPIOBundleInit(gpio_bundle_t *bundle, const gpio_t *pin_list, uint8_t pin_qty, io_t io);
+
+/**
+ * @brief Masked write: bits set in mask take the value of the same bits in value.
+ * 
+ * @param bundle Output bundle
+ * @param mask Bits to update
+ * @param value New value of the bits
+ */
+void GPIOBundleWrite(gpio_bundle_t *bundle, uint32_t mask, uint32_t value);
+
+/**
+ * @brief Invert the bits of the bundle in mask
+ * 
+ * @param bundle Output bundle
+ * @param mask Bits to invert
+ */
+void GPIOBundleToggle(gpio_bundle_t *bundle, uint32_t mask);
+
+/**
+ * @brief Read the output state of the bundle
+ * 
+ * @param bundle Output bundle
+ * @return uint32_t Last value written
+ */
+uint32_t GPIOBundleReadOut(gpio_bundle_t *bundle);
+
+/**
+ * @brief Sample all the pins of an input bundle at once
+ * 
+ * @param bundle Input bundle
+ * @param mask Bits to read
+ * @return uint32_t Input levels (bit n: level of pin_list[n])
+ */
+uint32_t GPIOBundleRead(gpio_bundle_t *bundle, uint32_t mask);
 
 /**
- * @brief 
+ * @brief Take consecutive samples of an input bundle as fast as possible 
+ * (e.g. to capture a parallel bus)
+ * 
+ * @param bundle Input bundle
+ * @param samples Array to store the samples
+ * @param sample_qty Number of samples
+ */
+void GPIOBundleSample(gpio_bundle_t *bundle, uint32_t *samples, uint16_t sample_qty);
+
+/**
+ * @brief Release the dedicated channels used by the bundle
+ * 
+ * @param bundle Bundle
+ */
+void GPIOBundleDeinit(gpio_bundle_t *bundle);
+
+/**
+ * @brief Initialize the default output bundle
+ * 
+ * @note Only the first GPIO_BUNDLE_MAX_PINS pins use dedicated channels, the 
+ * remaining ones (up to GPIO_FAST_MAX_PINS) are written with gpio_mcu functions.
  * 
- * @param pin_list 
- * @param pin_qty 
+ * @param pin_list Pins (pin_list[0] is bit 0)
+ * @param pin_qty Number of pins
  */
 void GPIOFastInit(gpio_t *pin_list, uint8_t pin_qty);
 
 /**
- * @brief 
+ * @brief Write all the pins of the default output bundle
  * 
- * @param value 
+ * @param value Value to write (bit n: state of pin_list[n])
  */
 void GPIOFastWrite(uint16_t value);
 
@@ -33,7 +33,7 @@
 #include <stdbool.h>
 #include <stdint.h>
 /*==================[macros]=================================================*/
-
+#define GPIO_QTY	24		/*!< Number of GPIOs (GPIO_0 to GPIO_23) */
 /*==================[typedef]================================================*/
 /**
  * @brief GPIO direction (input or output).
@@ -0,0 +1,106 @@
+#ifndef GPIO_PORT_MCU_H
+#define GPIO_PORT_MCU_H
+/** \addtogroup Drivers_Programable Drivers Programable
+ ** @{ */
+/** \addtogroup Drivers_Microcontroller Drivers microcontroller
+ ** @{ */
+/** \addtogroup GIOP_PORT GPIO Port
+ ** @{ */
+
+/** \brief GPIO port driver for the ESP-EDU Board.
+ *
+ * Groups several GPIOs in a named port, so they can be updated with a single
+ * masked write. Bit n of every mask/value corresponds to pin_list[n].
+ *
+ * Ports are output bundles of gpio_fast_out_mcu. When enough dedicated GPIO
+ * channels are free, all the pins of the port change in one CPU instruction.
+ * If the bundle can't be created, the port falls back to the gpio_mcu
+ * functions, one call per modified pin.
+ *
+ * @note Once a pin is added to a port it must only be driven through this
+ * driver (GPIOOn/GPIOOff don't reach a pin routed to a dedicated channel).
+ *
+ * @section changelog
+ *
+ * |   Date	    | Description                                    						|
+ * |:----------:|:----------------------------------------------------------------------|
+ * | 19/10/2026 | Document creation		                         						|
+ *
+ **/
+
+/*==================[inclusions]=============================================*/
+#include <stdbool.h>
+#include <stdint.h>
+#include "gpio_mcu.h"
+#include "gpio_fast_out_mcu.h"
+/*==================[macros]=================================================*/
+#define GPIO_PORT_MAX_PINS	GPIO_BUNDLE_MAX_PINS		/*!< Max number of pins in a port */
+/*==================[typedef]================================================*/
+/**
+ * @brief GPIO port
+ *
+ */
+typedef struct {
+	gpio_bundle_t bundle;				/*!< Output bundle with the port pins */
+} gpio_port_t;
+/*==================[external data declaration]==============================*/
+
+/*==================[external functions declaration]=========================*/
+/**
+ * @brief Port initialization. All pins are configured as outputs and cleared.
+ *
+ * @param port Port to initialize
+ * @param pin_list Pins of the port (pin_list[0] is bit 0)
+ * @param pin_qty Number of pins (up to GPIO_PORT_MAX_PINS)
+ * @return true if the port uses a dedicated GPIO bundle
+ * @return false if the port uses regular GPIO writes
+ */
+bool GPIOPortInit(gpio_port_t *port, const gpio_t *pin_list, uint8_t pin_qty);
+
+/**
+ * @brief Masked write: bits set in mask take the value of the same bits in value.
+ *
+ * @param port Port
+ * @param mask Bits to update
+ * @param value New value of the bits
+ */
+void GPIOPortWrite(gpio_port_t *port, uint8_t mask, uint8_t value);
+
+/**
+ * @brief Set to high the bits of the port in mask
+ *
+ * @param port Port
+ * @param mask Bits to set
+ */
+void GPIOPortSet(gpio_port_t *port, uint8_t mask);
+
+/**
+ * @brief Set to low the bits of the port in mask
+ *
+ * @param port Port
+ * @param mask Bits to clear
+ */
+void GPIOPortClear(gpio_port_t *port, uint8_t mask);
+
+/**
+ * @brief Invert the bits of the port in mask
+ *
+ * @param port Port
+ * @param mask Bits to invert
+ */
+void GPIOPortToggle(gpio_port_t *port, uint8_t mask);
+
+/**
+ * @brief Returns the last value written to the port
+ *
+ * @param port Port
+ * @return uint8_t Output state of the port
+ */
+uint8_t GPIOPortState(gpio_port_t *port);
+
+/** @} doxygen end group definition */
+/** @} doxygen end group definition */
+/** @} doxygen end group definition */
+#endif
+
+/*==================[end of file]============================================*/
@@ -0,0 +1,384 @@
+#ifndef HOST_MCU_H
+#define HOST_MCU_H
+/** \addtogroup Drivers_Programable Drivers Programable
+ ** @{ */
+/** \addtogroup Drivers_Microcontroller Drivers microcontroller
+ ** @{ */
+/** \addtogroup Host Host backend
+ ** @{ */
+
+/** \brief Simulation control of the host (Linux) backend of the microcontroller drivers.
+ *
+ * When the drivers are built for the ESP-IDF linux target (or with plain gcc
+ * and MCU_HOST defined) the *_mcu.c files of src_host/ replace the ESP-IDF
+ * ones. The *_mcu.h APIs are the same, so the device drivers, the middleware
+ * and the applications are compiled unmodified.
+ *
+ * The backend is single threaded and runs on a virtual clock:
+ * - The clock only advances in Delay*() calls, in bus transfers (the time
+ * they take at the configured bitrate), in GPIO accesses (HOST_GPIO_ACCESS_NS,
+ * so busy-wait loops end) and in HostRunUs() / HostWaitNs().
+ * - Timer callbacks, scheduled events and device models run while the clock
+ * advances, in the same thread. Two runs of the same program give the same
+ * results, so driver code can be benchmarked deterministically.
+ *
+ * Device models:
+ * - GPIO: a model watches the outputs (HostGPIOWatch()) and drives the
+ * inputs (HostGPIODrive()), usually from scheduled events. Input edges call
+ * the interrupts configured with GPIOActivInt().
+ * - UART: each port can be backed by file descriptors (files, pipes, a pty)
+ * and/or a model that receives the transmitted bytes and answers with
+ * HostUartInject(). Once UartInit() sets the baud rate, the TX FIFO drains
+ * at that rate: UartSendByte(), UartSendString() and UartSendBuffer() drop
+ * what does not fit in it, as on the target, and UartWriteBuffer() waits.
+ * - SPI: each device can be backed by a file descriptor (transmitted bytes)
+ * and/or a model that implements the full duplex transfer.
+ * - I2C: models attached to an address, with a register file or read/write
+ * callbacks.
+ * - ADC: each channel reads a waveform (raw counts) sampled at a fixed rate
+ * of the virtual clock.
+ * - Flash: data partitions backed by files (HostFlashPartition()), with NOR
+ * semantics (erased bytes are 0xFF, programming only clears bits) and the
+ * erase and program times of the ESP32-C6 flash.
+ *
+ * @note Only for host builds: this file is not available on the target.
+ *
+ * @author Albano Peñalva
+ *
+ * @section changelog
+ *
+ * |   Date	    | Description                                    						|
+ * |:----------:|:----------------------------------------------------------------------|
+ * | 19/10/2026 | Document creation		                         						|
+ *
+ **/
+
+/*==================[inclusions]=============================================*/
+#include <stdbool.h>
+#include <stdint.h>
+#include "gpio_mcu.h"
+#include "uart_mcu.h"
+#include "spi_mcu.h"
+#include "analog_io_mcu.h"
+#include "pwm_mcu.h"
+/*==================[macros]=================================================*/
+#define HOST_EVENT_QTY			32		/*!< Max number of scheduled events */
+#define HOST_GPIO_ACCESS_NS		50		/*!< Virtual time of a GPIO read or write */
+#define HOST_I2C_MODEL_QTY		8		/*!< Max number of I2C device models */
+#define HOST_UART_RX_SIZE		256		/*!< Injected bytes buffer of each UART port */
+#define HOST_UART_TX_FIFO		128		/*!< TX FIFO of the target UART (bytes) */
+#define HOST_NO_FD				(-1)	/*!< No file descriptor */
+#define HOST_FLASH_QTY			4		/*!< Max number of flash partitions */
+#define HOST_FLASH_SECTOR_SIZE	4096	/*!< Flash erase unit (bytes) */
+#define HOST_FLASH_ERASE_NS		45000000	/*!< Virtual time of a sector erase */
+#define HOST_FLASH_BYTE_NS		2500	/*!< Virtual time to program a byte */
+/*==================[typedef]================================================*/
+/**
+ * @brief UART device model
+ */
+typedef struct {
+	void (*tx)(uart_mcu_port_t port, const uint8_t *data, uint16_t len, void *param);	/*!< Bytes sent by the MCU */
+	void *param;						/*!< Parameter of the callback */
+} host_uart_model_t;
+
+/**
+ * @brief SPI device model
+ */
+typedef struct {
+	void (*transfer)(spi_dev_t device, const uint8_t *tx, uint8_t *rx, uint32_t len, void *param);	/*!< Full duplex transfer (tx or rx can be NULL) */
+	void *param;						/*!< Parameter of the callback */
+} host_spi_model_t;
+
+/**
+ * @brief I2C device model
+ *
+ * If read and write are NULL the device is a register file: regs (256 bytes)
+ * is read and written with register address auto-increment.
+ */
+typedef struct {
+	uint8_t addr;						/*!< 7 bit device address */
+	uint8_t *regs;						/*!< Register file (256 bytes) */
+	bool (*read)(uint8_t reg, uint8_t *data, uint8_t len, void *param);			/*!< Register read (false: NACK) */
+	bool (*write)(uint8_t reg, const uint8_t *data, uint8_t len, void *param);	/*!< Register write (false: NACK) */
+	void *param;						/*!< Parameter of the callbacks */
+} host_i2c_model_t;
+/*==================[external data declaration]==============================*/
+
+/*==================[external functions declaration]=========================*/
+/**
+ * @brief Virtual time since the program started
+ *
+ * @return uint64_t Time in ns
+ */
+uint64_t HostTimeNs(void);
+
+/**
+ * @brief Virtual time since the program started
+ *
+ * @return uint64_t Time in us
+ */
+uint64_t HostTimeUs(void);
+
+/**
+ * @brief Advance the virtual clock, running the events that expire
+ *
+ * @note Called from an event or a model callback it only advances the clock
+ * (events don't preempt each other).
+ *
+ * @param ns Time to advance (in ns)
+ */
+void HostRunNs(uint64_t ns);
+
+/**
+ * @brief Advance the virtual clock, running the events that expire
+ *
+ * @param us Time to advance (in us)
+ */
+void HostRunUs(uint64_t us);
+
+/**
+ * @brief Advance the virtual clock like HostRunNs(), but return as soon as an
+ * event calls HostWake(): the idle wait of a task until an ISR notifies it
+ * @note A HostWake() that arrives before the wait is kept (as a pending task
+ * notification) and ends the next wait at once.
+ * @param ns Max time to wait (in ns)
+ * @return true Woken up by HostWake()
+ * @return false Timeout
+ */
+bool HostWaitNs(uint64_t ns);
+
+/**
+ * @brief Wake up the program waiting in HostWaitNs() (ISR to task
+ * notification)
+ */
+void HostWake(void);
+
+/**
+ * @brief Schedule a callback on the virtual clock
+ *
+ * @note Events with the same time run in the order they were scheduled.
+ *
+ * @param delay_ns Time to the first call (in ns)
+ * @param period_ns Period of the following calls (0: one shot)
+ * @param func_p Callback: void func(void *param)
+ * @param param_p Callback parameter
+ * @return int Event id (-1: no free events)
+ */
+int HostSchedule(uint64_t delay_ns, uint64_t period_ns, void *func_p, void *param_p);
+
+/**
+ * @brief Cancel a scheduled event
+ *
+ * @param id Event id returned by HostSchedule (-1 is ignored)
+ */
+void HostCancel(int id);
+
+/**
+ * @brief Drive a GPIO from outside (input level). Changes call the GPIO
+ * interrupt and the edge hook of the pin.
+ *
+ * @param pin GPIO number
+ * @param level Input level
+ */
+void HostGPIODrive(gpio_t pin, bool level);
+
+/**
+ * @brief Output level of a GPIO (last value written by the MCU)
+ *
+ * @param pin GPIO number
+ * @return true High
+ * @return false Low
+ */
+bool HostGPIOLevel(gpio_t pin);
+
+/**
+ * @brief Call a function each time the MCU changes a GPIO output
+ *
+ * @param pin GPIO number
+ * @param func_p Callback: void func(gpio_t pin, bool level, void *param) (NULL: remove)
+ * @param param_p Callback parameter
+ */
+void HostGPIOWatch(gpio_t pin, void *func_p, void *param_p);
+
+/**
+ * @brief Call a function on each edge of a GPIO input (HostGPIODrive())
+ *
+ * @param pin GPIO number
+ * @param func_p Callback: void func(gpio_t pin, bool level, void *param) (NULL: remove)
+ * @param param_p Callback parameter
+ */
+void HostGPIOEdgeHook(gpio_t pin, void *func_p, void *param_p);
+
+/**
+ * @brief Set (level true) or clear (level false) the outputs of the GPIOs
+ * in mask, in one access (gpio_direct_mcu.h)
+ *
+ * @param mask GPIOs mask (bit n: GPIO n)
+ * @param level New level
+ */
+void HostGPIOWriteMask(uint32_t mask, bool level);
+
+/**
+ * @brief Read the levels of the GPIOs in mask, in one access (gpio_direct_mcu.h)
+ *
+ * @param mask GPIOs mask (bit n: GPIO n)
+ * @return uint32_t Levels (masked)
+ */
+uint32_t HostGPIOReadMask(uint32_t mask);
+
+/**
+ * @brief Output state of the GPIOs in mask (gpio_direct_mcu.h)
+ *
+ * @param mask GPIOs mask (bit n: GPIO n)
+ * @return uint32_t Output levels (masked)
+ */
+uint32_t HostGPIOReadOutMask(uint32_t mask);
+
+/**
+ * @brief Back a UART port with file descriptors
+ *
+ * @note By default UART_PC transmits to the standard output.
+ *
+ * @param port UART port
+ * @param rx_fd Received bytes are read from this descriptor (HOST_NO_FD: none)
+ * @param tx_fd Sent bytes are written to this descriptor (HOST_NO_FD: none)
+ */
+void HostUartOpen(uart_mcu_port_t port, int rx_fd, int tx_fd);
+
+/**
+ * @brief Attach a device model to a UART port
+ *
+ * @param port UART port
+ * @param model Model (NULL: remove). It must exist while attached
+ */
+void HostUartModel(uart_mcu_port_t port, const host_uart_model_t *model);
+
+/**
+ * @brief Bytes received by the MCU. The reception callback of the port is
+ * called once.
+ *
+ * @param port UART port
+ * @param data Bytes
+ * @param len Number of bytes (the ones that don't fit are dropped)
+ */
+void HostUartInject(uart_mcu_port_t port, const uint8_t *data, uint16_t len);
+
+/**
+ * @brief Write the bytes sent to a SPI device to a file descriptor
+ *
+ * @param device SPI device
+ * @param tx_fd File descriptor (HOST_NO_FD: none)
+ */
+void HostSpiOpen(spi_dev_t device, int tx_fd);
+
+/**
+ * @brief Attach a device model to a SPI device. Without model the received
+ * bytes are 0xFF.
+ *
+ * @param device SPI device
+ * @param model Model (NULL: remove). It must exist while attached
+ */
+void HostSpiModel(spi_dev_t device, const host_spi_model_t *model);
+
+/**
+ * @brief Attach a device model to the I2C bus
+ *
+ * @param model Model. It must exist while attached
+ * @return true Model attached
+ * @return false No free models
+ */
+bool HostI2CModel(const host_i2c_model_t *model);
+
+/**
+ * @brief Remove all the I2C device models
+ */
+void HostI2CClear(void);
+
+/**
+ * @brief Set the waveform read by an analog input
+ *
+ * @param channel Analog input
+ * @param samples Raw counts (0 to 4095). They must exist while used
+ * @param qty Number of samples (0: input reads 0)
+ * @param sample_frec Sample frequency of the waveform (in Hz)
+ * @param loop true: repeat the waveform - false: hold the last sample
+ */
+void HostAnalogWaveform(adc_ch_t channel, const uint16_t *samples, uint32_t qty, uint32_t sample_frec, bool loop);
+
+/**
+ * @brief Load the waveform of an analog input from a text file (raw counts
+ * separated by spaces or new lines)
+ *
+ * @param channel Analog input
+ * @param path File path
+ * @param sample_frec Sample frequency of the waveform (in Hz)
+ * @param loop true: repeat the waveform - false: hold the last sample
+ * @return uint32_t Number of samples loaded (0: error)
+ */
+uint32_t HostAnalogLoad(adc_ch_t channel, const char *path, uint32_t sample_frec, bool loop);
+
+/**
+ * @brief Last value written to the analog output
+ *
+ * @return uint8_t DAC value (0 to 255)
+ */
+uint8_t HostAnalogOutput(void);
+
+/**
+ * @brief State of a PWM output
+ *
+ * @param out PWM output
+ * @param freq Frequency (in Hz, can be NULL)
+ * @param duty_cycle Duty cycle (in %, can be NULL)
+ * @return true Output running
+ * @return false Output stopped or not initialized
+ */
+bool HostPWMState(pwm_out_t out, uint32_t *freq, uint8_t *duty_cycle);
+
+/**
+ * @brief Create a flash data partition backed by a file. The file is created
+ * (erased: 0xFF) or extended if needed, and keeps the contents between runs.
+ *
+ * @param label Partition label (esp_partition_find_first())
+ * @param path File path
+ * @param size Partition size (bytes, multiple of HOST_FLASH_SECTOR_SIZE)
+ * @return uint8_t* Partition contents (shared mapping of the file), NULL: error
+ */
+uint8_t* HostFlashPartition(const char *label, const char *path, uint32_t size);
+
+/**
+ * @brief Find a flash partition created with HostFlashPartition()
+ *
+ * @param label Partition label
+ * @param size Partition size (bytes, can be NULL)
+ * @return uint8_t* Partition contents, NULL: not found
+ */
+uint8_t* HostFlashFind(const char *label, uint32_t *size);
+
+/**
+ * @brief Erase a range of a flash partition (0xFF), HOST_FLASH_ERASE_NS per
+ * sector
+ *
+ * @param flash Partition contents
+ * @param offset Offset (multiple of HOST_FLASH_SECTOR_SIZE)
+ * @param size Bytes (multiple of HOST_FLASH_SECTOR_SIZE)
+ */
+void HostFlashErase(uint8_t *flash, uint32_t offset, uint32_t size);
+
+/**
+ * @brief Program bytes of a flash partition (bits can only be cleared),
+ * HOST_FLASH_BYTE_NS per byte
+ *
+ * @param flash Partition contents
+ * @param offset Offset
+ * @param data Bytes
+ * @param len Number of bytes
+ */
+void HostFlashProgram(uint8_t *flash, uint32_t offset, const void *data, uint32_t len);
+
+/** @} doxygen end group definition */
+/** @} doxygen end group definition */
+/** @} doxygen end group definition */
+#endif /* HOST_MCU_H */
+
+/*==================[end of file]============================================*/
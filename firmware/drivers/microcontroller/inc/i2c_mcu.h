@@ -27,8 +27,10 @@
 /*==================[inclusions]=============================================*/
 #include <stdint.h>
 #include <stdbool.h>
+#ifndef MCU_HOST
 #include "esp_log.h"
 #include "driver/i2c.h"
+#endif
 #include "gpio_mcu.h"
 /*==================[macros]=================================================*/
 
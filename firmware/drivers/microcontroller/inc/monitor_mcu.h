@@ -0,0 +1,276 @@
+#ifndef MONITOR_MCU_H
+#define MONITOR_MCU_H
+/** \addtogroup Drivers_Programable Drivers Programable
+ ** @{ */
+/** \addtogroup Drivers_Microcontroller Drivers microcontroller
+ ** @{ */
+/** \addtogroup MONITOR Monitor
+ ** @{ */
+
+/** \brief Runtime monitor of notification driven tasks: CPU load, run time,
+ * stack high-water mark, overruns and deadline misses.
+ *
+ * Each monitored task has an id (0 to MONITOR_MAX_TASKS - 1, chosen by the
+ * application) and an activation period. The task marks each activation with
+ * MonitorBegin() / MonitorEnd(), and the ISR (or task) that notifies it calls
+ * MonitorNotify() before vTaskNotifyGiveFromISR():
+ *
+ * @code
+ * void FuncTimerA(void *param){
+ *     MonitorNotify(TASK_ADC);
+ *     vTaskNotifyGiveFromISR(adc_task_handle, pdFALSE);
+ * }
+ *
+ * static void AdcTask(void *param){
+ *     while(1){
+ *         ulTaskNotifyTake(pdTRUE, portMAX_DELAY);
+ *         MonitorBegin(TASK_ADC);
+ *         ...
+ *         MonitorEnd(TASK_ADC);
+ *     }
+ * }
+ * @endcode
+ *
+ * For every task the monitor keeps:
+ * - Run time (last, max and average) and CPU load in the report window.
+ * - Latency: time from the notification to MonitorBegin().
+ * - Overruns: notifications that arrive while the task is still busy or
+ *   before it took the previous one (ulTaskNotifyTake(pdTRUE, ...) merges
+ *   them: those activations are lost).
+ * - Deadline misses: activations that end more than one period after their
+ *   notification.
+ * - Free stack at the high-water mark (bytes).
+ *
+ * MonitorGet() queries the statistics of a task; MonitorSend() publishes one
+ * compact line per task over UART and starts a new report window
+ * (MonitorFormat() gives the same lines for BLE, e.g. BleSendString()).
+ * MonitorStart() creates a low priority task that does it periodically.
+ *
+ * MonitorNotify(), MonitorBegin() and MonitorEnd() read the microsecond timer
+ * and update a few counters (about a microsecond per activation, under 0.1 %
+ * of CPU for a 1 kHz task).
+ *
+ * @note Run time is measured from MonitorBegin() to MonitorEnd(): it includes
+ * the time the task is preempted by ISRs and higher priority tasks.
+ *
+ * @note The stack high-water mark is taken from FreeRTOS on the target. Tasks
+ * with a known stack buffer (xTaskCreateStatic(), host builds) can give it
+ * with MonitorStack(): the unused part must keep MONITOR_STACK_FILL.
+ *
+ * @section changelog
+ *
+ * |   Date	    | Description                                    						|
+ * |:----------:|:----------------------------------------------------------------------|
+ * | 19/10/2026 | Document creation		                         						|
+ *
+ **/
+
+/*==================[inclusions]=============================================*/
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+#include "uart_mcu.h"
+#ifdef MCU_HOST
+#include "host_mcu.h"
+#else
+#include "esp_timer.h"
+#endif
+/*==================[macros]=================================================*/
+#define MONITOR_MAX_TASKS		8		/*!< Max monitored tasks */
+#define MONITOR_STACK_FILL		0xA5	/*!< Value of the unused stack (as FreeRTOS fills it) */
+#define MONITOR_STACK_UNKNOWN	UINT32_MAX	/*!< Free stack not available */
+#define MONITOR_LINE_SIZE		80		/*!< Max length of a report line */
+/*==================[typedef]================================================*/
+/**
+ * @brief Monitored task (updated by the inline functions of this file)
+ */
+typedef struct {
+	const char *name;			/*!< Name (report) */
+	uint32_t period;			/*!< Activation period (us), 0: deadlines not checked */
+	void *handle;				/*!< FreeRTOS task (TaskHandle_t), taken by MonitorBegin() */
+	const uint8_t *stack;		/*!< Stack buffer (MonitorStack()) */
+	uint32_t stack_size;		/*!< Stack buffer size (bytes) */
+	volatile bool busy;			/*!< Between MonitorBegin() and MonitorEnd() */
+	volatile bool pending;		/*!< Notified, MonitorBegin() not called yet */
+	volatile uint32_t notify_time;	/*!< Time of the pending notification (us) */
+	volatile uint32_t overruns;	/*!< Notifications while busy or pending */
+	uint32_t activation;		/*!< Notification time of the current activation (us) */
+	uint32_t start;				/*!< MonitorBegin() time (us) */
+	uint32_t runs;				/*!< Completed activations */
+	uint32_t misses;			/*!< Activations that ended after their deadline */
+	uint32_t run_last;			/*!< Last run time (us) */
+	uint32_t run_max;			/*!< Max run time (us) */
+	uint32_t latency_max;		/*!< Max notification to MonitorBegin() time (us) */
+	uint64_t busy_total;		/*!< Total run time (us) */
+	uint32_t busy_window;		/*!< Run time in the report window (us) */
+} monitor_task_t;
+
+/**
+ * @brief Statistics of a task (MonitorGet())
+ */
+typedef struct {
+	float load;					/*!< CPU load in the report window (%) */
+	uint32_t runs;				/*!< Completed activations */
+	uint32_t run_last;			/*!< Last run time (us) */
+	uint32_t run_max;			/*!< Max run time (us) */
+	uint32_t run_avg;			/*!< Average run time (us) */
+	uint32_t latency_max;		/*!< Max notification to MonitorBegin() time (us) */
+	uint32_t overruns;			/*!< Notifications while busy or pending */
+	uint32_t misses;			/*!< Deadline misses */
+	uint32_t stack_free;		/*!< Free stack at the high-water mark (bytes, MONITOR_STACK_UNKNOWN) */
+} monitor_stats_t;
+/*==================[external data declaration]==============================*/
+extern monitor_task_t monitor_tasks[MONITOR_MAX_TASKS];	/*!< Monitored tasks */
+/*==================[external functions declaration]=========================*/
+/**
+ * @brief Microsecond timer of the monitor
+ *
+ * @return uint32_t Time (us, host backend: virtual clock)
+ */
+static inline __attribute__((always_inline)) uint32_t MonitorTimeUs(void){
+#ifdef MCU_HOST
+	return (uint32_t)HostTimeUs();
+#else
+	return (uint32_t)esp_timer_get_time();
+#endif
+}
+
+/**
+ * @brief Record a notification of a task (ISR and task safe)
+ *
+ * @note Always inlined: it is called from IRAM ISRs.
+ *
+ * @param id Task id
+ */
+static inline __attribute__((always_inline)) void MonitorNotify(uint8_t id){
+	monitor_task_t *t = &monitor_tasks[id];
+
+	if(t->busy || t->pending){
+		t->overruns++;
+	}
+	if(!t->pending){
+		t->notify_time = MonitorTimeUs();
+		t->pending = true;
+	}
+}
+
+/**
+ * @brief Take the task handle (first MonitorBegin() of a task)
+ *
+ * @param id Task id
+ */
+void MonitorBeginFirst(uint8_t id);
+
+/**
+ * @brief Start of an activation (after ulTaskNotifyTake())
+ *
+ * @param id Task id
+ */
+static inline __attribute__((always_inline)) void MonitorBegin(uint8_t id){
+	monitor_task_t *t = &monitor_tasks[id];
+
+	if(t->handle == NULL){
+		MonitorBeginFirst(id);
+	}
+	t->start = MonitorTimeUs();
+	t->activation = t->pending ? t->notify_time : t->start;
+	t->pending = false;
+	t->busy = true;
+	if(t->start - t->activation > t->latency_max){
+		t->latency_max = t->start - t->activation;
+	}
+}
+
+/**
+ * @brief End of an activation
+ *
+ * @param id Task id
+ */
+static inline __attribute__((always_inline)) void MonitorEnd(uint8_t id){
+	monitor_task_t *t = &monitor_tasks[id];
+	uint32_t end = MonitorTimeUs();
+
+	t->run_last = end - t->start;
+	if(t->run_last > t->run_max){
+		t->run_max = t->run_last;
+	}
+	if(t->period && (end - t->activation > t->period)){
+		t->misses++;
+	}
+	t->busy_total += t->run_last;
+	t->busy_window += t->run_last;
+	t->runs++;
+	t->busy = false;
+}
+
+/**
+ * @brief Initialize a monitored task
+ *
+ * @param id Task id (0 to MONITOR_MAX_TASKS - 1)
+ * @param name Name
+ * @param period_us Activation period (us), 0: deadlines not checked
+ * @return true: OK, false: invalid id
+ */
+bool MonitorInit(uint8_t id, const char *name, uint32_t period_us);
+
+/**
+ * @brief Stack buffer of a task, to measure its high-water mark
+ *
+ * @param id Task id
+ * @param stack Stack buffer (unused part filled with MONITOR_STACK_FILL)
+ * @param size Size (bytes)
+ */
+void MonitorStack(uint8_t id, const void *stack, uint32_t size);
+
+/**
+ * @brief Statistics of a task
+ *
+ * @param id Task id
+ * @param stats Statistics
+ * @return true: OK, false: task not initialized
+ */
+bool MonitorGet(uint8_t id, monitor_stats_t *stats);
+
+/**
+ * @brief Report line of a task: name, load, average/max run time, free stack,
+ * overruns and deadline misses
+ *
+ * @param id Task id
+ * @param line Buffer (MONITOR_LINE_SIZE bytes)
+ * @param size Buffer size
+ * @return uint16_t Line length (0: task not initialized)
+ */
+uint16_t MonitorFormat(uint8_t id, char *line, uint16_t size);
+
+/**
+ * @brief Start a new report window (CPU load)
+ */
+void MonitorWindow(void);
+
+/**
+ * @brief Send the report lines of every task over UART and start a new
+ * report window
+ *
+ * @note Blocks until the report is queued (UartWriteBuffer()).
+ *
+ * @param port UART port (initialized)
+ */
+void MonitorSend(uart_mcu_port_t port);
+
+#ifndef MCU_HOST
+/**
+ * @brief Create a low priority task that calls MonitorSend() periodically
+ *
+ * @param port UART port (initialized)
+ * @param period_ms Report period (ms)
+ * @return true: OK, false: task not created
+ */
+bool MonitorStart(uart_mcu_port_t port, uint32_t period_ms);
+#endif
+
+/** @} doxygen end group definition */
+/** @} doxygen end group definition */
+/** @} doxygen end group definition */
+#endif /* MONITOR_MCU_H */
+
+/*==================[end of file]============================================*/
@@ -0,0 +1,210 @@
+#ifndef PIPELINE_MCU_H
+#define PIPELINE_MCU_H
+/** \addtogroup Drivers_Programable Drivers Programable
+ ** @{ */
+/** \addtogroup Drivers_Microcontroller Drivers microcontroller
+ ** @{ */
+/** \addtogroup PIPELINE Pipeline
+ ** @{ */
+
+/** \brief Dataflow pipeline: stages connected by ring buffers and run by a
+ * single worker task.
+ *
+ * A pipeline is a chain of stages (sources, processors and sinks) connected
+ * by ring buffers (ring_buffer_mcu.h). Each stage processes fixed size blocks:
+ * it consumes in_block elements of its input buffer and produces out_block
+ * elements in its output buffer per run. The blocks are handed to the stage
+ * in place (zero-copy): the input pointer points into the input buffer and the
+ * output pointer into the free space of the output buffer.
+ *
+ * Sources are fed in two ways:
+ * - From an ISR or a driver callback with PipelinePush() / PipelineWrite()
+ *   (stage without process function). The worker is notified every out_block
+ *   elements.
+ * - Polled by the worker: the process function is called with in = NULL and
+ *   returns false while there is no data (e.g. HX711 not ready, MPU6050 FIFO
+ *   below a block).
+ *
+ * One worker task (PipelineStart()) runs every stage that has a full block in
+ * its input and room for a block in its output, downstream stages first, until
+ * none can run. A stage whose output is full is not run (back-pressure): the
+ * data waits in its input buffer and, when everything is full, the source
+ * drops samples (counted as overruns). A process function can also return
+ * false to retry later (e.g. a sink whose transport is busy).
+ *
+ * Every stage keeps statistics: runs, processing time (total and max), max
+ * depth of its input buffer, back-pressure stalls and overruns.
+ * PipelinePrint() prints them.
+ *
+ * @note Block sizes must divide the size of the buffers they read or write, so
+ * that blocks never wrap around the end of a buffer.
+ *
+ * @note In host builds (MCU_HOST) there is no worker task: the program calls
+ * PipelineRun().
+ *
+ * @section changelog
+ *
+ * |   Date	    | Description                                    						|
+ * |:----------:|:----------------------------------------------------------------------|
+ * | 19/10/2026 | Document creation		                         						|
+ *
+ **/
+
+/*==================[inclusions]=============================================*/
+#include <stdbool.h>
+#include <stdint.h>
+#include "ring_buffer_mcu.h"
+/*==================[macros]=================================================*/
+#define PIPELINE_MAX_STAGES		8		/*!< Max stages of a pipeline */
+/*==================[typedef]================================================*/
+/**
+ * @brief Stage process function
+ *
+ * @param in Input block (in_block elements), NULL for sources
+ * @param out Output block (out_block elements), NULL for sinks
+ * @param param Stage parameter
+ * @return true: block processed, false: nothing done, try again later
+ */
+typedef bool (*pipeline_process_t)(const void *in, void *out, void *param);
+
+/**
+ * @brief Stage statistics
+ */
+typedef struct {
+	uint32_t runs;			/*!< Blocks processed (PipelinePush() sources: elements) */
+	uint32_t stalls;		/*!< Input ready but output full (back-pressure) */
+	uint32_t overruns;		/*!< Elements dropped by PipelinePush() / PipelineWrite() */
+	uint32_t depth_max;		/*!< Max elements waiting in the input buffer */
+	uint32_t time_max;		/*!< Max processing time of a block (ticks) */
+	uint64_t time;			/*!< Total processing time (ticks) */
+} pipeline_stats_t;
+
+typedef struct pipeline_s pipeline_t;
+
+/**
+ * @brief Pipeline stage
+ */
+typedef struct {
+	const char *name;			/*!< Name (statistics) */
+	pipeline_process_t process;	/*!< Process function (NULL: source fed with PipelinePush()) */
+	void *param;				/*!< Process function parameter */
+	uint32_t in_block;			/*!< Elements consumed per run (sinks and processors) */
+	uint32_t out_block;			/*!< Elements produced per run (sources and processors) */
+	/* Set by the pipeline */
+	ring_buffer_t *in;			/*!< Input buffer */
+	ring_buffer_t *out;			/*!< Output buffer */
+	pipeline_t *pipeline;		/*!< Pipeline of the stage */
+	pipeline_stats_t stats;		/*!< Statistics */
+} pipeline_stage_t;
+
+/**
+ * @brief Pipeline
+ */
+struct pipeline_s {
+	pipeline_stage_t *stages[PIPELINE_MAX_STAGES];	/*!< Stages, upstream first */
+	uint8_t qty;				/*!< Number of stages */
+	void *task;					/*!< Worker task (TaskHandle_t) */
+	uint32_t poll_ticks;		/*!< Worker wake up period (polled sources) */
+	volatile uint32_t notifications;	/*!< PipelineNotify() calls */
+};
+/*==================[external data declaration]==============================*/
+
+/*==================[external functions declaration]=========================*/
+/**
+ * @brief Initialize an empty pipeline
+ *
+ * @param pipeline Pipeline
+ */
+void PipelineInit(pipeline_t *pipeline);
+
+/**
+ * @brief Add a stage (stages are added upstream first)
+ *
+ * @param pipeline Pipeline
+ * @param stage Stage, with name, process, param and block sizes set
+ * @return true: OK, false: too many stages
+ */
+bool PipelineAdd(pipeline_t *pipeline, pipeline_stage_t *stage);
+
+/**
+ * @brief Connect the output of a stage to the input of another one
+ *
+ * @param from Producer stage
+ * @param to Consumer stage
+ * @param buffer Ring buffer of the connection
+ * @param storage Storage of the buffer (size elements)
+ * @param size Buffer size in elements (power of two, multiple of the blocks)
+ * @param elem_size Bytes per element
+ * @return true: OK, false: invalid size or stages already connected
+ */
+bool PipelineConnect(pipeline_stage_t *from, pipeline_stage_t *to, ring_buffer_t *buffer, void *storage,
+	uint32_t size, uint32_t elem_size);
+
+/**
+ * @brief Feed one element to a source stage (ISR or task)
+ *
+ * @param source Source stage (without process function)
+ * @param elem Element
+ * @return true: OK, false: buffer full, element dropped (overrun)
+ */
+bool PipelinePush(pipeline_stage_t *source, const void *elem);
+
+/**
+ * @brief Feed a block of elements to a source stage (ISR or task)
+ *
+ * @param source Source stage (without process function)
+ * @param elems Elements
+ * @param len Number of elements
+ * @return uint32_t Elements written (the rest are dropped: overruns)
+ */
+uint32_t PipelineWrite(pipeline_stage_t *source, const void *elems, uint32_t len);
+
+/**
+ * @brief Wake up the worker (ISR or task)
+ *
+ * @param pipeline Pipeline
+ */
+void PipelineNotify(pipeline_t *pipeline);
+
+/**
+ * @brief Run the stages until none of them can run
+ *
+ * @param pipeline Pipeline
+ * @return uint32_t Number of blocks processed
+ */
+uint32_t PipelineRun(pipeline_t *pipeline);
+
+#ifndef MCU_HOST
+/**
+ * @brief Create the worker task
+ *
+ * @param pipeline Pipeline
+ * @param stack Stack size (bytes)
+ * @param priority Task priority
+ * @param poll_ms Wake up period for polled sources (0: only on PipelineNotify())
+ * @return true: OK, false: task not created
+ */
+bool PipelineStart(pipeline_t *pipeline, uint32_t stack, uint8_t priority, uint32_t poll_ms);
+#endif
+
+/**
+ * @brief Processing time in microseconds
+ *
+ * @param ticks Processing time (pipeline_stats_t)
+ * @return float Microseconds
+ */
+float PipelineTimeUs(uint64_t ticks);
+
+/**
+ * @brief Print the statistics of every stage (printf)
+ *
+ * @param pipeline Pipeline
+ */
+void PipelinePrint(const pipeline_t *pipeline);
+
+/** @} doxygen end group definition */
+/** @} doxygen end group definition */
+/** @} doxygen end group definition */
+#endif /* PIPELINE_MCU_H */
+
+/*==================[end of file]============================================*/
@@ -0,0 +1,409 @@
+#ifndef RING_BUFFER_MCU_H
+#define RING_BUFFER_MCU_H
+/** \addtogroup Drivers_Programable Drivers Programable
+ ** @{ */
+/** \addtogroup Drivers_Microcontroller Drivers microcontroller
+ ** @{ */
+/** \addtogroup RING_BUFFER Ring buffer
+ ** @{ */
+
+/** \brief Lock-free ring buffers to move data between ISRs and tasks.
+ *
+ * Header only. Two flavours over caller provided storage of size elements
+ * (size must be a power of two, the indexes run free and are masked):
+ *
+ * - ring_buffer_t, single producer / single consumer (e.g. ISR -> task).
+ *   Element and bulk copies (RingBufferPush(), RingBufferWrite(), ...) and
+ *   zero-copy access to contiguous runs of the storage: RingBufferWriteReserve()
+ *   / RingBufferWriteCommit() on the producer side and RingBufferReadPeek() /
+ *   RingBufferReadRelease() on the consumer side (DMA friendly).
+ * - ring_buffer_mp_t, multiple producers / single consumer (e.g. several tasks
+ *   and ISRs logging to one task). Each producer reserves a slot with an
+ *   atomic compare-and-swap and publishes it with a per slot sequence number,
+ *   so a producer never waits for another one: an ISR that preempts a task in
+ *   the middle of a push doesn't block.
+ *
+ * No locks and no critical sections: the functions can be called from ISRs.
+ * They never block, a full or empty buffer is reported by the return value.
+ * Producer and consumer indexes live in different cache lines
+ * (RING_BUFFER_LINE) and each side keeps a copy of the other side index, so
+ * the shared lines are only touched when the cached copy runs out.
+ *
+ * @code
+ * static uint16_t storage[256];
+ * static ring_buffer_t samples;
+ *
+ * RingBufferInit(&samples, storage, 256, sizeof(uint16_t));
+ * RingBufferPush(&samples, &value);			// ISR
+ * while(RingBufferPop(&samples, &value)){...}	// task
+ * @endcode
+ *
+ * @section changelog
+ *
+ * |   Date	    | Description                                    						|
+ * |:----------:|:----------------------------------------------------------------------|
+ * | 19/10/2026 | Document creation		                         						|
+ *
+ **/
+
+/*==================[inclusions]=============================================*/
+#include <stdbool.h>
+#include <stdint.h>
+#include <string.h>
+/*==================[macros]=================================================*/
+#ifdef MCU_HOST
+#define RING_BUFFER_LINE	64		/*!< Cache line of the host CPU */
+#else
+#define RING_BUFFER_LINE	32		/*!< Cache line of the ESP32-C6 */
+#endif
+/** @brief Functions of this file are always inlined (callable from IRAM ISRs) */
+#define RING_BUFFER_INLINE	static inline __attribute__((always_inline))
+/*==================[typedef]================================================*/
+/**
+ * @brief Single producer / single consumer ring buffer
+ */
+typedef struct {
+	/* Read only after RingBufferInit() */
+	uint8_t *data;				/*!< Storage (size * elem_size bytes) */
+	uint32_t mask;				/*!< size - 1 */
+	uint32_t elem_size;			/*!< Bytes per element */
+	/* Producer side */
+	uint32_t head __attribute__((aligned(RING_BUFFER_LINE)));	/*!< Elements written */
+	uint32_t tail_cache;		/*!< Producer copy of tail */
+	/* Consumer side */
+	uint32_t tail __attribute__((aligned(RING_BUFFER_LINE)));	/*!< Elements read */
+	uint32_t head_cache;		/*!< Consumer copy of head */
+} ring_buffer_t;
+
+/**
+ * @brief Multiple producers / single consumer ring buffer
+ */
+typedef struct {
+	/* Read only after RingBufferMpInit() */
+	uint8_t *data;				/*!< Storage (size * elem_size bytes) */
+	uint32_t *seq;				/*!< Slot sequence numbers (size words) */
+	uint32_t mask;				/*!< size - 1 */
+	uint32_t elem_size;			/*!< Bytes per element */
+	/* Producers side */
+	uint32_t head __attribute__((aligned(RING_BUFFER_LINE)));	/*!< Slots reserved */
+	/* Consumer side */
+	uint32_t tail __attribute__((aligned(RING_BUFFER_LINE)));	/*!< Elements read */
+} ring_buffer_mp_t;
+/*==================[external data declaration]==============================*/
+
+/*==================[external functions declaration]=========================*/
+/**
+ * @brief Initialize an SPSC ring buffer (empty)
+ *
+ * @param rb Ring buffer
+ * @param storage Storage of size elements
+ * @param size Number of elements (power of two)
+ * @param elem_size Bytes per element
+ * @return true: OK, false: size is not a power of two
+ */
+RING_BUFFER_INLINE bool RingBufferInit(ring_buffer_t *rb, void *storage, uint32_t size, uint32_t elem_size){
+	if((size == 0) || (size & (size - 1))){
+		return false;
+	}
+	rb->data = storage;
+	rb->mask = size - 1;
+	rb->elem_size = elem_size;
+	rb->head = rb->tail_cache = 0;
+	rb->tail = rb->head_cache = 0;
+	return true;
+}
+
+/**
+ * @brief Elements in the buffer (exact from the producer or the consumer)
+ *
+ * @param rb Ring buffer
+ * @return uint32_t Elements ready to be read
+ */
+RING_BUFFER_INLINE uint32_t RingBufferCount(const ring_buffer_t *rb){
+	return __atomic_load_n(&rb->head, __ATOMIC_ACQUIRE) - __atomic_load_n(&rb->tail, __ATOMIC_ACQUIRE);
+}
+
+/**
+ * @brief Free elements in the buffer
+ *
+ * @param rb Ring buffer
+ * @return uint32_t Elements that can be written
+ */
+RING_BUFFER_INLINE uint32_t RingBufferFree(const ring_buffer_t *rb){
+	return rb->mask + 1 - RingBufferCount(rb);
+}
+
+/**
+ * @brief Producer: reserve a contiguous run of free elements (zero-copy)
+ *
+ * The run ends at the end of the storage or at the first element not yet
+ * read, so it can be shorter than requested even if there is more free
+ * space: commit it and reserve again.
+ *
+ * @param rb Ring buffer
+ * @param len In: elements wanted, out: elements available in the run
+ * @return void* First element of the run (valid if *len > 0)
+ */
+RING_BUFFER_INLINE void* RingBufferWriteReserve(ring_buffer_t *rb, uint32_t *len){
+	uint32_t head = rb->head;
+	uint32_t index = head & rb->mask;
+	uint32_t free = rb->mask + 1 - (head - rb->tail_cache);
+	uint32_t run;
+
+	if(free < *len){
+		rb->tail_cache = __atomic_load_n(&rb->tail, __ATOMIC_ACQUIRE);
+		free = rb->mask + 1 - (head - rb->tail_cache);
+	}
+	run = rb->mask + 1 - index;
+	if(run > free){
+		run = free;
+	}
+	if(*len > run){
+		*len = run;
+	}
+	return rb->data + index * rb->elem_size;
+}
+
+/**
+ * @brief Producer: publish elements written in a reserved run
+ *
+ * @param rb Ring buffer
+ * @param len Elements written (<= elements reserved)
+ */
+RING_BUFFER_INLINE void RingBufferWriteCommit(ring_buffer_t *rb, uint32_t len){
+	__atomic_store_n(&rb->head, rb->head + len, __ATOMIC_RELEASE);
+}
+
+/**
+ * @brief Consumer: contiguous run of elements ready to be read (zero-copy)
+ *
+ * @param rb Ring buffer
+ * @param len In: elements wanted, out: elements available in the run
+ * @return const void* First element of the run (valid if *len > 0)
+ */
+RING_BUFFER_INLINE const void* RingBufferReadPeek(ring_buffer_t *rb, uint32_t *len){
+	uint32_t tail = rb->tail;
+	uint32_t index = tail & rb->mask;
+	uint32_t count = rb->head_cache - tail;
+	uint32_t run;
+
+	if(count < *len){
+		rb->head_cache = __atomic_load_n(&rb->head, __ATOMIC_ACQUIRE);
+		count = rb->head_cache - tail;
+	}
+	run = rb->mask + 1 - index;
+	if(run > count){
+		run = count;
+	}
+	if(*len > run){
+		*len = run;
+	}
+	return rb->data + index * rb->elem_size;
+}
+
+/**
+ * @brief Consumer: release elements read from a peeked run
+ *
+ * @param rb Ring buffer
+ * @param len Elements read (<= elements peeked)
+ */
+RING_BUFFER_INLINE void RingBufferReadRelease(ring_buffer_t *rb, uint32_t len){
+	__atomic_store_n(&rb->tail, rb->tail + len, __ATOMIC_RELEASE);
+}
+
+/**
+ * @brief Producer: write up to len elements
+ *
+ * @param rb Ring buffer
+ * @param elems Elements
+ * @param len Number of elements
+ * @return uint32_t Elements written (less than len if the buffer is full)
+ */
+RING_BUFFER_INLINE uint32_t RingBufferWrite(ring_buffer_t *rb, const void *elems, uint32_t len){
+	const uint8_t *src = elems;
+	uint32_t done = 0, run;
+	void *dst;
+
+	/* At most two runs: up to the end of the storage and from the start */
+	for(uint8_t i = 0; (i < 2) && (done < len); i++){
+		run = len - done;
+		dst = RingBufferWriteReserve(rb, &run);
+		if(run == 0){
+			break;
+		}
+		memcpy(dst, src, run * rb->elem_size);
+		RingBufferWriteCommit(rb, run);
+		src += run * rb->elem_size;
+		done += run;
+	}
+	return done;
+}
+
+/**
+ * @brief Consumer: read up to len elements
+ *
+ * @param rb Ring buffer
+ * @param elems Destination
+ * @param len Max number of elements
+ * @return uint32_t Elements read (less than len if the buffer gets empty)
+ */
+RING_BUFFER_INLINE uint32_t RingBufferRead(ring_buffer_t *rb, void *elems, uint32_t len){
+	uint8_t *dst = elems;
+	uint32_t done = 0, run;
+	const void *src;
+
+	for(uint8_t i = 0; (i < 2) && (done < len); i++){
+		run = len - done;
+		src = RingBufferReadPeek(rb, &run);
+		if(run == 0){
+			break;
+		}
+		memcpy(dst, src, run * rb->elem_size);
+		RingBufferReadRelease(rb, run);
+		dst += run * rb->elem_size;
+		done += run;
+	}
+	return done;
+}
+
+/**
+ * @brief Producer: write one element
+ *
+ * @param rb Ring buffer
+ * @param elem Element
+ * @return true: written, false: buffer full
+ */
+RING_BUFFER_INLINE bool RingBufferPush(ring_buffer_t *rb, const void *elem){
+	uint32_t head = rb->head;
+
+	if(head - rb->tail_cache > rb->mask){
+		rb->tail_cache = __atomic_load_n(&rb->tail, __ATOMIC_ACQUIRE);
+		if(head - rb->tail_cache > rb->mask){
+			return false;
+		}
+	}
+	memcpy(rb->data + (head & rb->mask) * rb->elem_size, elem, rb->elem_size);
+	__atomic_store_n(&rb->head, head + 1, __ATOMIC_RELEASE);
+	return true;
+}
+
+/**
+ * @brief Consumer: read one element
+ *
+ * @param rb Ring buffer
+ * @param elem Destination
+ * @return true: read, false: buffer empty
+ */
+RING_BUFFER_INLINE bool RingBufferPop(ring_buffer_t *rb, void *elem){
+	uint32_t tail = rb->tail;
+
+	if(tail == rb->head_cache){
+		rb->head_cache = __atomic_load_n(&rb->head, __ATOMIC_ACQUIRE);
+		if(tail == rb->head_cache){
+			return false;
+		}
+	}
+	memcpy(elem, rb->data + (tail & rb->mask) * rb->elem_size, rb->elem_size);
+	__atomic_store_n(&rb->tail, tail + 1, __ATOMIC_RELEASE);
+	return true;
+}
+
+/**
+ * @brief Initialize an MPSC ring buffer (empty)
+ *
+ * @param rb Ring buffer
+ * @param storage Storage of size elements
+ * @param seq Storage of size sequence numbers
+ * @param size Number of elements (power of two)
+ * @param elem_size Bytes per element
+ * @return true: OK, false: size is not a power of two
+ */
+RING_BUFFER_INLINE bool RingBufferMpInit(ring_buffer_mp_t *rb, void *storage, uint32_t *seq, uint32_t size, uint32_t elem_size){
+	if((size == 0) || (size & (size - 1))){
+		return false;
+	}
+	rb->data = storage;
+	rb->seq = seq;
+	rb->mask = size - 1;
+	rb->elem_size = elem_size;
+	rb->head = 0;
+	rb->tail = 0;
+	/* seq == position: slot free for the producer that reserves position */
+	for(uint32_t i = 0; i < size; i++){
+		seq[i] = i;
+	}
+	return true;
+}
+
+/**
+ * @brief Producer (any task or ISR): write one element
+ *
+ * @param rb Ring buffer
+ * @param elem Element
+ * @return true: written, false: buffer full
+ */
+RING_BUFFER_INLINE bool RingBufferMpPush(ring_buffer_mp_t *rb, const void *elem){
+	uint32_t pos = __atomic_load_n(&rb->head, __ATOMIC_RELAXED);
+	uint32_t *seq;
+	int32_t diff;
+
+	while(1){
+		seq = &rb->seq[pos & rb->mask];
+		diff = (int32_t)(__atomic_load_n(seq, __ATOMIC_ACQUIRE) - pos);
+		if(diff == 0){
+			/* Slot free: reserve it (pos is reloaded if another producer won) */
+			if(__atomic_compare_exchange_n(&rb->head, &pos, pos + 1, true, __ATOMIC_RELAXED, __ATOMIC_RELAXED)){
+				break;
+			}
+		} else if(diff < 0){
+			/* Slot not read yet: full */
+			return false;
+		} else{
+			pos = __atomic_load_n(&rb->head, __ATOMIC_RELAXED);
+		}
+	}
+	memcpy(rb->data + (pos & rb->mask) * rb->elem_size, elem, rb->elem_size);
+	__atomic_store_n(seq, pos + 1, __ATOMIC_RELEASE);
+	return true;
+}
+
+/**
+ * @brief Consumer: read one element
+ *
+ * Elements are read in reservation order: an element reserved by a producer
+ * that was preempted before publishing it holds back the next ones.
+ *
+ * @param rb Ring buffer
+ * @param elem Destination
+ * @return true: read, false: buffer empty (or next element not published yet)
+ */
+RING_BUFFER_INLINE bool RingBufferMpPop(ring_buffer_mp_t *rb, void *elem){
+	uint32_t pos = rb->tail;
+	uint32_t *seq = &rb->seq[pos & rb->mask];
+
+	if(__atomic_load_n(seq, __ATOMIC_ACQUIRE) != pos + 1){
+		return false;
+	}
+	memcpy(elem, rb->data + (pos & rb->mask) * rb->elem_size, rb->elem_size);
+	/* Free for the producer of the next lap */
+	__atomic_store_n(seq, pos + rb->mask + 1, __ATOMIC_RELEASE);
+	__atomic_store_n(&rb->tail, pos + 1, __ATOMIC_RELAXED);
+	return true;
+}
+
+/**
+ * @brief Elements reserved and not read yet (approximate while producers run)
+ *
+ * @param rb Ring buffer
+ * @return uint32_t Elements in the buffer
+ */
+RING_BUFFER_INLINE uint32_t RingBufferMpCount(const ring_buffer_mp_t *rb){
+	return __atomic_load_n(&rb->head, __ATOMIC_RELAXED) - __atomic_load_n(&rb->tail, __ATOMIC_RELAXED);
+}
+
+/** @} doxygen end group definition */
+/** @} doxygen end group definition */
+/** @} doxygen end group definition */
+#endif /* RING_BUFFER_MCU_H */
+
+/*==================[end of file]============================================*/
@@ -0,0 +1,236 @@
+#ifndef STATS_MCU_H
+#define STATS_MCU_H
+/** \addtogroup Drivers_Programable Drivers Programable
+ ** @{ */
+/** \addtogroup Drivers_Microcontroller Drivers microcontroller
+ ** @{ */
+/** \addtogroup STATS Stats
+ ** @{ */
+
+/** \brief Performance counters of the microcontroller drivers.
+ *
+ * Every driver instance (SPI device, I2C bus, UART port, ADC channel, BLE
+ * link, timer) has a set of counters, always enabled:
+ * - Transactions, bytes and errors: failed transfers, I2C NACKs, received
+ *   UART bytes dropped (target: overflow events) and BLE messages dropped
+ *   while disconnected.
+ * - Total and max time of a transaction (timers: of the ISR callback).
+ * - High-water mark of the queue depth (UART received bytes waiting, BLE
+ *   messages waiting to be sent).
+ *
+ * The drivers update them with relaxed atomic adds and a cycle counter read
+ * (StatsStart() / StatsEnd()), safe from ISRs and tasks: a few tens of cycles
+ * per transaction. StatsGet() takes a snapshot of an instance (optionally
+ * resetting it), StatsFormat() gives one compact line per instance and
+ * StatsSend() streams the lines of the active instances over UART as
+ * telemetry, e.g. to find how many SPI transactions a screen refresh costs:
+ *
+ * @code
+ * StatsReset();
+ * ILI9341DrawFilledRectangle(0, 0, 239, 319, ILI9341_WHITE);
+ * StatsGet(STATS_SPI(SPI_1), &spi, false);
+ * @endcode
+ *
+ * @section changelog
+ *
+ * |   Date	    | Description                                    						|
+ * |:----------:|:----------------------------------------------------------------------|
+ * | 19/10/2026 | Document creation		                         						|
+ *
+ **/
+
+/*==================[inclusions]=============================================*/
+#include <stdbool.h>
+#include <stdint.h>
+#include "uart_mcu.h"
+#ifdef MCU_HOST
+#include "host_mcu.h"
+#else
+#include "sdkconfig.h"
+#include "esp_cpu.h"
+#endif
+/*==================[macros]=================================================*/
+#ifdef MCU_HOST
+#define STATS_TICKS_PER_US		1000							/*!< Virtual ns */
+#else
+#define STATS_TICKS_PER_US		CONFIG_ESP_DEFAULT_CPU_FREQ_MHZ	/*!< CPU cycles */
+#endif
+#define STATS_LINE_SIZE			96		/*!< Max length of a report line */
+
+#define STATS_SPI(device)		(STATS_SPI_1 + (device))		/*!< Instance of a SPI device (spi_dev_t) */
+#define STATS_UART(port)		(STATS_UART_PC + (port))		/*!< Instance of a UART port (uart_mcu_port_t) */
+#define STATS_ADC(channel)		(STATS_ADC_CH0 + (channel))		/*!< Instance of an analog input (adc_ch_t) */
+#define STATS_TIMER(timer)		(STATS_TIMER_A + (timer))		/*!< Instance of a timer (timer_mcu_t) */
+/*==================[typedef]================================================*/
+/**
+ * @brief Driver instances
+ */
+typedef enum {
+	STATS_SPI_1 = 0,		/*!< SPI device SPI_1 */
+	STATS_SPI_2,			/*!< SPI device SPI_2 */
+	STATS_SPI_3,			/*!< SPI device SPI_3 */
+	STATS_I2C,				/*!< I2C bus */
+	STATS_UART_PC,			/*!< UART_PC */
+	STATS_UART_CONNECTOR,	/*!< UART_CONNECTOR */
+	STATS_ADC_CH0,			/*!< Analog input CH0 */
+	STATS_ADC_CH1,			/*!< Analog input CH1 */
+	STATS_ADC_CH2,			/*!< Analog input CH2 */
+	STATS_ADC_CH3,			/*!< Analog input CH3 */
+	STATS_BLE,				/*!< BLE link (sent messages) */
+	STATS_TIMER_A,			/*!< TIMER_A ISR */
+	STATS_TIMER_B,			/*!< TIMER_B ISR */
+	STATS_TIMER_C,			/*!< TIMER_C ISR */
+	STATS_QTY
+} stats_id_t;
+
+/**
+ * @brief Counters of an instance (updated by the inline functions of this
+ * file)
+ */
+typedef struct {
+	uint32_t transactions;		/*!< Transactions */
+	uint32_t bytes;				/*!< Bytes transferred */
+	uint32_t errors;			/*!< Failed transactions or dropped bytes */
+	uint32_t time_max;			/*!< Max transaction time (ticks) */
+	uint64_t time_total;		/*!< Total transaction time (ticks) */
+	uint32_t depth_max;			/*!< Queue depth high-water mark */
+} stats_counters_t;
+
+/**
+ * @brief Snapshot of an instance (StatsGet())
+ */
+typedef struct {
+	uint32_t transactions;		/*!< Transactions */
+	uint32_t bytes;				/*!< Bytes transferred */
+	uint32_t errors;			/*!< Failed transactions or dropped bytes */
+	uint32_t time_max;			/*!< Max transaction time (ns) */
+	uint64_t time_total;		/*!< Total transaction time (ns) */
+	uint32_t depth_max;			/*!< Queue depth high-water mark */
+} stats_t;
+/*==================[external data declaration]==============================*/
+extern stats_counters_t stats_counters[STATS_QTY];	/*!< Counters of each instance */
+/*==================[external functions declaration]=========================*/
+/**
+ * @brief Time stamp of the start of a transaction (ISR and task safe)
+ *
+ * @return uint32_t Ticks (CPU cycles, host backend: virtual ns)
+ */
+static inline __attribute__((always_inline)) uint32_t StatsStart(void){
+#ifdef MCU_HOST
+	return (uint32_t)HostTimeNs();
+#else
+	return esp_cpu_get_cycle_count();
+#endif
+}
+
+/**
+ * @brief Raise a high-water mark (relaxed compare and swap)
+ *
+ * @param mark High-water mark
+ * @param value New value
+ */
+static inline __attribute__((always_inline)) void StatsMax(uint32_t *mark, uint32_t value){
+	uint32_t old = __atomic_load_n(mark, __ATOMIC_RELAXED);
+
+	while((value > old) && !__atomic_compare_exchange_n(mark, &old, value, true, __ATOMIC_RELAXED, __ATOMIC_RELAXED)){
+	}
+}
+
+/**
+ * @brief Count a transaction (ISR and task safe)
+ *
+ * @note Always inlined: it is called from IRAM ISRs.
+ *
+ * @param id Instance
+ * @param start StatsStart() at the start of the transaction
+ * @param bytes Bytes transferred
+ * @param ok false: failed transaction (counted as an error)
+ */
+static inline __attribute__((always_inline)) void StatsEnd(stats_id_t id, uint32_t start, uint32_t bytes, bool ok){
+	stats_counters_t *c = &stats_counters[id];
+	uint32_t time = StatsStart() - start;
+
+	__atomic_fetch_add(&c->transactions, 1, __ATOMIC_RELAXED);
+	__atomic_fetch_add(&c->bytes, bytes, __ATOMIC_RELAXED);
+	if(!ok){
+		__atomic_fetch_add(&c->errors, 1, __ATOMIC_RELAXED);
+	}
+	__atomic_fetch_add(&c->time_total, time, __ATOMIC_RELAXED);
+	StatsMax(&c->time_max, time);
+}
+
+/**
+ * @brief Count errors outside a transaction, e.g. dropped bytes (ISR and
+ * task safe)
+ *
+ * @param id Instance
+ * @param errors Number of errors
+ */
+static inline __attribute__((always_inline)) void StatsError(stats_id_t id, uint32_t errors){
+	__atomic_fetch_add(&stats_counters[id].errors, errors, __ATOMIC_RELAXED);
+}
+
+/**
+ * @brief Queue depth seen by the driver (ISR and task safe)
+ *
+ * @param id Instance
+ * @param depth Elements waiting in the queue
+ */
+static inline __attribute__((always_inline)) void StatsDepth(stats_id_t id, uint32_t depth){
+	StatsMax(&stats_counters[id].depth_max, depth);
+}
+
+/**
+ * @brief Name of an instance
+ *
+ * @param id Instance
+ * @return const char* Name (e.g. "spi_1")
+ */
+const char* StatsName(stats_id_t id);
+
+/**
+ * @brief Snapshot of the counters of an instance
+ *
+ * @param id Instance
+ * @param stats Snapshot (times in ns)
+ * @param reset true: reset the counters (each one is read and cleared
+ * atomically)
+ */
+void StatsGet(stats_id_t id, stats_t *stats, bool reset);
+
+/**
+ * @brief Reset the counters of every instance
+ */
+void StatsReset(void);
+
+/**
+ * @brief Report line of an instance: name, transactions, bytes, errors,
+ * average/max time and queue high-water mark
+ *
+ * @param stats Snapshot (StatsGet())
+ * @param id Instance
+ * @param line Buffer (STATS_LINE_SIZE bytes)
+ * @param size Buffer size
+ * @return uint16_t Line length
+ */
+uint16_t StatsFormat(const stats_t *stats, stats_id_t id, char *line, uint16_t size);
+
+/**
+ * @brief Send the report lines of the instances with transactions or errors
+ * over UART
+ *
+ * @note The UART counters include the transfers of the report itself. Blocks
+ * until the report is queued (UartWriteBuffer()).
+ *
+ * @param port UART port (initialized)
+ * @param reset true: reset the counters (start a new telemetry window)
+ * @return uint8_t Lines sent
+ */
+uint8_t StatsSend(uart_mcu_port_t port, bool reset);
+
+/** @} doxygen end group definition */
+/** @} doxygen end group definition */
+/** @} doxygen end group definition */
+#endif /* STATS_MCU_H */
+
+/*==================[end of file]============================================*/
@@ -0,0 +1,217 @@
+#ifndef TRACE_MCU_H
+#define TRACE_MCU_H
+/** \addtogroup Drivers_Programable Drivers Programable
+ ** @{ */
+/** \addtogroup Drivers_Microcontroller Drivers microcontroller
+ ** @{ */
+/** \addtogroup TRACE Trace
+ ** @{ */
+
+/** \brief Low overhead binary event tracer.
+ *
+ * Records compact events (8 bytes: cycle counter timestamp, type, id and a
+ * 16 bit argument) to a RAM ring buffer: ISR enter/exit of the timer and GPIO
+ * handlers, SPI/I2C/UART transactions start/end, task notify/take and user
+ * marks and spans. Recording an event is a relaxed atomic increment, a cycle
+ * counter read and an 8 byte store (tens of cycles), safe from ISRs and
+ * tasks.
+ *
+ * The buffer works as a flight recorder: when it is full the oldest events
+ * are overwritten. TraceStop() freezes it (e.g. after a missed deadline) and
+ * TraceFlush() streams it over UART in binary form. The stream is converted
+ * to Chrome trace / Perfetto JSON on the host with
+ * drivers/tools/trace_to_json.py.
+ *
+ * Enabled with CONFIG_MCU_TRACE (menuconfig: Drivers), which defines
+ * MCU_TRACE. When disabled every function of this file is empty and the tracer
+ * compiles out completely: the arguments of the recording macros are not
+ * evaluated, don't pass expressions with side effects.
+ *
+ * @section changelog
+ *
+ * |   Date	    | Description                                    						|
+ * |:----------:|:----------------------------------------------------------------------|
+ * | 19/10/2026 | Document creation		                         						|
+ *
+ **/
+
+/*==================[inclusions]=============================================*/
+#include <stdbool.h>
+#include <stdint.h>
+#include "uart_mcu.h"
+#ifdef MCU_TRACE
+#ifdef MCU_HOST
+#include "host_mcu.h"
+#else
+#include "esp_cpu.h"
+#endif
+#endif
+/*==================[macros]=================================================*/
+#ifndef TRACE_BUFFER_SIZE
+#define TRACE_BUFFER_SIZE		1024	/*!< Events in the ring buffer (power of two) */
+#endif
+#define TRACE_MAGIC				"TRCE"	/*!< Stream header magic */
+#define TRACE_VERSION			1		/*!< Stream format version */
+
+#define TRACE_ISR_TIMER(timer)	(timer)				/*!< ISR id of a timer (TIMER_A, TIMER_B, TIMER_C) */
+#define TRACE_ISR_GPIO(pin)		(0x10 + (pin))		/*!< ISR id of a GPIO interrupt */
+/*==================[typedef]================================================*/
+/**
+ * @brief Event types
+ */
+typedef enum {
+	TRACE_ISR_ENTER = 0,	/*!< id: ISR (TRACE_ISR_TIMER, TRACE_ISR_GPIO) */
+	TRACE_ISR_EXIT,			/*!< id: ISR */
+	TRACE_TASK_NOTIFY,		/*!< id: notified task */
+	TRACE_TASK_TAKE,		/*!< id: task, arg: pending notifications */
+	TRACE_SPI_START,		/*!< id: SPI device, arg: bytes */
+	TRACE_SPI_END,			/*!< id: SPI device */
+	TRACE_I2C_START,		/*!< id: device address, arg: bytes */
+	TRACE_I2C_END,			/*!< id: device address, arg: ACK */
+	TRACE_UART_START,		/*!< id: UART port, arg: bytes */
+	TRACE_UART_END,			/*!< id: UART port, arg: bytes transferred */
+	TRACE_MARK,				/*!< id: user mark, arg: user value */
+	TRACE_SPAN_START,		/*!< id: user span (task) */
+	TRACE_SPAN_END			/*!< id: user span (task) */
+} trace_type_t;
+
+/**
+ * @brief Trace event (8 bytes, little endian in the stream)
+ */
+typedef struct {
+	uint32_t time;			/*!< CPU cycle counter */
+	uint8_t type;			/*!< Event type (trace_type_t) */
+	uint8_t id;				/*!< Source */
+	uint16_t arg;			/*!< Argument */
+} trace_event_t;
+
+/**
+ * @brief Stream header, followed by count events (oldest first)
+ */
+typedef struct {
+	char magic[4];			/*!< TRACE_MAGIC */
+	uint8_t version;		/*!< TRACE_VERSION */
+	uint8_t event_size;		/*!< sizeof(trace_event_t) */
+	uint16_t ticks_per_us;	/*!< Cycle counter frequency (MHz) */
+	uint32_t count;			/*!< Events in the stream */
+	uint32_t lost;			/*!< Events overwritten before the flush */
+} trace_header_t;
+/*==================[external data declaration]==============================*/
+#ifdef MCU_TRACE
+extern trace_event_t trace_buffer[TRACE_BUFFER_SIZE];	/*!< Ring buffer */
+extern uint32_t trace_head;								/*!< Events recorded since TraceStart() */
+extern volatile bool trace_running;						/*!< Recording enabled */
+#endif
+/*==================[external functions declaration]=========================*/
+#ifdef MCU_TRACE
+/**
+ * @brief Cycle counter used for the timestamps
+ *
+ * @return uint32_t CPU cycles (host backend: virtual ns)
+ */
+static inline __attribute__((always_inline)) uint32_t TraceCycles(void){
+#ifdef MCU_HOST
+	return (uint32_t)HostTimeNs();
+#else
+	return esp_cpu_get_cycle_count();
+#endif
+}
+
+/**
+ * @brief Record an event (ISR and task safe)
+ *
+ * @note Always inlined: it is called from IRAM ISRs.
+ *
+ * @param type Event type (trace_type_t)
+ * @param id Source
+ * @param arg Argument
+ */
+static inline __attribute__((always_inline)) void TraceEvent(uint8_t type, uint8_t id, uint16_t arg){
+	trace_event_t *e;
+
+	if(trace_running){
+		e = &trace_buffer[__atomic_fetch_add(&trace_head, 1, __ATOMIC_RELAXED) & (TRACE_BUFFER_SIZE - 1)];
+		e->time = TraceCycles();
+		e->type = type;
+		e->id = id;
+		e->arg = arg;
+	}
+}
+
+/**
+ * @brief Clear the buffer and start recording
+ */
+void TraceStart(void);
+
+/**
+ * @brief Stop recording (the buffer keeps the last TRACE_BUFFER_SIZE events)
+ */
+void TraceStop(void);
+
+/**
+ * @brief Copy the buffer, oldest event first
+ *
+ * @param events Destination
+ * @param max Max number of events to copy
+ * @param lost Events overwritten (can be NULL)
+ * @return uint32_t Number of events copied
+ */
+uint32_t TraceCopy(trace_event_t *events, uint32_t max, uint32_t *lost);
+
+/**
+ * @brief Send the buffer over UART: trace_header_t and the events, oldest
+ * first
+ *
+ * @note Call TraceStop() first to get a consistent snapshot. The port must be
+ * initialized. Blocks until the whole stream is queued (UartWriteBuffer()):
+ * about 0.7 s for a full 1024 events buffer at 115200 bit/s.
+ *
+ * @param port UART port
+ * @return uint32_t Number of events sent
+ */
+uint32_t TraceFlush(uart_mcu_port_t port);
+
+#define TraceIsrEnter(isr)				TraceEvent(TRACE_ISR_ENTER, (isr), 0)			/*!< ISR entry */
+#define TraceIsrExit(isr)				TraceEvent(TRACE_ISR_EXIT, (isr), 0)			/*!< ISR exit */
+#define TraceTaskNotify(task)			TraceEvent(TRACE_TASK_NOTIFY, (task), 0)		/*!< Task notified (ISR or task) */
+#define TraceTaskTake(task, pending)	TraceEvent(TRACE_TASK_TAKE, (task), (pending))	/*!< Task woke up with pending notifications */
+#define TraceSpiStart(dev, len)			TraceEvent(TRACE_SPI_START, (dev), (len))		/*!< SPI transaction start */
+#define TraceSpiEnd(dev)				TraceEvent(TRACE_SPI_END, (dev), 0)				/*!< SPI transaction end */
+#define TraceI2CStart(addr, len)		TraceEvent(TRACE_I2C_START, (addr), (len))		/*!< I2C transaction start */
+#define TraceI2CEnd(addr, ack)			TraceEvent(TRACE_I2C_END, (addr), (ack))		/*!< I2C transaction end */
+#define TraceUartStart(port, len)		TraceEvent(TRACE_UART_START, (port), (len))		/*!< UART transfer start */
+#define TraceUartEnd(port, len)			TraceEvent(TRACE_UART_END, (port), (len))		/*!< UART transfer end */
+#define TraceMark(id, value)			TraceEvent(TRACE_MARK, (id), (value))			/*!< User mark */
+#define TraceSpanStart(id)				TraceEvent(TRACE_SPAN_START, (id), 0)			/*!< User span start */
+#define TraceSpanEnd(id)				TraceEvent(TRACE_SPAN_END, (id), 0)				/*!< User span end */
+#else
+#define TraceEvent(type, id, arg)		((void)0)
+#define TraceStart()					((void)0)
+#define TraceStop()						((void)0)
+static inline uint32_t TraceCopy(trace_event_t *events, uint32_t max, uint32_t *lost){
+	return 0;
+}
+static inline uint32_t TraceFlush(uart_mcu_port_t port){
+	return 0;
+}
+#define TraceIsrEnter(isr)				((void)0)
+#define TraceIsrExit(isr)				((void)0)
+#define TraceTaskNotify(task)			((void)0)
+#define TraceTaskTake(task, pending)	((void)0)
+#define TraceSpiStart(dev, len)			((void)0)
+#define TraceSpiEnd(dev)				((void)0)
+#define TraceI2CStart(addr, len)		((void)0)
+#define TraceI2CEnd(addr, ack)			((void)0)
+#define TraceUartStart(port, len)		((void)0)
+#define TraceUartEnd(port, len)			((void)0)
+#define TraceMark(id, value)			((void)0)
+#define TraceSpanStart(id)				((void)0)
+#define TraceSpanEnd(id)				((void)0)
+#endif
+
+/** @} doxygen end group definition */
+/** @} doxygen end group definition */
+/** @} doxygen end group definition */
+#endif /* TRACE_MCU_H */
+
+/*==================[end of file]============================================*/
@@ -97,6 +97,20 @@ void UartSendString(uart_mcu_port_t port, const char *msg);
  */
 void UartSendBuffer(uart_mcu_port_t port, const char *data, uint8_t nbytes);
 
+/**
+ * @brief Send multiple bytes through serial port, waiting for room in the
+ * transmit buffer
+ * 
+ * UartSendByte(), UartSendString() and UartSendBuffer() only fill the free
+ * space of the hardware FIFO (128 bytes) and drop the rest. Use this function
+ * for streams (binary dumps, logs): it returns when every byte is queued.
+ * 
+ * @param port Port for sending data
+ * @param data Pointer to array of data to be transmitted
+ * @param nbytes Number of bytes to be sended
+ */
+void UartWriteBuffer(uart_mcu_port_t port, const char *data, uint16_t nbytes);
+
 /**
  * @brief Convert a number to a String (char array ended with '\0')
  * 
@@ -11,6 +11,8 @@
 
 /*==================[inclusions]=============================================*/
 #include "analog_io_mcu.h"
+#include "analog_cali_mcu.h"
+#include "stats_mcu.h"
 #include "driver/gptimer.h"
 #include "driver/sdm.h"
 #include "esp_adc/adc_cali_scheme.h"
@@ -19,8 +21,9 @@
 /*==================[macros and definitions]=================================*/
 #define ADC_BITWIDTH 		SOC_ADC_DIGI_MAX_BITWIDTH	// 12 bit resolution
 #define ADC_ATTENUATION		ADC_ATTEN_DB_12				// 12dB attenuation (for 0-3,3V ADC range)
+#define ADC_RAW_MAX			ADC_CALI_RAW_MAX			// Max raw value (12 bit)
 /*==================[internal data declaration]==============================*/
-adc_cali_handle_t adc_calibration_single_0, adc_calibration_single_1, adc_calibration_single_2, adc_calibration_single_3;
+adc_cali_handle_t adc_calibration_single[ADC_CH_QTY];
 adc_oneshot_unit_handle_t adc1_single; 
 adc_continuous_handle_t adc2_cont;
 sdm_channel_handle_t dac = NULL;
@@ -35,11 +38,24 @@ adc_oneshot_unit_init_cfg_t init_config_single = {
 adc_oneshot_chan_cfg_t adc_config_single = {
 	.bitwidth = ADC_BITWIDTH,
 	.atten = ADC_ATTENUATION,
-};					
+};
+static const adc_channel_t adc_channel[ADC_CH_QTY] = {ADC_CHANNEL_0, ADC_CHANNEL_1, ADC_CHANNEL_2, ADC_CHANNEL_3};
+/**
+ * @brief Calibration curve of each channel sampled every 2^ADC_CALI_SEG_BITS raw
+ * counts (in mV). Raw values are converted by linear interpolation between points.
+ */
+static uint16_t adc_cali_table[ADC_CH_QTY][ADC_CALI_TABLE_POINTS];
 /*==================[external data definition]===============================*/
 
 /*==================[internal functions definition]==========================*/
+static void AnalogCaliTableInit(adc_ch_t channel){
+	int voltage;
 
+	for(uint8_t i = 0; i < ADC_CALI_TABLE_POINTS; i++){
+		adc_cali_raw_to_voltage(adc_calibration_single[channel], AnalogCaliTableRaw(i), &voltage);
+		adc_cali_table[channel][i] = voltage;
+	}
+}
 /*==================[external functions definition]==========================*/
 
 void AnalogInputInit(analog_input_config_t *config){
@@ -51,52 +67,16 @@ void AnalogInputInit(analog_input_config_t *config){
 				adc_oneshot_new_unit(&init_config_single, &adc1_single);
 				adc1_single_used = true;
 			}
-			switch(config->input){
-				case CH0:
-    				adc_oneshot_config_channel(adc1_single, ADC_CHANNEL_0, &adc_config_single);
-					// create calibration curve
-					adc_cali_curve_fitting_config_t cali_config_0 = {
-						.unit_id = ADC_UNIT_1,
-						.chan = ADC_CHANNEL_0, 
-						.atten = ADC_ATTENUATION,
-						.bitwidth = ADC_BITWIDTH,
-					};
-					ESP_ERROR_CHECK(adc_cali_create_scheme_curve_fitting(&cali_config_0, &adc_calibration_single_0));
-				break;
-				case CH1:
-    				adc_oneshot_config_channel(adc1_single, ADC_CHANNEL_1, &adc_config_single);
-					// create calibration curve
-					adc_cali_curve_fitting_config_t cali_config_1 = {
-						.unit_id = ADC_UNIT_1,
-						.chan = ADC_CHANNEL_1, 
-						.atten = ADC_ATTENUATION,
-						.bitwidth = ADC_BITWIDTH,
-					};
-					ESP_ERROR_CHECK(adc_cali_create_scheme_curve_fitting(&cali_config_1, &adc_calibration_single_1));
-				break;
-				case CH2:
-    				adc_oneshot_config_channel(adc1_single, ADC_CHANNEL_2, &adc_config_single);
-					// create calibration curve
-					adc_cali_curve_fitting_config_t cali_config_2 = {
-						.unit_id = ADC_UNIT_1,
-						.chan = ADC_CHANNEL_2, 
-						.atten = ADC_ATTENUATION,
-						.bitwidth = ADC_BITWIDTH,
-					};
-					ESP_ERROR_CHECK(adc_cali_create_scheme_curve_fitting(&cali_config_2, &adc_calibration_single_2));
-				break;
-				case CH3:
-    				adc_oneshot_config_channel(adc1_single, ADC_CHANNEL_3, &adc_config_single);
-					// create calibration curve
-					adc_cali_curve_fitting_config_t cali_config_3 = {
-						.unit_id = ADC_UNIT_1,
-						.chan = ADC_CHANNEL_3, 
-						.atten = ADC_ATTENUATION,
-						.bitwidth = ADC_BITWIDTH,
-					};
-					ESP_ERROR_CHECK(adc_cali_create_scheme_curve_fitting(&cali_config_3, &adc_calibration_single_3));
-				break;
-			}
+			adc_oneshot_config_channel(adc1_single, adc_channel[config->input], &adc_config_single);
+			// create calibration curve
+			adc_cali_curve_fitting_config_t cali_config = {
+				.unit_id = ADC_UNIT_1,
+				.chan = adc_channel[config->input], 
+				.atten = ADC_ATTENUATION,
+				.bitwidth = ADC_BITWIDTH,
+			};
+			ESP_ERROR_CHECK(adc_cali_create_scheme_curve_fitting(&cali_config, &adc_calibration_single[config->input]));
+			AnalogCaliTableInit(config->input);
 		break;
 		case ADC_CONTINUOUS:
 			switch(config->input){
@@ -128,19 +108,40 @@ void AnalogOutputInit(void){
 }
 
 void AnalogInputReadSingle(adc_ch_t channel, uint16_t *value){
-    switch(channel){
-		case CH0:
-			adc_oneshot_read(adc1_single, ADC_CHANNEL_0, (int*)value);
-		break;
-		case CH1:
-			adc_oneshot_read(adc1_single, ADC_CHANNEL_1, (int*)value);
-		break;
-		case CH2:
-			adc_oneshot_read(adc1_single, ADC_CHANNEL_2, (int*)value);
-		break;
-		case CH3:
-			adc_oneshot_read(adc1_single, ADC_CHANNEL_3, (int*)value);
-		break;
+	int raw = 0;
+	uint32_t start = StatsStart();
+	esp_err_t ret;
+
+	ret = adc_oneshot_read(adc1_single, adc_channel[channel], &raw);
+	StatsEnd(STATS_ADC(channel), start, sizeof(uint16_t), ret == ESP_OK);
+	*value = raw;
+}
+
+void AnalogInputScan(const adc_ch_t *channels, uint8_t qty, uint16_t *values){
+	int raw;
+	uint32_t start;
+	esp_err_t ret;
+
+	for(uint8_t i = 0; i < qty; i++){
+		raw = 0;
+		start = StatsStart();
+		ret = adc_oneshot_read(adc1_single, adc_channel[channels[i]], &raw);
+		StatsEnd(STATS_ADC(channels[i]), start, sizeof(uint16_t), ret == ESP_OK);
+		values[i] = raw;
+	}
+}
+
+void AnalogRawToMv(adc_ch_t channel, const uint16_t *raw, uint16_t *mv, uint16_t len){
+	const uint16_t *table = adc_cali_table[channel];
+
+	for(uint16_t i = 0; i < len; i++){
+		mv[i] = AnalogCaliTableRead(table, raw[i] > ADC_RAW_MAX ? ADC_RAW_MAX : raw[i]);
+	}
+}
+
+void AnalogScanToMv(const adc_ch_t *channels, uint8_t qty, uint16_t *values){
+	for(uint8_t i = 0; i < qty; i++){
+		values[i] = AnalogCaliTableRead(adc_cali_table[channels[i]], values[i] > ADC_RAW_MAX ? ADC_RAW_MAX : values[i]);
 	}
 }
 
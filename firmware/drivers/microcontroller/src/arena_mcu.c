@@ -0,0 +1,236 @@
+/**
+ * @file arena_mcu.c
+ * @brief Static arenas and fixed block pools
+ * @version 0.1
+ * @date 2026-10-19
+ *
+ * @copyright Copyright (c) 2026
+ *
+ */
+
+/*==================[inclusions]=============================================*/
+#include "arena_mcu.h"
+#include <stddef.h>
+#include <stdio.h>
+#ifdef MCU_HOST
+#include <stdlib.h>
+#else
+#include "esp_heap_caps.h"
+#include "freertos/FreeRTOS.h"
+#endif
+/*==================[macros and definitions]=================================*/
+#define ARENA_ROUND(size)	(((size) + ARENA_ALIGN - 1) & ~(uint32_t)(ARENA_ALIGN - 1))
+
+#ifdef MCU_HOST
+#define MEMORY_LOCK()		/* host backend: single thread */
+#define MEMORY_UNLOCK()
+#else
+#define MEMORY_LOCK()		portENTER_CRITICAL_SAFE(&memory_lock)
+#define MEMORY_UNLOCK()		portEXIT_CRITICAL_SAFE(&memory_lock)
+#endif
+/*==================[internal data declaration]==============================*/
+
+/*==================[internal functions declaration]=========================*/
+
+/*==================[internal data definition]===============================*/
+#ifndef MCU_HOST
+static portMUX_TYPE memory_lock = portMUX_INITIALIZER_UNLOCKED;
+#endif
+static arena_t *arenas = NULL;		/*!< Arenas in use */
+static pool_t *pools = NULL;		/*!< Pools in use */
+/*==================[external data definition]===============================*/
+arena_t arena_dsp = ARENA_INITIALIZER("dsp", CONFIG_MCU_ARENA_DSP_SIZE, false);
+arena_t arena_scratch = ARENA_INITIALIZER("scratch", CONFIG_MCU_ARENA_SCRATCH_SIZE, false);
+pool_t pool_dma = POOL_INITIALIZER("dma", CONFIG_MCU_POOL_DMA_BLOCK_SIZE, CONFIG_MCU_POOL_DMA_BLOCKS, ARENA_DMA);
+/*==================[internal functions definition]==========================*/
+static void* MemoryHeap(uint32_t size, bool dma){
+#ifdef MCU_HOST
+	return malloc(size);		/* glibc: 16 byte aligned */
+#else
+	return heap_caps_aligned_alloc(ARENA_ALIGN, size, dma ? (MALLOC_CAP_DMA | MALLOC_CAP_INTERNAL) : MALLOC_CAP_8BIT);
+#endif
+}
+
+static void MemoryHeapFree(void *memory){
+#ifdef MCU_HOST
+	free(memory);
+#else
+	heap_caps_free(memory);
+#endif
+}
+
+/* Free list through the first word of each block (called with the lock taken) */
+static void PoolBuild(pool_t *pool){
+	pool->free_list = NULL;
+	for(uint32_t i = pool->blocks; i > 0; i--){
+		void **block = (void **)(pool->base + (i - 1) * pool->block_size);
+		*block = pool->free_list;
+		pool->free_list = block;
+	}
+}
+
+/* Memory of the arena from the heap, the first time it is used */
+static bool ArenaAcquire(arena_t *arena){
+	uint8_t *memory;
+
+	if(arena->base != NULL){
+		return true;
+	}
+	memory = MemoryHeap(arena->size, arena->dma);
+	if(memory == NULL){
+		return false;
+	}
+	MEMORY_LOCK();
+	if(arena->base == NULL){
+		arena->base = memory;
+		arena->next = arenas;
+		arenas = arena;
+		memory = NULL;
+	}
+	MEMORY_UNLOCK();
+	/* Acquired by another task in the meantime */
+	if(memory != NULL){
+		MemoryHeapFree(memory);
+	}
+	return true;
+}
+
+static bool PoolAcquire(pool_t *pool){
+	uint8_t *memory;
+
+	if(pool->base != NULL){
+		return true;
+	}
+	pool->block_size = ARENA_ROUND(pool->block_size);
+	memory = MemoryHeap(pool->block_size * pool->blocks, pool->dma);
+	if(memory == NULL){
+		return false;
+	}
+	MEMORY_LOCK();
+	if(pool->base == NULL){
+		pool->base = memory;
+		PoolBuild(pool);
+		pool->next = pools;
+		pools = pool;
+		memory = NULL;
+	}
+	MEMORY_UNLOCK();
+	if(memory != NULL){
+		MemoryHeapFree(memory);
+	}
+	return true;
+}
+/*==================[external functions definition]==========================*/
+void ArenaInit(arena_t *arena, const char *name, void *memory, uint32_t size, bool dma){
+	arena->name = name;
+	arena->size = size;
+	arena->dma = dma;
+	arena->base = NULL;
+	arena->used = arena->peak = arena->fails = 0;
+	if(memory != NULL){
+		MEMORY_LOCK();
+		arena->base = memory;
+		arena->next = arenas;
+		arenas = arena;
+		MEMORY_UNLOCK();
+	}
+}
+
+void* ArenaAlloc(arena_t *arena, uint32_t size){
+	void *memory = NULL;
+
+	if(!ArenaAcquire(arena)){
+		arena->fails++;
+		return NULL;
+	}
+	size = ARENA_ROUND(size);
+	MEMORY_LOCK();
+	if(size <= arena->size - arena->used){
+		memory = arena->base + arena->used;
+		arena->used += size;
+		if(arena->used > arena->peak){
+			arena->peak = arena->used;
+		}
+	} else{
+		arena->fails++;
+	}
+	MEMORY_UNLOCK();
+	return memory;
+}
+
+uint32_t ArenaMark(const arena_t *arena){
+	return arena->used;
+}
+
+void ArenaReset(arena_t *arena, uint32_t mark){
+	MEMORY_LOCK();
+	if(mark < arena->used){
+		arena->used = mark;
+	}
+	MEMORY_UNLOCK();
+}
+
+void PoolInit(pool_t *pool, const char *name, void *memory, uint32_t block_size, uint32_t blocks, bool dma){
+	pool->name = name;
+	pool->block_size = ARENA_ROUND(block_size);
+	pool->blocks = blocks;
+	pool->dma = dma;
+	pool->base = NULL;
+	pool->free_list = NULL;
+	pool->used = pool->peak = pool->fails = 0;
+	if(memory != NULL){
+		MEMORY_LOCK();
+		pool->base = memory;
+		PoolBuild(pool);
+		pool->next = pools;
+		pools = pool;
+		MEMORY_UNLOCK();
+	}
+}
+
+void* PoolAlloc(pool_t *pool){
+	void **block = NULL;
+
+	if(!PoolAcquire(pool)){
+		pool->fails++;
+		return NULL;
+	}
+	MEMORY_LOCK();
+	if(pool->free_list != NULL){
+		block = pool->free_list;
+		pool->free_list = *block;
+		if(++pool->used > pool->peak){
+			pool->peak = pool->used;
+		}
+	} else{
+		pool->fails++;
+	}
+	MEMORY_UNLOCK();
+	return block;
+}
+
+void PoolFree(pool_t *pool, void *block){
+	if(block == NULL){
+		return;
+	}
+	MEMORY_LOCK();
+	*(void **)block = pool->free_list;
+	pool->free_list = block;
+	pool->used--;
+	MEMORY_UNLOCK();
+}
+
+void MemoryPrint(void){
+	printf("%-10s %8s %8s %8s %6s\n", "arena", "size", "used", "peak", "fails");
+	for(arena_t *a = arenas; a != NULL; a = a->next){
+		printf("%-10s %8lu %8lu %8lu %6lu\n", a->name, (unsigned long)a->size, (unsigned long)a->used,
+			(unsigned long)a->peak, (unsigned long)a->fails);
+	}
+	printf("%-10s %8s %8s %8s %6s\n", "pool", "blocks", "used", "peak", "fails");
+	for(pool_t *p = pools; p != NULL; p = p->next){
+		printf("%-10s %3lux%-4lu %8lu %8lu %6lu\n", p->name, (unsigned long)p->blocks, (unsigned long)p->block_size,
+			(unsigned long)p->used, (unsigned long)p->peak, (unsigned long)p->fails);
+	}
+}
+
+/*==================[end of file]============================================*/
@@ -11,6 +11,7 @@
 
 /*==================[inclusions]=============================================*/
 #include "ble_mcu.h"
+#include "stats_mcu.h"
 #include <stdint.h>
 #include <string.h>
 
@@ -408,6 +409,8 @@ void bluetooth_events_task(void * arg) {
 	uint16_t spp_conn_id = 0xffff;
 	esp_gatt_if_t spp_gatts_if = 0xff;
 	int data_sent, i;
+	uint32_t start;
+	bool ok;
 
 	while(1){
 		vTaskDelay(50 / portTICK_PERIOD_MS);
@@ -429,17 +432,23 @@ void bluetooth_events_task(void * arg) {
                 if (status == BLE_CONNECTED) {
 					data_sent = 0;
 					i = 0;
+					start = StatsStart();
+					ok = true;
 					while(data_sent < cmdBuf.length){
 						if((cmdBuf.length - data_sent) > MTU_MAX_BYTES){
-							esp_ble_gatts_send_indicate(spp_gatts_if, spp_conn_id, spp_handle_table[SPP_IDX_SPP_DATA_NOTIFY_VAL], MTU_MAX_BYTES, &cmdBuf.payload[i*MTU_MAX_BYTES], false);
+							ok &= ESP_OK == esp_ble_gatts_send_indicate(spp_gatts_if, spp_conn_id, spp_handle_table[SPP_IDX_SPP_DATA_NOTIFY_VAL], MTU_MAX_BYTES, &cmdBuf.payload[i*MTU_MAX_BYTES], false);
 							data_sent += MTU_MAX_BYTES;
 							i++;
 						}else{
-							esp_ble_gatts_send_indicate(spp_gatts_if, spp_conn_id, spp_handle_table[SPP_IDX_SPP_DATA_NOTIFY_VAL], cmdBuf.length - data_sent, &cmdBuf.payload[i*MTU_MAX_BYTES], false);
+							ok &= ESP_OK == esp_ble_gatts_send_indicate(spp_gatts_if, spp_conn_id, spp_handle_table[SPP_IDX_SPP_DATA_NOTIFY_VAL], cmdBuf.length - data_sent, &cmdBuf.payload[i*MTU_MAX_BYTES], false);
 							data_sent += MTU_MAX_BYTES;
 						}
 					}
-                }
+					StatsEnd(STATS_BLE, start, cmdBuf.length, ok);
+                } else{
+					/* Disconnected meanwhile: message dropped */
+					StatsError(STATS_BLE, 1);
+				}
             break;
             case CMD_BLUETOOTH_DATA:
                 xQueueSend(xQueueRead, &cmdBuf, portMAX_DELAY);
@@ -538,6 +547,9 @@ void BleSendByte(const char *data){
 		cmdBuf.length = 1;
 		memcpy(cmdBuf.payload, data, cmdBuf.length);
 		xQueueSend(xQueueEvents, &cmdBuf, portMAX_DELAY);
+		StatsDepth(STATS_BLE, uxQueueMessagesWaiting(xQueueEvents));
+	} else{
+		StatsError(STATS_BLE, 1);
 	}
 }
 
@@ -551,6 +563,9 @@ void BleSendString(const char *msg){
 		}
 		memcpy(cmdBuf.payload, msg, cmdBuf.length);
 		xQueueSend(xQueueEvents, &cmdBuf, portMAX_DELAY);
+		StatsDepth(STATS_BLE, uxQueueMessagesWaiting(xQueueEvents));
+	} else{
+		StatsError(STATS_BLE, 1);
 	}
 }
 
@@ -561,6 +576,9 @@ void BleSendBuffer(const char *data, uint8_t nbytes){
 		cmdBuf.length = nbytes;
 		memcpy(cmdBuf.payload, data, cmdBuf.length);
 		xQueueSend(xQueueEvents, &cmdBuf, portMAX_DELAY);
+		StatsDepth(STATS_BLE, uxQueueMessagesWaiting(xQueueEvents));
+	} else{
+		StatsError(STATS_BLE, 1);
 	}
 }
 /*==================[end of file]============================================*/
\ No newline at end of file
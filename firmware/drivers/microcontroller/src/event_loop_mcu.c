@@ -0,0 +1,322 @@
+/**
+ * @file event_loop_mcu.c
+ * @brief Cooperative event loop: event queue, timers, deadline scheduling and
+ * statistics
+ * @version 0.1
+ * @date 2026-10-19
+ *
+ * @copyright Copyright (c) 2026
+ *
+ */
+
+/*==================[inclusions]=============================================*/
+#include "event_loop_mcu.h"
+#include <stddef.h>
+#include <stdio.h>
+#include <string.h>
+#ifdef MCU_HOST
+#include "host_mcu.h"
+#else
+#include "sdkconfig.h"
+#include "esp_timer.h"
+#include "freertos/FreeRTOS.h"
+#include "freertos/task.h"
+#endif
+/*==================[macros and definitions]=================================*/
+#define NS_PER_US		1000
+/*==================[internal data declaration]==============================*/
+
+/*==================[internal functions declaration]=========================*/
+
+/*==================[internal data definition]===============================*/
+
+/*==================[external data definition]===============================*/
+
+/*==================[internal functions definition]==========================*/
+/* Wake up the loop (ISR or task) */
+static void EventLoopNotify(event_loop_t *loop){
+#ifdef MCU_HOST
+	HostWake();
+#else
+	BaseType_t woken = pdFALSE;
+
+	if(loop->task == NULL){
+		return;
+	}
+	if(xPortInIsrContext()){
+		vTaskNotifyGiveFromISR(loop->task, &woken);
+		portYIELD_FROM_ISR(woken);
+	} else{
+		xTaskNotifyGive(loop->task);
+	}
+#endif
+}
+
+/* Run a handler and update its statistics */
+static void EventLoopDispatch(event_loop_handler_t *handler, const event_loop_event_t *event){
+	event_loop_stats_t *s = &handler->stats;
+	uint32_t start = EventLoopTimeUs();
+	uint32_t latency = start - event->time, time;
+
+	handler->func(handler, event);
+	time = EventLoopTimeUs() - start;
+	s->runs++;
+	s->latency += latency;
+	if(latency > s->latency_max){
+		s->latency_max = latency;
+	}
+	s->time += time;
+	if(time > s->time_max){
+		s->time_max = time;
+	}
+	if(handler->deadline_us && (latency + time > handler->deadline_us)){
+		s->misses++;
+	}
+}
+
+static void EventLoopGPIOEvent(gpio_event_t *event, void *param){
+	EventLoopPost(param, EVENT_LOOP_GPIO, EVENT_LOOP_GPIO_DATA(event->pin, event->type));
+}
+/*==================[external functions definition]==========================*/
+uint32_t EventLoopTimeUs(void){
+#ifdef MCU_HOST
+	return (uint32_t)HostTimeUs();
+#else
+	return (uint32_t)esp_timer_get_time();
+#endif
+}
+
+void EventLoopInit(event_loop_t *loop){
+	loop->qty = 0;
+	RingBufferMpInit(&loop->queue, loop->storage, loop->seq, EVENT_LOOP_QUEUE_SIZE, sizeof(event_loop_item_t));
+	loop->ready_qty = 0;
+	loop->dropped = 0;
+	loop->depth_max = 0;
+	loop->task = NULL;
+	loop->timer = NULL;
+}
+
+bool EventLoopAdd(event_loop_t *loop, event_loop_handler_t *handler){
+	if(loop->qty >= EVENT_LOOP_MAX_HANDLERS){
+		return false;
+	}
+	handler->loop = loop;
+	handler->pt = 0;
+	handler->sleeping = false;
+	handler->next = EventLoopTimeUs() + handler->period_us;
+	handler->stats = (event_loop_stats_t){0};
+	loop->handlers[loop->qty++] = handler;
+	return true;
+}
+
+bool EventLoopPost(event_loop_handler_t *handler, event_loop_type_t type, uint32_t data){
+	event_loop_t *loop = handler->loop;
+	event_loop_item_t item = {
+		.handler = handler,
+		.event = {.type = type, .data = data, .time = EventLoopTimeUs()},
+	};
+
+	if(!RingBufferMpPush(&loop->queue, &item)){
+		__atomic_fetch_add(&loop->dropped, 1, __ATOMIC_RELAXED);
+		return false;
+	}
+	EventLoopNotify(loop);
+	return true;
+}
+
+void EventLoopCallback(void *handler){
+	EventLoopPost(handler, EVENT_LOOP_DRIVER, 0);
+}
+
+bool EventLoopSubscribeGPIO(event_loop_handler_t *handler, gpio_event_config_t *config){
+	config->func_p = EventLoopGPIOEvent;
+	config->param_p = handler;
+	return GPIOEventSubscribe(config);
+}
+
+void EventLoopSleep(event_loop_handler_t *handler, uint32_t us){
+	handler->wake = EventLoopTimeUs() + us;
+	handler->sleeping = true;
+}
+
+uint32_t EventLoopRun(event_loop_t *loop){
+	event_loop_handler_t *h, *best;
+	event_loop_event_t event;
+	event_loop_type_t best_type = EVENT_LOOP_TIMER;
+	uint32_t runs = 0, now, depth, deadline, best_deadline = 0, skipped;
+	int8_t best_ready;
+
+	while(1){
+		/* Posted events, in the order they arrived */
+		depth = RingBufferMpCount(&loop->queue) + loop->ready_qty;
+		if(depth > loop->depth_max){
+			loop->depth_max = depth;
+		}
+		while((loop->ready_qty < EVENT_LOOP_QUEUE_SIZE) &&
+			RingBufferMpPop(&loop->queue, &loop->ready[loop->ready_qty])){
+			loop->ready_qty++;
+		}
+		/* Earliest deadline first (ties: order of arrival, events before timers) */
+		now = EventLoopTimeUs();
+		best = NULL;
+		best_ready = -1;
+		for(uint8_t i = 0; i < loop->ready_qty; i++){
+			h = loop->ready[i].handler;
+			deadline = loop->ready[i].event.time + h->deadline_us;
+			if((best == NULL) || ((int32_t)(deadline - best_deadline) < 0)){
+				best = h;
+				best_deadline = deadline;
+				best_ready = i;
+			}
+		}
+		for(uint8_t i = 0; i < loop->qty; i++){
+			h = loop->handlers[i];
+			if(h->period_us && ((int32_t)(now - h->next) >= 0)){
+				deadline = h->next + h->deadline_us;
+				if((best == NULL) || ((int32_t)(deadline - best_deadline) < 0)){
+					best = h;
+					best_deadline = deadline;
+					best_ready = -1;
+					best_type = EVENT_LOOP_TIMER;
+				}
+			}
+			if(h->sleeping && ((int32_t)(now - h->wake) >= 0)){
+				deadline = h->wake + h->deadline_us;
+				if((best == NULL) || ((int32_t)(deadline - best_deadline) < 0)){
+					best = h;
+					best_deadline = deadline;
+					best_ready = -1;
+					best_type = EVENT_LOOP_WAKE;
+				}
+			}
+		}
+		if(best == NULL){
+			break;
+		}
+		if(best_ready >= 0){
+			event = loop->ready[best_ready].event;
+			loop->ready_qty--;
+			memmove(&loop->ready[best_ready], &loop->ready[best_ready + 1],
+				(loop->ready_qty - best_ready) * sizeof(event_loop_item_t));
+		} else if(best_type == EVENT_LOOP_TIMER){
+			event = (event_loop_event_t){.type = EVENT_LOOP_TIMER, .data = 0, .time = best->next};
+			best->next += best->period_us;
+			/* Periods that expired while waiting are skipped */
+			if((int32_t)(now - best->next) >= 0){
+				skipped = (now - best->next) / best->period_us + 1;
+				best->stats.overruns += skipped;
+				best->next += skipped * best->period_us;
+			}
+		} else{
+			event = (event_loop_event_t){.type = EVENT_LOOP_WAKE, .data = 0, .time = best->wake};
+			best->sleeping = false;
+		}
+		EventLoopDispatch(best, &event);
+		runs++;
+	}
+	return runs;
+}
+
+bool EventLoopNextTimer(const event_loop_t *loop, uint32_t *us){
+	const event_loop_handler_t *h;
+	uint32_t now = EventLoopTimeUs();
+	int32_t next = INT32_MAX, left;
+	bool armed = false;
+
+	for(uint8_t i = 0; i < loop->qty; i++){
+		h = loop->handlers[i];
+		if(h->period_us){
+			left = (int32_t)(h->next - now);
+			next = (left < next) ? left : next;
+			armed = true;
+		}
+		if(h->sleeping){
+			left = (int32_t)(h->wake - now);
+			next = (left < next) ? left : next;
+			armed = true;
+		}
+	}
+	*us = (next > 0) ? (uint32_t)next : 0;
+	return armed;
+}
+
+#ifdef MCU_HOST
+uint32_t EventLoopRunUs(event_loop_t *loop, uint32_t us){
+	uint64_t end = HostTimeNs() + (uint64_t)us * NS_PER_US, now, wake;
+	uint32_t runs = 0, next;
+
+	while(HostTimeNs() < end){
+		runs += EventLoopRun(loop);
+		now = HostTimeNs();
+		wake = end;
+		if(EventLoopNextTimer(loop, &next)){
+			if(next == 0){
+				/* Expired while the handlers ran */
+				continue;
+			}
+			/* Timers have us resolution: wake up at the start of the us */
+			wake = ((now / NS_PER_US) + next) * NS_PER_US;
+			wake = (wake < end) ? wake : end;
+		}
+		if(wake > now){
+			HostWaitNs(wake - now);
+		}
+	}
+	return runs;
+}
+#else
+static void EventLoopTimer(void *param){
+	EventLoopNotify(param);
+}
+
+static void EventLoopTask(void *param){
+	event_loop_t *loop = param;
+	uint32_t us;
+
+	while(1){
+		EventLoopRun(loop);
+		esp_timer_stop(loop->timer);
+		if(EventLoopNextTimer(loop, &us)){
+			if(us == 0){
+				/* Expired while the handlers ran */
+				continue;
+			}
+			esp_timer_start_once(loop->timer, us);
+		}
+		ulTaskNotifyTake(pdTRUE, portMAX_DELAY);
+	}
+}
+
+bool EventLoopStart(event_loop_t *loop, uint32_t stack, uint8_t priority){
+	const esp_timer_create_args_t timer_args = {
+		.callback = EventLoopTimer,
+		.arg = loop,
+#if CONFIG_ESP_TIMER_SUPPORTS_ISR_DISPATCH_METHOD
+		.dispatch_method = ESP_TIMER_ISR,	/* One context switch less per expiry */
+#endif
+		.name = "event_loop",
+	};
+
+	if(esp_timer_create(&timer_args, (esp_timer_handle_t *)&loop->timer) != ESP_OK){
+		return false;
+	}
+	return xTaskCreate(EventLoopTask, "event_loop", stack, loop, priority, (TaskHandle_t *)&loop->task) == pdPASS;
+}
+#endif
+
+void EventLoopPrint(const event_loop_t *loop){
+	const event_loop_stats_t *s;
+
+	printf("%-12s %8s %8s %8s %8s %8s %8s %8s\n", "handler", "runs", "avg us", "max us", "lat avg", "lat max",
+		"overrun", "misses");
+	for(uint8_t i = 0; i < loop->qty; i++){
+		s = &loop->handlers[i]->stats;
+		printf("%-12s %8lu %8.1f %8lu %8.1f %8lu %8lu %8lu\n", loop->handlers[i]->name, (unsigned long)s->runs,
+			s->runs ? (float)s->time / s->runs : 0.0f, (unsigned long)s->time_max,
+			s->runs ? (float)s->latency / s->runs : 0.0f, (unsigned long)s->latency_max,
+			(unsigned long)s->overruns, (unsigned long)s->misses);
+	}
+	printf("queue: %lu dropped, max depth %lu\n", (unsigned long)loop->dropped, (unsigned long)loop->depth_max);
+}
+
+/*==================[end of file]============================================*/
@@ -0,0 +1,465 @@
+/**
+ * @file flash_log_mcu.c
+ * @brief Flash log: record framing, sector rotation, recovery, readback and
+ * export
+ * @version 0.1
+ * @date 2026-10-19
+ *
+ * @copyright Copyright (c) 2026
+ *
+ */
+
+/*==================[inclusions]=============================================*/
+#include "flash_log_mcu.h"
+#include <stddef.h>
+#include <stdio.h>
+#include <string.h>
+#ifdef MCU_HOST
+#include "host_mcu.h"
+#else
+#include "esp_attr.h"
+#include "esp_timer.h"
+#include "esp_partition.h"
+#include "esp_rom_crc.h"
+#include "freertos/FreeRTOS.h"
+#include "freertos/task.h"
+#endif
+/*==================[macros and definitions]=================================*/
+#ifdef MCU_HOST
+#define IRAM_ATTR
+#endif
+#define FLASH_LOG_END			0xFFFF		/*!< Record length of erased flash */
+#define FLASH_LOG_UART_CHUNK	255			/*!< Bytes per UartWriteBuffer() call */
+
+/** @brief Bytes of a record in flash (header, payload, CRC, 4 byte aligned) */
+#define FLASH_LOG_RECORD_SIZE(len)	((sizeof(flash_log_record_t) + (len) + sizeof(uint32_t) + 3) & ~3UL)
+/*==================[internal data declaration]==============================*/
+
+/*==================[internal functions declaration]=========================*/
+
+/*==================[internal data definition]===============================*/
+
+/*==================[external data definition]===============================*/
+
+/*==================[internal functions definition]==========================*/
+/* CRC-32 (IEEE 802.3, same as zlib) */
+static uint32_t FlashLogCrc(const void *data, uint32_t len){
+#ifdef MCU_HOST
+	const uint8_t *bytes = data;
+	uint32_t crc = 0xFFFFFFFF;
+
+	for(uint32_t i = 0; i < len; i++){
+		crc ^= bytes[i];
+		for(uint8_t bit = 0; bit < 8; bit++){
+			crc = (crc >> 1) ^ (0xEDB88320 & -(crc & 1));
+		}
+	}
+	return ~crc;
+#else
+	return esp_rom_crc32_le(0, data, len);
+#endif
+}
+
+static inline uint32_t FlashLogTimeUs(void){
+#ifdef MCU_HOST
+	return (uint32_t)HostTimeUs();
+#else
+	return (uint32_t)esp_timer_get_time();
+#endif
+}
+
+/*--- Partition access ---*/
+static bool FlashLogPartitionOpen(flash_log_t *log, const char *label, uint32_t *size){
+#ifdef MCU_HOST
+	log->map = HostFlashFind(label, size);
+	log->partition = log->map;
+	return log->map != NULL;
+#else
+	const esp_partition_t *partition;
+	esp_partition_mmap_handle_t handle;
+	const void *map;
+
+	partition = esp_partition_find_first(ESP_PARTITION_TYPE_DATA, ESP_PARTITION_SUBTYPE_ANY, label);
+	if(partition == NULL){
+		return false;
+	}
+	if(esp_partition_mmap(partition, 0, partition->size, ESP_PARTITION_MMAP_DATA, &map, &handle) != ESP_OK){
+		return false;
+	}
+	log->partition = partition;
+	log->map = map;
+	log->map_handle = handle;
+	*size = partition->size;
+	return true;
+#endif
+}
+
+static bool FlashLogEraseRange(flash_log_t *log, uint32_t offset, uint32_t size){
+#ifdef MCU_HOST
+	HostFlashErase((uint8_t *)log->partition, offset, size);
+	return true;
+#else
+	return esp_partition_erase_range(log->partition, offset, size) == ESP_OK;
+#endif
+}
+
+static bool FlashLogProgram(flash_log_t *log, uint32_t offset, const void *data, uint32_t len){
+#ifdef MCU_HOST
+	HostFlashProgram((uint8_t *)log->partition, offset, data, len);
+	return true;
+#else
+	return esp_partition_write(log->partition, offset, data, len) == ESP_OK;
+#endif
+}
+
+/*--- Sectors and records ---*/
+static inline const flash_log_sector_t* FlashLogSector(const flash_log_t *log, uint32_t sector){
+	return (const flash_log_sector_t *)(log->map + sector * FLASH_LOG_SECTOR_SIZE);
+}
+
+static bool FlashLogSectorValid(const flash_log_sector_t *header){
+	return (header->magic == FLASH_LOG_MAGIC) && (header->crc == FlashLogCrc(header, offsetof(flash_log_sector_t, crc)));
+}
+
+static bool FlashLogRecordValid(const flash_log_record_t *record){
+	uint32_t crc;
+
+	memcpy(&crc, FLASH_LOG_PAYLOAD(record) + record->len, sizeof(crc));
+	return crc == FlashLogCrc(record, sizeof(flash_log_record_t) + record->len);
+}
+
+/* Record at an offset of a sector, NULL at the end of the sector data (erased
+ * flash or a corrupted length) */
+static const flash_log_record_t* FlashLogRecordAt(const flash_log_t *log, uint32_t sector, uint32_t offset){
+	const flash_log_record_t *record;
+
+	if(offset + sizeof(flash_log_record_t) > FLASH_LOG_SECTOR_SIZE){
+		return NULL;
+	}
+	record = (const flash_log_record_t *)((const uint8_t *)FlashLogSector(log, sector) + offset);
+	if((record->len == FLASH_LOG_END) || (record->len > FLASH_LOG_MAX_PAYLOAD) ||
+		(offset + FLASH_LOG_RECORD_SIZE(record->len) > FLASH_LOG_SECTOR_SIZE)){
+		return NULL;
+	}
+	return record;
+}
+
+/* Write the page buffer: the complete pages, or everything (all) */
+static void FlashLogProgramPending(flash_log_t *log, bool all){
+	uint32_t start = log->offset - log->pending;
+	uint32_t len;
+
+	while(log->pending){
+		len = all ? log->pending : ((start | (FLASH_LOG_PAGE_SIZE - 1)) + 1) - start;
+		if(len > log->pending){
+			break;
+		}
+		if(!FlashLogProgram(log, log->head * FLASH_LOG_SECTOR_SIZE + start, log->buffer, len)){
+			log->errors++;
+		}
+		log->pending -= len;
+		memmove(log->buffer, log->buffer + len, log->pending);
+		start += len;
+	}
+}
+
+/* Erase a sector and start it with its header (in the page buffer) */
+static bool FlashLogOpenSector(flash_log_t *log, uint32_t sector){
+	const flash_log_sector_t *old = FlashLogSector(log, sector);
+	flash_log_sector_t header = {
+		.magic = FLASH_LOG_MAGIC,
+		.seq = log->sector_seq + 1,
+		.erase_count = FlashLogSectorValid(old) ? old->erase_count + 1 : 1,
+		.first = log->seq,
+	};
+
+	if(!FlashLogEraseRange(log, sector * FLASH_LOG_SECTOR_SIZE, FLASH_LOG_SECTOR_SIZE)){
+		log->errors++;
+		return false;
+	}
+	log->erases++;
+	header.crc = FlashLogCrc(&header, offsetof(flash_log_sector_t, crc));
+	log->head = sector;
+	log->sector_seq = header.seq;
+	memcpy(log->buffer, &header, sizeof(header));
+	log->pending = log->offset = sizeof(header);
+	return true;
+}
+
+/* Close the head sector and open the next one, erasing the oldest if the
+ * partition is full */
+static bool FlashLogNextSector(flash_log_t *log){
+	uint32_t next = (log->head + 1) % log->sectors;
+
+	FlashLogProgramPending(log, true);
+	if(next == log->oldest){
+		if(!log->wrap){
+			log->full = true;
+			return false;
+		}
+		log->oldest = (log->oldest + 1) % log->sectors;
+	}
+	return FlashLogOpenSector(log, next);
+}
+
+/* End of the log in the head sector, and next sequence number */
+static void FlashLogScan(flash_log_t *log){
+	const flash_log_record_t *record;
+	uint32_t offset = sizeof(flash_log_sector_t);
+
+	log->seq = FlashLogSector(log, log->head)->first;
+	while((record = FlashLogRecordAt(log, log->head, offset)) != NULL){
+		if(FlashLogRecordValid(record)){
+			log->seq = record->seq + 1;
+		} else{
+			/* Cut by a reset */
+			log->bad++;
+		}
+		offset += FLASH_LOG_RECORD_SIZE(record->len);
+	}
+	if((offset + sizeof(flash_log_record_t) <= FLASH_LOG_SECTOR_SIZE) &&
+		(((const flash_log_record_t *)((const uint8_t *)FlashLogSector(log, log->head) + offset))->len != FLASH_LOG_END)){
+		/* Corrupted length: don't append to this sector */
+		offset = FLASH_LOG_SECTOR_SIZE;
+	}
+	log->offset = offset;
+}
+
+/* Bytes of a sector in use (header and records) */
+static uint32_t FlashLogSectorUsed(const flash_log_t *log, uint32_t sector){
+	const flash_log_record_t *record;
+	uint32_t offset = sizeof(flash_log_sector_t);
+
+	while((record = FlashLogRecordAt(log, sector, offset)) != NULL){
+		offset += FLASH_LOG_RECORD_SIZE(record->len);
+	}
+	return offset;
+}
+
+static void FlashLogCursorSector(const flash_log_t *log, flash_log_cursor_t *cursor, uint32_t sector){
+	cursor->sector = sector;
+	cursor->offset = FlashLogSectorValid(FlashLogSector(log, sector)) ? sizeof(flash_log_sector_t) : FLASH_LOG_SECTOR_SIZE;
+}
+
+static void FlashLogSendUart(const uint8_t *data, uint32_t len, void *param){
+	uart_mcu_port_t port = *(const uart_mcu_port_t *)param;
+	uint32_t chunk;
+
+	while(len){
+		chunk = (len > FLASH_LOG_UART_CHUNK) ? FLASH_LOG_UART_CHUNK : len;
+		UartWriteBuffer(port, (const char *)data, chunk);
+		data += chunk;
+		len -= chunk;
+	}
+}
+
+#ifndef MCU_HOST
+static void FlashLogTask(void *param){
+	flash_log_t *log = param;
+
+	while(1){
+		if(ulTaskNotifyTake(pdTRUE, pdMS_TO_TICKS(FLASH_LOG_FLUSH_MS)) != 0){
+			FlashLogRun(log);
+		} else{
+			/* Producers idle: write the partial page too */
+			FlashLogRun(log);
+			FlashLogFlush(log);
+		}
+	}
+}
+#endif
+/*==================[external functions definition]==========================*/
+bool FlashLogInit(flash_log_t *log, const char *label, bool wrap){
+	const flash_log_sector_t *header;
+	bool found = false;
+	uint32_t size;
+
+	memset(log, 0, sizeof(*log));
+	if(!FlashLogPartitionOpen(log, label, &size)){
+		return false;
+	}
+	log->sectors = size / FLASH_LOG_SECTOR_SIZE;
+	log->wrap = wrap;
+	if(log->sectors < 2){
+		return false;
+	}
+	RingBufferInit(&log->ring, log->ring_data, FLASH_LOG_RING_SIZE, 1);
+	/* Newest sector: head, oldest sector: start of the log */
+	for(uint32_t i = 0; i < log->sectors; i++){
+		header = FlashLogSector(log, i);
+		if(!FlashLogSectorValid(header)){
+			continue;
+		}
+		if(!found || (int32_t)(header->seq - FlashLogSector(log, log->head)->seq) > 0){
+			log->head = i;
+		}
+		if(!found || (int32_t)(header->seq - FlashLogSector(log, log->oldest)->seq) < 0){
+			log->oldest = i;
+		}
+		found = true;
+	}
+	if(!found){
+		/* Empty partition */
+		return FlashLogOpenSector(log, 0);
+	}
+	log->sector_seq = FlashLogSector(log, log->head)->seq;
+	FlashLogScan(log);
+	return true;
+}
+
+bool IRAM_ATTR FlashLogWrite(flash_log_t *log, uint16_t type, const void *data, uint16_t len){
+	flash_log_record_t entry = {.len = len, .type = type, .seq = 0, .time = FlashLogTimeUs()};
+
+	if((len > FLASH_LOG_MAX_PAYLOAD) || (RingBufferFree(&log->ring) < sizeof(entry) + len)){
+		__atomic_fetch_add(&log->dropped, 1, __ATOMIC_RELAXED);
+		return false;
+	}
+	RingBufferWrite(&log->ring, &entry, sizeof(entry));
+	RingBufferWrite(&log->ring, data, len);
+#ifndef MCU_HOST
+	/* Wake the writer once a page is waiting */
+	uint32_t count = RingBufferCount(&log->ring);
+	if((log->task != NULL) && (count >= FLASH_LOG_PAGE_SIZE) && (count - sizeof(entry) - len < FLASH_LOG_PAGE_SIZE)){
+		if(xPortInIsrContext()){
+			vTaskNotifyGiveFromISR(log->task, NULL);
+		} else{
+			xTaskNotifyGive(log->task);
+		}
+	}
+#endif
+	return true;
+}
+
+uint32_t FlashLogRun(flash_log_t *log){
+	flash_log_record_t *record;
+	uint32_t moved = 0, count, size, crc;
+
+	while(1){
+		count = RingBufferCount(&log->ring);
+		if(count > log->ring_max){
+			log->ring_max = count;
+		}
+		if(!log->entry_ready){
+			if(count < sizeof(flash_log_record_t)){
+				break;
+			}
+			RingBufferRead(&log->ring, &log->entry, sizeof(log->entry));
+			log->entry_ready = true;
+			count -= sizeof(flash_log_record_t);
+		}
+		if(count < log->entry.len){
+			/* Payload still being written */
+			break;
+		}
+		log->entry_ready = false;
+		size = FLASH_LOG_RECORD_SIZE(log->entry.len);
+		if(log->full || ((log->offset + size > FLASH_LOG_SECTOR_SIZE) && !FlashLogNextSector(log))){
+			/* Partition full: discard the payload */
+			RingBufferRead(&log->ring, log->buffer + log->pending, log->entry.len);
+			__atomic_fetch_add(&log->dropped, 1, __ATOMIC_RELAXED);
+			continue;
+		}
+		record = (flash_log_record_t *)(log->buffer + log->pending);
+		*record = log->entry;
+		record->seq = log->seq++;
+		RingBufferRead(&log->ring, log->buffer + log->pending + sizeof(flash_log_record_t), record->len);
+		crc = FlashLogCrc(record, sizeof(flash_log_record_t) + record->len);
+		memcpy(log->buffer + log->pending + sizeof(flash_log_record_t) + record->len, &crc, sizeof(crc));
+		memset(log->buffer + log->pending + sizeof(flash_log_record_t) + record->len + sizeof(crc), 0xFF,
+			size - sizeof(flash_log_record_t) - record->len - sizeof(crc));
+		log->pending += size;
+		log->offset += size;
+		log->records++;
+		moved++;
+		FlashLogProgramPending(log, false);
+	}
+	return moved;
+}
+
+void FlashLogFlush(flash_log_t *log){
+	FlashLogProgramPending(log, true);
+}
+
+bool FlashLogErase(flash_log_t *log){
+	/* Sector 0 is erased by FlashLogOpenSector(), keeping its erase count */
+	if(!FlashLogEraseRange(log, FLASH_LOG_SECTOR_SIZE, (log->sectors - 1) * FLASH_LOG_SECTOR_SIZE)){
+		log->errors++;
+		return false;
+	}
+	log->erases += log->sectors - 1;
+	log->pending = 0;
+	log->oldest = 0;
+	log->sector_seq = 0;
+	log->seq = 0;
+	log->full = false;
+	return FlashLogOpenSector(log, 0);
+}
+
+void FlashLogFirst(const flash_log_t *log, flash_log_cursor_t *cursor){
+	FlashLogCursorSector(log, cursor, log->oldest);
+	cursor->left = (log->head + log->sectors - log->oldest) % log->sectors;
+}
+
+const flash_log_record_t* FlashLogNext(const flash_log_t *log, flash_log_cursor_t *cursor){
+	const flash_log_record_t *record;
+
+	while(1){
+		record = FlashLogRecordAt(log, cursor->sector, cursor->offset);
+		if(record != NULL){
+			cursor->offset += FLASH_LOG_RECORD_SIZE(record->len);
+			if(FlashLogRecordValid(record)){
+				return record;
+			}
+			continue;
+		}
+		if(cursor->left == 0){
+			return NULL;
+		}
+		cursor->left--;
+		FlashLogCursorSector(log, cursor, (cursor->sector + 1) % log->sectors);
+	}
+}
+
+uint32_t FlashLogExport(flash_log_t *log, flash_log_send_t send, void *param){
+	flash_log_export_t header = {
+		.magic = FLASH_LOG_MAGIC,
+		.version = FLASH_LOG_VERSION,
+		.sector_size = FLASH_LOG_SECTOR_SIZE,
+		.sectors = (log->head + log->sectors - log->oldest) % log->sectors + 1,
+		.first = FlashLogSector(log, log->oldest)->first,
+		.next = log->seq,
+	};
+	uint32_t sector = log->oldest, sent = sizeof(header), used;
+
+	send((const uint8_t *)&header, sizeof(header), param);
+	for(uint32_t i = 0; i < header.sectors; i++){
+		/* Zero-copy: straight from the mapped flash */
+		used = FlashLogSectorValid(FlashLogSector(log, sector)) ? FlashLogSectorUsed(log, sector) : 0;
+		send((const uint8_t *)&used, sizeof(used), param);
+		send((const uint8_t *)FlashLogSector(log, sector), used, param);
+		sent += sizeof(used) + used;
+		sector = (sector + 1) % log->sectors;
+	}
+	return sent;
+}
+
+uint32_t FlashLogExportUart(flash_log_t *log, uart_mcu_port_t port){
+	return FlashLogExport(log, FlashLogSendUart, &port);
+}
+
+#ifndef MCU_HOST
+bool FlashLogStart(flash_log_t *log, uint32_t stack, uint8_t priority){
+	return xTaskCreate(FlashLogTask, "flash_log", stack, log, priority, (TaskHandle_t *)&log->task) == pdPASS;
+}
+#endif
+
+void FlashLogPrint(const flash_log_t *log){
+	printf("flash log: %lu sectors, head %lu (offset %lu), oldest %lu, next record %lu\n",
+		(unsigned long)log->sectors, (unsigned long)log->head, (unsigned long)log->offset,
+		(unsigned long)log->oldest, (unsigned long)log->seq);
+	printf("  records %lu dropped %lu bad %lu erases %lu errors %lu ring max %lu/%d\n",
+		(unsigned long)log->records, (unsigned long)log->dropped, (unsigned long)log->bad,
+		(unsigned long)log->erases, (unsigned long)log->errors, (unsigned long)log->ring_max, FLASH_LOG_RING_SIZE);
+}
+
+/*==================[end of file]============================================*/
@@ -0,0 +1,337 @@
+/**
+ * @file gpio_event_mcu.c
+ * @brief Debounced GPIO event dispatcher. The debounce and gesture state
+ * machine is shared by both backends: on the host the pin interrupt is the
+ * edge hook of the simulated pin and the dispatcher runs as an event of the
+ * virtual clock
+ * @version 0.1
+ * @date 2026-10-19
+ *
+ * @copyright Copyright (c) 2026
+ *
+ */
+
+/*==================[inclusions]=============================================*/
+#include "gpio_event_mcu.h"
+#include "gpio_mcu.h"
+#include "trace_mcu.h"
+#include <stddef.h>
+#include <stdint.h>
+#ifdef MCU_HOST
+#include "host_mcu.h"
+#else
+#include "driver/gpio.h"
+#include "esp_timer.h"
+#include "freertos/FreeRTOS.h"
+#include "freertos/task.h"
+#endif
+/*==================[macros and definitions]=================================*/
+#ifdef MCU_HOST
+#define IRAM_ATTR
+#endif
+#define QUEUE_MASK			(GPIO_EVENT_QUEUE_SIZE - 1)
+#define MS_TO_US			1000
+#define NS_PER_US			1000
+#define NO_TIMEOUT			UINT32_MAX
+/*==================[internal data declaration]==============================*/
+/**
+ * @brief Edge pushed by the ISR
+ */
+typedef struct {
+	uint8_t pin;				/*!< GPIO number */
+	uint32_t time;				/*!< Edge time (us) */
+} gpio_edge_t;
+
+/**
+ * @brief Debounce and gesture state of a pin
+ */
+typedef struct {
+	bool used;					/*!< Pin has subscribers */
+	bool active_low;			/*!< Pressed level is low */
+	bool sampling;				/*!< Debounce window running */
+	bool pressed;				/*!< Debounced state */
+	bool long_pending;			/*!< Waiting for long press time */
+	bool long_fired;			/*!< Long press already reported for this press */
+	bool release_valid;			/*!< release_time can start a double click */
+#ifdef MCU_HOST
+	bool intr_enabled;			/*!< Pin interrupt enabled (gpio_intr_enable()) */
+#endif
+	uint32_t debounce_us;		/*!< Debounce window */
+	uint32_t long_press_us;		/*!< Long press time (0: disabled) */
+	uint32_t double_click_us;	/*!< Double click window (0: disabled) */
+	uint32_t edge_time;			/*!< First edge of the current bounce burst */
+	uint32_t sample_time;		/*!< End of the debounce window */
+	uint32_t long_time;			/*!< Time to report long press */
+	uint32_t release_time;		/*!< Last short release */
+} gpio_event_pin_t;
+
+/**
+ * @brief Subscriber
+ */
+typedef struct {
+	gpio_t pin;					/*!< GPIO number */
+	void (*func_p)(gpio_event_t*, void*);	/*!< Callback */
+	void *param_p;				/*!< Callback parameters */
+} gpio_event_subscriber_t;
+/*==================[internal functions declaration]=========================*/
+#ifdef MCU_HOST
+static void GPIOEventRun(void *param);
+#endif
+/*==================[internal data definition]===============================*/
+static gpio_edge_t edges[GPIO_EVENT_QUEUE_SIZE];	/*!< Edges queue (ISR -> dispatcher) */
+static volatile uint32_t edges_head = 0;			/*!< Written only by the ISR */
+static volatile uint32_t edges_tail = 0;			/*!< Written only by the dispatcher */
+static volatile uint32_t edges_dropped = 0;
+static gpio_event_pin_t pins[GPIO_QTY];
+static gpio_event_subscriber_t subscribers[GPIO_EVENT_MAX_SUBSCRIBERS];
+static uint8_t subscribers_qty = 0;
+static bool dispatcher_started = false;
+#ifdef MCU_HOST
+static int dispatcher_event = -1;					/*!< Next run of the dispatcher */
+#else
+static TaskHandle_t dispatcher_task_handle = NULL;
+#endif
+/*==================[external data definition]===============================*/
+
+/*==================[internal functions definition]==========================*/
+static uint32_t GPIOEventTimeUs(void){
+#ifdef MCU_HOST
+	return (uint32_t)HostTimeUs();
+#else
+	return (uint32_t)esp_timer_get_time();
+#endif
+}
+
+static void IRAM_ATTR GPIOEventIntrEnable(gpio_t pin, bool enable){
+#ifdef MCU_HOST
+	pins[pin].intr_enabled = enable;
+#else
+	if(enable){
+		gpio_intr_enable(pin);
+	} else{
+		gpio_intr_disable(pin);
+	}
+#endif
+}
+
+/* Wake up the dispatcher (from the ISR) */
+static void IRAM_ATTR GPIOEventWake(void){
+#ifdef MCU_HOST
+	HostCancel(dispatcher_event);
+	dispatcher_event = HostSchedule(0, 0, GPIOEventRun, NULL);
+#else
+	BaseType_t xHigherPriorityTaskWoken = pdFALSE;
+
+	vTaskNotifyGiveFromISR(dispatcher_task_handle, &xHigherPriorityTaskWoken);
+	portYIELD_FROM_ISR(xHigherPriorityTaskWoken);
+#endif
+}
+
+static void IRAM_ATTR gpio_event_isr(void *args){
+	uint8_t pin = (uint8_t)(uintptr_t)args;
+	uint32_t head = edges_head;
+
+	TraceIsrEnter(TRACE_ISR_GPIO(pin));
+	/* Following bounces are ignored until the dispatcher samples the pin */
+	GPIOEventIntrEnable(pin, false);
+	if((head - __atomic_load_n(&edges_tail, __ATOMIC_ACQUIRE)) < GPIO_EVENT_QUEUE_SIZE){
+		edges[head & QUEUE_MASK].pin = pin;
+		edges[head & QUEUE_MASK].time = GPIOEventTimeUs();
+		__atomic_store_n(&edges_head, head + 1, __ATOMIC_RELEASE);
+	} else{
+		edges_dropped++;
+	}
+	TraceIsrExit(TRACE_ISR_GPIO(pin));
+	GPIOEventWake();
+}
+
+#ifdef MCU_HOST
+/* Edge of a simulated pin: the interrupt of the pin, if enabled */
+static void GPIOEventHostEdge(gpio_t pin, bool level, void *param){
+	if(pins[pin].intr_enabled){
+		gpio_event_isr(param);
+	}
+}
+#endif
+
+static void GPIOEventDispatch(gpio_t pin, gpio_event_type_t type, bool level, uint32_t time){
+	gpio_event_t event = {
+		.pin = pin,
+		.type = type,
+		.level = level,
+		.time = time,
+	};
+	for(uint8_t i = 0; i < subscribers_qty; i++){
+		if(subscribers[i].pin == pin){
+			subscribers[i].func_p(&event, subscribers[i].param_p);
+		}
+	}
+}
+
+static void GPIOEventUpdate(gpio_t pin, bool level, uint32_t time){
+	gpio_event_pin_t *p = &pins[pin];
+	bool pressed = level ^ p->active_low;
+
+	if(pressed == p->pressed){
+		/* Bounce ended in the previous state */
+		return;
+	}
+	p->pressed = pressed;
+	if(pressed){
+		GPIOEventDispatch(pin, GPIO_EVENT_PRESS, level, time);
+		if(p->double_click_us && p->release_valid && (time - p->release_time) <= p->double_click_us){
+			p->release_valid = false;
+			GPIOEventDispatch(pin, GPIO_EVENT_DOUBLE_CLICK, level, time);
+		}
+		if(p->long_press_us){
+			p->long_pending = true;
+			p->long_time = time + p->long_press_us;
+		}
+		p->long_fired = false;
+	} else{
+		GPIOEventDispatch(pin, GPIO_EVENT_RELEASE, level, time);
+		p->long_pending = false;
+		p->release_valid = !p->long_fired;
+		p->release_time = time;
+	}
+}
+
+static uint32_t GPIOEventTimeout(uint32_t now){
+	uint32_t wait_us = NO_TIMEOUT;
+	int32_t remaining;
+
+	for(uint8_t pin = 0; pin < GPIO_QTY; pin++){
+		if(pins[pin].sampling){
+			remaining = (int32_t)(pins[pin].sample_time - now);
+			wait_us = (remaining <= 0) ? 0 : ((uint32_t)remaining < wait_us ? (uint32_t)remaining : wait_us);
+		}
+		if(pins[pin].long_pending){
+			remaining = (int32_t)(pins[pin].long_time - now);
+			wait_us = (remaining <= 0) ? 0 : ((uint32_t)remaining < wait_us ? (uint32_t)remaining : wait_us);
+		}
+	}
+	return wait_us;
+}
+
+/* Dispatcher: one debounce window per bounce burst, from its first edge (the
+ * interrupt is masked until the pin is sampled). Returns the time to the next
+ * window end or long press (NO_TIMEOUT: none) */
+static uint32_t GPIOEventProcess(void){
+	uint32_t now, tail;
+	gpio_edge_t edge;
+	gpio_event_pin_t *p;
+
+	tail = edges_tail;
+	while(tail != __atomic_load_n(&edges_head, __ATOMIC_ACQUIRE)){
+		edge = edges[tail & QUEUE_MASK];
+		__atomic_store_n(&edges_tail, ++tail, __ATOMIC_RELEASE);
+		p = &pins[edge.pin];
+		if(!p->sampling){
+			p->sampling = true;
+			p->edge_time = edge.time;
+			p->sample_time = edge.time + p->debounce_us;
+		}
+	}
+	now = GPIOEventTimeUs();
+	for(uint8_t pin = 0; pin < GPIO_QTY; pin++){
+		p = &pins[pin];
+		if(p->sampling && (int32_t)(now - p->sample_time) >= 0){
+			p->sampling = false;
+			/* Interrupt enabled before sampling: a later edge is never lost */
+			GPIOEventIntrEnable(pin, true);
+			GPIOEventUpdate(pin, GPIORead(pin), p->edge_time);
+		}
+		if(p->long_pending && (int32_t)(now - p->long_time) >= 0){
+			p->long_pending = false;
+			p->long_fired = true;
+			p->release_valid = false;
+			GPIOEventDispatch(pin, GPIO_EVENT_LONG_PRESS, !p->active_low, p->long_time);
+		}
+	}
+	return GPIOEventTimeout(now);
+}
+
+#ifdef MCU_HOST
+static void GPIOEventRun(void *param){
+	uint32_t wait_us;
+
+	dispatcher_event = -1;
+	wait_us = GPIOEventProcess();
+	if(wait_us != NO_TIMEOUT){
+		dispatcher_event = HostSchedule((uint64_t)wait_us * NS_PER_US, 0, GPIOEventRun, NULL);
+	}
+}
+
+static void GPIOEventStart(void){
+	/* The dispatcher runs when an edge or a timeout schedules it */
+}
+
+static void GPIOEventPinInit(gpio_t pin){
+	HostGPIOEdgeHook(pin, GPIOEventHostEdge, (void *)(uintptr_t)pin);
+	GPIOEventIntrEnable(pin, true);
+}
+#else
+static void GPIOEventTask(void *pvParameters){
+	uint32_t wait_us;
+	TickType_t ticks;
+
+	while(1){
+		wait_us = GPIOEventProcess();
+		if(wait_us == NO_TIMEOUT){
+			ticks = portMAX_DELAY;
+		} else if(wait_us == 0){
+			ticks = 0;
+		} else{
+			ticks = pdMS_TO_TICKS((wait_us + MS_TO_US - 1) / MS_TO_US) + 1;
+		}
+		ulTaskNotifyTake(pdTRUE, ticks);
+	}
+}
+
+static void GPIOEventStart(void){
+	xTaskCreate(GPIOEventTask, "gpio_event_task", GPIO_EVENT_TASK_STACK, NULL,
+		GPIO_EVENT_TASK_PRIORITY, &dispatcher_task_handle);
+	/* ESP_ERR_INVALID_STATE if GPIOActivInt() already installed it */
+	gpio_install_isr_service(0);
+}
+
+static void GPIOEventPinInit(gpio_t pin){
+	gpio_set_intr_type(pin, GPIO_INTR_ANYEDGE);
+	gpio_isr_handler_add(pin, gpio_event_isr, (void *)(uintptr_t)pin);
+	GPIOEventIntrEnable(pin, true);
+}
+#endif
+/*==================[external functions definition]==========================*/
+bool GPIOEventSubscribe(gpio_event_config_t *config){
+	gpio_event_pin_t *p;
+
+	if((subscribers_qty >= GPIO_EVENT_MAX_SUBSCRIBERS) || (config->pin >= GPIO_QTY) || (config->func_p == NULL)){
+		return false;
+	}
+	if(!dispatcher_started){
+		dispatcher_started = true;
+		GPIOEventStart();
+	}
+	subscribers[subscribers_qty].pin = config->pin;
+	subscribers[subscribers_qty].func_p = config->func_p;
+	subscribers[subscribers_qty].param_p = config->param_p;
+	subscribers_qty++;
+
+	p = &pins[config->pin];
+	if(!p->used){
+		p->used = true;
+		p->active_low = config->active_low;
+		p->debounce_us = (config->debounce_ms ? config->debounce_ms : GPIO_EVENT_DEBOUNCE_MS) * MS_TO_US;
+		p->long_press_us = config->long_press_ms * MS_TO_US;
+		p->double_click_us = config->double_click_ms * MS_TO_US;
+		p->pressed = GPIORead(config->pin) ^ p->active_low;
+		GPIOEventPinInit(config->pin);
+	}
+	return true;
+}
+
+uint32_t GPIOEventDropped(void){
+	return edges_dropped;
+}
+
+/*==================[end of file]============================================*/
@@ -13,14 +13,15 @@
 #include "gpio_fast_out_mcu.h"
 #include "gpio_mcu.h"
 #include <stdint.h>
-#include <string.h>
 #include "driver/gpio.h"
 #include "driver/dedic_gpio.h"
 /*==================[macros and definitions]=================================*/
-
+#define BUNDLE_MASK(qty)	((uint32_t)((1ULL << (qty)) - 1))
 /*==================[internal data declaration]==============================*/
-dedic_gpio_bundle_handle_t bundleA = NULL;
-int bundleA_gpios[16];
+static gpio_bundle_t bundleA;						/*!< Default output bundle (GPIOFastWrite) */
+static gpio_t bundleA_extra[GPIO_FAST_MAX_PINS - GPIO_BUNDLE_MAX_PINS];	/*!< Pins beyond bundleA width */
+static uint8_t bundleA_extra_qty = 0;
+static uint16_t bundleA_extra_state = 0;
 /*==================[internal functions declaration]=========================*/
 
 /*==================[internal data definition]===============================*/
@@ -30,29 +31,140 @@ int bundleA_gpios[16];
 /*==================[internal functions definition]==========================*/
 
 /*==================[external functions definition]==========================*/
+bool GPIOBundleInit(gpio_bundle_t *bundle, const gpio_t *pin_list, uint8_t pin_qty, io_t io){
+	int bundle_gpios[GPIO_BUNDLE_MAX_PINS];
+	dedic_gpio_bundle_handle_t handle = NULL;
+
+	if(pin_qty > GPIO_BUNDLE_MAX_PINS){
+		pin_qty = GPIO_BUNDLE_MAX_PINS;
+	}
+	bundle->pin_qty = pin_qty;
+	bundle->io = io;
+	bundle->state = 0;
+	bundle->handle = NULL;
+	for(uint8_t i = 0; i < pin_qty; i++){
+		bundle->pins[i] = pin_list[i];
+		bundle_gpios[i] = pin_list[i];
+		GPIOInit(pin_list[i], io);
+		if(io == GPIO_OUTPUT){
+			GPIOOff(pin_list[i]);
+		}
+	}
+	dedic_gpio_bundle_config_t bundle_config = {
+		.gpio_array = bundle_gpios,
+		.array_size = pin_qty,
+		.flags = {
+			.in_en = (io == GPIO_INPUT),
+			.out_en = (io == GPIO_OUTPUT),
+		},
+	};
+	/* Dedicated channels are limited, if none is free keep using the GPIO matrix */
+	if(dedic_gpio_new_bundle(&bundle_config, &handle) != ESP_OK){
+		return false;
+	}
+	bundle->handle = handle;
+	if(io == GPIO_OUTPUT){
+		dedic_gpio_bundle_write(handle, BUNDLE_MASK(pin_qty), 0);
+	}
+	return true;
+}
+
+void GPIOBundleWrite(gpio_bundle_t *bundle, uint32_t mask, uint32_t value){
+	uint32_t changed;
+	mask &= BUNDLE_MASK(bundle->pin_qty);
+	value &= mask;
+	if(bundle->handle != NULL){
+		dedic_gpio_bundle_write((dedic_gpio_bundle_handle_t)bundle->handle, mask, value);
+		bundle->state = (bundle->state & ~mask) | value;
+	} else{
+		/* Fallback: only touch the pins whose state changes */
+		changed = (bundle->state & mask) ^ value;
+		bundle->state = (bundle->state & ~mask) | value;
+		for(uint8_t i = 0; changed; i++, changed >>= 1){
+			if(changed & 1){
+				GPIOState(bundle->pins[i], (value >> i) & 1);
+			}
+		}
+	}
+}
+
+void GPIOBundleToggle(gpio_bundle_t *bundle, uint32_t mask){
+	GPIOBundleWrite(bundle, mask, ~bundle->state);
+}
+
+uint32_t GPIOBundleReadOut(gpio_bundle_t *bundle){
+	return bundle->state;
+}
+
+uint32_t GPIOBundleRead(gpio_bundle_t *bundle, uint32_t mask){
+	uint32_t value = 0;
+	mask &= BUNDLE_MASK(bundle->pin_qty);
+	if(bundle->handle != NULL){
+		value = dedic_gpio_bundle_read_in((dedic_gpio_bundle_handle_t)bundle->handle);
+	} else{
+		for(uint8_t i = 0; i < bundle->pin_qty; i++){
+			if((mask >> i) & 1){
+				value |= (uint32_t)GPIORead(bundle->pins[i]) << i;
+			}
+		}
+	}
+	return value & mask;
+}
+
+void GPIOBundleSample(gpio_bundle_t *bundle, uint32_t *samples, uint16_t sample_qty){
+	uint32_t mask = BUNDLE_MASK(bundle->pin_qty);
+	if(bundle->handle != NULL){
+		dedic_gpio_bundle_handle_t handle = (dedic_gpio_bundle_handle_t)bundle->handle;
+		for(uint16_t i = 0; i < sample_qty; i++){
+			samples[i] = dedic_gpio_bundle_read_in(handle) & mask;
+		}
+	} else{
+		for(uint16_t i = 0; i < sample_qty; i++){
+			samples[i] = GPIOBundleRead(bundle, mask);
+		}
+	}
+}
+
+void GPIOBundleDeinit(gpio_bundle_t *bundle){
+	if(bundle->handle != NULL){
+		dedic_gpio_del_bundle((dedic_gpio_bundle_handle_t)bundle->handle);
+		bundle->handle = NULL;
+	}
+}
 
 void GPIOFastInit(gpio_t *pin_list, uint8_t pin_qty){
-    memcpy(bundleA_gpios, pin_list, pin_qty);
-    gpio_config_t io_conf = {
-        .mode = GPIO_MODE_OUTPUT,
-    };
-    for (int i = 0; i < pin_qty; i++) {
-        io_conf.pin_bit_mask = 1ULL << bundleA_gpios[i];
-        gpio_config(&io_conf);
-    }
-    // Create bundleA, output only
-    dedic_gpio_bundle_config_t bundleA_config = {
-        .gpio_array = bundleA_gpios,
-        .array_size = pin_qty,
-        .flags = {
-            .out_en = 1,
-        },
-    };
-    ESP_ERROR_CHECK(dedic_gpio_new_bundle(&bundleA_config, &bundleA));
+	if(pin_qty > GPIO_FAST_MAX_PINS){
+		pin_qty = GPIO_FAST_MAX_PINS;
+	}
+	GPIOBundleDeinit(&bundleA);
+	if(pin_qty > GPIO_BUNDLE_MAX_PINS){
+		bundleA_extra_qty = pin_qty - GPIO_BUNDLE_MAX_PINS;
+		GPIOBundleInit(&bundleA, pin_list, GPIO_BUNDLE_MAX_PINS, GPIO_OUTPUT);
+	} else{
+		bundleA_extra_qty = 0;
+		GPIOBundleInit(&bundleA, pin_list, pin_qty, GPIO_OUTPUT);
+	}
+	bundleA_extra_state = 0;
+	for(uint8_t i = 0; i < bundleA_extra_qty; i++){
+		bundleA_extra[i] = pin_list[GPIO_BUNDLE_MAX_PINS + i];
+		GPIOInit(bundleA_extra[i], GPIO_OUTPUT);
+		GPIOOff(bundleA_extra[i]);
+	}
 }
 
 void GPIOFastWrite(uint16_t value){
-    dedic_gpio_bundle_write(bundleA, 0xFF, value);
+	uint16_t changed;
+	GPIOBundleWrite(&bundleA, BUNDLE_MASK(bundleA.pin_qty), value);
+	if(bundleA_extra_qty){
+		value >>= GPIO_BUNDLE_MAX_PINS;
+		changed = (bundleA_extra_state ^ value) & BUNDLE_MASK(bundleA_extra_qty);
+		bundleA_extra_state = value;
+		for(uint8_t i = 0; changed; i++, changed >>= 1){
+			if(changed & 1){
+				GPIOState(bundleA_extra[i], (value >> i) & 1);
+			}
+		}
+	}
 }
 
 /*==================[end of file]============================================*/
\ No newline at end of file
@@ -11,11 +11,11 @@
 
 /*==================[inclusions]=============================================*/
 #include "gpio_mcu.h"
+#include "trace_mcu.h"
 #include <stdint.h>
 #include "driver/gpio.h"
 #include "driver/gpio_filter.h"
 /*==================[macros and definitions]=================================*/
-#define GPIO_QTY 	24
 #define FILTER_QTY	8
 typedef struct{
 	uint64_t pin;				/*!< GPIO pin */
@@ -23,6 +23,12 @@ typedef struct{
 	gpio_pull_mode_t pull;		/*!< GPIO pull-up/pull-down resistor */
 	bool state;					/*!< GPIO output state */
 } digital_io_t;
+#ifdef MCU_TRACE
+typedef struct{
+	void (*func_p)(void*);		/*!< User ISR */
+	void *args;					/*!< User ISR parameter */
+} gpio_isr_t;
+#endif
 /*==================[internal data declaration]==============================*/
 
 /*==================[internal functions declaration]=========================*/
@@ -54,6 +60,9 @@ digital_io_t gpio_list[GPIO_QTY] = {
 	{GPIO_NUM_22, GPIO_MODE_DISABLE, GPIO_PULLUP_ONLY, false}, /* Configuration GPIO22*/
 	{GPIO_NUM_23, GPIO_MODE_DISABLE, GPIO_PULLUP_ONLY, false}, /* Configuration GPIO23*/
 };
+#ifdef MCU_TRACE
+static gpio_isr_t gpio_isr[GPIO_QTY];	/*!< User ISRs, called through GPIOTraceIsr() */
+#endif
 gpio_flex_glitch_filter_config_t filter_config = {
 	.clk_src = GLITCH_FILTER_CLK_SRC_DEFAULT,
 	.window_width_ns = 700,
@@ -62,7 +71,14 @@ gpio_flex_glitch_filter_config_t filter_config = {
 /*==================[external data definition]===============================*/
 
 /*==================[internal functions definition]==========================*/
-
+#ifdef MCU_TRACE
+static void IRAM_ATTR GPIOTraceIsr(void *args){
+	uint8_t pin = (uint8_t)(uintptr_t)args;
+	TraceIsrEnter(TRACE_ISR_GPIO(pin));
+	gpio_isr[pin].func_p(gpio_isr[pin].args);
+	TraceIsrExit(TRACE_ISR_GPIO(pin));
+}
+#endif
 /*==================[external functions definition]==========================*/
 void GPIOInit(gpio_t pin, io_t io){
 	if((pin == GPIO_14) || (pin > GPIO_23)){
@@ -113,7 +129,13 @@ void GPIOActivInt(gpio_t pin, void *ptr_int_func, bool edge, void *args){
 		gpio_install_isr_service(0);
 		isr_service_installed = true;
 	}
+#ifdef MCU_TRACE
+	gpio_isr[pin].func_p = ptr_int_func;
+	gpio_isr[pin].args = args;
+	gpio_isr_handler_add(gpio_list[pin].pin, GPIOTraceIsr, (void *)(uintptr_t)pin);
+#else
     gpio_isr_handler_add(gpio_list[pin].pin, ptr_int_func, (void *)args);	
+#endif
 }
 
 void GPIOInputFilter(gpio_t pin){
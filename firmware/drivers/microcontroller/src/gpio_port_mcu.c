@@ -0,0 +1,52 @@
+/**
+ * @file gpio_port_mcu.c
+ * @brief
+ * @version 0.1
+ * @date 2026-10-19
+ *
+ * @copyright Copyright (c) 2026
+ *
+ */
+
+/*==================[inclusions]=============================================*/
+#include "gpio_port_mcu.h"
+#include "gpio_fast_out_mcu.h"
+#include <stdint.h>
+/*==================[macros and definitions]=================================*/
+
+/*==================[internal data declaration]==============================*/
+
+/*==================[internal functions declaration]=========================*/
+
+/*==================[internal data definition]===============================*/
+
+/*==================[external data definition]===============================*/
+
+/*==================[internal functions definition]==========================*/
+
+/*==================[external functions definition]==========================*/
+bool GPIOPortInit(gpio_port_t *port, const gpio_t *pin_list, uint8_t pin_qty){
+	return GPIOBundleInit(&port->bundle, pin_list, pin_qty, GPIO_OUTPUT);
+}
+
+void GPIOPortWrite(gpio_port_t *port, uint8_t mask, uint8_t value){
+	GPIOBundleWrite(&port->bundle, mask, value);
+}
+
+void GPIOPortSet(gpio_port_t *port, uint8_t mask){
+	GPIOBundleWrite(&port->bundle, mask, mask);
+}
+
+void GPIOPortClear(gpio_port_t *port, uint8_t mask){
+	GPIOBundleWrite(&port->bundle, mask, 0);
+}
+
+void GPIOPortToggle(gpio_port_t *port, uint8_t mask){
+	GPIOBundleToggle(&port->bundle, mask);
+}
+
+uint8_t GPIOPortState(gpio_port_t *port){
+	return GPIOBundleReadOut(&port->bundle);
+}
+
+/*==================[end of file]============================================*/
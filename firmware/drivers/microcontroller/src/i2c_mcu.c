@@ -17,6 +17,8 @@
 //#include "sdkconfig.h"
 
 #include "i2c_mcu.h"
+#include "trace_mcu.h"
+#include "stats_mcu.h"
 /*==================[macros and definitions]=================================*/
 #define I2C_NUM I2C_NUM_0
 
@@ -125,6 +127,9 @@ int8_t I2C_readByte(uint8_t devAddr, uint8_t regAddr, uint8_t *data, uint16_t ti
  */
 int8_t I2C_readBytes(uint8_t devAddr, uint8_t regAddr, uint8_t length, uint8_t *data, uint16_t timeout) {
 	i2c_cmd_handle_t cmd;
+	esp_err_t ret;
+	uint32_t start = StatsStart();
+	TraceI2CStart(devAddr, length);
 	I2C_SelectRegister(devAddr, regAddr);
 
 	cmd = i2c_cmd_link_create();
@@ -137,8 +142,11 @@ int8_t I2C_readBytes(uint8_t devAddr, uint8_t regAddr, uint8_t length, uint8_t *
 	ESP_ERROR_CHECK(i2c_master_read_byte(cmd, data+length-1, I2C_MASTER_NACK));
 
 	ESP_ERROR_CHECK(i2c_master_stop(cmd));
-	ESP_ERROR_CHECK(i2c_master_cmd_begin(I2C_NUM, cmd, 1000/portTICK_PERIOD_MS));
+	ret = i2c_master_cmd_begin(I2C_NUM, cmd, 1000/portTICK_PERIOD_MS);
+	ESP_ERROR_CHECK(ret);
 	i2c_cmd_link_delete(cmd);
+	TraceI2CEnd(devAddr, ret == ESP_OK);
+	StatsEnd(STATS_I2C, start, length, ret == ESP_OK);
 
 	return length;
 }
@@ -235,7 +243,10 @@ bool I2C_writeByte(uint8_t devAddr, uint8_t regAddr, uint8_t data) {
  */
 bool I2C_writeBytes(uint8_t devAddr, uint8_t regAddr, uint8_t length, uint8_t *data){
 	i2c_cmd_handle_t cmd;
+	esp_err_t ret;
+	uint32_t start = StatsStart();
 
+	TraceI2CStart(devAddr, length);
 	cmd = i2c_cmd_link_create();
 	ESP_ERROR_CHECK(i2c_master_start(cmd));
 	ESP_ERROR_CHECK(i2c_master_write_byte(cmd, (devAddr << 1) | I2C_MASTER_WRITE, 1));
@@ -243,9 +254,11 @@ bool I2C_writeBytes(uint8_t devAddr, uint8_t regAddr, uint8_t length, uint8_t *d
 	ESP_ERROR_CHECK(i2c_master_write(cmd, data, length-1, 0));
 	ESP_ERROR_CHECK(i2c_master_write_byte(cmd, data[length-1], 1));
 	ESP_ERROR_CHECK(i2c_master_stop(cmd));
-	i2c_master_cmd_begin(I2C_NUM, cmd, 1000/portTICK_PERIOD_MS);
+	ret = i2c_master_cmd_begin(I2C_NUM, cmd, 1000/portTICK_PERIOD_MS);
 	i2c_cmd_link_delete(cmd);
-	return true;
+	TraceI2CEnd(devAddr, ret == ESP_OK);
+	StatsEnd(STATS_I2C, start, length, ret == ESP_OK);
+	return ret == ESP_OK;
 }
 
 
@@ -0,0 +1,160 @@
+/**
+ * @file monitor_mcu.c
+ * @brief Runtime monitor: statistics queries and periodic report
+ * @version 0.1
+ * @date 2026-10-19
+ *
+ * @copyright Copyright (c) 2026
+ *
+ */
+
+/*==================[inclusions]=============================================*/
+#include "monitor_mcu.h"
+#include <stdio.h>
+#ifndef MCU_HOST
+#include "freertos/FreeRTOS.h"
+#include "freertos/task.h"
+#endif
+/*==================[macros and definitions]=================================*/
+#define MONITOR_TASK_STACK		2048	/*!< Report task stack (bytes) */
+#define MONITOR_TASK_PRIORITY	1		/*!< Report task priority (just above idle) */
+/*==================[internal data declaration]==============================*/
+
+/*==================[internal functions declaration]=========================*/
+
+/*==================[internal data definition]===============================*/
+static uint32_t window_start;			/*!< Start of the report window (us) */
+#ifndef MCU_HOST
+static uart_mcu_port_t report_port;		/*!< MonitorStart() port */
+static uint32_t report_ms;				/*!< MonitorStart() period */
+#endif
+/*==================[external data definition]===============================*/
+monitor_task_t monitor_tasks[MONITOR_MAX_TASKS];
+/*==================[internal functions definition]==========================*/
+/* Free bytes at the high-water mark: fill values left at the bottom of the
+ * stack (it grows downwards) */
+static uint32_t MonitorStackFree(const monitor_task_t *t){
+	uint32_t free_bytes = 0;
+
+	if(t->stack != NULL){
+		while((free_bytes < t->stack_size) && (t->stack[free_bytes] == MONITOR_STACK_FILL)){
+			free_bytes++;
+		}
+		return free_bytes;
+	}
+#ifndef MCU_HOST
+	if(t->handle != NULL){
+		/* ESP-IDF: high-water mark in bytes */
+		return uxTaskGetStackHighWaterMark((TaskHandle_t)t->handle);
+	}
+#endif
+	return MONITOR_STACK_UNKNOWN;
+}
+
+#ifndef MCU_HOST
+static void MonitorTask(void *param){
+	while(1){
+		vTaskDelay(pdMS_TO_TICKS(report_ms));
+		MonitorSend(report_port);
+	}
+}
+#endif
+/*==================[external functions definition]==========================*/
+bool MonitorInit(uint8_t id, const char *name, uint32_t period_us){
+	if(id >= MONITOR_MAX_TASKS){
+		return false;
+	}
+	monitor_tasks[id] = (monitor_task_t){.name = name, .period = period_us};
+	window_start = MonitorTimeUs();
+	return true;
+}
+
+void MonitorStack(uint8_t id, const void *stack, uint32_t size){
+	monitor_tasks[id].stack = stack;
+	monitor_tasks[id].stack_size = size;
+}
+
+void MonitorBeginFirst(uint8_t id){
+#ifdef MCU_HOST
+	monitor_tasks[id].handle = &monitor_tasks[id];
+#else
+	monitor_tasks[id].handle = xTaskGetCurrentTaskHandle();
+#endif
+}
+
+bool MonitorGet(uint8_t id, monitor_stats_t *stats){
+	const monitor_task_t *t;
+	uint32_t window = MonitorTimeUs() - window_start;
+
+	if((id >= MONITOR_MAX_TASKS) || (monitor_tasks[id].name == NULL)){
+		return false;
+	}
+	t = &monitor_tasks[id];
+	stats->load = window ? 100.0f * t->busy_window / window : 0;
+	stats->runs = t->runs;
+	stats->run_last = t->run_last;
+	stats->run_max = t->run_max;
+	stats->run_avg = t->runs ? (uint32_t)(t->busy_total / t->runs) : 0;
+	stats->latency_max = t->latency_max;
+	stats->overruns = t->overruns;
+	stats->misses = t->misses;
+	stats->stack_free = MonitorStackFree(t);
+	return true;
+}
+
+uint16_t MonitorFormat(uint8_t id, char *line, uint16_t size){
+	monitor_stats_t s;
+	uint32_t load;
+	int len;
+
+	if(!MonitorGet(id, &s)){
+		return 0;
+	}
+	/* Load in tenths of % (no float formatting) */
+	load = (uint32_t)(s.load * 10 + 0.5f);
+	if(s.stack_free == MONITOR_STACK_UNKNOWN){
+		len = snprintf(line, size, "%s: load %lu.%lu%% run %lu/%lu us stack - ovr %lu miss %lu\r\n",
+			monitor_tasks[id].name, (unsigned long)load / 10, (unsigned long)load % 10, (unsigned long)s.run_avg,
+			(unsigned long)s.run_max, (unsigned long)s.overruns, (unsigned long)s.misses);
+	} else{
+		len = snprintf(line, size, "%s: load %lu.%lu%% run %lu/%lu us stack %lu ovr %lu miss %lu\r\n",
+			monitor_tasks[id].name, (unsigned long)load / 10, (unsigned long)load % 10, (unsigned long)s.run_avg,
+			(unsigned long)s.run_max, (unsigned long)s.stack_free, (unsigned long)s.overruns,
+			(unsigned long)s.misses);
+	}
+	if(len < 0){
+		return 0;
+	}
+	return (len < size) ? len : size - 1;
+}
+
+void MonitorWindow(void){
+	for(uint8_t i = 0; i < MONITOR_MAX_TASKS; i++){
+		monitor_tasks[i].busy_window = 0;
+	}
+	window_start = MonitorTimeUs();
+}
+
+void MonitorSend(uart_mcu_port_t port){
+	char line[MONITOR_LINE_SIZE];
+	uint16_t len;
+
+	for(uint8_t i = 0; i < MONITOR_MAX_TASKS; i++){
+		len = MonitorFormat(i, line, sizeof(line));
+		if(len){
+			/* Waits for room in the TX FIFO: the report can be longer than it */
+			UartWriteBuffer(port, line, len);
+		}
+	}
+	MonitorWindow();
+}
+
+#ifndef MCU_HOST
+bool MonitorStart(uart_mcu_port_t port, uint32_t period_ms){
+	report_port = port;
+	report_ms = period_ms;
+	return xTaskCreate(MonitorTask, "monitor", MONITOR_TASK_STACK, NULL, MONITOR_TASK_PRIORITY, NULL) == pdPASS;
+}
+#endif
+
+/*==================[end of file]============================================*/
@@ -0,0 +1,224 @@
+/**
+ * @file pipeline_mcu.c
+ * @brief Dataflow pipeline: stage scheduling, back-pressure and statistics
+ * @version 0.1
+ * @date 2026-10-19
+ *
+ * @copyright Copyright (c) 2026
+ *
+ */
+
+/*==================[inclusions]=============================================*/
+#include "pipeline_mcu.h"
+#include <stddef.h>
+#include <stdio.h>
+#ifdef MCU_HOST
+#include <time.h>
+#else
+#include "sdkconfig.h"
+#include "esp_cpu.h"
+#include "freertos/FreeRTOS.h"
+#include "freertos/task.h"
+#endif
+/*==================[macros and definitions]=================================*/
+#ifdef MCU_HOST
+#define PIPELINE_TICKS_PER_US	1000							/*!< ns (host clock) */
+#else
+#define PIPELINE_TICKS_PER_US	CONFIG_ESP_DEFAULT_CPU_FREQ_MHZ	/*!< CPU cycles */
+#endif
+/*==================[internal data declaration]==============================*/
+
+/*==================[internal functions declaration]=========================*/
+
+/*==================[internal data definition]===============================*/
+
+/*==================[external data definition]===============================*/
+
+/*==================[internal functions definition]==========================*/
+static uint32_t PipelineTicks(void){
+#ifdef MCU_HOST
+	struct timespec t;
+
+	clock_gettime(CLOCK_MONOTONIC, &t);
+	return (uint32_t)(t.tv_sec * 1000000000ULL + t.tv_nsec);
+#else
+	return esp_cpu_get_cycle_count();
+#endif
+}
+
+/* Run a stage once if it has an input block and room for an output block */
+static bool PipelineStageRun(pipeline_stage_t *stage){
+	uint32_t in_len = stage->in_block, out_len = stage->out_block;
+	const void *in = NULL;
+	void *out = NULL;
+	uint32_t start, time, depth;
+	bool done;
+
+	if(stage->process == NULL){
+		return false;
+	}
+	if(stage->in != NULL){
+		depth = RingBufferCount(stage->in);
+		if(depth > stage->stats.depth_max){
+			stage->stats.depth_max = depth;
+		}
+		if(depth < stage->in_block){
+			return false;
+		}
+		in = RingBufferReadPeek(stage->in, &in_len);
+	}
+	if(stage->out != NULL){
+		out = RingBufferWriteReserve(stage->out, &out_len);
+		if(out_len < stage->out_block){
+			stage->stats.stalls++;
+			return false;
+		}
+	}
+	start = PipelineTicks();
+	done = stage->process(in, out, stage->param);
+	time = PipelineTicks() - start;
+	if(done){
+		if(stage->in != NULL){
+			RingBufferReadRelease(stage->in, stage->in_block);
+		}
+		if(stage->out != NULL){
+			RingBufferWriteCommit(stage->out, stage->out_block);
+		}
+		stage->stats.runs++;
+		stage->stats.time += time;
+		if(time > stage->stats.time_max){
+			stage->stats.time_max = time;
+		}
+	}
+	return done;
+}
+/*==================[external functions definition]==========================*/
+void PipelineInit(pipeline_t *pipeline){
+	pipeline->qty = 0;
+	pipeline->task = NULL;
+	pipeline->poll_ticks = 0;
+	pipeline->notifications = 0;
+}
+
+bool PipelineAdd(pipeline_t *pipeline, pipeline_stage_t *stage){
+	if(pipeline->qty >= PIPELINE_MAX_STAGES){
+		return false;
+	}
+	stage->in = NULL;
+	stage->out = NULL;
+	stage->pipeline = pipeline;
+	stage->stats = (pipeline_stats_t){0};
+	pipeline->stages[pipeline->qty++] = stage;
+	return true;
+}
+
+bool PipelineConnect(pipeline_stage_t *from, pipeline_stage_t *to, ring_buffer_t *buffer, void *storage,
+	uint32_t size, uint32_t elem_size){
+	/* Blocks never wrap: they divide the buffer size (both are powers of two) */
+	if((from->out != NULL) || (to->in != NULL) || (from->out_block == 0) || (to->in_block == 0) ||
+		(from->out_block > size) || (to->in_block > size) ||
+		(size % from->out_block) || (size % to->in_block)){
+		return false;
+	}
+	if(!RingBufferInit(buffer, storage, size, elem_size)){
+		return false;
+	}
+	from->out = buffer;
+	to->in = buffer;
+	return true;
+}
+
+bool PipelinePush(pipeline_stage_t *source, const void *elem){
+	if(!RingBufferPush(source->out, elem)){
+		source->stats.overruns++;
+		return false;
+	}
+	if((++source->stats.runs % source->out_block) == 0){
+		PipelineNotify(source->pipeline);
+	}
+	return true;
+}
+
+uint32_t PipelineWrite(pipeline_stage_t *source, const void *elems, uint32_t len){
+	uint32_t written = RingBufferWrite(source->out, elems, len);
+	uint32_t before = source->stats.runs;
+
+	source->stats.overruns += len - written;
+	source->stats.runs += written;
+	if((before / source->out_block) != (source->stats.runs / source->out_block)){
+		PipelineNotify(source->pipeline);
+	}
+	return written;
+}
+
+void PipelineNotify(pipeline_t *pipeline){
+	pipeline->notifications++;
+#ifndef MCU_HOST
+	BaseType_t woken = pdFALSE;
+
+	if(pipeline->task == NULL){
+		return;
+	}
+	if(xPortInIsrContext()){
+		vTaskNotifyGiveFromISR(pipeline->task, &woken);
+		portYIELD_FROM_ISR(woken);
+	} else{
+		xTaskNotifyGive(pipeline->task);
+	}
+#endif
+}
+
+uint32_t PipelineRun(pipeline_t *pipeline){
+	uint32_t runs = 0, pass;
+
+	/* Downstream stages first: blocks leave the pipeline as soon as possible
+	 * and free room for the stages upstream */
+	do{
+		pass = 0;
+		for(int8_t i = pipeline->qty - 1; i >= 0; i--){
+			while(PipelineStageRun(pipeline->stages[i])){
+				pass++;
+			}
+		}
+		runs += pass;
+	} while(pass);
+	return runs;
+}
+
+#ifndef MCU_HOST
+static void PipelineTask(void *param){
+	pipeline_t *pipeline = param;
+
+	while(1){
+		ulTaskNotifyTake(pdTRUE, pipeline->poll_ticks ? pipeline->poll_ticks : portMAX_DELAY);
+		PipelineRun(pipeline);
+	}
+}
+
+bool PipelineStart(pipeline_t *pipeline, uint32_t stack, uint8_t priority, uint32_t poll_ms){
+	pipeline->poll_ticks = poll_ms ? pdMS_TO_TICKS(poll_ms) : 0;
+	if((poll_ms != 0) && (pipeline->poll_ticks == 0)){
+		pipeline->poll_ticks = 1;
+	}
+	return xTaskCreate(PipelineTask, "pipeline", stack, pipeline, priority, (TaskHandle_t *)&pipeline->task) == pdPASS;
+}
+#endif
+
+float PipelineTimeUs(uint64_t ticks){
+	return (float)ticks / PIPELINE_TICKS_PER_US;
+}
+
+void PipelinePrint(const pipeline_t *pipeline){
+	const pipeline_stats_t *s;
+
+	printf("%-12s %8s %10s %10s %8s %8s %8s\n", "stage", "runs", "avg us", "max us", "depth", "stalls", "overrun");
+	for(uint8_t i = 0; i < pipeline->qty; i++){
+		s = &pipeline->stages[i]->stats;
+		printf("%-12s %8lu %10.1f %10.1f %8lu %8lu %8lu\n", pipeline->stages[i]->name, (unsigned long)s->runs,
+			(pipeline->stages[i]->process && s->runs) ? PipelineTimeUs(s->time) / s->runs : 0.0f,
+			PipelineTimeUs(s->time_max), (unsigned long)s->depth_max, (unsigned long)s->stalls,
+			(unsigned long)s->overruns);
+	}
+}
+
+/*==================[end of file]============================================*/
@@ -12,6 +12,8 @@
 /*==================[inclusions]=============================================*/
 #include "rtc_mcu.h"
 #include <stdint.h>
+#include <stddef.h>
+#include <time.h>
 #include "sys/time.h"
 /*==================[macros and definitions]=================================*/
 
@@ -15,6 +15,8 @@
 #include <string.h>
 #include "driver/spi_master.h"
 #include "gpio_mcu.h"
+#include "trace_mcu.h"
+#include "stats_mcu.h"
 /*==================[macros and definitions]=================================*/
 #define PIN_NUM_MISO	GPIO_22	/*!<  */
 #define PIN_NUM_MOSI	GPIO_21	/*!<  */
@@ -104,122 +106,137 @@ uint8_t SpiInit(spi_mcu_config_t* spi){
 
 void SpiRead(spi_dev_t device, uint8_t * rx_buffer, uint32_t rx_buffer_size){
     spi_transaction_t t;
+    esp_err_t ret = ESP_OK;
+    uint32_t start = StatsStart();
     memset(&t, 0, sizeof(t));       // Zero out the transaction
     t.length = rx_buffer_size * 8;  // tx_buffer_size is in bytes, transaction length is in bits.
     t.rxlength = rx_buffer_size * 8;
     t.rx_buffer = rx_buffer;        // Data
+    TraceSpiStart(device, rx_buffer_size);
     switch(device){
         case SPI_1:
             switch(transfer_mode_1){
                 case SPI_POLLING:
-                    spi_device_polling_transmit(spi_1, &t); 
+                    ret = spi_device_polling_transmit(spi_1, &t); 
                     break;
                 case SPI_INTERRUPT:
-                    spi_device_transmit(spi_1, &t); 
+                    ret = spi_device_transmit(spi_1, &t); 
                     break;
             }
             break;
         case SPI_2:
             switch(transfer_mode_2){
                 case SPI_POLLING:
-                    spi_device_polling_transmit(spi_2, &t); 
+                    ret = spi_device_polling_transmit(spi_2, &t); 
                     break;
                 case SPI_INTERRUPT:
-                    spi_device_transmit(spi_2, &t); 
+                    ret = spi_device_transmit(spi_2, &t); 
                     break;
             }
             break;
         case SPI_3:
             switch(transfer_mode_3){
                 case SPI_POLLING:
-                    spi_device_polling_transmit(spi_3, &t); 
+                    ret = spi_device_polling_transmit(spi_3, &t); 
                     break;
                 case SPI_INTERRUPT:
-                    spi_device_transmit(spi_3, &t); 
+                    ret = spi_device_transmit(spi_3, &t); 
                     break;
             }
             break;
     }
+    TraceSpiEnd(device);
+    StatsEnd(STATS_SPI(device), start, rx_buffer_size, ret == ESP_OK);
 }
 
 void SpiWrite(spi_dev_t device, uint8_t * tx_buffer, uint32_t tx_buffer_size){
     spi_transaction_t t;
+    esp_err_t ret = ESP_OK;
+    uint32_t start = StatsStart();
     memset(&t, 0, sizeof(t));       // Zero out the transaction
     t.length = tx_buffer_size * 8;  // tx_buffer_size is in bytes, transaction length is in bits.
     t.tx_buffer = tx_buffer;        // Data
+    TraceSpiStart(device, tx_buffer_size);
     switch(device){
         case SPI_1:
             switch(transfer_mode_1){
                 case SPI_POLLING:
-                    spi_device_polling_transmit(spi_1, &t); 
+                    ret = spi_device_polling_transmit(spi_1, &t); 
                     break;
                 case SPI_INTERRUPT:
-                    spi_device_transmit(spi_1, &t); 
+                    ret = spi_device_transmit(spi_1, &t); 
                     break;
             }
             break;
         case SPI_2:
             switch(transfer_mode_2){
                 case SPI_POLLING:
-                    spi_device_polling_transmit(spi_2, &t); 
+                    ret = spi_device_polling_transmit(spi_2, &t); 
                     break;
                 case SPI_INTERRUPT:
-                    spi_device_transmit(spi_2, &t); 
+                    ret = spi_device_transmit(spi_2, &t); 
                     break;
             }
             break;
         case SPI_3:
             switch(transfer_mode_3){
                 case SPI_POLLING:
-                    spi_device_polling_transmit(spi_3, &t); 
+                    ret = spi_device_polling_transmit(spi_3, &t); 
                     break;
                 case SPI_INTERRUPT:
-                    spi_device_transmit(spi_3, &t); 
+                    ret = spi_device_transmit(spi_3, &t); 
                     break;
             }
             break;
     }
+    TraceSpiEnd(device);
+    StatsEnd(STATS_SPI(device), start, tx_buffer_size, ret == ESP_OK);
 }
 
 void SpiReadWrite(spi_dev_t device, uint8_t * tx_buffer, uint8_t * rx_buffer, uint32_t buffer_size){
     spi_transaction_t t;
+    esp_err_t ret = ESP_OK;
+    uint32_t start = StatsStart();
     memset(&t, 0, sizeof(t));       // Zero out the transaction
     t.length = buffer_size * 8;     // tx_buffer_size is in bytes, transaction length is in bits.
     t.rxlength = buffer_size * 8;
     t.tx_buffer = tx_buffer;        // Data
     t.rx_buffer = rx_buffer;        
+    TraceSpiStart(device, buffer_size);
     switch(device){
         case SPI_1:
             switch(transfer_mode_1){
                 case SPI_POLLING:
-                    spi_device_polling_transmit(spi_1, &t); 
+                    ret = spi_device_polling_transmit(spi_1, &t); 
                     break;
                 case SPI_INTERRUPT:
-                    spi_device_transmit(spi_1, &t); 
+                    ret = spi_device_transmit(spi_1, &t); 
                     break;
             }
             break;
         case SPI_2:
             switch(transfer_mode_2){
                 case SPI_POLLING:
-                    spi_device_polling_transmit(spi_2, &t); 
+                    ret = spi_device_polling_transmit(spi_2, &t); 
                     break;
                 case SPI_INTERRUPT:
-                    spi_device_transmit(spi_2, &t); 
+                    ret = spi_device_transmit(spi_2, &t); 
                     break;
             }
             break;
         case SPI_3:
             switch(transfer_mode_3){
                 case SPI_POLLING:
-                    spi_device_polling_transmit(spi_3, &t); 
+                    ret = spi_device_polling_transmit(spi_3, &t); 
                     break;
                 case SPI_INTERRUPT:
-                    spi_device_transmit(spi_3, &t); 
+                    ret = spi_device_transmit(spi_3, &t); 
                     break;
             }
             break;
     }
+    TraceSpiEnd(device);
+    StatsEnd(STATS_SPI(device), start, buffer_size, ret == ESP_OK);
 }
 
 uint8_t SpiDeInit(spi_dev_t device){
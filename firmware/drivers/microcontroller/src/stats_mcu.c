@@ -0,0 +1,98 @@
+/**
+ * @file stats_mcu.c
+ * @brief Performance counters of the drivers: snapshots and report
+ * @version 0.1
+ * @date 2026-10-19
+ *
+ * @copyright Copyright (c) 2026
+ *
+ */
+
+/*==================[inclusions]=============================================*/
+#include "stats_mcu.h"
+#include <stdio.h>
+/*==================[macros and definitions]=================================*/
+
+/*==================[internal data declaration]==============================*/
+
+/*==================[internal functions declaration]=========================*/
+
+/*==================[internal data definition]===============================*/
+static const char *const stats_names[STATS_QTY] = {
+	"spi_1", "spi_2", "spi_3", "i2c", "uart_pc", "uart_conn",
+	"adc_ch0", "adc_ch1", "adc_ch2", "adc_ch3", "ble", "timer_a", "timer_b", "timer_c",
+};
+/*==================[external data definition]===============================*/
+stats_counters_t stats_counters[STATS_QTY];
+/*==================[internal functions definition]==========================*/
+static inline uint32_t StatsRead32(uint32_t *counter, bool reset){
+	return reset ? __atomic_exchange_n(counter, 0, __ATOMIC_RELAXED) : __atomic_load_n(counter, __ATOMIC_RELAXED);
+}
+
+static inline uint64_t StatsTicksToNs(uint64_t ticks){
+	return ticks * 1000 / STATS_TICKS_PER_US;
+}
+/*==================[external functions definition]==========================*/
+const char* StatsName(stats_id_t id){
+	return (id < STATS_QTY) ? stats_names[id] : "?";
+}
+
+void StatsGet(stats_id_t id, stats_t *stats, bool reset){
+	stats_counters_t *c = &stats_counters[id];
+	uint64_t total;
+
+	stats->transactions = StatsRead32(&c->transactions, reset);
+	stats->bytes = StatsRead32(&c->bytes, reset);
+	stats->errors = StatsRead32(&c->errors, reset);
+	stats->time_max = StatsTicksToNs(StatsRead32(&c->time_max, reset));
+	total = reset ? __atomic_exchange_n(&c->time_total, 0, __ATOMIC_RELAXED) : __atomic_load_n(&c->time_total, __ATOMIC_RELAXED);
+	stats->time_total = StatsTicksToNs(total);
+	stats->depth_max = StatsRead32(&c->depth_max, reset);
+}
+
+void StatsReset(void){
+	stats_t stats;
+
+	for(uint8_t i = 0; i < STATS_QTY; i++){
+		StatsGet(i, &stats, true);
+	}
+}
+
+uint16_t StatsFormat(const stats_t *stats, stats_id_t id, char *line, uint16_t size){
+	/* Times in tenths of us (no float formatting) */
+	uint32_t avg = stats->transactions ? (uint32_t)((stats->time_total / stats->transactions + 50) / 100) : 0;
+	uint32_t max = (stats->time_max + 50) / 100;
+	uint16_t len;
+
+	len = snprintf(line, size, "%s: n %lu bytes %lu err %lu time %lu.%lu/%lu.%lu us depth %lu\r\n",
+		StatsName(id), (unsigned long)stats->transactions, (unsigned long)stats->bytes,
+		(unsigned long)stats->errors, (unsigned long)avg / 10, (unsigned long)avg % 10,
+		(unsigned long)max / 10, (unsigned long)max % 10, (unsigned long)stats->depth_max);
+	if(len < 0){
+		return 0;
+	}
+	return (len < size) ? len : size - 1;
+}
+
+uint8_t StatsSend(uart_mcu_port_t port, bool reset){
+	stats_t stats[STATS_QTY];
+	char line[STATS_LINE_SIZE];
+	uint8_t lines = 0;
+	uint16_t len;
+
+	/* Snapshot first: the report itself goes through the UART counters */
+	for(uint8_t i = 0; i < STATS_QTY; i++){
+		StatsGet(i, &stats[i], reset);
+	}
+	for(uint8_t i = 0; i < STATS_QTY; i++){
+		if(stats[i].transactions || stats[i].errors){
+			/* Waits for room in the TX FIFO: the report is longer than it */
+			len = StatsFormat(&stats[i], i, line, sizeof(line));
+			UartWriteBuffer(port, line, len);
+			lines++;
+		}
+	}
+	return lines;
+}
+
+/*==================[end of file]============================================*/
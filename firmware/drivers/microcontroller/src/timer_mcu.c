@@ -11,6 +11,8 @@
 
 /*==================[inclusions]=============================================*/
 #include "timer_mcu.h"
+#include "trace_mcu.h"
+#include "stats_mcu.h"
 #include "driver/gptimer.h"
 #include "freertos/FreeRTOS.h"
 #include "freertos/task.h"
@@ -46,15 +48,27 @@ gptimer_alarm_config_t alarm_config_b;	/*!< Configuration for alarm B */
 gptimer_alarm_config_t alarm_config_c;	/*!< Configuration for alarm C */
 /*==================[internal functions declaration]=========================*/
 static bool IRAM_ATTR timer_a_isr(gptimer_handle_t timer, const gptimer_alarm_event_data_t *edata, void *user_data){
+	uint32_t start = StatsStart();
+	TraceIsrEnter(TRACE_ISR_TIMER(TIMER_A));
 	timer_a_isr_p(timer_a_user_data);
+	TraceIsrExit(TRACE_ISR_TIMER(TIMER_A));
+	StatsEnd(STATS_TIMER(TIMER_A), start, 0, true);
 	return true;
 }
 static bool IRAM_ATTR timer_b_isr(gptimer_handle_t timer, const gptimer_alarm_event_data_t *edata, void *user_data){
+	uint32_t start = StatsStart();
+	TraceIsrEnter(TRACE_ISR_TIMER(TIMER_B));
 	timer_b_isr_p(timer_b_user_data);
+	TraceIsrExit(TRACE_ISR_TIMER(TIMER_B));
+	StatsEnd(STATS_TIMER(TIMER_B), start, 0, true);
 	return true;
 }
 static bool IRAM_ATTR timer_c_isr(gptimer_handle_t timer, const gptimer_alarm_event_data_t *edata, void *user_data){
+	uint32_t start = StatsStart();
+	TraceIsrEnter(TRACE_ISR_TIMER(TIMER_C));
 	timer_c_isr_p(timer_c_user_data);
+	TraceIsrExit(TRACE_ISR_TIMER(TIMER_C));
+	StatsEnd(STATS_TIMER(TIMER_C), start, 0, true);
 	return true;
 }
 /*==================[internal data definition]===============================*/
@@ -0,0 +1,106 @@
+/**
+ * @file trace_mcu.c
+ * @brief Binary event tracer: ring buffer and UART streaming
+ * @version 0.1
+ * @date 2026-10-19
+ *
+ * @copyright Copyright (c) 2026
+ *
+ */
+
+/*==================[inclusions]=============================================*/
+#include "trace_mcu.h"
+#ifdef MCU_TRACE
+#include <stddef.h>
+#include <string.h>
+#ifndef MCU_HOST
+#include "sdkconfig.h"
+#endif
+/*==================[macros and definitions]=================================*/
+#ifdef MCU_HOST
+#define TRACE_TICKS_PER_US	1000							/*!< Virtual ns */
+#else
+#define TRACE_TICKS_PER_US	CONFIG_ESP_DEFAULT_CPU_FREQ_MHZ	/*!< CPU cycles */
+#endif
+#define UART_CHUNK			240		/*!< Bytes per UartWriteBuffer() call (multiple of 8) */
+
+#if (TRACE_BUFFER_SIZE & (TRACE_BUFFER_SIZE - 1)) != 0
+#error "TRACE_BUFFER_SIZE must be a power of two"
+#endif
+/*==================[internal data declaration]==============================*/
+
+/*==================[internal functions declaration]=========================*/
+
+/*==================[internal data definition]===============================*/
+
+/*==================[external data definition]===============================*/
+trace_event_t trace_buffer[TRACE_BUFFER_SIZE];
+uint32_t trace_head = 0;
+volatile bool trace_running = false;
+/*==================[internal functions definition]==========================*/
+static void TraceSend(uart_mcu_port_t port, const uint8_t *data, uint32_t len){
+	uint32_t chunk;
+
+	while(len){
+		chunk = (len > UART_CHUNK) ? UART_CHUNK : len;
+		UartWriteBuffer(port, (const char *)data, chunk);
+		data += chunk;
+		len -= chunk;
+	}
+}
+/*==================[external functions definition]==========================*/
+void TraceStart(void){
+	trace_running = false;
+	__atomic_store_n(&trace_head, 0, __ATOMIC_RELAXED);
+	trace_running = true;
+}
+
+void TraceStop(void){
+	trace_running = false;
+}
+
+uint32_t TraceCopy(trace_event_t *events, uint32_t max, uint32_t *lost){
+	uint32_t head = __atomic_load_n(&trace_head, __ATOMIC_RELAXED);
+	uint32_t qty = (head > TRACE_BUFFER_SIZE) ? TRACE_BUFFER_SIZE : head;
+	uint32_t first;
+
+	if(lost != NULL){
+		*lost = head - qty;
+	}
+	if(qty > max){
+		qty = max;
+	}
+	/* The last qty events, oldest first */
+	first = head - qty;
+	for(uint32_t i = 0; i < qty; i++){
+		events[i] = trace_buffer[(first + i) & (TRACE_BUFFER_SIZE - 1)];
+	}
+	return qty;
+}
+
+uint32_t TraceFlush(uart_mcu_port_t port){
+	uint32_t head = __atomic_load_n(&trace_head, __ATOMIC_RELAXED);
+	uint32_t qty = (head > TRACE_BUFFER_SIZE) ? TRACE_BUFFER_SIZE : head;
+	uint32_t first = head & (TRACE_BUFFER_SIZE - 1);
+	trace_header_t header = {
+		.magic = TRACE_MAGIC,
+		.version = TRACE_VERSION,
+		.event_size = sizeof(trace_event_t),
+		.ticks_per_us = TRACE_TICKS_PER_US,
+		.count = qty,
+		.lost = head - qty,
+	};
+
+	TraceSend(port, (const uint8_t *)&header, sizeof(header));
+	if(head > TRACE_BUFFER_SIZE){
+		/* Wrapped: oldest events from head to the end of the buffer */
+		TraceSend(port, (const uint8_t *)&trace_buffer[first], (TRACE_BUFFER_SIZE - first) * sizeof(trace_event_t));
+		TraceSend(port, (const uint8_t *)trace_buffer, first * sizeof(trace_event_t));
+	} else{
+		TraceSend(port, (const uint8_t *)trace_buffer, qty * sizeof(trace_event_t));
+	}
+	return qty;
+}
+#endif
+
+/*==================[end of file]============================================*/
@@ -12,6 +12,8 @@
 /*==================[inclusions]=============================================*/
 #include "uart_mcu.h"
 #include "gpio_mcu.h"
+#include "trace_mcu.h"
+#include "stats_mcu.h"
 #include "driver/uart.h"
 #include "freertos/FreeRTOS.h"
 #include "freertos/queue.h"
@@ -50,8 +52,8 @@ static void uart_pc_event_task(void *pvParameters){
                 case UART_BREAK:
                     break;
                 case UART_BUFFER_FULL:
-                    break;
                 case UART_FIFO_OVF:
+                    StatsError(STATS_UART(UART_PC), 1);
                     break;
                 case UART_FRAME_ERR:
                     break;
@@ -83,8 +85,8 @@ static void uart_conn_event_task(void *pvParameters){
                 case UART_BREAK:
                     break;
                 case UART_BUFFER_FULL:
-                    break;
                 case UART_FIFO_OVF:
+                    StatsError(STATS_UART(UART_CONNECTOR), 1);
                     break;
                 case UART_FRAME_ERR:
                     break;
@@ -141,7 +143,9 @@ void UartInit(serial_config_t *port_config){
 
 uint8_t UartReadByte(uart_mcu_port_t port, uint8_t* data){
     uart_port_t uart_num = UART_NUM_0;
-    uint16_t length = 0;
+    int length = 0;
+    size_t waiting = 0;
+    uint32_t start = StatsStart();
     switch(port){
         case UART_PC:
                 uart_num = UART_NUM_0;
@@ -150,7 +154,12 @@ uint8_t UartReadByte(uart_mcu_port_t port, uint8_t* data){
                 uart_num = UART_NUM_1;
             break;
     }
+    uart_get_buffered_data_len(uart_num, &waiting);
+    StatsDepth(STATS_UART(port), waiting);
+    TraceUartStart(port, 1);
     length = uart_read_bytes(uart_num, data, 1, READ_TIMEOUT);
+    TraceUartEnd(port, length);
+    StatsEnd(STATS_UART(port), start, (length > 0) ? length : 0, length >= 0);
     if(length > 0){
         return true;
     } else{
@@ -160,7 +169,9 @@ uint8_t UartReadByte(uart_mcu_port_t port, uint8_t* data){
 
 uint8_t UartReadBuffer(uart_mcu_port_t port, uint8_t* data, uint16_t nbytes){
     uart_port_t uart_num = UART_NUM_0;
-    uint16_t length = 0;
+    int length = 0;
+    size_t waiting = 0;
+    uint32_t start = StatsStart();
     switch(port){
         case UART_PC:
                 uart_num = UART_NUM_0;
@@ -169,7 +180,12 @@ uint8_t UartReadBuffer(uart_mcu_port_t port, uint8_t* data, uint16_t nbytes){
                 uart_num = UART_NUM_1;
             break;
     }
+    uart_get_buffered_data_len(uart_num, &waiting);
+    StatsDepth(STATS_UART(port), waiting);
+    TraceUartStart(port, nbytes);
     length = uart_read_bytes(uart_num, data, nbytes, READ_TIMEOUT);
+    TraceUartEnd(port, length);
+    StatsEnd(STATS_UART(port), start, (length > 0) ? length : 0, length >= 0);
     if(length > 0){
         return true;
     } else{
@@ -179,6 +195,8 @@ uint8_t UartReadBuffer(uart_mcu_port_t port, uint8_t* data, uint16_t nbytes){
 
 void UartSendByte(uart_mcu_port_t port, const char *data){
     uart_port_t uart_num = UART_NUM_0;
+    uint32_t start = StatsStart();
+    int length;
     switch(port){
         case UART_PC:
                 uart_num = UART_NUM_0;
@@ -187,11 +205,16 @@ void UartSendByte(uart_mcu_port_t port, const char *data){
                 uart_num = UART_NUM_1;
             break;
     }
-    uart_tx_chars(uart_num, data, 1);
+    TraceUartStart(port, 1);
+    length = uart_tx_chars(uart_num, data, 1);
+    TraceUartEnd(port, 1);
+    StatsEnd(STATS_UART(port), start, (length > 0) ? length : 0, length == 1);
 }
 
 void UartSendString(uart_mcu_port_t port, const char *msg){
     uart_port_t uart_num = UART_NUM_0;
+    uint32_t start = StatsStart();
+    uint32_t sent = 0, length = 0;
     switch(port){
         case UART_PC:
                 uart_num = UART_NUM_0;
@@ -200,14 +223,38 @@ void UartSendString(uart_mcu_port_t port, const char *msg){
                 uart_num = UART_NUM_1;
             break;
     }
+    TraceUartStart(port, 0);
 	while(*msg != 0){
-        uart_tx_chars(uart_num, msg, 1);
+        sent += (uart_tx_chars(uart_num, msg, 1) == 1);
+        length++;
 		msg++;
 	}
+    TraceUartEnd(port, 0);
+    StatsEnd(STATS_UART(port), start, sent, sent == length);
 }
 
 void UartSendBuffer(uart_mcu_port_t port, const char *data, uint8_t nbytes){
     uart_port_t uart_num = UART_NUM_0;
+    uint32_t start = StatsStart();
+    int length;
+    switch(port){
+        case UART_PC:
+                uart_num = UART_NUM_0;
+            break;
+        case UART_CONNECTOR:
+                uart_num = UART_NUM_1;
+            break;
+    }
+    TraceUartStart(port, nbytes);
+    length = uart_tx_chars(uart_num, data, nbytes);
+    TraceUartEnd(port, nbytes);
+    StatsEnd(STATS_UART(port), start, (length > 0) ? length : 0, length == nbytes);
+}
+
+void UartWriteBuffer(uart_mcu_port_t port, const char *data, uint16_t nbytes){
+    uart_port_t uart_num = UART_NUM_0;
+    uint32_t start = StatsStart();
+    int length;
     switch(port){
         case UART_PC:
                 uart_num = UART_NUM_0;
@@ -216,7 +263,11 @@ void UartSendBuffer(uart_mcu_port_t port, const char *data, uint8_t nbytes){
                 uart_num = UART_NUM_1;
             break;
     }
-    uart_tx_chars(uart_num, data, nbytes);
+    TraceUartStart(port, nbytes);
+    /* Blocks until the bytes are copied to the TX ring buffer */
+    length = uart_write_bytes(uart_num, data, nbytes);
+    TraceUartEnd(port, nbytes);
+    StatsEnd(STATS_UART(port), start, (length > 0) ? length : 0, length == nbytes);
 }
 
 uint8_t* UartItoa(uint32_t val, uint8_t base){
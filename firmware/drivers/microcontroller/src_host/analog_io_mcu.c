@@ -0,0 +1,155 @@
+/**
+ * @file analog_io_mcu.c
+ * @brief Analog inputs and output, host backend: inputs fed from recorded
+ * waveforms sampled on the virtual clock
+ * @version 0.1
+ * @date 2026-10-19
+ *
+ * @copyright Copyright (c) 2026
+ *
+ */
+
+/*==================[inclusions]=============================================*/
+#include "analog_io_mcu.h"
+#include "host_mcu.h"
+#include "stats_mcu.h"
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdio.h>
+#include <stdlib.h>
+/*==================[macros and definitions]=================================*/
+#define ADC_RAW_MAX			4095						// Max raw value (12 bit)
+#define ADC_MV_MAX			3300						// Full scale (12dB attenuation)
+#define NS_PER_SEC			1000000000ULL
+/*==================[internal data declaration]==============================*/
+/**
+ * @brief Waveform of an analog input
+ */
+typedef struct {
+	const uint16_t *samples;	/*!< Raw counts */
+	uint16_t *loaded;			/*!< Samples loaded by HostAnalogLoad() (owned) */
+	uint32_t qty;				/*!< Number of samples */
+	uint32_t sample_frec;		/*!< Sample frequency (Hz) */
+	bool loop;					/*!< Repeat the waveform */
+	uint64_t start;				/*!< Virtual time of the first sample (ns) */
+} host_waveform_t;
+/*==================[internal functions declaration]=========================*/
+
+/*==================[internal data definition]===============================*/
+static host_waveform_t waveforms[ADC_CH_QTY];
+static uint8_t dac_value = 0;
+/*==================[external data definition]===============================*/
+
+/*==================[internal functions definition]==========================*/
+static uint16_t AnalogSample(adc_ch_t channel){
+	host_waveform_t *w = &waveforms[channel];
+	uint64_t n;
+
+	StatsEnd(STATS_ADC(channel), StatsStart(), sizeof(uint16_t), true);
+	if(w->qty == 0){
+		return 0;
+	}
+	n = (HostTimeNs() - w->start) * w->sample_frec / NS_PER_SEC;
+	if(n >= w->qty){
+		n = w->loop ? n % w->qty : w->qty - 1;
+	}
+	return (w->samples[n] > ADC_RAW_MAX) ? ADC_RAW_MAX : w->samples[n];
+}
+
+static uint16_t AnalogToMv(uint16_t raw){
+	if(raw > ADC_RAW_MAX){
+		raw = ADC_RAW_MAX;
+	}
+	return ((uint32_t)raw * ADC_MV_MAX + ADC_RAW_MAX / 2) / ADC_RAW_MAX;
+}
+/*==================[external functions definition]==========================*/
+
+void AnalogInputInit(analog_input_config_t *config){
+
+}
+
+void AnalogOutputInit(void){
+
+}
+
+void AnalogInputReadSingle(adc_ch_t channel, uint16_t *value){
+	*value = AnalogSample(channel);
+}
+
+void AnalogInputScan(const adc_ch_t *channels, uint8_t qty, uint16_t *values){
+	for(uint8_t i = 0; i < qty; i++){
+		values[i] = AnalogSample(channels[i]);
+	}
+}
+
+void AnalogRawToMv(adc_ch_t channel, const uint16_t *raw, uint16_t *mv, uint16_t len){
+	for(uint16_t i = 0; i < len; i++){
+		mv[i] = AnalogToMv(raw[i]);
+	}
+}
+
+void AnalogScanToMv(const adc_ch_t *channels, uint8_t qty, uint16_t *values){
+	for(uint8_t i = 0; i < qty; i++){
+		values[i] = AnalogToMv(values[i]);
+	}
+}
+
+void AnalogStartContinuous(adc_ch_t channel){
+
+}
+
+void AnalogStopContinuous(adc_ch_t channel){
+
+}
+
+void AnalogInputReadContinuous(adc_ch_t channel, uint16_t *values){
+
+}
+
+void AnalogOutputWrite(uint8_t value){
+	dac_value = value;
+}
+
+void HostAnalogWaveform(adc_ch_t channel, const uint16_t *samples, uint32_t qty, uint32_t sample_frec, bool loop){
+	host_waveform_t *w = &waveforms[channel];
+
+	free(w->loaded);
+	w->loaded = NULL;
+	w->samples = samples;
+	w->qty = (samples != NULL) ? qty : 0;
+	w->sample_frec = sample_frec;
+	w->loop = loop;
+	w->start = HostTimeNs();
+}
+
+uint32_t HostAnalogLoad(adc_ch_t channel, const char *path, uint32_t sample_frec, bool loop){
+	FILE *f = fopen(path, "r");
+	uint16_t *samples = NULL, *aux;
+	uint32_t qty = 0, size = 0;
+	unsigned int value;
+
+	if(f == NULL){
+		return 0;
+	}
+	while(fscanf(f, "%u", &value) == 1){
+		if(qty == size){
+			size = size ? 2 * size : 1024;
+			aux = realloc(samples, size * sizeof(uint16_t));
+			if(aux == NULL){
+				break;
+			}
+			samples = aux;
+		}
+		samples[qty++] = value;
+	}
+	fclose(f);
+	HostAnalogWaveform(channel, samples, qty, sample_frec, loop);
+	waveforms[channel].loaded = samples;
+	return waveforms[channel].qty;
+}
+
+uint8_t HostAnalogOutput(void){
+	return dac_value;
+}
+
+/*==================[end of file]============================================*/
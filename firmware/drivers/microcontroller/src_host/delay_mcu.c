@@ -0,0 +1,40 @@
+/**
+ * @file delay_mcu.c
+ * @brief Delays, host backend: the virtual clock advances the delay time
+ * @version 0.1
+ * @date 2026-10-19
+ *
+ * @copyright Copyright (c) 2026
+ *
+ */
+
+/*==================[inclusions]=============================================*/
+#include "delay_mcu.h"
+#include "host_mcu.h"
+/*==================[macros and definitions]=================================*/
+#define MSEC				1000	/*!< 1msec = 1000usec */
+#define SEC					1000000	/*!< 1sec = 1000msec */
+/*==================[internal data declaration]==============================*/
+
+/*==================[internal functions declaration]=========================*/
+
+/*==================[internal data definition]===============================*/
+
+/*==================[external data definition]===============================*/
+
+/*==================[internal functions definition]==========================*/
+
+/*==================[external functions definition]==========================*/
+void DelaySec(uint16_t sec){
+	HostRunUs((uint64_t)sec * SEC);
+}
+
+void DelayMs(uint16_t msec){
+	HostRunUs((uint64_t)msec * MSEC);
+}
+
+void DelayUs(uint16_t usec){
+	HostRunUs(usec);
+}
+
+/*==================[end of file]============================================*/
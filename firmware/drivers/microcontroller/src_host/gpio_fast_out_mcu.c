@@ -0,0 +1,201 @@
+/**
+ * @file gpio_fast_out_mcu.c
+ * @brief GPIO bundles, host backend: dedicated channels emulated with a
+ * single access to the simulated pins
+ * @version 0.1
+ * @date 2026-10-19
+ *
+ * @copyright Copyright (c) 2026
+ *
+ */
+
+/*==================[inclusions]=============================================*/
+#include "gpio_fast_out_mcu.h"
+#include "gpio_mcu.h"
+#include "host_mcu.h"
+#include <stddef.h>
+#include <stdint.h>
+/*==================[macros and definitions]=================================*/
+#define BUNDLE_MASK(qty)	((uint32_t)((1ULL << (qty)) - 1))
+#define DEDIC_CHANNELS		8	/*!< Dedicated channels of the ESP32-C6 (per direction) */
+/*==================[internal data declaration]==============================*/
+/**
+ * @brief Emulated dedicated GPIO bundle
+ */
+typedef struct {
+	uint32_t pin_mask[GPIO_BUNDLE_MAX_PINS + 1];	/*!< GPIOs mask of each bundle bit (last: all) */
+	uint8_t channels;			/*!< Channels used */
+} host_bundle_t;
+
+static gpio_bundle_t bundleA;						/*!< Default output bundle (GPIOFastWrite) */
+static gpio_t bundleA_extra[GPIO_FAST_MAX_PINS - GPIO_BUNDLE_MAX_PINS];	/*!< Pins beyond bundleA width */
+static uint8_t bundleA_extra_qty = 0;
+static uint16_t bundleA_extra_state = 0;
+/*==================[internal functions declaration]=========================*/
+
+/*==================[internal data definition]===============================*/
+static host_bundle_t host_bundles[2 * DEDIC_CHANNELS];
+static uint8_t channels_used[2] = {0, 0};			/*!< Input, output channels used */
+/*==================[external data definition]===============================*/
+
+/*==================[internal functions definition]==========================*/
+static uint32_t BundleToPins(host_bundle_t *handle, uint32_t value){
+	uint32_t pins = 0;
+
+	for(uint8_t i = 0; value; i++, value >>= 1){
+		if(value & 1){
+			pins |= handle->pin_mask[i];
+		}
+	}
+	return pins;
+}
+
+static uint32_t PinsToBundle(host_bundle_t *handle, uint32_t pins, uint8_t pin_qty){
+	uint32_t value = 0;
+
+	for(uint8_t i = 0; i < pin_qty; i++){
+		if(pins & handle->pin_mask[i]){
+			value |= 1UL << i;
+		}
+	}
+	return value;
+}
+/*==================[external functions definition]==========================*/
+bool GPIOBundleInit(gpio_bundle_t *bundle, const gpio_t *pin_list, uint8_t pin_qty, io_t io){
+	host_bundle_t *handle = NULL;
+
+	if(pin_qty > GPIO_BUNDLE_MAX_PINS){
+		pin_qty = GPIO_BUNDLE_MAX_PINS;
+	}
+	bundle->pin_qty = pin_qty;
+	bundle->io = io;
+	bundle->state = 0;
+	bundle->handle = NULL;
+	for(uint8_t i = 0; i < pin_qty; i++){
+		bundle->pins[i] = pin_list[i];
+		GPIOInit(pin_list[i], io);
+		if(io == GPIO_OUTPUT){
+			GPIOOff(pin_list[i]);
+		}
+	}
+	/* Same limit as the target: if no channels are free keep using gpio_mcu */
+	if(channels_used[io] + pin_qty > DEDIC_CHANNELS){
+		return false;
+	}
+	for(uint8_t i = 0; i < 2 * DEDIC_CHANNELS; i++){
+		if(host_bundles[i].channels == 0){
+			handle = &host_bundles[i];
+			break;
+		}
+	}
+	if((handle == NULL) || (pin_qty == 0)){
+		return false;
+	}
+	handle->channels = pin_qty;
+	handle->pin_mask[GPIO_BUNDLE_MAX_PINS] = 0;
+	for(uint8_t i = 0; i < pin_qty; i++){
+		handle->pin_mask[i] = 1UL << pin_list[i];
+		handle->pin_mask[GPIO_BUNDLE_MAX_PINS] |= handle->pin_mask[i];
+	}
+	channels_used[io] += pin_qty;
+	bundle->handle = handle;
+	return true;
+}
+
+void GPIOBundleWrite(gpio_bundle_t *bundle, uint32_t mask, uint32_t value){
+	uint32_t changed;
+	host_bundle_t *handle = bundle->handle;
+	mask &= BUNDLE_MASK(bundle->pin_qty);
+	value &= mask;
+	if(handle != NULL){
+		/* One access for all the pins, as dedic_gpio_bundle_write() */
+		HostGPIOWriteMask(BundleToPins(handle, value), true);
+		HostGPIOWriteMask(BundleToPins(handle, mask & ~value), false);
+		bundle->state = (bundle->state & ~mask) | value;
+	} else{
+		changed = (bundle->state & mask) ^ value;
+		bundle->state = (bundle->state & ~mask) | value;
+		for(uint8_t i = 0; changed; i++, changed >>= 1){
+			if(changed & 1){
+				GPIOState(bundle->pins[i], (value >> i) & 1);
+			}
+		}
+	}
+}
+
+void GPIOBundleToggle(gpio_bundle_t *bundle, uint32_t mask){
+	GPIOBundleWrite(bundle, mask, ~bundle->state);
+}
+
+uint32_t GPIOBundleReadOut(gpio_bundle_t *bundle){
+	return bundle->state;
+}
+
+uint32_t GPIOBundleRead(gpio_bundle_t *bundle, uint32_t mask){
+	uint32_t value = 0;
+	host_bundle_t *handle = bundle->handle;
+	mask &= BUNDLE_MASK(bundle->pin_qty);
+	if(handle != NULL){
+		value = PinsToBundle(handle, HostGPIOReadMask(handle->pin_mask[GPIO_BUNDLE_MAX_PINS]), bundle->pin_qty);
+	} else{
+		for(uint8_t i = 0; i < bundle->pin_qty; i++){
+			if((mask >> i) & 1){
+				value |= (uint32_t)GPIORead(bundle->pins[i]) << i;
+			}
+		}
+	}
+	return value & mask;
+}
+
+void GPIOBundleSample(gpio_bundle_t *bundle, uint32_t *samples, uint16_t sample_qty){
+	uint32_t mask = BUNDLE_MASK(bundle->pin_qty);
+	for(uint16_t i = 0; i < sample_qty; i++){
+		samples[i] = GPIOBundleRead(bundle, mask);
+	}
+}
+
+void GPIOBundleDeinit(gpio_bundle_t *bundle){
+	host_bundle_t *handle = bundle->handle;
+	if(handle != NULL){
+		channels_used[bundle->io] -= handle->channels;
+		handle->channels = 0;
+		bundle->handle = NULL;
+	}
+}
+
+void GPIOFastInit(gpio_t *pin_list, uint8_t pin_qty){
+	if(pin_qty > GPIO_FAST_MAX_PINS){
+		pin_qty = GPIO_FAST_MAX_PINS;
+	}
+	GPIOBundleDeinit(&bundleA);
+	if(pin_qty > GPIO_BUNDLE_MAX_PINS){
+		bundleA_extra_qty = pin_qty - GPIO_BUNDLE_MAX_PINS;
+		GPIOBundleInit(&bundleA, pin_list, GPIO_BUNDLE_MAX_PINS, GPIO_OUTPUT);
+	} else{
+		bundleA_extra_qty = 0;
+		GPIOBundleInit(&bundleA, pin_list, pin_qty, GPIO_OUTPUT);
+	}
+	bundleA_extra_state = 0;
+	for(uint8_t i = 0; i < bundleA_extra_qty; i++){
+		bundleA_extra[i] = pin_list[GPIO_BUNDLE_MAX_PINS + i];
+		GPIOInit(bundleA_extra[i], GPIO_OUTPUT);
+		GPIOOff(bundleA_extra[i]);
+	}
+}
+
+void GPIOFastWrite(uint16_t value){
+	uint16_t changed;
+	GPIOBundleWrite(&bundleA, BUNDLE_MASK(bundleA.pin_qty), value);
+	if(bundleA_extra_qty){
+		value >>= GPIO_BUNDLE_MAX_PINS;
+		changed = (bundleA_extra_state ^ value) & BUNDLE_MASK(bundleA_extra_qty);
+		bundleA_extra_state = value;
+		for(uint8_t i = 0; changed; i++, changed >>= 1){
+			if(changed & 1){
+				GPIOState(bundleA_extra[i], (value >> i) & 1);
+			}
+		}
+	}
+}
+
+/*==================[end of file]============================================*/
@@ -0,0 +1,184 @@
+/**
+ * @file gpio_mcu.c
+ * @brief GPIO driver, host backend: simulated pins with edge injection
+ * @version 0.1
+ * @date 2026-10-19
+ *
+ * @copyright Copyright (c) 2026
+ *
+ */
+
+/*==================[inclusions]=============================================*/
+#include "gpio_mcu.h"
+#include "host_mcu.h"
+#include "trace_mcu.h"
+#include <stddef.h>
+#include <stdint.h>
+/*==================[macros and definitions]=================================*/
+
+/*==================[internal data declaration]==============================*/
+/**
+ * @brief Simulated pin
+ */
+typedef struct {
+	bool used;					/*!< Pin initialized */
+	io_t io;					/*!< Direction */
+	bool out;					/*!< Output level */
+	bool in;					/*!< Level driven from outside (pull-up: high) */
+	bool int_edge;				/*!< Interrupt edge (true: positive) */
+	void (*isr_p)(void*);		/*!< Interrupt handler (NULL: disabled) */
+	void *isr_args;				/*!< Interrupt handler parameter */
+	void (*watch_p)(gpio_t, bool, void*);	/*!< Output change callback */
+	void *watch_param;			/*!< Output change callback parameter */
+	void (*hook_p)(gpio_t, bool, void*);	/*!< Input edge callback */
+	void *hook_param;			/*!< Input edge callback parameter */
+} host_gpio_t;
+/*==================[internal functions declaration]=========================*/
+
+/*==================[internal data definition]===============================*/
+static host_gpio_t gpio_list[GPIO_QTY];
+static bool gpio_list_init = false;
+/*==================[external data definition]===============================*/
+
+/*==================[internal functions definition]==========================*/
+static void GPIOListInit(void){
+	if(!gpio_list_init){
+		gpio_list_init = true;
+		for(uint8_t i = 0; i < GPIO_QTY; i++){
+			gpio_list[i].in = true;
+		}
+	}
+}
+
+static void GPIOWrite(gpio_t pin, bool state){
+	host_gpio_t *p = &gpio_list[pin];
+
+	if(p->out != state){
+		p->out = state;
+		if(p->watch_p != NULL){
+			p->watch_p(pin, state, p->watch_param);
+		}
+	}
+}
+
+static bool GPIOLevel(gpio_t pin){
+	GPIOListInit();
+	return (gpio_list[pin].io == GPIO_OUTPUT) ? gpio_list[pin].out : gpio_list[pin].in;
+}
+/*==================[external functions definition]==========================*/
+void GPIOInit(gpio_t pin, io_t io){
+	if((pin == GPIO_14) || (pin > GPIO_23)){
+		return;
+	}
+	GPIOListInit();
+	gpio_list[pin].used = true;
+	gpio_list[pin].io = io;
+}
+
+void GPIOOn(gpio_t pin){
+	HostRunNs(HOST_GPIO_ACCESS_NS);
+	GPIOWrite(pin, true);
+}
+
+void GPIOOff(gpio_t pin){
+	HostRunNs(HOST_GPIO_ACCESS_NS);
+	GPIOWrite(pin, false);
+}
+
+void GPIOState(gpio_t pin, bool state){
+	HostRunNs(HOST_GPIO_ACCESS_NS);
+	GPIOWrite(pin, state);
+}
+
+void GPIOToggle(gpio_t pin){
+	HostRunNs(HOST_GPIO_ACCESS_NS);
+	GPIOWrite(pin, !gpio_list[pin].out);
+}
+
+bool GPIORead(gpio_t pin){
+	HostRunNs(HOST_GPIO_ACCESS_NS);
+	return GPIOLevel(pin);
+}
+
+void GPIOActivInt(gpio_t pin, void *ptr_int_func, bool edge, void *args){
+	gpio_list[pin].int_edge = edge;
+	gpio_list[pin].isr_args = args;
+	gpio_list[pin].isr_p = ptr_int_func;
+}
+
+void GPIOInputFilter(gpio_t pin){
+	/* HostGPIODrive() levels have no glitches */
+}
+
+void GPIODeinit(void){
+
+}
+
+void HostGPIODrive(gpio_t pin, bool level){
+	host_gpio_t *p = &gpio_list[pin];
+
+	GPIOListInit();
+	if(p->in == level){
+		return;
+	}
+	p->in = level;
+	if(p->io != GPIO_INPUT){
+		return;
+	}
+	if(p->hook_p != NULL){
+		p->hook_p(pin, level, p->hook_param);
+	}
+	if((p->isr_p != NULL) && (p->int_edge == level)){
+		TraceIsrEnter(TRACE_ISR_GPIO(pin));
+		p->isr_p(p->isr_args);
+		TraceIsrExit(TRACE_ISR_GPIO(pin));
+	}
+}
+
+bool HostGPIOLevel(gpio_t pin){
+	return gpio_list[pin].out;
+}
+
+void HostGPIOWatch(gpio_t pin, void *func_p, void *param_p){
+	gpio_list[pin].watch_param = param_p;
+	gpio_list[pin].watch_p = func_p;
+}
+
+void HostGPIOEdgeHook(gpio_t pin, void *func_p, void *param_p){
+	gpio_list[pin].hook_param = param_p;
+	gpio_list[pin].hook_p = func_p;
+}
+
+void HostGPIOWriteMask(uint32_t mask, bool level){
+	HostRunNs(HOST_GPIO_ACCESS_NS);
+	for(uint8_t pin = 0; mask && (pin < GPIO_QTY); pin++, mask >>= 1){
+		if(mask & 1){
+			GPIOWrite(pin, level);
+		}
+	}
+}
+
+uint32_t HostGPIOReadMask(uint32_t mask){
+	uint32_t value = 0;
+
+	HostRunNs(HOST_GPIO_ACCESS_NS);
+	for(uint8_t pin = 0; pin < GPIO_QTY; pin++){
+		if((mask >> pin) & 1){
+			value |= (uint32_t)GPIOLevel(pin) << pin;
+		}
+	}
+	return value;
+}
+
+uint32_t HostGPIOReadOutMask(uint32_t mask){
+	uint32_t value = 0;
+
+	for(uint8_t pin = 0; pin < GPIO_QTY; pin++){
+		if((mask >> pin) & 1){
+			value |= (uint32_t)gpio_list[pin].out << pin;
+		}
+	}
+	return value;
+}
+
+/*==================[end of file]============================================*/
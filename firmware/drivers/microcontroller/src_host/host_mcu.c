@@ -0,0 +1,216 @@
+/**
+ * @file host_mcu.c
+ * @brief Virtual clock, event scheduler and flash partitions of the host
+ * backend
+ * @version 0.1
+ * @date 2026-10-19
+ *
+ * @copyright Copyright (c) 2026
+ *
+ */
+
+/*==================[inclusions]=============================================*/
+#include "host_mcu.h"
+#include <stddef.h>
+#include <string.h>
+#include <fcntl.h>
+#include <unistd.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+/*==================[macros and definitions]=================================*/
+#define NS_PER_US		1000
+/*==================[internal data declaration]==============================*/
+/**
+ * @brief Scheduled event
+ */
+typedef struct {
+	bool used;					/*!< Event scheduled */
+	uint64_t time;				/*!< Next call (ns) */
+	uint64_t period;			/*!< Period (ns, 0: one shot) */
+	uint32_t order;				/*!< Scheduling order, for events with the same time */
+	void (*func_p)(void*);		/*!< Callback */
+	void *param_p;				/*!< Callback parameter */
+} host_event_t;
+
+/**
+ * @brief Flash partition
+ */
+typedef struct {
+	const char *label;			/*!< Partition label */
+	uint8_t *data;				/*!< Shared mapping of the file */
+	uint32_t size;				/*!< Size (bytes) */
+} host_flash_t;
+/*==================[internal functions declaration]=========================*/
+
+/*==================[internal data definition]===============================*/
+static uint64_t now_ns = 0;
+static bool running = false;
+static bool woken = false;
+static uint32_t event_order = 0;
+static host_event_t events[HOST_EVENT_QTY];
+static host_flash_t flashes[HOST_FLASH_QTY];
+/*==================[external data definition]===============================*/
+
+/*==================[internal functions definition]==========================*/
+static host_event_t* HostNextEvent(uint64_t end){
+	host_event_t *next = NULL;
+
+	for(uint8_t i = 0; i < HOST_EVENT_QTY; i++){
+		if(events[i].used && (events[i].time <= end)){
+			if((next == NULL) || (events[i].time < next->time) ||
+				((events[i].time == next->time) && ((int32_t)(events[i].order - next->order) < 0))){
+				next = &events[i];
+			}
+		}
+	}
+	return next;
+}
+
+/* Advance the clock running the events, until end or (wait) a HostWake() */
+static bool HostAdvance(uint64_t ns, bool wait){
+	uint64_t end = now_ns + ns;
+	host_event_t *event;
+	void (*func_p)(void*);
+	void *param_p;
+
+	if(running){
+		/* Delay inside an event: no preemption */
+		now_ns = end;
+		return false;
+	}
+	running = true;
+	while(!(wait && woken) && ((event = HostNextEvent(end)) != NULL)){
+		if(event->time > now_ns){
+			now_ns = event->time;
+		}
+		func_p = event->func_p;
+		param_p = event->param_p;
+		if(event->period){
+			event->time += event->period;
+			event->order = event_order++;
+		} else{
+			event->used = false;
+		}
+		func_p(param_p);
+		/* The event could take longer than its period */
+		if(end < now_ns){
+			end = now_ns;
+		}
+	}
+	running = false;
+	if(wait && woken){
+		woken = false;
+		return true;
+	}
+	now_ns = end;
+	return false;
+}
+/*==================[external functions definition]==========================*/
+uint64_t HostTimeNs(void){
+	return now_ns;
+}
+
+uint64_t HostTimeUs(void){
+	return now_ns / NS_PER_US;
+}
+
+void HostRunNs(uint64_t ns){
+	HostAdvance(ns, false);
+}
+
+void HostRunUs(uint64_t us){
+	HostRunNs(us * NS_PER_US);
+}
+
+bool HostWaitNs(uint64_t ns){
+	return HostAdvance(ns, true);
+}
+
+void HostWake(void){
+	woken = true;
+}
+
+int HostSchedule(uint64_t delay_ns, uint64_t period_ns, void *func_p, void *param_p){
+	for(uint8_t i = 0; i < HOST_EVENT_QTY; i++){
+		if(!events[i].used){
+			events[i].used = true;
+			events[i].time = now_ns + delay_ns;
+			events[i].period = period_ns;
+			events[i].order = event_order++;
+			events[i].func_p = func_p;
+			events[i].param_p = param_p;
+			return i;
+		}
+	}
+	return -1;
+}
+
+void HostCancel(int id){
+	if((id >= 0) && (id < HOST_EVENT_QTY)){
+		events[id].used = false;
+	}
+}
+
+uint8_t* HostFlashPartition(const char *label, const char *path, uint32_t size){
+	static const uint8_t erased[HOST_FLASH_SECTOR_SIZE] = {[0 ... HOST_FLASH_SECTOR_SIZE - 1] = 0xFF};
+	host_flash_t *flash = NULL;
+	struct stat st;
+	uint8_t *data;
+	int fd;
+
+	for(uint8_t i = 0; i < HOST_FLASH_QTY; i++){
+		if(flashes[i].label == NULL){
+			flash = &flashes[i];
+			break;
+		}
+	}
+	if(flash == NULL){
+		return NULL;
+	}
+	fd = open(path, O_RDWR | O_CREAT, 0644);
+	if((fd < 0) || (fstat(fd, &st) < 0)){
+		return NULL;
+	}
+	/* New or shorter file: the missing part is erased flash */
+	for(off_t pos = st.st_size; pos < size; pos += HOST_FLASH_SECTOR_SIZE){
+		if(pwrite(fd, erased, HOST_FLASH_SECTOR_SIZE, pos) != HOST_FLASH_SECTOR_SIZE){
+			close(fd);
+			return NULL;
+		}
+	}
+	data = mmap(NULL, size, PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0);
+	close(fd);
+	if(data == MAP_FAILED){
+		return NULL;
+	}
+	*flash = (host_flash_t){.label = label, .data = data, .size = size};
+	return data;
+}
+
+uint8_t* HostFlashFind(const char *label, uint32_t *size){
+	for(uint8_t i = 0; i < HOST_FLASH_QTY; i++){
+		if((flashes[i].label != NULL) && (strcmp(flashes[i].label, label) == 0)){
+			if(size != NULL){
+				*size = flashes[i].size;
+			}
+			return flashes[i].data;
+		}
+	}
+	return NULL;
+}
+
+void HostFlashErase(uint8_t *flash, uint32_t offset, uint32_t size){
+	memset(flash + offset, 0xFF, size);
+	HostRunNs((uint64_t)HOST_FLASH_ERASE_NS * (size / HOST_FLASH_SECTOR_SIZE));
+}
+
+void HostFlashProgram(uint8_t *flash, uint32_t offset, const void *data, uint32_t len){
+	const uint8_t *bytes = data;
+
+	for(uint32_t i = 0; i < len; i++){
+		flash[offset + i] &= bytes[i];
+	}
+	HostRunNs((uint64_t)HOST_FLASH_BYTE_NS * len);
+}
+
+/*==================[end of file]============================================*/
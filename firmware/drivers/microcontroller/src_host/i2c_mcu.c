@@ -0,0 +1,178 @@
+/**
+ * @file i2c_mcu.c
+ * @brief I2C driver, host backend: transactions served by device models
+ * @version 0.1
+ * @date 2026-10-19
+ *
+ * @copyright Copyright (c) 2026
+ *
+ */
+
+/*==================[inclusions]=============================================*/
+#include "i2c_mcu.h"
+#include "host_mcu.h"
+#include "trace_mcu.h"
+#include "stats_mcu.h"
+#include <stddef.h>
+/*==================[macros and definitions]=================================*/
+#define BITS_PER_BYTE		9				/*!< 8 data + ACK */
+#define NS_PER_SEC			1000000000ULL
+/*==================[internal data definition]===============================*/
+static uint32_t i2c_clock = I2C_MASTER_FREQ_HZ;
+static const host_i2c_model_t *models[HOST_I2C_MODEL_QTY];
+/*==================[internal functions declaration]=========================*/
+
+/*==================[internal functions definition]==========================*/
+static const host_i2c_model_t* I2CFindModel(uint8_t devAddr){
+	for(uint8_t i = 0; i < HOST_I2C_MODEL_QTY; i++){
+		if((models[i] != NULL) && (models[i]->addr == devAddr)){
+			return models[i];
+		}
+	}
+	return NULL;
+}
+
+/* Bus time of a transaction of len bytes (address byte included) */
+static void I2CBusTime(uint16_t len){
+	HostRunNs((uint64_t)len * BITS_PER_BYTE * NS_PER_SEC / i2c_clock);
+}
+/*==================[external functions definition]==========================*/
+
+bool I2C_initialize( uint32_t clockRateHz )
+{
+	i2c_clock = clockRateHz ? clockRateHz : I2C_MASTER_FREQ_HZ;
+	return true;
+}
+
+void I2C_enable(bool isEnabled) {
+
+}
+
+int8_t I2C_readBit(uint8_t devAddr, uint8_t regAddr, uint8_t bitNum, uint8_t *data, uint16_t timeout) {
+	uint8_t b = 0;
+    uint8_t count = I2C_readByte(devAddr, regAddr, &b, timeout);
+    *data = b & (1 << bitNum);
+    return count;
+}
+
+int8_t I2C_readBits(uint8_t devAddr, uint8_t regAddr, uint8_t bitStart, uint8_t length, uint8_t *data, uint16_t timeout) {
+    uint8_t count, b;
+    if ((count = I2C_readByte(devAddr, regAddr, &b, timeout)) != 0) {
+        uint8_t mask = ((1 << length) - 1) << (bitStart - length + 1);
+        b &= mask;
+        b >>= (bitStart - length + 1);
+        *data = b;
+    }
+    return count;
+}
+
+int8_t I2C_readByte(uint8_t devAddr, uint8_t regAddr, uint8_t *data, uint16_t timeout) {
+    return I2C_readBytes(devAddr, regAddr, 1, data, timeout);
+}
+
+/** Read multiple bytes from an 8-bit device register.
+ * @return Number of bytes read (0: no device)
+ */
+int8_t I2C_readBytes(uint8_t devAddr, uint8_t regAddr, uint8_t length, uint8_t *data, uint16_t timeout) {
+	const host_i2c_model_t *model = I2CFindModel(devAddr);
+	bool ack = (model != NULL);
+	uint32_t start = StatsStart();
+
+	TraceI2CStart(devAddr, length);
+	/* Register select (address + register) and read (address + data) */
+	I2CBusTime(2);
+	if(ack){
+		if(model->read != NULL){
+			ack = model->read(regAddr, data, length, model->param);
+		} else{
+			for(uint8_t i = 0; i < length; i++){
+				data[i] = model->regs[(uint8_t)(regAddr + i)];
+			}
+		}
+	}
+	I2CBusTime(1 + (ack ? length : 0));
+	TraceI2CEnd(devAddr, ack);
+	StatsEnd(STATS_I2C, start, ack ? length : 0, ack);
+	return ack ? length : 0;
+}
+
+bool I2C_writeWord(uint8_t devAddr, uint8_t regAddr, uint16_t data){
+	uint8_t data1[] = {(uint8_t)(data>>8), (uint8_t)(data & 0xff)};
+	return I2C_writeBytes(devAddr, regAddr, 2, data1);
+}
+
+void I2C_SelectRegister(uint8_t devAddr, uint8_t reg){
+	I2CBusTime(2);
+}
+
+bool I2C_writeBit(uint8_t devAddr, uint8_t regAddr, uint8_t bitNum, uint8_t data) {
+    uint8_t b = 0;
+    I2C_readByte(devAddr, regAddr, &b, 0);
+    b = (data != 0) ? (b | (1 << bitNum)) : (b & ~(1 << bitNum));
+    return I2C_writeByte(devAddr, regAddr, b);
+}
+
+bool I2C_writeBits(uint8_t devAddr, uint8_t regAddr, uint8_t bitStart, uint8_t length, uint8_t data) {
+    uint8_t b = 0;
+    if (I2C_readByte(devAddr, regAddr, &b, 0) != 0) {
+        uint8_t mask = ((1 << length) - 1) << (bitStart - length + 1);
+        data <<= (bitStart - length + 1);
+        data &= mask;
+        b &= ~(mask);
+        b |= data;
+        return I2C_writeByte(devAddr, regAddr, b);
+    } else {
+        return false;
+    }
+}
+
+bool I2C_writeByte(uint8_t devAddr, uint8_t regAddr, uint8_t data) {
+	return I2C_writeBytes(devAddr, regAddr, 1, &data);
+}
+
+bool I2C_writeBytes(uint8_t devAddr, uint8_t regAddr, uint8_t length, uint8_t *data){
+	const host_i2c_model_t *model = I2CFindModel(devAddr);
+	bool ack = (model != NULL);
+	uint32_t start = StatsStart();
+
+	TraceI2CStart(devAddr, length);
+	if(ack){
+		if(model->write != NULL){
+			ack = model->write(regAddr, data, length, model->param);
+		} else{
+			for(uint8_t i = 0; i < length; i++){
+				model->regs[(uint8_t)(regAddr + i)] = data[i];
+			}
+		}
+	}
+	/* Address + register + data */
+	I2CBusTime(ack ? 2 + length : 1);
+	TraceI2CEnd(devAddr, ack);
+	StatsEnd(STATS_I2C, start, ack ? length : 0, ack);
+	return ack;
+}
+
+int8_t I2C_readWord(uint8_t devAddr, uint8_t regAddr, uint16_t *data, uint16_t timeout){
+	uint8_t msb[2] = {0,0};
+	I2C_readBytes(devAddr, regAddr, 2, msb, 0);
+	*data = (int16_t)((msb[0] << 8) | msb[1]);
+	return 0;
+}
+
+bool HostI2CModel(const host_i2c_model_t *model){
+	for(uint8_t i = 0; i < HOST_I2C_MODEL_QTY; i++){
+		if(models[i] == NULL){
+			models[i] = model;
+			return true;
+		}
+	}
+	return false;
+}
+
+void HostI2CClear(void){
+	for(uint8_t i = 0; i < HOST_I2C_MODEL_QTY; i++){
+		models[i] = NULL;
+	}
+}
+
+/*==================[end of file]============================================*/
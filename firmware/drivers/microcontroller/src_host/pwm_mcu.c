@@ -0,0 +1,81 @@
+/**
+ * @file pwm_mcu.c
+ * @brief PWM driver, host backend: the outputs state is kept for HostPWMState()
+ * @version 0.1
+ * @date 2026-10-19
+ *
+ * @copyright Copyright (c) 2026
+ *
+ */
+
+/*==================[inclusions]=============================================*/
+#include "pwm_mcu.h"
+#include "host_mcu.h"
+#include <stdbool.h>
+#include <stddef.h>
+/*==================[macros and definitions]=================================*/
+#define PWM_QTY		4		/*!< PWM_0 to PWM_3 */
+#define DC_100		100
+/*==================[internal data declaration]==============================*/
+/**
+ * @brief Simulated PWM output
+ */
+typedef struct {
+	bool used;				/*!< Output initialized */
+	bool on;				/*!< Output running */
+	gpio_t gpio;			/*!< GPIO pin */
+	uint32_t freq;			/*!< Frequency (Hz) */
+	uint8_t duty_cycle;		/*!< Duty cycle (%) */
+} host_pwm_t;
+/*==================[internal functions declaration]=========================*/
+
+/*==================[internal data definition]===============================*/
+static host_pwm_t pwms[PWM_QTY];
+/*==================[external data definition]===============================*/
+
+/*==================[internal functions definition]==========================*/
+
+/*==================[external functions definition]==========================*/
+uint8_t PWMInit(pwm_out_t out, gpio_t gpio, uint16_t freq){
+	pwms[out].used = true;
+	pwms[out].on = true;
+	pwms[out].gpio = gpio;
+	pwms[out].freq = freq;
+	pwms[out].duty_cycle = 0;
+	return 0;
+}
+
+void PWMOn(pwm_out_t out){
+	pwms[out].on = pwms[out].used;
+}
+
+void PWMOff(pwm_out_t out){
+	pwms[out].on = false;
+}
+
+void PWMSetDutyCycle(pwm_out_t out, uint8_t duty_cycle){
+	pwms[out].duty_cycle = (duty_cycle > DC_100) ? DC_100 : duty_cycle;
+}
+
+uint8_t PWMSetFreq(pwm_out_t out, uint32_t freq){
+	pwms[out].freq = freq;
+	return 0;
+}
+
+uint8_t PWMDeinit(pwm_out_t out){
+	pwms[out].used = false;
+	pwms[out].on = false;
+	return 0;
+}
+
+bool HostPWMState(pwm_out_t out, uint32_t *freq, uint8_t *duty_cycle){
+	if(freq != NULL){
+		*freq = pwms[out].freq;
+	}
+	if(duty_cycle != NULL){
+		*duty_cycle = pwms[out].duty_cycle;
+	}
+	return pwms[out].on;
+}
+
+/*==================[end of file]============================================*/
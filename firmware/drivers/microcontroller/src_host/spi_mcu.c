@@ -0,0 +1,107 @@
+/**
+ * @file spi_mcu.c
+ * @brief SPI driver, host backend: devices backed by file descriptors and
+ * device models
+ * @version 0.1
+ * @date 2026-10-19
+ *
+ * @copyright Copyright (c) 2026
+ *
+ */
+
+/*==================[inclusions]=============================================*/
+#include "spi_mcu.h"
+#include "host_mcu.h"
+#include "trace_mcu.h"
+#include "stats_mcu.h"
+#include <stddef.h>
+#include <stdint.h>
+#include <string.h>
+#include <unistd.h>
+/*==================[macros and definitions]=================================*/
+#define SPI_QTY			3			/*!< SPI_1, SPI_2, SPI_3 */
+#define SPI_IDLE_BYTE	0xFF		/*!< MISO without device (pull-up) */
+#define NS_PER_SEC		1000000000ULL
+/*==================[internal data declaration]==============================*/
+/**
+ * @brief Simulated SPI device
+ */
+typedef struct {
+	uint32_t bitrate;			/*!< Transfer speed */
+	transfer_mode_t transfer_mode;	/*!< Transfer mode */
+	void (*isr_p)(void*);		/*!< Transaction end callback */
+	void *user_data;			/*!< Transaction end callback parameter */
+	int tx_fd;					/*!< Sent bytes destination */
+	const host_spi_model_t *model;	/*!< Device model */
+} host_spi_t;
+/*==================[internal functions declaration]=========================*/
+
+/*==================[internal data definition]===============================*/
+static host_spi_t spis[SPI_QTY] = {
+	{.tx_fd = HOST_NO_FD}, {.tx_fd = HOST_NO_FD}, {.tx_fd = HOST_NO_FD},
+};
+/*==================[external data definition]===============================*/
+
+/*==================[internal functions definition]==========================*/
+static void SpiTransfer(spi_dev_t device, const uint8_t *tx, uint8_t *rx, uint32_t len){
+	host_spi_t *s = &spis[device];
+	uint32_t start = StatsStart();
+
+	TraceSpiStart(device, len);
+	if((tx != NULL) && (s->tx_fd != HOST_NO_FD)){
+		if(write(s->tx_fd, tx, len) < 0){
+			s->tx_fd = HOST_NO_FD;
+		}
+	}
+	if(rx != NULL){
+		memset(rx, SPI_IDLE_BYTE, len);
+	}
+	if(s->model != NULL){
+		s->model->transfer(device, tx, rx, len, s->model->param);
+	}
+	/* Bus time of the transaction */
+	if(s->bitrate){
+		HostRunNs((uint64_t)len * 8 * NS_PER_SEC / s->bitrate);
+	}
+	TraceSpiEnd(device);
+	StatsEnd(STATS_SPI(device), start, len, true);
+	if((s->transfer_mode == SPI_INTERRUPT) && (s->isr_p != NULL)){
+		s->isr_p(s->user_data);
+	}
+}
+/*==================[external functions definition]==========================*/
+uint8_t SpiInit(spi_mcu_config_t* spi){
+	host_spi_t *s = &spis[spi->device];
+
+	s->bitrate = spi->bitrate;
+	s->transfer_mode = spi->transfer_mode;
+	s->isr_p = spi->func_p;
+	s->user_data = spi->param_p;
+	return 0;
+}
+
+void SpiRead(spi_dev_t device, uint8_t * rx_buffer, uint32_t rx_buffer_size){
+	SpiTransfer(device, NULL, rx_buffer, rx_buffer_size);
+}
+
+void SpiWrite(spi_dev_t device, uint8_t * tx_buffer, uint32_t tx_buffer_size){
+	SpiTransfer(device, tx_buffer, NULL, tx_buffer_size);
+}
+
+void SpiReadWrite(spi_dev_t device, uint8_t * tx_buffer, uint8_t * rx_buffer, uint32_t buffer_size){
+	SpiTransfer(device, tx_buffer, rx_buffer, buffer_size);
+}
+
+uint8_t SpiDeInit(spi_dev_t device){
+	return 0;
+}
+
+void HostSpiOpen(spi_dev_t device, int tx_fd){
+	spis[device].tx_fd = tx_fd;
+}
+
+void HostSpiModel(spi_dev_t device, const host_spi_model_t *model){
+	spis[device].model = model;
+}
+
+/*==================[end of file]============================================*/
@@ -0,0 +1,134 @@
+/**
+ * @file timer_mcu.c
+ * @brief Timers, host backend: GPTimer with auto-reload on the virtual clock
+ * @version 0.1
+ * @date 2026-10-19
+ *
+ * @copyright Copyright (c) 2026
+ *
+ */
+
+/*==================[inclusions]=============================================*/
+#include "timer_mcu.h"
+#include "host_mcu.h"
+#include "trace_mcu.h"
+#include "stats_mcu.h"
+#include <stdbool.h>
+#include <stddef.h>
+/*==================[macros and definitions]=================================*/
+#define TIMER_QTY			3		/*!< TIMER_A, TIMER_B, TIMER_C */
+#define NS_PER_US			1000
+#define RESET_COUNT_VALUE	0		/*!< Reset timer count to 0 */
+/*==================[internal data declaration]==============================*/
+/**
+ * @brief Simulated timer
+ */
+typedef struct {
+	void (*isr_p)(void*);		/*!< Callback */
+	void *user_data;			/*!< Callback parameter */
+	uint32_t period;			/*!< Alarm count (us) */
+	uint32_t count;				/*!< Count when the timer was started or reloaded (us) */
+	uint64_t start;				/*!< Virtual time of count (ns) */
+	bool running;				/*!< Timer counting */
+	int event;					/*!< Alarm event */
+} host_timer_t;
+/*==================[internal functions declaration]=========================*/
+
+/*==================[internal data definition]===============================*/
+static host_timer_t timers[TIMER_QTY] = {
+	{.event = -1}, {.event = -1}, {.event = -1},
+};
+/*==================[external data definition]===============================*/
+
+/*==================[internal functions definition]==========================*/
+static uint32_t TimerCount(host_timer_t *t){
+	if(!t->running){
+		return t->count;
+	}
+	return t->count + (HostTimeNs() - t->start) / NS_PER_US;
+}
+
+static void TimerAlarm(void *param){
+	host_timer_t *t = param;
+
+	/* Auto-reload on alarm */
+	t->count = RESET_COUNT_VALUE;
+	t->start = HostTimeNs();
+	if(t->isr_p != NULL){
+		uint32_t start = StatsStart();
+
+		TraceIsrEnter(TRACE_ISR_TIMER(t - timers));
+		t->isr_p(t->user_data);
+		TraceIsrExit(TRACE_ISR_TIMER(t - timers));
+		StatsEnd(STATS_TIMER(t - timers), start, 0, true);
+	}
+}
+
+/* Alarm at period, then every period */
+static void TimerSchedule(host_timer_t *t){
+	uint32_t count = TimerCount(t);
+
+	HostCancel(t->event);
+	t->count = count;
+	t->start = HostTimeNs();
+	t->event = HostSchedule((uint64_t)(count < t->period ? t->period - count : 0) * NS_PER_US,
+		(uint64_t)t->period * NS_PER_US, TimerAlarm, t);
+}
+/*==================[external functions definition]==========================*/
+void TimerInit(timer_config_t *timer_ini){
+	host_timer_t *t = &timers[timer_ini->timer];
+
+	HostCancel(t->event);
+	t->event = -1;
+	t->isr_p = timer_ini->func_p;
+	t->user_data = timer_ini->param_p;
+	t->period = timer_ini->period;
+	t->count = RESET_COUNT_VALUE;
+	t->running = false;
+}
+
+void TimerStart(timer_mcu_t timer){
+	host_timer_t *t = &timers[timer];
+
+	if(!t->running){
+		t->start = HostTimeNs();
+		t->running = true;
+		TimerSchedule(t);
+	}
+}
+
+uint32_t TimerRead(timer_mcu_t timer){
+	return TimerCount(&timers[timer]);
+}
+
+void TimerStop(timer_mcu_t timer){
+	host_timer_t *t = &timers[timer];
+
+	if(t->running){
+		t->count = TimerCount(t);
+		t->running = false;
+		HostCancel(t->event);
+		t->event = -1;
+	}
+}
+
+void TimerReset(timer_mcu_t timer){
+	host_timer_t *t = &timers[timer];
+
+	t->count = RESET_COUNT_VALUE;
+	t->start = HostTimeNs();
+	if(t->running){
+		TimerSchedule(t);
+	}
+}
+
+void TimerUpdatePeriod(timer_mcu_t timer, uint32_t period){
+	host_timer_t *t = &timers[timer];
+
+	t->period = period;
+	if(t->running){
+		TimerSchedule(t);
+	}
+}
+
+/*==================[end of file]============================================*/
@@ -0,0 +1,205 @@
+/**
+ * @file uart_mcu.c
+ * @brief UART driver, host backend: ports backed by file descriptors and
+ * device models
+ * @version 0.1
+ * @date 2026-10-19
+ *
+ * @copyright Copyright (c) 2026
+ *
+ */
+
+/*==================[inclusions]=============================================*/
+#include "uart_mcu.h"
+#include "host_mcu.h"
+#include "trace_mcu.h"
+#include "stats_mcu.h"
+#include <stdbool.h>
+#include <stddef.h>
+#include <string.h>
+#include <poll.h>
+#include <unistd.h>
+/*==================[macros and definitions]=================================*/
+#define UART_QTY			2				/*!< UART_PC, UART_CONNECTOR */
+#define READ_TIMEOUT_US		1000000			/*!< READ_TIMEOUT of the target (100 ticks) */
+#define BITS_PER_BYTE		10				/*!< Start + 8 data + stop */
+#define NS_PER_SEC			1000000000ULL
+/*==================[internal data declaration]==============================*/
+/**
+ * @brief Simulated UART port
+ */
+typedef struct {
+	uint32_t baud_rate;			/*!< Baudrate (bits per second) */
+	int rx_fd;					/*!< Received bytes source */
+	int tx_fd;					/*!< Sent bytes destination */
+	const host_uart_model_t *model;	/*!< Device model */
+	void (*isr_p)(void*);		/*!< Reception callback */
+	void *user_data;			/*!< Reception callback parameter */
+	uint8_t rx[HOST_UART_RX_SIZE];	/*!< Injected bytes */
+	uint16_t rx_head;			/*!< Next injected byte */
+	uint16_t rx_qty;			/*!< Injected bytes not read */
+	uint64_t tx_end_ns;			/*!< Virtual time the TX FIFO gets empty */
+} host_uart_t;
+/*==================[internal functions declaration]=========================*/
+
+/*==================[internal data definition]===============================*/
+static host_uart_t uarts[UART_QTY] = {
+	{.rx_fd = HOST_NO_FD, .tx_fd = STDOUT_FILENO},
+	{.rx_fd = HOST_NO_FD, .tx_fd = HOST_NO_FD},
+};
+/*==================[external data definition]===============================*/
+
+/*==================[internal functions definition]==========================*/
+static uint16_t UartRead(uart_mcu_port_t port, uint8_t *data, uint16_t nbytes){
+	host_uart_t *u = &uarts[port];
+	uint16_t qty = 0;
+	struct pollfd pfd;
+	ssize_t len;
+	uint32_t start = StatsStart();
+
+	TraceUartStart(port, nbytes);
+	while((qty < nbytes) && u->rx_qty){
+		data[qty++] = u->rx[u->rx_head];
+		u->rx_head = (u->rx_head + 1) % HOST_UART_RX_SIZE;
+		u->rx_qty--;
+	}
+	if((qty < nbytes) && (u->rx_fd != HOST_NO_FD)){
+		pfd.fd = u->rx_fd;
+		pfd.events = POLLIN;
+		if(poll(&pfd, 1, 0) > 0){
+			len = read(u->rx_fd, data + qty, nbytes - qty);
+			qty += (len > 0) ? len : 0;
+		}
+	}
+	if(qty == 0){
+		/* Nothing to read: the target waits for the timeout */
+		HostRunUs(READ_TIMEOUT_US);
+	} else if(u->baud_rate){
+		HostRunNs(qty * BITS_PER_BYTE * NS_PER_SEC / u->baud_rate);
+	}
+	TraceUartEnd(port, qty);
+	StatsEnd(STATS_UART(port), start, qty, true);
+	return qty;
+}
+
+/* Bytes of the TX FIFO not sent yet */
+static uint16_t UartTxLevel(host_uart_t *u, uint64_t byte_ns){
+	uint64_t now = HostTimeNs();
+
+	if(u->tx_end_ns < now){
+		u->tx_end_ns = now;
+	}
+	return (u->tx_end_ns - now + byte_ns - 1) / byte_ns;
+}
+
+static void UartWrite(uart_mcu_port_t port, const char *data, uint16_t nbytes, bool wait){
+	host_uart_t *u = &uarts[port];
+	uint32_t start = StatsStart();
+	uint16_t qty = nbytes;
+	uint16_t level;
+	uint64_t byte_ns;
+
+	TraceUartStart(port, nbytes);
+	if(u->baud_rate){
+		byte_ns = BITS_PER_BYTE * NS_PER_SEC / u->baud_rate;
+		level = UartTxLevel(u, byte_ns);
+		if(wait){
+			/* Returns when the rest fits in the FIFO */
+			if(level + nbytes > HOST_UART_TX_FIFO){
+				HostRunNs((uint64_t)(level + nbytes - HOST_UART_TX_FIFO) * byte_ns);
+			}
+		} else if(level + nbytes > HOST_UART_TX_FIFO){
+			/* uart_tx_chars(): only the free space of the FIFO */
+			qty = HOST_UART_TX_FIFO - level;
+		}
+		u->tx_end_ns += qty * byte_ns;
+	}
+	if((u->tx_fd != HOST_NO_FD) && qty){
+		if(write(u->tx_fd, data, qty) < 0){
+			u->tx_fd = HOST_NO_FD;
+		}
+	}
+	if((u->model != NULL) && qty){
+		u->model->tx(port, (const uint8_t *)data, qty, u->model->param);
+	}
+	TraceUartEnd(port, qty);
+	StatsEnd(STATS_UART(port), start, qty, qty == nbytes);
+}
+/*==================[external functions definition]==========================*/
+
+void UartInit(serial_config_t *port_config){
+	host_uart_t *u = &uarts[port_config->port];
+
+	u->baud_rate = port_config->baud_rate;
+	if(port_config->func_p != UART_NO_INT){
+		u->isr_p = port_config->func_p;
+		u->user_data = port_config->param_p;
+	} else{
+		u->isr_p = NULL;
+	}
+}
+
+uint8_t UartReadByte(uart_mcu_port_t port, uint8_t* data){
+	return UartRead(port, data, 1) > 0;
+}
+
+uint8_t UartReadBuffer(uart_mcu_port_t port, uint8_t* data, uint16_t nbytes){
+	return UartRead(port, data, nbytes) > 0;
+}
+
+void UartSendByte(uart_mcu_port_t port, const char *data){
+	UartWrite(port, data, 1, false);
+}
+
+void UartSendString(uart_mcu_port_t port, const char *msg){
+	UartWrite(port, msg, strlen(msg), false);
+}
+
+void UartSendBuffer(uart_mcu_port_t port, const char *data, uint8_t nbytes){
+	UartWrite(port, data, nbytes, false);
+}
+
+void UartWriteBuffer(uart_mcu_port_t port, const char *data, uint16_t nbytes){
+	UartWrite(port, data, nbytes, true);
+}
+
+uint8_t* UartItoa(uint32_t val, uint8_t base){
+	static uint8_t buf[32] = {0};
+	uint32_t i = 30;
+    if(val == 0){
+        return (uint8_t*)"0";
+    }else{
+        for(; val && i ; --i, val /= base){
+            buf[i] = "0123456789abcdef"[val % base];
+        }
+        return &buf[i+1];
+    }
+}
+
+void HostUartOpen(uart_mcu_port_t port, int rx_fd, int tx_fd){
+	uarts[port].rx_fd = rx_fd;
+	uarts[port].tx_fd = tx_fd;
+}
+
+void HostUartModel(uart_mcu_port_t port, const host_uart_model_t *model){
+	uarts[port].model = model;
+}
+
+void HostUartInject(uart_mcu_port_t port, const uint8_t *data, uint16_t len){
+	host_uart_t *u = &uarts[port];
+
+	uint16_t i;
+
+	for(i = 0; (i < len) && (u->rx_qty < HOST_UART_RX_SIZE); i++){
+		u->rx[(u->rx_head + u->rx_qty) % HOST_UART_RX_SIZE] = data[i];
+		u->rx_qty++;
+	}
+	/* Receive buffer full: the rest is dropped */
+	StatsError(STATS_UART(port), len - i);
+	StatsDepth(STATS_UART(port), u->rx_qty);
+	if(u->isr_p != NULL){
+		u->isr_p(u->user_data);
+	}
+}
+
+/*==================[end of file]============================================*/
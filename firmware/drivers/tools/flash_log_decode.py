@@ -0,0 +1,105 @@
+#!/usr/bin/env python3
+#
+# Decodes a flash log export stream (FlashLogExport(), see flash_log_mcu.h)
+# to CSV: one line per record with its sequence number, time stamp (us),
+# type and payload.
+#
+# The stream can be a raw UART capture: bytes before the FLASH_LOG_MAGIC
+# header (console logs) are skipped. Records with a wrong CRC are skipped and
+# counted; gaps in the sequence numbers (dropped or overwritten records) are
+# reported.
+#
+# The payload is written as hex, or as little endian int16 columns with
+# --int16 (e.g. IMU samples).
+#
+# Usage: flash_log_decode.py [--int16] log.bin [log.csv]
+
+import struct
+import sys
+import zlib
+
+MAGIC = struct.pack('<I', 0x474F4C46)
+HEADER = struct.Struct('<IHHIII')
+SECTOR = struct.Struct('<IIIII')
+RECORD = struct.Struct('<HHII')
+CRC = struct.Struct('<I')
+LENGTH = struct.Struct('<I')
+END = 0xFFFF
+
+
+def parse_sector(data, records):
+    bad = 0
+    magic, seq, erase_count, first, crc = SECTOR.unpack_from(data)
+    if magic != struct.unpack('<I', MAGIC)[0] or crc != zlib.crc32(data[:SECTOR.size - CRC.size]):
+        return 0, 1
+    offset = SECTOR.size
+    while offset + RECORD.size <= len(data):
+        length, kind, seq, time = RECORD.unpack_from(data, offset)
+        if length == END or offset + RECORD.size + length + CRC.size > len(data):
+            break
+        end = offset + RECORD.size + length
+        (crc,) = CRC.unpack_from(data, end)
+        if crc == zlib.crc32(data[offset:end]):
+            records.append((seq, time, kind, data[offset + RECORD.size:end]))
+        else:
+            bad += 1
+        offset = (end + CRC.size + 3) & ~3
+    return bad, 0
+
+
+def parse(data):
+    start = data.find(MAGIC)
+    if start < 0:
+        raise ValueError('no flash log header')
+    magic, version, sector_size, sectors, first, next_seq = HEADER.unpack_from(data, start)
+    if version != 1:
+        raise ValueError('unknown version %d' % version)
+    offset = start + HEADER.size
+    records = []
+    bad = bad_sectors = 0
+    for _ in range(sectors):
+        (used,) = LENGTH.unpack_from(data, offset)
+        offset += LENGTH.size
+        if used:
+            b, s = parse_sector(data[offset:offset + used], records)
+            bad += b
+            bad_sectors += s
+        offset += used
+    return first, next_seq, records, bad, bad_sectors
+
+
+def payload_columns(payload, int16):
+    if int16:
+        return [str(v) for v in struct.unpack('<%dh' % (len(payload) // 2), payload[:len(payload) // 2 * 2])]
+    return [payload.hex()]
+
+
+def main():
+    args = sys.argv[1:]
+    int16 = '--int16' in args
+    if int16:
+        args.remove('--int16')
+    if len(args) not in (1, 2):
+        sys.stderr.write('usage: flash_log_decode.py [--int16] log.bin [log.csv]\n')
+        return 1
+    with open(args[0], 'rb') as f:
+        first, next_seq, records, bad, bad_sectors = parse(f.read())
+    lines = ['seq,time_us,type,data']
+    gaps = 0
+    for i, (seq, time, kind, payload) in enumerate(records):
+        if i and seq != records[i - 1][0] + 1:
+            gaps += 1
+        lines.append(','.join([str(seq), str(time), str(kind)] + payload_columns(payload, int16)))
+    if len(args) == 2:
+        with open(args[1], 'w') as f:
+            f.write('\n'.join(lines) + '\n')
+    else:
+        sys.stdout.write('\n'.join(lines) + '\n')
+    sys.stderr.write('%d records (%d to %d), %d bad, %d bad sectors, %d gaps, next %d\n' %
+                     (len(records), records[0][0] if records else 0, records[-1][0] if records else 0,
+                      bad, bad_sectors, gaps, next_seq))
+    return 0
+
+
+if __name__ == '__main__':
+    sys.exit(main())
@@ -0,0 +1,129 @@
+#!/usr/bin/env python3
+#
+# Converts a binary trace stream (TraceFlush(), see trace_mcu.h) to Chrome
+# trace / Perfetto JSON (open it in ui.perfetto.dev or chrome://tracing).
+#
+# The stream can be a raw UART capture: bytes before the TRACE_MAGIC header
+# (console logs) are skipped.
+#
+#   - ISR enter/exit, SPI/I2C/UART transactions and user spans: slices, one
+#     track per source.
+#   - Task notify/take and user marks: instant events.
+#
+# Timestamps are 32 bit cycle counters: they are unwrapped in stream order and
+# converted to us with the ticks_per_us of the header.
+#
+# Usage: trace_to_json.py trace.bin [trace.json]
+
+import json
+import struct
+import sys
+
+MAGIC = b'TRCE'
+HEADER = struct.Struct('<4sBBHII')
+EVENT = struct.Struct('<IBBH')
+
+ISR_ENTER, ISR_EXIT, TASK_NOTIFY, TASK_TAKE, SPI_START, SPI_END, \
+    I2C_START, I2C_END, UART_START, UART_END, MARK, SPAN_START, SPAN_END = range(13)
+
+TIMERS = ('TIMER_A', 'TIMER_B', 'TIMER_C')
+UARTS = ('UART_PC', 'UART_CONNECTOR')
+
+
+def isr_name(isr):
+    if isr < len(TIMERS):
+        return 'ISR ' + TIMERS[isr]
+    if isr >= 0x10:
+        return 'ISR GPIO_%d' % (isr - 0x10)
+    return 'ISR %d' % isr
+
+
+def track(kind, ident):
+    if kind in (ISR_ENTER, ISR_EXIT):
+        return isr_name(ident)
+    if kind in (SPI_START, SPI_END):
+        return 'SPI_%d' % (ident + 1)
+    if kind in (I2C_START, I2C_END):
+        return 'I2C 0x%02x' % ident
+    if kind in (UART_START, UART_END):
+        return UARTS[ident] if ident < len(UARTS) else 'UART %d' % ident
+    if kind == MARK:
+        return 'Marks'
+    return 'Task %d' % ident
+
+
+def parse(data):
+    start = data.find(MAGIC)
+    if start < 0:
+        raise ValueError('no trace header found')
+    magic, version, event_size, ticks_per_us, count, lost = HEADER.unpack_from(data, start)
+    if event_size != EVENT.size:
+        raise ValueError('unsupported event size %d' % event_size)
+    offset = start + HEADER.size
+    available = (len(data) - offset) // EVENT.size
+    if available < count:
+        sys.stderr.write('warning: stream truncated (%d of %d events)\n' % (available, count))
+        count = available
+    events = [EVENT.unpack_from(data, offset + i * EVENT.size) for i in range(count)]
+    return ticks_per_us, lost, events
+
+
+def convert(ticks_per_us, events):
+    tids = {}
+    out = []
+    time = None
+    last = 0
+    for raw, kind, ident, arg in events:
+        # Unwrap the 32 bit counter (events can be slightly out of order when
+        # an ISR preempts a task while it records)
+        if time is None:
+            time = 0
+        else:
+            delta = (raw - last) & 0xFFFFFFFF
+            time += delta - (1 << 32) if delta & 0x80000000 else delta
+        last = raw
+        name = track(kind, ident)
+        tid = tids.setdefault(name, len(tids) + 1)
+        e = {'pid': 1, 'tid': tid, 'ts': time / ticks_per_us}
+        if kind in (ISR_ENTER, SPI_START, I2C_START, UART_START, SPAN_START):
+            e.update(ph='B', name=name if kind != SPAN_START else 'run')
+            if kind in (SPI_START, I2C_START, UART_START):
+                e['args'] = {'bytes': arg}
+        elif kind in (ISR_EXIT, SPI_END, I2C_END, UART_END, SPAN_END):
+            e.update(ph='E')
+            if kind == I2C_END:
+                e['args'] = {'ack': arg}
+            elif kind == UART_END:
+                e['args'] = {'transferred': arg}
+        elif kind == TASK_NOTIFY:
+            e.update(ph='i', s='t', name='notify')
+        elif kind == TASK_TAKE:
+            e.update(ph='i', s='t', name='take', args={'pending': arg})
+        elif kind == MARK:
+            e.update(ph='i', s='t', name='mark %d' % ident, args={'value': arg})
+        else:
+            continue
+        out.append(e)
+    meta = [{'ph': 'M', 'pid': 1, 'tid': tid, 'name': 'thread_name', 'args': {'name': name}}
+            for name, tid in tids.items()]
+    return {'traceEvents': meta + out, 'displayTimeUnit': 'ns'}
+
+
+def main():
+    if len(sys.argv) not in (2, 3):
+        sys.stderr.write('usage: trace_to_json.py trace.bin [trace.json]\n')
+        return 1
+    with open(sys.argv[1], 'rb') as f:
+        ticks_per_us, lost, events = parse(f.read())
+    trace = convert(ticks_per_us, events)
+    if len(sys.argv) == 3:
+        with open(sys.argv[2], 'w') as f:
+            json.dump(trace, f)
+    else:
+        json.dump(trace, sys.stdout)
+    sys.stderr.write('%d events (%d lost), %d ticks/us\n' % (len(events), lost, ticks_per_us))
+    return 0
+
+
+if __name__ == '__main__':
+    sys.exit(main())
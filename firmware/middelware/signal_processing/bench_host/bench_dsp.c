@@ -0,0 +1,70 @@
+/**
+ * @file bench_dsp.c
+ * @brief Host benchmark: DSP benchmark suite (dsp_bench.h), results to CSV
+ * and JSON for tools/dsp_bench_compare.py
+ * @version 0.1
+ * @date 2026-10-19
+ *
+ * @copyright Copyright (c) 2026
+ *
+ */
+
+/*==================[inclusions]=============================================*/
+#include <stdio.h>
+#include "dsp_bench.h"
+/*==================[macros and definitions]=================================*/
+#define CSV_FILE        "dsp_bench.csv"
+#define JSON_FILE       "dsp_bench.json"
+#define SUITE_RESULTS   63      /*!< Results of the full suite (no case skipped) */
+/*==================[internal data definition]===============================*/
+static dsp_bench_result_t results[DSP_BENCH_MAX_RESULTS];
+/*==================[internal functions definition]==========================*/
+static void PrintResult(const dsp_bench_result_t *result, void *param){
+    printf("%-20s %5lu %10lu %10lu %10lu %10.2f\n", result->name, (unsigned long)result->size,
+        (unsigned long)result->min, (unsigned long)result->median, (unsigned long)result->max,
+        (double)result->median / result->items);
+    fflush(stdout);
+}
+/*==================[external functions definition]==========================*/
+int main(int argc, char *argv[]){
+    const char *filter = (argc > 1) ? argv[1] : NULL;
+    int errors = 0;
+    uint16_t count;
+    FILE *f;
+
+    printf("case                  size     min(%s)  median(%s)     max(%s)  per item\n",
+        DspBenchUnit(), DspBenchUnit(), DspBenchUnit());
+    count = DspBenchRun(filter, results, DSP_BENCH_MAX_RESULTS, PrintResult, NULL);
+    for (uint16_t i = 0; i < count; i++){
+        if ((results[i].min == 0) || (results[i].min > results[i].median) || (results[i].median > results[i].max)){
+            printf("FAIL: %s(%lu) times\n", results[i].name, (unsigned long)results[i].size);
+            errors++;
+        }
+    }
+    if ((filter == NULL) && (count != SUITE_RESULTS)){
+        printf("FAIL: %d results, expected %d\n", count, SUITE_RESULTS);
+        errors++;
+    }
+
+    f = fopen(CSV_FILE, "w");
+    if (f != NULL){
+        DspBenchCsvHeader(f);
+        for (uint16_t i = 0; i < count; i++){
+            DspBenchCsvLine(f, &results[i]);
+        }
+        fclose(f);
+    }
+    f = fopen(JSON_FILE, "w");
+    if (f != NULL){
+        DspBenchJson(f, results, count);
+        fclose(f);
+    }
+    printf("%d results: %s, %s\n", count, CSV_FILE, JSON_FILE);
+    if (errors){
+        printf("FAIL: %d errors\n", errors);
+        return 1;
+    }
+    return 0;
+}
+
+/*==================[end of file]============================================*/
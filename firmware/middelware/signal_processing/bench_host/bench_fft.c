@@ -0,0 +1,132 @@
+/**
+ * @file bench_fft.c
+ * @brief Host benchmark: FFT plans vs FFTMagnitude(), plan memory when
+ * initialized again
+ * @version 0.1
+ * @date 2026-10-19
+ *
+ * @copyright Copyright (c) 2026
+ *
+ */
+
+/*==================[inclusions]=============================================*/
+#include <stdio.h>
+#include <stdlib.h>
+#include <math.h>
+#include <time.h>
+#include "fft.h"
+#include "arena_mcu.h"
+/*==================[macros and definitions]=================================*/
+#define REPEAT      200
+#define REINITS     10
+#define PLAN_BYTES(n)   ((n) * sizeof(float) + (n) / 2 * sizeof(uint16_t))   /*!< Tables of a plan */
+/*==================[internal data definition]===============================*/
+static float signal[MAX_SIGNAL_LENGHT];
+static float fft_ref[MAX_SIGNAL_LENGHT / 2];
+static float fft_plan[MAX_SIGNAL_LENGHT / 2];
+static fft_plan_t plan;
+static fft_plan_t other;
+/*==================[internal functions definition]==========================*/
+static double TimeUs(void){
+    struct timespec t;
+    clock_gettime(CLOCK_MONOTONIC, &t);
+    return t.tv_sec * 1e6 + t.tv_nsec / 1e3;
+}
+/*==================[external functions definition]==========================*/
+int main(void){
+    int errors = 0;
+    double start, t_ref, t_plan;
+    float max_err, max_ref;
+
+    if (!FFTInit()){
+        printf("FFTInit failed\n");
+        return 1;
+    }
+    printf("    N  plan       FFTMagnitude(us)  FFTPlanMagnitude(us)  speedup  max error\n");
+    for (uint16_t n = 256; n <= MAX_SIGNAL_LENGHT; n *= 2){
+        for (uint16_t i = 0; i < n; i++){
+            signal[i] = 1000 * sinf(2 * M_PI * 37.3f * i / n) + 200 * cosf(2 * M_PI * 101 * i / n)
+                + 50 + (rand() % 200 - 100);
+        }
+        // One plan at a time: give back the tables of the previous size
+        ArenaReset(&arena_dsp, 0);
+        plan = (fft_plan_t){0};
+        if (!FFTPlanInit(&plan, n)){
+            printf("FFTPlanInit(%d) failed\n", n);
+            return 1;
+        }
+        start = TimeUs();
+        for (int r = 0; r < REPEAT; r++){
+            FFTMagnitude(signal, fft_ref, n);
+        }
+        t_ref = (TimeUs() - start) / REPEAT;
+        start = TimeUs();
+        for (int r = 0; r < REPEAT; r++){
+            FFTPlanMagnitude(&plan, signal, fft_plan);
+        }
+        t_plan = (TimeUs() - start) / REPEAT;
+        max_err = 0;
+        max_ref = 0;
+        for (uint16_t j = 0; j < n / 2; j++){
+            max_err = fmaxf(max_err, fabsf(fft_ref[j] - fft_plan[j]));
+            max_ref = fmaxf(max_ref, fabsf(fft_ref[j]));
+        }
+        printf("%5d  %-9s  %16.1f  %20.1f  %7.2f  %9.2e\n", n,
+            plan.radix == FFT_PLAN_RADIX_4 ? "radix-4" : "radix-4+2", t_ref, t_plan, t_ref / t_plan, max_err / max_ref);
+        if (max_err > 1e-4f * max_ref){
+            errors++;
+        }
+    }
+    // Invalid lengths: all zeros and the scratch memory is given back
+    const uint16_t bad_lenghts[] = {1000, 12};
+    for (uint8_t i = 0; i < sizeof(bad_lenghts) / sizeof(bad_lenghts[0]); i++){
+        uint32_t mark = ArenaMark(&arena_scratch);
+        for (uint16_t j = 0; j < bad_lenghts[i] / 2; j++){
+            fft_ref[j] = 1;
+        }
+        FFTMagnitude(signal, fft_ref, bad_lenghts[i]);
+        max_ref = 0;
+        for (uint16_t j = 0; j < bad_lenghts[i] / 2; j++){
+            max_ref = fmaxf(max_ref, fabsf(fft_ref[j]));
+        }
+        printf("%5d  invalid length: %s\n", bad_lenghts[i], (max_ref == 0) ? "zeros" : "not zeroed");
+        if ((max_ref != 0) || (ArenaMark(&arena_scratch) != mark)){
+            errors++;
+        }
+    }
+    // Plans initialized again with growing lengths: arena_dsp stays bounded
+    ArenaReset(&arena_dsp, 0);
+    plan = (fft_plan_t){0};
+    for (uint8_t r = 0; r < REINITS; r++){
+        for (uint16_t n = 256; n <= MAX_SIGNAL_LENGHT; n *= 2){
+            errors += !FFTPlanInit(&plan, n);
+        }
+    }
+    printf("Plan re-initialized %d times (last tables): arena_dsp %lu bytes\n", REINITS * 4, (unsigned long)ArenaMark(&arena_dsp));
+    if (ArenaMark(&arena_dsp) > PLAN_BYTES(MAX_SIGNAL_LENGHT)){
+        errors++;
+    }
+    // Tables of another plan on top: the first one grows only once
+    ArenaReset(&arena_dsp, 0);
+    plan = (fft_plan_t){0};
+    other = (fft_plan_t){0};
+    errors += !FFTPlanInit(&plan, 256);
+    errors += !FFTPlanInit(&other, 256);
+    for (uint8_t r = 0; r < REINITS; r++){
+        for (uint16_t n = 256; n <= MAX_SIGNAL_LENGHT; n *= 2){
+            errors += !FFTPlanInit(&plan, n);
+        }
+    }
+    printf("Plan re-initialized %d times (tables below others): arena_dsp %lu bytes\n", REINITS * 4, (unsigned long)ArenaMark(&arena_dsp));
+    if (ArenaMark(&arena_dsp) > 2 * PLAN_BYTES(256) + PLAN_BYTES(MAX_SIGNAL_LENGHT)){
+        errors++;
+    }
+    MemoryPrint();
+    if (errors){
+        printf("FAIL: %d sizes failed\n", errors);
+        return 1;
+    }
+    return 0;
+}
+
+/*==================[end of file]============================================*/
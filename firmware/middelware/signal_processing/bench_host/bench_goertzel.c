@@ -0,0 +1,190 @@
+/**
+ * @file bench_goertzel.c
+ * @brief Host check and benchmark: Goertzel / sliding DFT bank vs FFT
+ * @version 0.1
+ * @date 2026-10-19
+ *
+ * @copyright Copyright (c) 2026
+ *
+ */
+
+/*==================[inclusions]=============================================*/
+#include <stdio.h>
+#include <stdlib.h>
+#include <math.h>
+#include <time.h>
+#include "goertzel.h"
+#include "fft.h"
+#include "dsps_fft2r.h"
+/*==================[macros and definitions]=================================*/
+#define LEN         1024
+#define FS          1000.0f
+#define FREQS_QTY   4
+#define REPEAT      200
+#define LONG_RUN    2000000
+/*==================[internal data definition]===============================*/
+static float signal[LEN];
+static float fft[LEN / 2];
+static float fft_complex[2 * LEN];
+static float delay[LEN];
+static float results[LEN * FREQS_QTY];
+static goertzel_t bank;
+static int errors = 0;
+/*==================[internal functions definition]==========================*/
+static double TimeUs(void){
+    struct timespec t;
+    clock_gettime(CLOCK_MONOTONIC, &t);
+    return t.tv_sec * 1e6 + t.tv_nsec / 1e3;
+}
+
+static float Sample(long n){
+    return 1000 * sinf(2 * M_PI * 50.0 * n / FS) + 300 * cosf(2 * M_PI * 100.3 * n / FS + 1)
+        + 80 * sinf(2 * M_PI * 273.7 * n / FS) + 20 + (rand() % 100 - 50);
+}
+
+/* Amplitude of a window of x (x[0] oldest), weights r^(age), in double */
+static double DftAmplitude(const float *x, int len, double f, double r){
+    double re = 0, im = 0, gain = 0, weight = 1;
+    for(int m = len - 1; m >= 0; m--){
+        re += weight * x[m] * cos(2 * M_PI * f * m / FS);
+        im += weight * x[m] * sin(2 * M_PI * f * m / FS);
+        gain += weight;
+        weight *= r;
+    }
+    return 2 * sqrt(re * re + im * im) / gain;
+}
+
+static void Check(const char *name, float value, double ref, double tol){
+    if(fabs(value - ref) > tol){
+        printf("%s: %f, expected %f\n", name, value, ref);
+        errors++;
+    }
+}
+
+/* Bin centred frequencies: same as the (rectangular window) FFT */
+static void TestFFT(void){
+    const float freqs[FREQS_QTY] = {0, 51 * FS / LEN, 102 * FS / LEN, FS / 2};
+    float amplitude[FREQS_QTY];
+    dsps_fft2r_plan_fc32_t plan;
+    uint16_t bin;
+
+    for(uint16_t i = 0; i < LEN; i++){
+        signal[i] = Sample(i);
+        fft_complex[2 * i] = signal[i];
+        fft_complex[2 * i + 1] = 0;
+    }
+    dsps_fft2r_plan_init_fc32(&plan, LEN);
+    dsps_fft2r_plan_fc32(&plan, fft_complex);
+    dsps_bit_rev_plan_fc32(&plan, fft_complex);
+    GoertzelInit(&bank, freqs, FREQS_QTY, FS, LEN, GOERTZEL_BLOCK, NULL);
+    if(GoertzelProcess(&bank, signal, LEN, amplitude) != 1){
+        printf("block: no result after %d samples\n", LEN);
+        errors++;
+    }
+    for(uint8_t i = 0; i < FREQS_QTY; i++){
+        bin = lrintf(freqs[i] * LEN / FS);
+        Check("block vs FFT", amplitude[i],
+            2 * hypotf(fft_complex[2 * bin], fft_complex[2 * bin + 1]) / LEN, 1e-3);
+    }
+}
+
+/* Any frequency, blocks and samples of any length */
+static void TestBlock(void){
+    const float freqs[FREQS_QTY] = {0.37f, 50, 100.3f, 499.61f};
+    float amplitude[FREQS_QTY];
+    uint16_t results_qty = 0;
+
+    for(uint16_t i = 0; i < LEN; i++){
+        signal[i] = Sample(i);
+    }
+    GoertzelInit(&bank, freqs, FREQS_QTY, FS, LEN / 2, GOERTZEL_BLOCK, NULL);
+    for(uint16_t pos = 0, len = 1; pos < LEN; pos += len, len = len * 2 + 1){
+        len = (len > LEN - pos) ? LEN - pos : len;
+        results_qty += GoertzelProcess(&bank, &signal[pos], len, &results[results_qty * FREQS_QTY]);
+    }
+    GoertzelAmplitude(&bank, amplitude);
+    for(uint8_t i = 0; i < FREQS_QTY; i++){
+        Check("block", results[i], DftAmplitude(signal, LEN / 2, freqs[i], 1), 1e-3);
+        Check("block", results[FREQS_QTY + i], DftAmplitude(&signal[LEN / 2], LEN / 2, freqs[i], 1), 1e-3);
+        Check("block last", amplitude[i], results[FREQS_QTY + i], 0);
+    }
+    if(results_qty != 2){
+        printf("block: %d results, expected 2\n", results_qty);
+        errors++;
+    }
+}
+
+/* Sliding DFT: every sample, and after a long run (no drift) */
+static void TestSliding(void){
+    const float freqs[FREQS_QTY] = {50, 100.3f, 273.7f, 12.5f};
+    float amplitude[FREQS_QTY];
+    float x;
+
+    GoertzelInit(&bank, freqs, FREQS_QTY, FS, LEN, GOERTZEL_SLIDING, delay);
+    for(uint16_t i = 0; i < LEN; i++){
+        signal[i] = Sample(i);
+    }
+    GoertzelProcess(&bank, signal, LEN, results);
+    for(uint16_t n = LEN / 4; n < LEN; n += LEN / 4){
+        for(uint8_t i = 0; i < FREQS_QTY; i++){
+            Check("sliding", results[n * FREQS_QTY + i], DftAmplitude(signal, n + 1, freqs[i], GOERTZEL_SLIDING_DAMPING)
+                * (1 - pow(GOERTZEL_SLIDING_DAMPING, n + 1)) / (1 - pow(GOERTZEL_SLIDING_DAMPING, LEN)), 2e-2);
+        }
+    }
+    for(long n = LEN; n < LONG_RUN; n++){
+        x = Sample(n);
+        GoertzelProcess(&bank, &x, 1, NULL);
+        signal[n % LEN] = x;
+    }
+    GoertzelAmplitude(&bank, amplitude);
+    for(uint16_t i = 0; i < LEN; i++){
+        fft_complex[i] = signal[(LONG_RUN + i) % LEN];
+    }
+    for(uint8_t i = 0; i < FREQS_QTY; i++){
+        Check("sliding, long run", amplitude[i], DftAmplitude(fft_complex, LEN, freqs[i], GOERTZEL_SLIDING_DAMPING), 2e-2);
+    }
+    printf("Sliding DFT after %d samples: %.2f %.2f %.2f %.2f (tones: 1000 300 80)\n", LONG_RUN,
+        amplitude[0], amplitude[1], amplitude[2], amplitude[3]);
+}
+
+static void Bench(void){
+    const float freqs[FREQS_QTY] = {50, 100, 150, 200};
+    double start, t_fft, t_block, t_sliding;
+
+    GoertzelInit(&bank, freqs, FREQS_QTY, FS, LEN, GOERTZEL_BLOCK, NULL);
+    start = TimeUs();
+    for(int r = 0; r < REPEAT; r++){
+        FFTMagnitude(signal, fft, LEN);
+    }
+    t_fft = (TimeUs() - start) / REPEAT;
+    start = TimeUs();
+    for(int r = 0; r < REPEAT; r++){
+        GoertzelProcess(&bank, signal, LEN, NULL);
+    }
+    t_block = (TimeUs() - start) / REPEAT;
+    GoertzelInit(&bank, freqs, FREQS_QTY, FS, LEN, GOERTZEL_SLIDING, delay);
+    start = TimeUs();
+    for(int r = 0; r < REPEAT; r++){
+        GoertzelProcess(&bank, signal, LEN, NULL);
+    }
+    t_sliding = (TimeUs() - start) / REPEAT;
+    printf("%d samples, %d frequencies:\n", LEN, FREQS_QTY);
+    printf("  FFTMagnitude (%d points)    %8.1f us\n", LEN, t_fft);
+    printf("  Goertzel (1 result)          %8.1f us  x%.1f\n", t_block, t_fft / t_block);
+    printf("  Sliding DFT (%d results)   %8.1f us  x%.1f\n", LEN, t_sliding, t_fft / t_sliding);
+}
+/*==================[external functions definition]==========================*/
+int main(void){
+    FFTInit();
+    TestFFT();
+    TestBlock();
+    TestSliding();
+    Bench();
+    if(errors){
+        printf("FAIL: %d errors\n", errors);
+        return 1;
+    }
+    return 0;
+}
+
+/*==================[end of file]============================================*/
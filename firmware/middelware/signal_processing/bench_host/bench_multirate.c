@@ -0,0 +1,201 @@
+/**
+ * @file bench_multirate.c
+ * @brief Host check and benchmark: decimators, interpolator and CIC (multirate.c)
+ * @version 0.1
+ * @date 2026-10-19
+ *
+ * @copyright Copyright (c) 2026
+ *
+ */
+
+/*==================[inclusions]=============================================*/
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <math.h>
+#include <time.h>
+#include "multirate.h"
+#include "esp_dsp.h"
+/*==================[macros and definitions]=================================*/
+#define FS          48000.0f
+#define LEN         8192
+#define TAPS        64
+#define DECIM       8
+#define INTERP      4
+#define CIC_ORDER   4
+#define CIC_RATIO   32
+#define COMP_TAPS   64
+#define REPEAT      20
+/*==================[internal data definition]===============================*/
+static float input[LEN];
+static float output[LEN * INTERP];
+static float output_ref[LEN];
+static int16_t input_s16[LEN];
+static float coeffs[TAPS];
+static float comp_coeffs[COMP_TAPS];
+static float delay[TAPS];
+static float comp_delay[COMP_TAPS];
+static float phase_coeffs[TAPS + INTERP];
+static float interp_delay[2 * TAPS];
+static int errors = 0;
+/*==================[internal functions definition]==========================*/
+static double TimeUs(void){
+    struct timespec t;
+    clock_gettime(CLOCK_MONOTONIC, &t);
+    return t.tv_sec * 1e6 + t.tv_nsec / 1e3;
+}
+
+/* Amplitude (dB) of the f component of a signal, skipping the transient.
+ * Hann window, so the leakage of the other tones doesn't count */
+static float ToneDb(const float *x, uint16_t len, float f, float fs){
+    double re = 0, im = 0, gain = 0, w;
+    uint16_t skip = len / 4;
+    for(uint16_t i = skip; i < len; i++){
+        w = 0.5 - 0.5 * cos(2 * M_PI * (i - skip) / (len - skip));
+        re += w * x[i] * cos(2 * M_PI * f * i / fs);
+        im += w * x[i] * sin(2 * M_PI * f * i / fs);
+        gain += w;
+    }
+    return 20 * log10(2 * sqrt(re * re + im * im) / gain);
+}
+
+static void Tone(float f){
+    for(uint16_t i = 0; i < LEN; i++){
+        input[i] = sinf(2 * M_PI * f * i / FS);
+        input_s16[i] = lrintf(16000 * input[i]);
+    }
+}
+
+static void Check(const char *name, float f, float db, float min, float max){
+    printf("  %-22s %8.0f Hz %8.2f dB\n", name, f, db);
+    if((db < min) || (db > max)){
+        printf("  FAIL: expected %.2f .. %.2f dB\n", min, max);
+        errors++;
+    }
+}
+
+/* Decimate by DECIM: pass band flat, aliases rejected */
+static void TestDecim(void){
+    multirate_decim_t decimator;
+    uint16_t len;
+
+    printf("Decimator x%d, %d taps (Blackman):\n", DECIM, TAPS);
+    MultirateLowPassDesign(coeffs, TAPS, FS / (2 * DECIM) * 0.8f, FS, MULTIRATE_WIND_BLACKMAN);
+    const float pass[] = {100, 500};
+    const float stop[] = {FS / DECIM - 500, FS / DECIM + 1000, 3 * FS / DECIM + 200};
+    for(uint8_t i = 0; i < sizeof(pass) / sizeof(pass[0]); i++){
+        Tone(pass[i]);
+        MultirateDecimInit(&decimator, coeffs, delay, TAPS, DECIM);
+        len = MultirateDecim(&decimator, input, output, LEN);
+        Check("pass band", pass[i], ToneDb(output, len, pass[i], FS / DECIM), -0.1f, 0.1f);
+    }
+    for(uint8_t i = 0; i < sizeof(stop) / sizeof(stop[0]); i++){
+        Tone(stop[i]);
+        MultirateDecimInit(&decimator, coeffs, delay, TAPS, DECIM);
+        len = MultirateDecim(&decimator, input, output, LEN);
+        /* Alias frequency at the output rate */
+        float alias = fabsf(stop[i] - lrintf(stop[i] / (FS / DECIM)) * (FS / DECIM));
+        Check("stop band (alias)", stop[i], ToneDb(output, len, alias, FS / DECIM), -200, -60);
+    }
+    /* Blocks of any length, in place: same as one call */
+    Tone(1234);
+    MultirateDecimInit(&decimator, coeffs, delay, TAPS, DECIM);
+    len = MultirateDecim(&decimator, input, output_ref, LEN);
+    MultirateDecimInit(&decimator, coeffs, delay, TAPS, DECIM);
+    uint16_t results = 0;
+    for(uint16_t pos = 0, block = 1; pos < LEN; pos += block, block = block * 3 % 37 + 1){
+        block = (block > LEN - pos) ? LEN - pos : block;
+        memcpy(output, &input[pos], block * sizeof(float));
+        uint16_t n = MultirateDecim(&decimator, output, output, block);
+        memcpy(&output[LEN + results], output, n * sizeof(float));
+        results += n;
+    }
+    if((results != len) || memcmp(&output[LEN], output_ref, len * sizeof(float))){
+        printf("  FAIL: streaming blocks differ from a single block\n");
+        errors++;
+    }
+}
+
+/* Interpolate by INTERP: the tone is kept, images rejected */
+static void TestInterp(void){
+    multirate_interp_t interpolator;
+    const float fs_out = FS * INTERP;
+    const float f = 3000;
+    uint16_t len;
+
+    printf("Interpolator x%d, %d taps (Blackman):\n", INTERP, TAPS);
+    MultirateLowPassDesign(coeffs, TAPS, FS / 2 * 0.8f, fs_out, MULTIRATE_WIND_BLACKMAN);
+    MultirateInterpInit(&interpolator, coeffs, TAPS, INTERP, phase_coeffs, interp_delay);
+    Tone(f);
+    len = MultirateInterp(&interpolator, input, output, LEN / INTERP);
+    Check("tone", f, ToneDb(output, len, f, fs_out), -0.1f, 0.1f);
+    Check("image", FS - f, ToneDb(output, len, FS - f, fs_out), -200, -60);
+    Check("image", FS + f, ToneDb(output, len, FS + f, fs_out), -200, -60);
+}
+
+/* CIC x CIC_RATIO + compensator x2 */
+static void TestCic(void){
+    multirate_cic_t cic;
+    multirate_decim_t comp;
+    const float fs_cic = FS / CIC_RATIO;
+    const float pass[] = {50, 150, 250};
+    uint16_t len;
+
+    printf("CIC x%d (order %d) + compensator x2, %d taps:\n", CIC_RATIO, CIC_ORDER, COMP_TAPS);
+    MultirateCicCompDesign(comp_coeffs, COMP_TAPS, fs_cic / 4, fs_cic, CIC_ORDER, CIC_RATIO, MULTIRATE_WIND_BLACKMAN);
+    for(uint8_t i = 0; i < sizeof(pass) / sizeof(pass[0]); i++){
+        Tone(pass[i]);
+        MultirateCicInit(&cic, CIC_ORDER, CIC_RATIO);
+        MultirateDecimInit(&comp, comp_coeffs, comp_delay, COMP_TAPS, 2);
+        len = MultirateCicDecim(&cic, input_s16, output, LEN);
+        Check("CIC only", pass[i], ToneDb(output, len, pass[i], fs_cic) - 20 * log10f(16000), -3, 0.01f);
+        len = MultirateDecim(&comp, output, output, len);
+        Check("CIC + compensator", pass[i], ToneDb(output, len, pass[i], fs_cic / 2) - 20 * log10f(16000), -0.1f, 0.1f);
+    }
+}
+
+/* Decimation by DECIM against filtering at the full rate */
+static void Bench(void){
+    multirate_decim_t decimator;
+    multirate_cic_t cic;
+    fir_f32_t fir;
+    double start, t_fir, t_decim, t_cic;
+
+    MultirateLowPassDesign(coeffs, TAPS, FS / (2 * DECIM) * 0.8f, FS, MULTIRATE_WIND_BLACKMAN);
+    dsps_fir_init_f32(&fir, coeffs, delay, TAPS);
+    start = TimeUs();
+    for(int r = 0; r < REPEAT; r++){
+        dsps_fir_f32(&fir, input, output, LEN);
+    }
+    t_fir = (TimeUs() - start) / REPEAT;
+    MultirateDecimInit(&decimator, coeffs, delay, TAPS, DECIM);
+    start = TimeUs();
+    for(int r = 0; r < REPEAT; r++){
+        MultirateDecim(&decimator, input, output, LEN);
+    }
+    t_decim = (TimeUs() - start) / REPEAT;
+    MultirateCicInit(&cic, CIC_ORDER, CIC_RATIO);
+    start = TimeUs();
+    for(int r = 0; r < REPEAT; r++){
+        MultirateCicDecim(&cic, input_s16, output, LEN);
+    }
+    t_cic = (TimeUs() - start) / REPEAT;
+    printf("%d samples:\n", LEN);
+    printf("  FIR %d taps, full rate       %8.1f us\n", TAPS, t_fir);
+    printf("  Decimator x%d, %d taps        %8.1f us  x%.1f\n", DECIM, TAPS, t_decim, t_fir / t_decim);
+    printf("  CIC x%d, order %d             %8.1f us\n", CIC_RATIO, CIC_ORDER, t_cic);
+}
+/*==================[external functions definition]==========================*/
+int main(void){
+    TestDecim();
+    TestInterp();
+    TestCic();
+    Bench();
+    if(errors){
+        printf("FAIL: %d errors\n", errors);
+        return 1;
+    }
+    return 0;
+}
+
+/*==================[end of file]============================================*/
@@ -0,0 +1,187 @@
+/**
+ * @file bench_q15.c
+ * @brief Host check and benchmark: Q15 chain (q15_dsp.c) against the float
+ * chain (iir_filter.c, multirate.c, fft.c), SNR after each stage and time
+ * @version 0.1
+ * @date 2026-10-19
+ *
+ * @copyright Copyright (c) 2026
+ *
+ */
+
+/*==================[inclusions]=============================================*/
+#include <stdio.h>
+#include <stdlib.h>
+#include <math.h>
+#include <time.h>
+#include "q15_dsp.h"
+#include "iir_filter.h"
+#include "multirate.h"
+#include "fft.h"
+/*==================[macros and definitions]=================================*/
+#define FS          1000.0f
+#define LEN         2048
+#define CUT         100.0f
+#define ORDER       ORDER_4
+#define DECIM       4
+#define TAPS        32
+#define REPEAT      50
+#define RUNS        5           /*!< Best of RUNS (the host is shared) */
+/*==================[internal data definition]===============================*/
+static uint16_t adc[LEN];
+/* Float chain */
+static float x[LEN];
+static float y[LEN];
+static float yd[LEN / DECIM];
+static float fft_ref[LEN / DECIM / 2];
+static float coeffs[TAPS];
+static float delay[TAPS];
+static multirate_decim_t decimator;
+/* Q15 chain */
+static int16_t xq[LEN];
+static int16_t ydq[LEN / DECIM];
+static int16_t fftq[LEN / DECIM / 2];
+static int16_t coeffs_q15[TAPS];
+static int16_t delay_q15[TAPS];
+static q15_biquad_t biquad;
+static q15_fir_t fir;
+static q15_block_t block;
+static q15_block_t block_fft;
+/* Q15 stage converted back to float (ADC counts) */
+static float out[LEN];
+static int errors = 0;
+/*==================[internal functions definition]==========================*/
+static double TimeUs(void){
+    struct timespec t;
+    clock_gettime(CLOCK_MONOTONIC, &t);
+    return t.tv_sec * 1e6 + t.tv_nsec / 1e3;
+}
+
+static void Check(bool ok, const char *what){
+    if(!ok){
+        printf("  FAIL: %s\n", what);
+        errors++;
+    }
+}
+
+/* SNR (dB) of a stage of the Q15 chain, the float chain is the reference */
+static float Snr(const char *name, const float *ref, const int16_t *q15, uint16_t len, const q15_block_t *b){
+    double signal = 0, noise = 0;
+    float snr;
+
+    Q15ToFloat(q15, out, len, b);
+    for(uint16_t i = 0; i < len; i++){
+        signal += (double)ref[i] * ref[i];
+        noise += (double)(out[i] - ref[i]) * (out[i] - ref[i]);
+    }
+    snr = (noise > 0) ? 10 * log10(signal / noise) : INFINITY;
+    printf("  %-24s exponent %3d  SNR %6.1f dB\n", name, b->exponent, snr);
+    return snr;
+}
+
+static void FloatChain(void){
+    uint32_t sum = 0;
+    uint16_t mean;
+
+    /* Same offset as Q15FromAdc(Q15_OFFSET_MEAN) */
+    for(uint16_t i = 0; i < LEN; i++){
+        sum += adc[i];
+    }
+    mean = (sum + LEN / 2) / LEN;
+    for(uint16_t i = 0; i < LEN; i++){
+        x[i] = (float)adc[i] - mean;
+    }
+    LowPassFilter(x, y, LEN);
+    MultirateDecim(&decimator, y, yd, LEN);
+    FFTMagnitude(yd, fft_ref, LEN / DECIM);
+}
+
+static void Q15Chain(void){
+    block = (q15_block_t){0};
+    Q15FromAdc(adc, xq, LEN, Q15_OFFSET_MEAN, &block);
+    Q15BiquadFilter(&biquad, xq, xq, LEN, &block);
+    Q15FirDecim(&fir, xq, ydq, LEN, &block);
+    block_fft = block;
+    Q15FFTMagnitude(ydq, fftq, LEN / DECIM, &block_fft);
+}
+
+static void Init(void){
+    LowPassInit(FS, CUT, ORDER);
+    MultirateDecimInit(&decimator, coeffs, delay, TAPS, DECIM);
+    Q15LowPassInit(&biquad, FS, CUT, ORDER);
+    Q15FirDecimInit(&fir, coeffs, coeffs_q15, delay_q15, TAPS, DECIM);
+}
+
+static double Time(void (*chain)(void)){
+    double start, best = 0, us;
+
+    for(uint8_t run = 0; run < RUNS; run++){
+        start = TimeUs();
+        for(uint16_t r = 0; r < REPEAT; r++){
+            chain();
+        }
+        us = (TimeUs() - start) / REPEAT;
+        best = ((run == 0) || (us < best)) ? us : best;
+    }
+    return best;
+}
+/*==================[external functions definition]==========================*/
+int main(void){
+    float snr_adc, snr_iir, snr_fir, snr_fft;
+    double t_float, t_q15;
+    int32_t value;
+
+    if(!Q15FFTInit() || !FFTInit()){
+        printf("FFT init failed\n");
+        return 1;
+    }
+    /* 12 bit frame: tones in the pass band and above the cut-off, noise */
+    srand(1);
+    for(uint16_t i = 0; i < LEN; i++){
+        value = lrintf(2048 + 900 * sinf(2 * M_PI * 12.5f * i / FS) + 300 * sinf(2 * M_PI * 60 * i / FS)
+            + 200 * sinf(2 * M_PI * 310 * i / FS)) + rand() % 17 - 8;
+        adc[i] = (value < 0) ? 0 : (value > 4095) ? 4095 : value;
+    }
+    MultirateLowPassDesign(coeffs, TAPS, FS / (2 * DECIM) * 0.8f, FS, MULTIRATE_WIND_BLACKMAN);
+
+    printf("Q15 chain against the float chain, %d samples at %.0f Hz:\n", LEN, FS);
+    Init();
+    FloatChain();
+    /* Each stage of the Q15 chain is compared with the same stage of the
+     * float chain (errors add up from one stage to the next) */
+    block = (q15_block_t){0};
+    Q15FromAdc(adc, xq, LEN, Q15_OFFSET_MEAN, &block);
+    snr_adc = Snr("Q15FromAdc", x, xq, LEN, &block);
+    Q15BiquadFilter(&biquad, xq, xq, LEN, &block);
+    snr_iir = Snr("Q15BiquadFilter", y, xq, LEN, &block);
+    Q15FirDecim(&fir, xq, ydq, LEN, &block);
+    snr_fir = Snr("Q15FirDecim", yd, ydq, LEN / DECIM, &block);
+    block_fft = block;
+    Q15FFTMagnitude(ydq, fftq, LEN / DECIM, &block_fft);
+    snr_fft = Snr("Q15FFTMagnitude", fft_ref, fftq, LEN / DECIM / 2, &block_fft);
+    Check(block_fft.saturations == 0, "no saturated samples");
+    /* 12 bit input is kept exactly and the filters add Q15 rounding noise.
+     * The FFT scales by 1/2 each stage (9 for 512 points): ~46 dB */
+    Check(snr_adc > 120, "Q15FromAdc is exact");
+    Check(snr_iir > 60, "biquad SNR above 60 dB");
+    Check(snr_fir > 60, "FIR decimator SNR above 60 dB");
+    Check(snr_fft > 40, "FFT magnitude SNR above 40 dB");
+
+    /* The host has a FPU: the Q15 chain is expected to win on the ESP32-C6
+     * (no FPU, projects/bench_dsp), here it is only tracked */
+    t_float = Time(FloatChain);
+    t_q15 = Time(Q15Chain);
+    printf("Frame of %d samples (best of %d runs):\n", LEN, RUNS);
+    printf("  float chain  %8.1f us\n", t_float);
+    printf("  Q15 chain    %8.1f us  x%.2f\n", t_q15, t_float / t_q15);
+    Q15FirDecimDeinit(&fir);
+
+    if(errors){
+        printf("FAIL: %d errors\n", errors);
+        return 1;
+    }
+    printf("OK\n");
+    return 0;
+}
+
+/*==================[end of file]============================================*/
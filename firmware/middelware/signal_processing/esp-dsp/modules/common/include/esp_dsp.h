@@ -33,6 +33,7 @@ extern "C"
 #include "dsps_wind.h"
 #include "dsps_conv.h"
 #include "dsps_corr.h"
+#include "dsps_fconv.h"
 
 #include "dsps_d_gen.h"
 #include "dsps_h_gen.h"
@@ -60,6 +61,8 @@ extern "C"
 
 #ifdef __cplusplus
 #include "mat.h"
+#include "matn.h"
+#include "mat_factor.h"
 #endif
 
 #endif // _esp_dsp_H_
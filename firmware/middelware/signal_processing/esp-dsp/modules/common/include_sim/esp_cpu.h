@@ -0,0 +1,15 @@
+#ifndef _esp_cpu_h_
+#define _esp_cpu_h_
+
+#include <stdint.h>
+#include <time.h>
+
+// Host builds count nanoseconds of the monotonic clock instead of CPU cycles
+static inline uint32_t esp_cpu_get_cycle_count(void)
+{
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (uint32_t)((uint64_t)ts.tv_sec * 1000000000ULL + ts.tv_nsec);
+}
+
+#endif // _esp_cpu_h_
@@ -0,0 +1,8 @@
+#ifndef _esp_idf_version_h_
+#define _esp_idf_version_h_
+
+// Host builds behave as the IDF version used by the firmware
+#define ESP_IDF_VERSION_VAL(major, minor, patch) ((major << 16) | (minor << 8) | (patch))
+#define ESP_IDF_VERSION ESP_IDF_VERSION_VAL(5, 1, 0)
+
+#endif // _esp_idf_version_h_
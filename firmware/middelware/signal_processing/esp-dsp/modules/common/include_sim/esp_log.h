@@ -20,5 +20,9 @@
 #include <stdlib.h>
 
 #define ESP_LOGD
+#define ESP_LOGE(...)
+#define ESP_LOGW(...)
+#define ESP_LOGI(...)
+#define ESP_LOGV(...)
 
 #endif // _esp_log_h_
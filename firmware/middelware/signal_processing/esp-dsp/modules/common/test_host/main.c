@@ -0,0 +1,19 @@
+#include <stdio.h>
+
+int test_rv32(void);
+int test_fft_tables(void);
+int test_fconv(void);
+
+int main(void)
+{
+    printf("main starts!\n");
+    int errors = test_rv32();
+    errors += test_fft_tables();
+    errors += test_fconv();
+    if (errors) {
+        printf("Test FAIL: %i errors\n", errors);
+        return 1;
+    }
+    printf("Test done\n");
+    return 0;
+}
@@ -0,0 +1,191 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <math.h>
+
+#include "dsp_common.h"
+#include "dsps_fir.h"
+#include "dsps_corr.h"
+#include "dsps_fconv.h"
+
+#define SIG_LEN     2048
+#define MAX_KERN    512
+#define REPEAT      8
+
+static float sig[SIG_LEN];
+static float kern[MAX_KERN];
+static float out[SIG_LEN + MAX_KERN];
+static float ref[SIG_LEN + MAX_KERN];
+static float delay[MAX_KERN];
+static int errors;
+
+static int check_init(const char *name, int kernlen, esp_err_t ret)
+{
+    if (ret != ESP_OK) {
+        printf("%s kernlen=%i: init failed (%i)\n", name, kernlen, ret);
+        errors++;
+        return 0;
+    }
+    return 1;
+}
+
+static void check(const char *name, int kernlen, const float *y, const float *y_ref, int len)
+{
+    for (int i = 0 ; i < len ; i++) {
+        if (fabsf(y[i] - y_ref[i]) > 1e-4f * (1 + fabsf(y_ref[i]))) {
+            printf("%s kernlen=%i: [%i] = %f, expected %f\n", name, kernlen, i, y[i], y_ref[i]);
+            errors++;
+            return;
+        }
+    }
+}
+
+// Direct convolution / correlation, as dsps_conv_f32 / dsps_ccorr_f32
+static void conv_ref(const float *x, int xlen, const float *h, int hlen, float *y, int reverse)
+{
+    for (int n = 0 ; n < xlen + hlen - 1 ; n++) {
+        y[n] = 0;
+        for (int k = 0 ; k < hlen ; k++) {
+            if ((n - k >= 0) && (n - k < xlen)) {
+                y[n] += x[n - k] * (reverse ? h[hlen - 1 - k] : h[k]);
+            }
+        }
+    }
+}
+
+static void test_functions(dsps_fconv_mode_t mode, const char *mode_name)
+{
+    fconv_f32_t conv;
+    char name[32];
+
+    for (int kernlen = 1 ; kernlen <= MAX_KERN ; kernlen = kernlen * 3 + 1) {
+        // Several FFT lengths: auto, the smallest valid one and a big one
+        int sizes[3] = {0, 4, 4096};
+        while (sizes[1] <= kernlen) {
+            sizes[1] <<= 1;
+        }
+        for (int s = 0 ; s < 3 ; s++) {
+            snprintf(name, sizeof(name), "%s N=%i conv", mode_name, sizes[s]);
+            if (check_init(name, kernlen, dsps_fconv_init_f32(&conv, kern, kernlen, mode, sizes[s]))) {
+                dsps_conv_fft_f32(&conv, sig, SIG_LEN, out);
+                conv_ref(sig, SIG_LEN, kern, kernlen, ref, 0);
+                check(name, kernlen, out, ref, SIG_LEN + kernlen - 1);
+            }
+            dsps_fconv_free_f32(&conv);
+
+            snprintf(name, sizeof(name), "%s N=%i ccorr", mode_name, sizes[s]);
+            if (!check_init(name, kernlen, dsps_fcorr_init_f32(&conv, kern, kernlen, mode, sizes[s]))) {
+                dsps_fconv_free_f32(&conv);
+                continue;
+            }
+            dsps_conv_fft_f32(&conv, sig, SIG_LEN, out);
+            conv_ref(sig, SIG_LEN, kern, kernlen, ref, 1);
+            check(name, kernlen, out, ref, SIG_LEN + kernlen - 1);
+
+            snprintf(name, sizeof(name), "%s N=%i corr", mode_name, sizes[s]);
+            dsps_corr_fft_f32(&conv, sig, SIG_LEN, out);
+            dsps_corr_f32_ansi(sig, SIG_LEN, kern, kernlen, ref);
+            check(name, kernlen, out, ref, SIG_LEN - kernlen + 1);
+            dsps_fconv_free_f32(&conv);
+        }
+    }
+}
+
+// Streaming with random piece lengths == dsps_fir_f32 (reversed coefficients)
+static void test_stream(dsps_fconv_mode_t mode, const char *mode_name)
+{
+    fconv_f32_t conv;
+    fir_f32_t fir;
+
+    for (int kernlen = 1 ; kernlen <= MAX_KERN ; kernlen = kernlen * 5 + 3) {
+        if (!check_init(mode_name, kernlen, dsps_fcorr_init_f32(&conv, kern, kernlen, mode, 0))) {
+            dsps_fconv_free_f32(&conv);
+            continue;
+        }
+        dsps_fir_init_f32(&fir, kern, delay, kernlen);
+        memset(delay, 0, sizeof(delay));
+        dsps_fir_f32_ansi(&fir, sig, ref, SIG_LEN);
+        for (int pos = 0, len ; pos < SIG_LEN ; pos += len) {
+            len = rand() % (2 * conv.block_len + 1);
+            if (len > SIG_LEN - pos) {
+                len = SIG_LEN - pos;
+            }
+            dsps_fconv_f32(&conv, sig + pos, out + pos, len);
+        }
+        check(mode_name, kernlen, out, ref, SIG_LEN);
+        dsps_fconv_free_f32(&conv);
+    }
+}
+
+static void test_params(void)
+{
+    fconv_f32_t conv;
+
+    if ((dsps_fconv_init_f32(&conv, kern, 0, DSPS_FCONV_OVERLAP_ADD, 0) != ESP_ERR_DSP_INVALID_LENGTH)
+            || (dsps_fconv_init_f32(&conv, kern, 64, DSPS_FCONV_OVERLAP_ADD, 64) != ESP_ERR_DSP_INVALID_LENGTH)
+            || (dsps_fconv_init_f32(&conv, kern, 64, DSPS_FCONV_OVERLAP_ADD, 100) != ESP_ERR_DSP_INVALID_LENGTH)) {
+        printf("dsps_fconv_init_f32 accepts invalid lengths\n");
+        errors++;
+    }
+    // A failed init leaves an empty instance: no run, free is safe
+    memset(&conv, 0x5a, sizeof(conv));
+    dsps_fconv_init_f32(&conv, kern, 0, DSPS_FCONV_OVERLAP_ADD, 0);
+    if ((dsps_conv_fft_f32(&conv, sig, SIG_LEN, out) == ESP_OK)
+            || (dsps_fconv_f32(&conv, sig, out, SIG_LEN) == ESP_OK)) {
+        printf("dsps_fconv_f32 runs after a failed init\n");
+        errors++;
+    }
+    dsps_fconv_free_f32(&conv);
+}
+
+// Direct FIR against the streaming FFT FIR (automatic FFT length)
+static void bench(void)
+{
+    fconv_f32_t conv;
+    fir_f32_t fir;
+    int crossover = 0;
+
+    printf("kernlen   direct (ns)   fft (ns)   N\n");
+    for (int kernlen = 8 ; kernlen <= MAX_KERN ; kernlen <<= 1) {
+        dsps_fir_init_f32(&fir, kern, delay, kernlen);
+        if (!check_init("bench", kernlen, dsps_fcorr_init_f32(&conv, kern, kernlen, DSPS_FCONV_OVERLAP_SAVE, 0))) {
+            dsps_fconv_free_f32(&conv);
+            continue;
+        }
+        uint32_t t_direct = dsp_get_cpu_cycle_count();
+        for (int r = 0 ; r < REPEAT ; r++) {
+            dsps_fir_f32_ansi(&fir, sig, out, SIG_LEN);
+        }
+        t_direct = dsp_get_cpu_cycle_count() - t_direct;
+        uint32_t t_fft = dsp_get_cpu_cycle_count();
+        for (int r = 0 ; r < REPEAT ; r++) {
+            dsps_fconv_f32(&conv, sig, out, SIG_LEN);
+        }
+        t_fft = dsp_get_cpu_cycle_count() - t_fft;
+        printf("%7i %13u %10u %5i\n", kernlen, (unsigned)(t_direct / REPEAT), (unsigned)(t_fft / REPEAT), conv.fft_size);
+        if ((crossover == 0) && (t_fft < t_direct)) {
+            crossover = kernlen;
+        }
+        dsps_fconv_free_f32(&conv);
+    }
+    printf("FFT convolution faster from kernlen %i\n", crossover);
+}
+
+int test_fconv(void)
+{
+    errors = 0;
+    for (int i = 0 ; i < SIG_LEN ; i++) {
+        sig[i] = (float)rand() / RAND_MAX - 0.5f;
+    }
+    for (int i = 0 ; i < MAX_KERN ; i++) {
+        kern[i] = (float)rand() / RAND_MAX - 0.5f;
+    }
+    test_params();
+    test_functions(DSPS_FCONV_OVERLAP_ADD, "OLA");
+    test_functions(DSPS_FCONV_OVERLAP_SAVE, "OLS");
+    test_stream(DSPS_FCONV_OVERLAP_ADD, "OLA stream");
+    test_stream(DSPS_FCONV_OVERLAP_SAVE, "OLS stream");
+    printf("FFT convolution: %s\n", errors ? "FAIL" : "OK");
+    bench();
+    return errors;
+}
@@ -0,0 +1,102 @@
+#include <stdio.h>
+#include <string.h>
+#include <math.h>
+
+#include "dsp_common.h"
+#include "dsps_fft2r.h"
+#include "dsps_fft_tables.h"
+
+#define MAX_N       CONFIG_DSP_MAX_FFT_SIZE
+
+static float w_runtime[MAX_N];
+static float data[MAX_N * 2];
+static float data_ref[MAX_N * 2];
+static int errors;
+
+// Twiddles generated at build time == dsps_fft2r_init_fc32() with a RAM buffer
+static void test_twiddles(void)
+{
+    if (dsps_fft2r_w_table_fc32_const_size != MAX_N) {
+        printf("twiddle table size %i, expected %i\n", dsps_fft2r_w_table_fc32_const_size, MAX_N);
+        errors++;
+    }
+    dsps_fft2r_init_fc32(w_runtime, MAX_N);
+    for (int i = 0 ; i < MAX_N ; i++) {
+        if (fabsf(dsps_fft2r_w_table_fc32_const[i] - w_runtime[i]) > 1e-6f) {
+            printf("twiddle [%i] = %f, runtime %f\n", i, dsps_fft2r_w_table_fc32_const[i], w_runtime[i]);
+            errors++;
+            break;
+        }
+    }
+    dsps_fft2r_deinit_fc32();
+}
+
+// Bit reverse tables == checked in tables == dsps_bit_rev_fc32_ansi()
+static void test_bitrev(void)
+{
+    for (int pow = 4 ; pow < dsps_fft2r_rev_tables_fc32_const_count ; pow++) {
+        int N = 1 << pow;
+        const uint16_t *table = dsps_fft2r_rev_tables_fc32_const[pow];
+        int size = dsps_fft2r_rev_tables_fc32_const_size[pow];
+        if ((size != dsps_fft2r_rev_tables_fc32_size[pow - 4])
+                || memcmp(table, dsps_fft2r_rev_tables_fc32[pow - 4], size * 2 * sizeof(uint16_t))) {
+            printf("bit reverse table %i differs from dsps_fft2r_rev_tables_fc32\n", N);
+            errors++;
+        }
+        for (int i = 0 ; i < N * 2 ; i++) {
+            data[i] = i;
+        }
+        memcpy(data_ref, data, N * 2 * sizeof(float));
+        dsps_bit_rev_lookup_fc32_ansi(data, size, (uint16_t *)table);
+        dsps_bit_rev_fc32_ansi(data_ref, N);
+        if (memcmp(data, data_ref, N * 2 * sizeof(float))) {
+            printf("bit reverse table %i differs from dsps_bit_rev_fc32_ansi\n", N);
+            errors++;
+        }
+    }
+}
+
+// A plan gives the same FFT as the runtime tables, without dsps_fft2r_init_fc32()
+static void test_plan(void)
+{
+    dsps_fft2r_plan_fc32_t plan;
+
+    if (dsps_fft2r_plan_init_fc32(&plan, 100) != ESP_ERR_DSP_INVALID_LENGTH
+            || dsps_fft2r_plan_init_fc32(&plan, MAX_N * 2) != ESP_ERR_DSP_INVALID_LENGTH) {
+        printf("dsps_fft2r_plan_init_fc32 accepts invalid lengths\n");
+        errors++;
+    }
+    for (int N = 4 ; N <= MAX_N ; N <<= 1) {
+        for (int i = 0 ; i < N ; i++) {
+            data[i * 2 + 0] = (float)((i * 37) % 101) / 50.0f - 1.0f;
+            data[i * 2 + 1] = (float)((i * 53) % 97) / 48.0f - 1.0f;
+        }
+        memcpy(data_ref, data, N * 2 * sizeof(float));
+        if (dsps_fft2r_plan_init_fc32(&plan, N) != ESP_OK) {
+            printf("dsps_fft2r_plan_init_fc32(%i) failed\n", N);
+            errors++;
+            continue;
+        }
+        dsps_fft2r_plan_fc32(&plan, data);
+        dsps_bit_rev_plan_fc32(&plan, data);
+        dsps_fft2r_fc32_ansi_(data_ref, N, w_runtime);
+        dsps_bit_rev_fc32_ansi(data_ref, N);
+        for (int i = 0 ; i < N * 2 ; i++) {
+            if (fabsf(data[i] - data_ref[i]) > 1e-5f * N) {
+                printf("plan N=%i [%i] = %f, expected %f\n", N, i, data[i], data_ref[i]);
+                errors++;
+                break;
+            }
+        }
+    }
+}
+
+int test_fft_tables(void)
+{
+    errors = 0;
+    test_twiddles();
+    test_bitrev();
+    test_plan();
+    printf("FFT const tables (N <= %i): %s\n", MAX_N, errors ? "FAIL" : "OK");
+    return errors;
+}
@@ -0,0 +1,185 @@
+#include <stdio.h>
+#include <string.h>
+#include <math.h>
+
+#include "dsp_common.h"
+#include "dsps_dotprod.h"
+#include "dsps_fir.h"
+#include "dsps_biquad.h"
+#include "dsps_mul.h"
+#include "dsps_fft2r.h"
+
+#define LEN         1024
+#define REPEAT      64
+
+static float x[LEN * 2];
+static float y[LEN * 2];
+static float z[LEN * 2];
+static float z_ansi[LEN * 2];
+static float coeffs[35];
+static float delay[35];
+static float delay_ansi[35];
+
+static int errors;
+
+static void check(const char *name, const float *out, const float *ref, int len, float tol)
+{
+    for (int i = 0 ; i < len ; i++) {
+        if (fabsf(out[i] - ref[i]) > tol) {
+            printf("%s: [%i] = %f, expected %f\n", name, i, out[i], ref[i]);
+            errors++;
+            return;
+        }
+    }
+}
+
+static void report(const char *name, uint32_t t, uint32_t t_ansi)
+{
+    printf("%-24s %10u ns   ansi %10u ns   x%.2f\n", name, (unsigned)t, (unsigned)t_ansi, (float)t_ansi / t);
+}
+
+static void test_dotprod(void)
+{
+    for (int len = 0 ; len < 64 ; len++) {
+        dsps_dotprod_f32_rv32(x, y, &z[0], len);
+        dsps_dotprod_f32_ansi(x, y, &z_ansi[0], len);
+        check("dsps_dotprod_f32_rv32", z, z_ansi, 1, 0);
+    }
+    uint32_t t = dsp_get_cpu_cycle_count();
+    for (int i = 0 ; i < REPEAT ; i++) {
+        dsps_dotprod_f32_rv32(x, y, &z[i], LEN);
+    }
+    t = dsp_get_cpu_cycle_count() - t;
+    uint32_t t_ansi = dsp_get_cpu_cycle_count();
+    for (int i = 0 ; i < REPEAT ; i++) {
+        dsps_dotprod_f32_ansi(x, y, &z_ansi[i], LEN);
+    }
+    t_ansi = dsp_get_cpu_cycle_count() - t_ansi;
+    report("dsps_dotprod_f32", t, t_ansi);
+}
+
+static void test_fir(void)
+{
+    fir_f32_t fir, fir_ansi;
+    for (int fir_len = 1 ; fir_len <= 35 ; fir_len++) {
+        for (int i = 0 ; i < fir_len ; i++) {
+            coeffs[i] = (float)(fir_len - i) / fir_len;
+        }
+        dsps_fir_init_f32(&fir, coeffs, delay, fir_len);
+        dsps_fir_init_f32(&fir_ansi, coeffs, delay_ansi, fir_len);
+        for (int block = 0 ; block < LEN ; block += 97) {
+            int n = (LEN - block) < 97 ? (LEN - block) : 97;
+            dsps_fir_f32_rv32(&fir, &x[block], &z[block], n);
+            dsps_fir_f32_ansi(&fir_ansi, &x[block], &z_ansi[block], n);
+        }
+        check("dsps_fir_f32_rv32", z, z_ansi, LEN, 0);
+    }
+    dsps_fir_init_f32(&fir, coeffs, delay, 32);
+    uint32_t t = dsp_get_cpu_cycle_count();
+    dsps_fir_f32_rv32(&fir, x, z, LEN);
+    t = dsp_get_cpu_cycle_count() - t;
+    uint32_t t_ansi = dsp_get_cpu_cycle_count();
+    dsps_fir_f32_ansi(&fir, x, z, LEN);
+    t_ansi = dsp_get_cpu_cycle_count() - t_ansi;
+    report("dsps_fir_f32 (32 taps)", t, t_ansi);
+}
+
+static void test_biquad(void)
+{
+    float coef[5] = {0.0675f, 0.1349f, 0.0675f, -1.1430f, 0.4128f};
+    float w[2] = {0};
+    float w_ansi[2] = {0};
+
+    dsps_biquad_f32_rv32(x, z, LEN / 2, coef, w);
+    dsps_biquad_f32_rv32(&x[LEN / 2], &z[LEN / 2], LEN / 2, coef, w);
+    dsps_biquad_f32_ansi(x, z_ansi, LEN, coef, w_ansi);
+    check("dsps_biquad_f32_rv32", z, z_ansi, LEN, 0);
+    check("dsps_biquad_f32_rv32 w", w, w_ansi, 2, 0);
+
+    memcpy(z, x, LEN * sizeof(float));
+    w[0] = w[1] = 0;
+    dsps_biquad_f32_rv32(z, z, LEN, coef, w);
+    w_ansi[0] = w_ansi[1] = 0;
+    dsps_biquad_f32_ansi(x, z_ansi, LEN, coef, w_ansi);
+    check("dsps_biquad_f32_rv32 in place", z, z_ansi, LEN, 0);
+
+    uint32_t t = dsp_get_cpu_cycle_count();
+    for (int i = 0 ; i < REPEAT ; i++) {
+        dsps_biquad_f32_rv32(x, z, LEN, coef, w);
+    }
+    t = dsp_get_cpu_cycle_count() - t;
+    uint32_t t_ansi = dsp_get_cpu_cycle_count();
+    for (int i = 0 ; i < REPEAT ; i++) {
+        dsps_biquad_f32_ansi(x, z, LEN, coef, w);
+    }
+    t_ansi = dsp_get_cpu_cycle_count() - t_ansi;
+    report("dsps_biquad_f32", t, t_ansi);
+}
+
+static void test_mul(void)
+{
+    for (int len = 0 ; len < 64 ; len++) {
+        dsps_mul_f32_rv32(x, y, z, len, 1, 1, 1);
+        dsps_mul_f32_ansi(x, y, z_ansi, len, 1, 1, 1);
+        check("dsps_mul_f32_rv32", z, z_ansi, len, 0);
+    }
+    memset(z, 0, sizeof(z));
+    memset(z_ansi, 0, sizeof(z_ansi));
+    dsps_mul_f32_rv32(x, y, z, LEN, 1, 1, 2);
+    dsps_mul_f32_ansi(x, y, z_ansi, LEN, 1, 1, 2);
+    check("dsps_mul_f32_rv32 strided", z, z_ansi, 2 * LEN, 0);
+
+    uint32_t t = dsp_get_cpu_cycle_count();
+    for (int i = 0 ; i < REPEAT ; i++) {
+        dsps_mul_f32_rv32(x, y, z, LEN, 1, 1, 1);
+    }
+    t = dsp_get_cpu_cycle_count() - t;
+    uint32_t t_ansi = dsp_get_cpu_cycle_count();
+    for (int i = 0 ; i < REPEAT ; i++) {
+        dsps_mul_f32_ansi(x, y, z, LEN, 1, 1, 1);
+    }
+    t_ansi = dsp_get_cpu_cycle_count() - t_ansi;
+    report("dsps_mul_f32", t, t_ansi);
+}
+
+static void test_fft2r(void)
+{
+    if (dsps_fft2r_init_fc32(NULL, CONFIG_DSP_MAX_FFT_SIZE) != ESP_OK) {
+        printf("dsps_fft2r_init_fc32 failed\n");
+        errors++;
+        return;
+    }
+    for (int N = 2 ; N <= LEN ; N <<= 1) {
+        memcpy(z, x, N * 2 * sizeof(float));
+        memcpy(z_ansi, x, N * 2 * sizeof(float));
+        dsps_fft2r_fc32_rv32(z, N);
+        dsps_fft2r_fc32_ansi(z_ansi, N);
+        check("dsps_fft2r_fc32_rv32", z, z_ansi, N * 2, 1e-5f * N);
+    }
+    uint32_t t = dsp_get_cpu_cycle_count();
+    for (int i = 0 ; i < REPEAT ; i++) {
+        dsps_fft2r_fc32_rv32(z, LEN);
+    }
+    t = dsp_get_cpu_cycle_count() - t;
+    uint32_t t_ansi = dsp_get_cpu_cycle_count();
+    for (int i = 0 ; i < REPEAT ; i++) {
+        dsps_fft2r_fc32_ansi(z_ansi, LEN);
+    }
+    t_ansi = dsp_get_cpu_cycle_count() - t_ansi;
+    report("dsps_fft2r_fc32 (1024)", t, t_ansi);
+    dsps_fft2r_deinit_fc32();
+}
+
+int test_rv32(void)
+{
+    for (int i = 0 ; i < LEN * 2 ; i++) {
+        x[i] = (float)((i * 37) % 101) / 50.0f - 1.0f;
+        y[i] = (float)((i * 53) % 97) / 48.0f - 1.0f;
+    }
+    test_dotprod();
+    test_fir();
+    test_biquad();
+    test_mul();
+    test_fft2r();
+    return errors;
+}
@@ -0,0 +1,296 @@
+// Fast (FFT) convolution and correlation: overlap-add and overlap-save.
+//
+// Two input blocks are filtered with each complex FFT: block a goes to the
+// real part and block b to the imaginary part. The kernel is real, so its
+// spectrum is hermitian and the product keeps both results separated
+// (a * h in the real part, b * h in the imaginary part). The inverse FFT is
+// done with the forward FFT: ifft(X) = conj(fft(conj(X))) / N, the
+// conjugate and the 1/N are folded into the stored kernel spectrum.
+//
+// The kernel spectrum is kept in bit reversed order (the FFT output order),
+// so only the inverse transform needs the bit reverse passes.
+
+#include <string.h>
+#include <malloc.h>
+#include "dsps_fconv.h"
+#include "dsp_common.h"
+
+static int dsps_fconv_fft_size(int kernlen)
+{
+    // Cost per output sample ~ N * (log2(N) + 1) / (N - M + 1)
+    int best = 0;
+    float best_cost = 0;
+    for (int n = 4; n <= CONFIG_DSP_MAX_FFT_SIZE; n <<= 1) {
+        if (n <= kernlen) {
+            continue;
+        }
+        float cost = (float)n * (dsp_power_of_two(n) + 1) / (n - kernlen + 1);
+        if ((best == 0) || (cost < best_cost)) {
+            best = n;
+            best_cost = cost;
+        }
+    }
+    return best;
+}
+
+static esp_err_t dsps_fconv_init(fconv_f32_t *conv, const float *kernel, int kernlen, dsps_fconv_mode_t mode, int fft_size, bool reverse)
+{
+    if (NULL == conv) {
+        return ESP_ERR_DSP_PARAM_OUTOFRANGE;
+    }
+    // A failed init leaves an empty instance: free is safe, run is rejected
+    memset(conv, 0, sizeof(*conv));
+    if (NULL == kernel) {
+        return ESP_ERR_DSP_PARAM_OUTOFRANGE;
+    }
+    if (kernlen < 1) {
+        return ESP_ERR_DSP_INVALID_LENGTH;
+    }
+    if (fft_size == 0) {
+        fft_size = dsps_fconv_fft_size(kernlen);
+    }
+    if ((fft_size <= kernlen) || !dsp_is_power_of_two(fft_size)) {
+        return ESP_ERR_DSP_INVALID_LENGTH;
+    }
+    esp_err_t ret = dsps_fft2r_plan_init_fc32(&conv->plan, fft_size);
+    if (ret != ESP_OK) {
+        return ret;
+    }
+    conv->mode = mode;
+    conv->kernlen = kernlen;
+    conv->fft_size = fft_size;
+    conv->block_len = fft_size - kernlen + 1;
+    conv->kernel_fft = (float *)malloc(2 * fft_size * sizeof(float));
+    conv->work = (float *)malloc(2 * fft_size * sizeof(float));
+    conv->state = (float *)malloc(kernlen * sizeof(float));
+    if ((conv->kernel_fft == NULL) || (conv->work == NULL) || (conv->state == NULL)) {
+        dsps_fconv_free_f32(conv);
+        return ESP_ERR_DSP_PARAM_OUTOFRANGE;
+    }
+    dsps_fconv_reset_f32(conv);
+
+    // Kernel spectrum, bit reversed order
+    float *h = conv->kernel_fft;
+    memset(h, 0, 2 * fft_size * sizeof(float));
+    for (int i = 0; i < kernlen; i++) {
+        h[2 * i] = reverse ? kernel[kernlen - 1 - i] : kernel[i];
+    }
+    ret = dsps_fft2r_plan_fc32(&conv->plan, h);
+    if (ret != ESP_OK) {
+        dsps_fconv_free_f32(conv);
+        return ret;
+    }
+    float scale = 1.0f / fft_size;
+    for (int i = 0; i < fft_size; i++) {
+        h[2 * i + 0] = h[2 * i + 0] * scale;
+        h[2 * i + 1] = -h[2 * i + 1] * scale;
+    }
+    return ESP_OK;
+}
+
+esp_err_t dsps_fconv_init_f32(fconv_f32_t *conv, const float *kernel, int kernlen, dsps_fconv_mode_t mode, int fft_size)
+{
+    return dsps_fconv_init(conv, kernel, kernlen, mode, fft_size, false);
+}
+
+esp_err_t dsps_fcorr_init_f32(fconv_f32_t *conv, const float *pattern, int patlen, dsps_fconv_mode_t mode, int fft_size)
+{
+    return dsps_fconv_init(conv, pattern, patlen, mode, fft_size, true);
+}
+
+void dsps_fconv_free_f32(fconv_f32_t *conv)
+{
+    free(conv->kernel_fft);
+    free(conv->work);
+    free(conv->state);
+    conv->kernel_fft = NULL;
+    conv->work = NULL;
+    conv->state = NULL;
+}
+
+void dsps_fconv_reset_f32(fconv_f32_t *conv)
+{
+    if (conv->state != NULL) {
+        memset(conv->state, 0, conv->kernlen * sizeof(float));
+    }
+}
+
+// Loads block a (real part) and block b (imaginary part) to the FFT buffer
+static void dsps_fconv_load(fconv_f32_t *conv, const float *in_a, int len_a, const float *in_b, int len_b)
+{
+    float *w = conv->work;
+    int hist = conv->kernlen - 1;
+    int n = conv->fft_size;
+    int i = 0;
+
+    if (conv->mode == DSPS_FCONV_OVERLAP_SAVE) {
+        // a = [history, in_a], b = [last hist samples of a, in_b]
+        for (; i < hist; i++) {
+            w[2 * i] = conv->state[i];
+        }
+        for (; i < hist + len_a; i++) {
+            w[2 * i] = in_a ? in_a[i - hist] : 0;
+        }
+        for (; i < n; i++) {
+            w[2 * i] = 0;
+        }
+        for (i = 0; i < hist; i++) {
+            w[2 * i + 1] = w[2 * (len_a + i)];
+        }
+        for (; i < hist + len_b; i++) {
+            w[2 * i + 1] = in_b ? in_b[i - hist] : 0;
+        }
+        for (; i < n; i++) {
+            w[2 * i + 1] = 0;
+        }
+        // New history: last hist input samples
+        if (len_b > 0) {
+            for (i = 0; i < hist; i++) {
+                conv->state[i] = w[2 * (len_b + i) + 1];
+            }
+        } else {
+            for (i = 0; i < hist; i++) {
+                conv->state[i] = w[2 * (len_a + i)];
+            }
+        }
+    } else {
+        // a and b zero padded
+        for (; i < len_a; i++) {
+            w[2 * i] = in_a ? in_a[i] : 0;
+        }
+        for (; i < n; i++) {
+            w[2 * i] = 0;
+        }
+        for (i = 0; i < len_b; i++) {
+            w[2 * i + 1] = in_b ? in_b[i] : 0;
+        }
+        for (; i < n; i++) {
+            w[2 * i + 1] = 0;
+        }
+    }
+}
+
+// work = ifft(fft(work) * H), without the final conjugate
+static esp_err_t dsps_fconv_filter(fconv_f32_t *conv)
+{
+    float *w = conv->work;
+    const float *h = conv->kernel_fft;
+
+    esp_err_t ret = dsps_fft2r_plan_fc32(&conv->plan, w);
+    if (ret != ESP_OK) {
+        return ret;
+    }
+    // conj(X * H) / N = conj(X) * conj(H) / N, both in bit reversed order
+    for (int k = 0; k < conv->fft_size; k++) {
+        float xr = w[2 * k + 0];
+        float xi = w[2 * k + 1];
+        w[2 * k + 0] = xr * h[2 * k + 0] + xi * h[2 * k + 1];
+        w[2 * k + 1] = xr * h[2 * k + 1] - xi * h[2 * k + 0];
+    }
+    dsps_bit_rev_plan_fc32(&conv->plan, w);
+    ret = dsps_fft2r_plan_fc32(&conv->plan, w);
+    if (ret != ESP_OK) {
+        return ret;
+    }
+    return dsps_bit_rev_plan_fc32(&conv->plan, w);
+}
+
+// Writes the outputs of a block. y[i] = sign * work[2 * (offset + i) + part]
+// Output sample n (stream position) goes to output[n - skip] if n >= skip.
+static void dsps_fconv_store(fconv_f32_t *conv, int part, int len, float *output, int pos, int skip)
+{
+    const float *w = conv->work + part;
+    float sign = part ? -1.0f : 1.0f;
+    int hist = conv->kernlen - 1;
+    float y;
+
+    if (len == 0) {
+        return;
+    }
+    if (conv->mode == DSPS_FCONV_OVERLAP_SAVE) {
+        // The first hist outputs are aliased
+        for (int i = 0; i < len; i++) {
+            if (pos + i >= skip) {
+                output[pos + i - skip] = sign * w[2 * (hist + i)];
+            }
+        }
+    } else {
+        float *tail = conv->state;
+        for (int i = 0; i < len; i++) {
+            y = sign * w[2 * i];
+            if (i < hist) {
+                y += tail[i];
+            }
+            if (pos + i >= skip) {
+                output[pos + i - skip] = y;
+            }
+        }
+        // Tail for the next block (reads ahead of the writes)
+        for (int j = 0; j < hist; j++) {
+            y = (j + len < hist) ? tail[j + len] : 0;
+            tail[j] = y + sign * w[2 * (len + j)];
+        }
+    }
+}
+
+static esp_err_t dsps_fconv_run(fconv_f32_t *conv, const float *input, float *output, int len, int skip)
+{
+    int pos = 0;
+
+    if ((NULL == output) || (NULL == conv->work)) {
+        return ESP_ERR_DSP_PARAM_OUTOFRANGE;
+    }
+    if (conv->block_len <= 0) {
+        return ESP_ERR_DSP_INVALID_LENGTH;
+    }
+    while (pos < len) {
+        int len_a = (len - pos < conv->block_len) ? (len - pos) : conv->block_len;
+        int len_b = (len - pos - len_a < conv->block_len) ? (len - pos - len_a) : conv->block_len;
+
+        dsps_fconv_load(conv, input ? input + pos : NULL, len_a, input ? input + pos + len_a : NULL, len_b);
+        esp_err_t ret = dsps_fconv_filter(conv);
+        if (ret != ESP_OK) {
+            return ret;
+        }
+        dsps_fconv_store(conv, 0, len_a, output, pos, skip);
+        dsps_fconv_store(conv, 1, len_b, output, pos + len_a, skip);
+        pos += len_a + len_b;
+    }
+    return ESP_OK;
+}
+
+esp_err_t dsps_fconv_f32(fconv_f32_t *conv, const float *input, float *output, int len)
+{
+    return dsps_fconv_run(conv, input, output, len, 0);
+}
+
+esp_err_t dsps_conv_fft_f32(fconv_f32_t *conv, const float *Signal, int siglen, float *convout)
+{
+    if ((NULL == Signal) || (NULL == convout)) {
+        return ESP_ERR_DSP_PARAM_OUTOFRANGE;
+    }
+    dsps_fconv_reset_f32(conv);
+    esp_err_t ret = dsps_fconv_run(conv, Signal, convout, siglen, 0);
+    if (ret != ESP_OK) {
+        return ret;
+    }
+    // Tail of the convolution: the kernel over zeros
+    ret = dsps_fconv_run(conv, NULL, convout + siglen, conv->kernlen - 1, 0);
+    dsps_fconv_reset_f32(conv);
+    return ret;
+}
+
+esp_err_t dsps_corr_fft_f32(fconv_f32_t *conv, const float *Signal, int siglen, float *dest)
+{
+    if ((NULL == Signal) || (NULL == dest)) {
+        return ESP_ERR_DSP_PARAM_OUTOFRANGE;
+    }
+    if (siglen < conv->kernlen) {
+        return ESP_ERR_DSP_PARAM_OUTOFRANGE;
+    }
+    dsps_fconv_reset_f32(conv);
+    // dest[n] is the filter output n + patlen - 1
+    esp_err_t ret = dsps_fconv_run(conv, Signal, dest, siglen, conv->kernlen - 1);
+    dsps_fconv_reset_f32(conv);
+    return ret;
+}
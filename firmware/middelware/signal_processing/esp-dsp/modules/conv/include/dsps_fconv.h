@@ -0,0 +1,143 @@
+#ifndef _dsps_fconv_H_
+#define _dsps_fconv_H_
+#include <stdbool.h>
+#include "dsp_err.h"
+#include "dsps_fft2r.h"
+
+#ifdef __cplusplus
+extern "C"
+{
+#endif
+
+/**
+ * @brief   Fast (FFT) convolution method
+ */
+typedef enum {
+    DSPS_FCONV_OVERLAP_ADD = 0,     /*!< Blocks are zero padded, the FFT tails are added to the next blocks */
+    DSPS_FCONV_OVERLAP_SAVE,        /*!< Blocks overlap kernlen - 1 input samples, the aliased outputs are discarded */
+} dsps_fconv_mode_t;
+
+/**
+ * @brief   Fast convolution (FFT) structure
+ *
+ * The kernel spectrum is calculated once by the init function. The structure
+ * keeps the state between calls, so a signal can be processed in pieces of
+ * any length (streaming FIR filter).
+ */
+typedef struct fconv_f32_s {
+    dsps_fconv_mode_t mode;         /*!< Overlap-add or overlap-save */
+    int kernlen;                    /*!< Kernel length (M) */
+    int fft_size;                   /*!< FFT length (N, complex points) */
+    int block_len;                  /*!< Max input samples per FFT block (N - M + 1) */
+    float *kernel_fft;              /*!< conj(FFT(kernel)) / N, in bit reversed order (2 * N floats) */
+    float *work;                    /*!< FFT buffer (2 * N floats) */
+    float *state;                   /*!< Overlap-add tail or overlap-save input history (M - 1 floats) */
+    dsps_fft2r_plan_fc32_t plan;    /*!< FFT plan */
+} fconv_f32_t;
+
+/**@{*/
+/**
+ * @brief   Fast convolution / correlation init
+ *
+ * Allocates the buffers and calculates the spectrum of the kernel.
+ * dsps_fcorr_init_f32() reverses the pattern, so the filter output is the
+ * correlation with the pattern (dsps_corr_f32 / dsps_ccorr_f32).
+ *
+ * The FFT tables must be available: CONFIG_DSP_FFT_CONST_TABLES or
+ * dsps_fft2r_init_fc32() called before.
+ * On error conv is left empty: dsps_fconv_free_f32() may be called and the
+ * processing functions return an error.
+ *
+ * @param conv: pointer to fast convolution structure
+ * @param[in] kernel: kernel (or pattern) array
+ * @param[in] kernlen: kernel length
+ * @param[in] mode: overlap-add or overlap-save
+ * @param[in] fft_size: FFT length (power of two, bigger than kernlen),
+ *                      0 to choose the fastest length for this kernel
+ *
+ * @return
+ *      - ESP_OK on success
+ *      - ESP_ERR_DSP_INVALID_LENGTH if kernlen or fft_size are not valid
+ *      - ESP_ERR_DSP_PARAM_OUTOFRANGE if the buffers can't be allocated
+ *      - One of the error codes from DSP library
+ */
+esp_err_t dsps_fconv_init_f32(fconv_f32_t *conv, const float *kernel, int kernlen, dsps_fconv_mode_t mode, int fft_size);
+esp_err_t dsps_fcorr_init_f32(fconv_f32_t *conv, const float *pattern, int patlen, dsps_fconv_mode_t mode, int fft_size);
+/**@}*/
+
+/**
+ * @brief   Free the buffers allocated by dsps_fconv_init_f32() / dsps_fcorr_init_f32()
+ *
+ * @param conv: pointer to fast convolution structure
+ */
+void dsps_fconv_free_f32(fconv_f32_t *conv);
+
+/**
+ * @brief   Clear the state (start a new signal)
+ *
+ * @param conv: pointer to fast convolution structure
+ */
+void dsps_fconv_reset_f32(fconv_f32_t *conv);
+
+/**
+ * @brief   Streaming FFT FIR filter
+ *
+ * output[n] = sum(kernel[k] * input[n - k]). dsps_fir_f32 applies the
+ * coefficients in reverse order: initialized with dsps_fcorr_init_f32() and
+ * the same coefficients, the result is the same as dsps_fir_f32.
+ * The input can be passed in pieces of any
+ * length, the output is not delayed. Pieces of conv->block_len samples (or
+ * multiples of it) make the best use of each FFT.
+ *
+ * @param conv: pointer to fast convolution structure
+ * @param[in] input: input array (NULL: zeros)
+ * @param[out] output: output array (len samples)
+ * @param[in] len: number of samples
+ *
+ * @return
+ *      - ESP_OK on success
+ *      - One of the error codes from DSP library
+ */
+esp_err_t dsps_fconv_f32(fconv_f32_t *conv, const float *input, float *output, int len);
+
+/**
+ * @brief   Convolution using the FFT
+ *
+ * Same result as dsps_conv_f32(Signal, siglen, kernel, kernlen, convout)
+ * (or dsps_ccorr_f32() if conv was initialized with dsps_fcorr_init_f32).
+ * The state of conv is cleared.
+ *
+ * @param conv: pointer to fast convolution structure
+ * @param[in] Signal: input array with signal
+ * @param[in] siglen: length of the input signal
+ * @param[out] convout: output array of siglen + kernlen - 1 samples
+ *
+ * @return
+ *      - ESP_OK on success
+ *      - One of the error codes from DSP library
+ */
+esp_err_t dsps_conv_fft_f32(fconv_f32_t *conv, const float *Signal, int siglen, float *convout);
+
+/**
+ * @brief   Correlation with pattern using the FFT
+ *
+ * Same result as dsps_corr_f32(Signal, siglen, pattern, patlen, dest).
+ * conv must be initialized with dsps_fcorr_init_f32(). The state of conv is
+ * cleared.
+ *
+ * @param conv: pointer to fast convolution structure
+ * @param[in] Signal: input array with signal
+ * @param[in] siglen: length of the signal array (bigger than patlen)
+ * @param[out] dest: output array of siglen - patlen + 1 samples
+ *
+ * @return
+ *      - ESP_OK on success
+ *      - One of the error codes from DSP library
+ */
+esp_err_t dsps_corr_fft_f32(fconv_f32_t *conv, const float *Signal, int siglen, float *dest);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif // _dsps_fconv_H_
@@ -0,0 +1,113 @@
+// Tests for the FFT (overlap-add / overlap-save) convolution and correlation.
+
+#include <string.h>
+#include <math.h>
+#include <malloc.h>
+#include "unity.h"
+#include "esp_dsp.h"
+#include "dsp_platform.h"
+#include "esp_log.h"
+
+#include "dsps_fconv.h"
+#include "dsp_tests.h"
+
+static const char *TAG = "dsps_fconv";
+
+#define lenSig  1000
+#define lenKern 100
+
+static float signal[lenSig];
+static float kernel[lenKern];
+static float output[lenSig + lenKern];
+static float output_ref[lenSig + lenKern];
+
+static void dsps_fconv_check(const float *out, const float *ref, int len)
+{
+    for (int i = 0 ; i < len ; i++) {
+        if (fabsf(out[i] - ref[i]) > 1e-4f * (1 + fabsf(ref[i]))) {
+            ESP_LOGE(TAG, "output[%i] = %f, expected %f", i, out[i], ref[i]);
+            TEST_ASSERT_EQUAL(ref[i], out[i]);
+        }
+    }
+}
+
+static void dsps_fconv_test_mode(dsps_fconv_mode_t mode)
+{
+    fconv_f32_t conv;
+    fir_f32_t fir;
+    float *delay = (float *)malloc((lenKern + 4) * sizeof(float));
+    TEST_ASSERT_NOT_NULL(delay);
+
+    TEST_ESP_OK(dsps_fft2r_init_fc32(NULL, CONFIG_DSP_MAX_FFT_SIZE));
+    for (int i = 0 ; i < lenSig ; i++) {
+        signal[i] = (float)((i * 37) % 101) / 50.0f - 1.0f;
+    }
+    for (int i = 0 ; i < lenKern ; i++) {
+        kernel[i] = (float)((i * 53) % 97) / 48.0f - 1.0f;
+    }
+
+    TEST_ESP_OK(dsps_fconv_init_f32(&conv, kernel, lenKern, mode, 0));
+    TEST_ESP_OK(dsps_conv_fft_f32(&conv, signal, lenSig, output));
+    dsps_conv_f32_ansi(signal, lenSig, kernel, lenKern, output_ref);
+    dsps_fconv_check(output, output_ref, lenSig + lenKern - 1);
+    dsps_fconv_free_f32(&conv);
+
+    TEST_ESP_OK(dsps_fcorr_init_f32(&conv, kernel, lenKern, mode, 256));
+    TEST_ESP_OK(dsps_conv_fft_f32(&conv, signal, lenSig, output));
+    dsps_ccorr_f32_ansi(signal, lenSig, kernel, lenKern, output_ref);
+    dsps_fconv_check(output, output_ref, lenSig + lenKern - 1);
+
+    TEST_ESP_OK(dsps_corr_fft_f32(&conv, signal, lenSig, output));
+    dsps_corr_f32_ansi(signal, lenSig, kernel, lenKern, output_ref);
+    dsps_fconv_check(output, output_ref, lenSig - lenKern + 1);
+
+    // Streaming, pieces of different lengths: same as the FIR filter
+    dsps_fir_init_f32(&fir, kernel, delay, lenKern);
+    dsps_fir_f32_ansi(&fir, signal, output_ref, lenSig);
+    for (int pos = 0, len = 1 ; pos < lenSig ; pos += len, len = len * 3 + 1) {
+        if (len > lenSig - pos) {
+            len = lenSig - pos;
+        }
+        TEST_ESP_OK(dsps_fconv_f32(&conv, &signal[pos], &output[pos], len));
+    }
+    dsps_fconv_check(output, output_ref, lenSig);
+    dsps_fconv_free_f32(&conv);
+
+    free(delay);
+    dsps_fft2r_deinit_fc32();
+}
+
+TEST_CASE("dsps_fconv_f32 overlap-add functionality", "[dsps]")
+{
+    dsps_fconv_test_mode(DSPS_FCONV_OVERLAP_ADD);
+}
+
+TEST_CASE("dsps_fconv_f32 overlap-save functionality", "[dsps]")
+{
+    dsps_fconv_test_mode(DSPS_FCONV_OVERLAP_SAVE);
+}
+
+TEST_CASE("dsps_fconv_f32 benchmark", "[dsps]")
+{
+    fconv_f32_t conv;
+    fir_f32_t fir;
+    float *delay = (float *)malloc((lenKern + 4) * sizeof(float));
+    TEST_ASSERT_NOT_NULL(delay);
+
+    TEST_ESP_OK(dsps_fft2r_init_fc32(NULL, CONFIG_DSP_MAX_FFT_SIZE));
+    TEST_ESP_OK(dsps_fcorr_init_f32(&conv, kernel, lenKern, DSPS_FCONV_OVERLAP_SAVE, 0));
+    dsps_fir_init_f32(&fir, kernel, delay, lenKern);
+
+    unsigned int start_b = dsp_get_cpu_cycle_count();
+    dsps_fir_f32(&fir, signal, output_ref, lenSig);
+    unsigned int direct = dsp_get_cpu_cycle_count() - start_b;
+    start_b = dsp_get_cpu_cycle_count();
+    dsps_fconv_f32(&conv, signal, output, lenSig);
+    unsigned int fft = dsp_get_cpu_cycle_count() - start_b;
+    ESP_LOGI(TAG, "%i samples, %i taps: dsps_fir_f32 %u cycles, dsps_fconv_f32 (N=%i) %u cycles",
+             lenSig, lenKern, direct, conv.fft_size, fft);
+
+    dsps_fconv_free_f32(&conv);
+    free(delay);
+    dsps_fft2r_deinit_fc32();
+}
@@ -0,0 +1,32 @@
+// Dot product for RISC-V cores (ESP32-C6).
+//
+// The loop is unrolled by 4 to remove most of the branch and index overhead.
+// A single accumulator is kept, so the summation order (and the result) is
+// the same as dsps_dotprod_f32_ansi().
+
+#include "dsps_dotprod.h"
+
+#if (dsps_dotprod_f32_rv32_enabled == 1)
+
+esp_err_t dsps_dotprod_f32_rv32(const float *src1, const float *src2, float *dest, int len)
+{
+    float acc = 0;
+    const float *end4 = src1 + (len & ~3);
+    const float *end = src1 + len;
+
+    while (src1 < end4) {
+        acc += src1[0] * src2[0];
+        acc += src1[1] * src2[1];
+        acc += src1[2] * src2[2];
+        acc += src1[3] * src2[3];
+        src1 += 4;
+        src2 += 4;
+    }
+    while (src1 < end) {
+        acc += *src1++ * *src2++;
+    }
+    *dest = acc;
+    return ESP_OK;
+}
+
+#endif // dsps_dotprod_f32_rv32_enabled
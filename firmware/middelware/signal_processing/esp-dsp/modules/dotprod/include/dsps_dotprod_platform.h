@@ -23,6 +23,12 @@
 #endif // __XTENSA__
 
 
+#ifdef __riscv
+
+#define dsps_dotprod_f32_rv32_enabled 1
+
+#endif // __riscv
+
 #if CONFIG_IDF_TARGET_ESP32S3
 #define dsps_dotprod_s16_aes3_enabled 1
 #define dsps_dotprod_f32_aes3_enabled 1
@@ -0,0 +1,81 @@
+// Tests for the RISC-V dot product (ESP32-C6).
+// The result must be bit exact with dsps_dotprod_f32_ansi().
+
+#include <string.h>
+#include "unity.h"
+#include "esp_dsp.h"
+#include "dsp_platform.h"
+#include "esp_log.h"
+#include <malloc.h>
+
+#include "dsps_dotprod.h"
+#include "dsp_tests.h"
+
+#if (dsps_dotprod_f32_rv32_enabled == 1)
+
+static const char *TAG = "dsps_dotprod_f32_rv32";
+
+TEST_CASE("dsps_dotprod_f32_rv32 functionality", "[dsps]")
+{
+    int max_N = 1024;
+    float *x = (float *)malloc(max_N * sizeof(float));
+    float *y = (float *)malloc(max_N * sizeof(float));
+    float z[3];
+    float z_ansi;
+
+    for (int i = 0 ; i < max_N ; i++) {
+        x[i] = (float)((i * 37) % 101) / 50.0f - 1.0f;
+        y[i] = (float)((i * 53) % 97) / 48.0f - 1.0f;
+    }
+    z[0] = 1235;
+    z[2] = 1236;
+    // All the tails of the unrolled loop
+    for (int i = 0 ; i < max_N ; i++) {
+        esp_err_t status = dsps_dotprod_f32_rv32(x, y, &z[1], i);
+        TEST_ASSERT_EQUAL(status, ESP_OK);
+        dsps_dotprod_f32_ansi(x, y, &z_ansi, i);
+        TEST_ASSERT_EQUAL(1235, z[0]);
+        TEST_ASSERT_EQUAL(1236, z[2]);
+        if (z[1] != z_ansi) {
+            TEST_ASSERT_EQUAL(z_ansi, z[1]);
+        }
+    }
+    free(x);
+    free(y);
+}
+
+TEST_CASE("dsps_dotprod_f32_rv32 benchmark", "[dsps]")
+{
+    int max_N = 1024;
+    int repeat_count = 64;
+    float *x = (float *)malloc(max_N * sizeof(float));
+    float *y = (float *)malloc(max_N * sizeof(float));
+    float z;
+
+    for (int i = 0 ; i < max_N ; i++) {
+        x[i] = i;
+        y[i] = 1000;
+    }
+
+    unsigned int start_b = dsp_get_cpu_cycle_count();
+    for (int i = 0 ; i < repeat_count ; i++) {
+        dsps_dotprod_f32_rv32(x, y, &z, max_N);
+    }
+    float cycles = (float)(dsp_get_cpu_cycle_count() - start_b) / repeat_count;
+
+    start_b = dsp_get_cpu_cycle_count();
+    for (int i = 0 ; i < repeat_count ; i++) {
+        dsps_dotprod_f32_ansi(x, y, &z, max_N);
+    }
+    float cycles_ansi = (float)(dsp_get_cpu_cycle_count() - start_b) / repeat_count;
+
+    ESP_LOGI(TAG, "dsps_dotprod_f32_rv32 - %f cycles per 1024 samples", cycles);
+    ESP_LOGI(TAG, "dsps_dotprod_f32_ansi - %f cycles per 1024 samples", cycles_ansi);
+    // Must not be slower than the ANSI version (10% margin for cache effects)
+    TEST_ASSERT_EXEC_IN_RANGE(1024, cycles_ansi * 1.1f, cycles);
+
+    free(x);
+    free(y);
+}
+
+#endif // dsps_dotprod_f32_rv32_enabled
@@ -49,6 +49,15 @@ esp_err_t dsps_fft2r_init_fc32(float *fft_table_buff, int table_size)
     if (table_size == 0) {
         return result;
     }
+#if CONFIG_DSP_FFT_CONST_TABLES
+    // Tables generated at build time: nothing to allocate or calculate
+    if ((fft_table_buff == NULL) && (table_size <= dsps_fft2r_w_table_fc32_const_size)) {
+        dsps_fft_w_table_fc32 = (float *)dsps_fft2r_w_table_fc32_const;
+        dsps_fft_w_table_size = table_size;
+        dsps_fft2r_initialized = 1;
+        return ESP_OK;
+    }
+#endif // CONFIG_DSP_FFT_CONST_TABLES
     if (fft_table_buff != NULL) {
         if (dsps_fft2r_mem_allocated) {
             return ESP_ERR_DSP_REINITIALIZED;
@@ -116,6 +125,7 @@ void dsps_fft2r_deinit_fc32()
     }
     // Re init bitrev table for next use
     dsps_fft2r_rev_tables_init_fc32();
+    dsps_fft_w_table_fc32 = NULL;
     dsps_fft2r_mem_allocated = 0;
     dsps_fft2r_initialized = 0;
 }
@@ -125,7 +135,7 @@ esp_err_t dsps_fft2r_fc32_ansi_(float *data, int N, float *w)
     if (!dsp_is_power_of_two(N)) {
         return ESP_ERR_DSP_INVALID_LENGTH;
     }
-    if (!dsps_fft2r_initialized) {
+    if (w == NULL) {
         return ESP_ERR_DSP_UNINITIALIZED;
     }
 
@@ -0,0 +1,62 @@
+// Complex radix-2 FFT for RISC-V cores (ESP32-C6).
+//
+// Same algorithm and twiddle table as dsps_fft2r_fc32_ansi_(), with pointer
+// based butterflies. The first butterfly group of every stage uses the twiddle
+// w = 1 + 0j, so it is computed without multiplications (about 2/log2(N) of
+// all the butterflies, 20% for N = 1024).
+
+#include "dsps_fft2r.h"
+#include "dsp_common.h"
+#include "dsp_types.h"
+
+#if (dsps_fft2r_fc32_rv32_enabled == 1)
+
+esp_err_t dsps_fft2r_fc32_rv32_(float *data, int N, float *w)
+{
+    if (!dsp_is_power_of_two(N)) {
+        return ESP_ERR_DSP_INVALID_LENGTH;
+    }
+    if (w == NULL) {
+        return ESP_ERR_DSP_UNINITIALIZED;
+    }
+
+    int ie = 1;
+    for (int N2 = N / 2; N2 > 0; N2 >>= 1) {
+        float *p = data;
+        float *q = data + 2 * N2;
+        float *end = q;
+
+        // Group 0: w = 1 + 0j
+        while (p < end) {
+            float re = q[0];
+            float im = q[1];
+            q[0] = p[0] - re;
+            q[1] = p[1] - im;
+            p[0] = p[0] + re;
+            p[1] = p[1] + im;
+            p += 2;
+            q += 2;
+        }
+        for (int j = 1; j < ie; j++) {
+            const float c = w[2 * j];
+            const float s = w[2 * j + 1];
+            p = q;
+            q = p + 2 * N2;
+            end = q;
+            while (p < end) {
+                float re = c * q[0] + s * q[1];
+                float im = c * q[1] - s * q[0];
+                q[0] = p[0] - re;
+                q[1] = p[1] - im;
+                p[0] = p[0] + re;
+                p[1] = p[1] + im;
+                p += 2;
+                q += 2;
+            }
+        }
+        ie <<= 1;
+    }
+    return ESP_OK;
+}
+
+#endif // dsps_fft2r_fc32_rv32_enabled
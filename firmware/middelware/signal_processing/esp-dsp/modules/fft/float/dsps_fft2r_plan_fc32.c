@@ -0,0 +1,51 @@
+// Radix-2 FFT plans.
+//
+// A plan only holds pointers to read only tables. With
+// CONFIG_DSP_FFT_CONST_TABLES they are the tables generated at build time
+// (tools/gen_fft2r_tables_fc32.py), so a plan costs nothing to create and
+// doesn't depend on the global state of dsps_fft2r_init_fc32().
+
+#include "dsps_fft2r.h"
+#include "dsp_common.h"
+
+esp_err_t dsps_fft2r_plan_init_fc32(dsps_fft2r_plan_fc32_t *plan, int N)
+{
+    if (!dsp_is_power_of_two(N)) {
+        return ESP_ERR_DSP_INVALID_LENGTH;
+    }
+    int pow = dsp_power_of_two(N);
+#if CONFIG_DSP_FFT_CONST_TABLES
+    if (N > dsps_fft2r_w_table_fc32_const_size) {
+        return ESP_ERR_DSP_INVALID_LENGTH;
+    }
+    plan->N = N;
+    plan->w = (float *)dsps_fft2r_w_table_fc32_const;
+    plan->rev_table = (uint16_t *)dsps_fft2r_rev_tables_fc32_const[pow];
+    plan->rev_table_size = dsps_fft2r_rev_tables_fc32_const_size[pow];
+#else
+    if (!dsps_fft2r_initialized) {
+        return ESP_ERR_DSP_UNINITIALIZED;
+    }
+    if (N > dsps_fft_w_table_size) {
+        return ESP_ERR_DSP_INVALID_LENGTH;
+    }
+    plan->N = N;
+    plan->w = dsps_fft_w_table_fc32;
+    if ((pow > 3) && (pow < 13)) {
+        plan->rev_table = dsps_fft2r_rev_tables_fc32[pow - 4];
+        plan->rev_table_size = dsps_fft2r_rev_tables_fc32_size[pow - 4];
+    } else {
+        plan->rev_table = NULL;
+        plan->rev_table_size = 0;
+    }
+#endif // CONFIG_DSP_FFT_CONST_TABLES
+    return ESP_OK;
+}
+
+esp_err_t dsps_bit_rev_plan_fc32(const dsps_fft2r_plan_fc32_t *plan, float *data)
+{
+    if (plan->rev_table == NULL) {
+        return dsps_bit_rev_fc32(data, plan->N);
+    }
+    return dsps_bit_rev_lookup_fc32(data, plan->rev_table_size, plan->rev_table);
+}
@@ -33,6 +33,19 @@ extern float *dsps_fft_w_table_fc32;
 extern int dsps_fft_w_table_size;
 extern uint8_t dsps_fft2r_initialized;
 
+/**
+ * @brief      Radix-2 FFT plan
+ *
+ * Tables used by a FFT of a given length. Plans don't use the global tables
+ * (dsps_fft_w_table_fc32), so several lengths and users can coexist.
+ */
+typedef struct {
+    int N;                  /*!< Number of complex points */
+    float *w;               /*!< Twiddle table (read only) */
+    uint16_t *rev_table;    /*!< Bit reverse table (read only), NULL: direct bit reverse */
+    int rev_table_size;     /*!< Number of pairs in rev_table */
+} dsps_fft2r_plan_fc32_t;
+
 extern int16_t *dsps_fft_w_table_sc16;
 extern int dsps_fft_w_table_sc16_size;
 extern uint8_t dsps_fft2r_sc16_initialized;
@@ -81,6 +94,7 @@ void dsps_fft2r_deinit_sc16(void);
  * Complex FFT of radix 2
  * The extension (_ansi) use ANSI C and could be compiled and run on any platform.
  * The extension (_ae32) is optimized for ESP32 chip.
+ * The extension (_rv32) is optimized for RISC-V chips (ESP32-C6).
  *
  * @param[inout] data: input/output complex array. An elements located: Re[0], Im[0], ... Re[N-1], Im[N-1]
  *               result of FFT will be stored to this array.
@@ -94,6 +108,7 @@ void dsps_fft2r_deinit_sc16(void);
 esp_err_t dsps_fft2r_fc32_ansi_(float *data, int N, float *w);
 esp_err_t dsps_fft2r_fc32_ae32_(float *data, int N, float *w);
 esp_err_t dsps_fft2r_fc32_aes3_(float *data, int N, float *w);
+esp_err_t dsps_fft2r_fc32_rv32_(float *data, int N, float *w);
 esp_err_t dsps_fft2r_sc16_ansi_(int16_t *data, int N, int16_t *w);
 esp_err_t dsps_fft2r_sc16_ae32_(int16_t *data, int N, int16_t *w);
 esp_err_t dsps_fft2r_sc16_aes3_(int16_t *data, int N, int16_t *w);
@@ -105,6 +120,7 @@ esp_err_t dsps_fft2r_sc16_aes3_(int16_t *data, int N, int16_t *w);
 #define dsps_fft2r_sc16_ae32(data, N) dsps_fft2r_sc16_ae32_(data, N, dsps_fft_w_table_sc16)
 #define dsps_fft2r_sc16_aes3(data, N) dsps_fft2r_sc16_aes3_(data, N, dsps_fft_w_table_sc16)
 #define dsps_fft2r_fc32_ansi(data, N) dsps_fft2r_fc32_ansi_(data, N, dsps_fft_w_table_fc32)
+#define dsps_fft2r_fc32_rv32(data, N) dsps_fft2r_fc32_rv32_(data, N, dsps_fft_w_table_fc32)
 #define dsps_fft2r_sc16_ansi(data, N) dsps_fft2r_sc16_ansi_(data, N, dsps_fft_w_table_sc16)
 
 
@@ -198,6 +214,40 @@ esp_err_t dsps_cplx2real256_fc32_ansi(float *data);
 
 esp_err_t dsps_gen_bitrev2r_table(int N, int step, char *name_ext);
 
+/**@{*/
+/**
+ * @brief      init radix-2 FFT plan
+ *
+ * Sets the tables of a plan for N points. With CONFIG_DSP_FFT_CONST_TABLES
+ * the plan points to the constant tables in flash: no heap, no calculation
+ * and dsps_fft2r_init_fc32() is not needed. Otherwise the plan uses the
+ * tables of dsps_fft2r_init_fc32(), that must be called first.
+ *
+ * @param[out] plan: plan to initialize
+ * @param[in] N: Number of complex points (power of two, up to CONFIG_DSP_MAX_FFT_SIZE)
+ *
+ * @return
+ *      - ESP_OK on success
+ *      - ESP_ERR_DSP_INVALID_LENGTH if N is not a power of two or bigger than the tables
+ *      - ESP_ERR_DSP_UNINITIALIZED if there are no tables
+ */
+esp_err_t dsps_fft2r_plan_init_fc32(dsps_fft2r_plan_fc32_t *plan, int N);
+/**@}*/
+
+/**@{*/
+/**
+ * @brief      bit reverse operation with the table of a plan
+ *
+ * @param[in] plan: plan initialized with dsps_fft2r_plan_init_fc32()
+ * @param[inout] data: complex array of plan->N elements
+ *
+ * @return
+ *      - ESP_OK on success
+ *      - One of the error codes from DSP library
+ */
+esp_err_t dsps_bit_rev_plan_fc32(const dsps_fft2r_plan_fc32_t *plan, float *data);
+/**@}*/
+
 #ifdef __cplusplus
 }
 #endif
@@ -210,10 +260,22 @@ esp_err_t dsps_gen_bitrev2r_table(int N, int step, char *name_ext);
 #define dsps_fft2r_fc32 dsps_fft2r_fc32_aes3
 #elif (dsps_fft2r_fc32_ae32_enabled == 1)
 #define dsps_fft2r_fc32 dsps_fft2r_fc32_ae32
+#elif (dsps_fft2r_fc32_rv32_enabled == 1)
+#define dsps_fft2r_fc32 dsps_fft2r_fc32_rv32
 #else
 #define dsps_fft2r_fc32 dsps_fft2r_fc32_ansi
 #endif
 
+#if (dsps_fft2r_fc32_aes3_enabled == 1)
+#define dsps_fft2r_plan_fc32(plan, data) dsps_fft2r_fc32_aes3_(data, (plan)->N, (plan)->w)
+#elif (dsps_fft2r_fc32_ae32_enabled == 1)
+#define dsps_fft2r_plan_fc32(plan, data) dsps_fft2r_fc32_ae32_(data, (plan)->N, (plan)->w)
+#elif (dsps_fft2r_fc32_rv32_enabled == 1)
+#define dsps_fft2r_plan_fc32(plan, data) dsps_fft2r_fc32_rv32_(data, (plan)->N, (plan)->w)
+#else
+#define dsps_fft2r_plan_fc32(plan, data) dsps_fft2r_fc32_ansi_(data, (plan)->N, (plan)->w)
+#endif
+
 #if (dsps_fft2r_sc16_aes3_enabled == 1)
 #define dsps_fft2r_sc16 dsps_fft2r_sc16_aes3
 #elif (dsps_fft2r_sc16_ae32_enabled == 1)
@@ -235,6 +297,8 @@ esp_err_t dsps_gen_bitrev2r_table(int N, int step, char *name_ext);
 #else // CONFIG_DSP_OPTIMIZED
 
 #define dsps_fft2r_fc32 dsps_fft2r_fc32_ansi
+#define dsps_fft2r_plan_fc32(plan, data) dsps_fft2r_fc32_ansi_(data, (plan)->N, (plan)->w)
+#define dsps_fft2r_sc16 dsps_fft2r_sc16_ansi
 #define dsps_bit_rev_fc32 dsps_bit_rev_fc32_ansi
 #define dsps_cplx2reC_fc32 dsps_cplx2reC_fc32_ansi
 #define dsps_bit_rev_sc16 dsps_bit_rev_sc16_ansi
@@ -27,6 +27,12 @@
 #endif //
 #endif // __XTENSA__
 
+#ifdef __riscv
+
+#define dsps_fft2r_fc32_rv32_enabled 1
+
+#endif // __riscv
+
 #if CONFIG_IDF_TARGET_ESP32S3
 #define dsps_fft2r_fc32_aes3_enabled 1
 #define dsps_fft2r_sc16_aes3_enabled 1
@@ -78,6 +78,15 @@ extern const uint16_t bitrev4r_table_2048_fc32_size;
 extern const uint16_t bitrev4r_table_4096_fc32[];
 extern const uint16_t bitrev4r_table_4096_fc32_size;
 
+// Constant tables generated at build time by tools/gen_fft2r_tables_fc32.py
+// (CONFIG_DSP_FFT_CONST_TABLES): twiddles for CONFIG_DSP_MAX_FFT_SIZE points
+// and bit reverse tables indexed by log2(N) (NULL for N < 16)
+extern const float dsps_fft2r_w_table_fc32_const[];
+extern const int dsps_fft2r_w_table_fc32_const_size;
+extern const uint16_t *const dsps_fft2r_rev_tables_fc32_const[];
+extern const uint16_t dsps_fft2r_rev_tables_fc32_const_size[];
+extern const int dsps_fft2r_rev_tables_fc32_const_count;
+
 void dsps_fft4r_rev_tables_init_fc32(void);
 extern uint16_t *dsps_fft4r_rev_tables_fc32[];
 extern const uint16_t dsps_fft4r_rev_tables_fc32_size[];
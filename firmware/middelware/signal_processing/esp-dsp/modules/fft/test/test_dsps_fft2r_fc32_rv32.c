@@ -0,0 +1,74 @@
+// Tests for the RISC-V radix-2 FFT (ESP32-C6).
+
+#include <string.h>
+#include <math.h>
+#include "unity.h"
+#include "esp_dsp.h"
+#include "dsp_platform.h"
+#include "esp_log.h"
+
+#include "dsps_fft2r.h"
+#include "dsp_tests.h"
+
+#if (dsps_fft2r_fc32_rv32_enabled == 1)
+
+static const char *TAG = "fft2r_rv32";
+
+static float data[1024 * 2];
+static float check_data[1024 * 2];
+
+TEST_CASE("dsps_fft2r_fc32_rv32 functionality", "[dsps]")
+{
+    esp_err_t ret = dsps_fft2r_init_fc32(NULL, CONFIG_DSP_MAX_FFT_SIZE);
+    TEST_ESP_OK(ret);
+
+    for (int N = 4 ; N <= 1024 ; N <<= 1) {
+        for (int i = 0 ; i < N ; i++) {
+            data[i * 2 + 0] = (float)((i * 37) % 101) / 50.0f - 1.0f;
+            data[i * 2 + 1] = (float)((i * 53) % 97) / 48.0f - 1.0f;
+        }
+        memcpy(check_data, data, N * 2 * sizeof(float));
+
+        TEST_ESP_OK(dsps_fft2r_fc32_rv32(data, N));
+        dsps_fft2r_fc32_ansi(check_data, N);
+
+        for (int i = 0 ; i < N * 2 ; i++) {
+            if (fabsf(check_data[i] - data[i]) > 1e-5f * N) {
+                ESP_LOGE(TAG, "N=%i Data[%i] =%f, %f", N, i, data[i], check_data[i]);
+                TEST_ASSERT_EQUAL(check_data[i], data[i]);
+            }
+        }
+    }
+    TEST_ASSERT_EQUAL(ESP_ERR_DSP_INVALID_LENGTH, dsps_fft2r_fc32_rv32(data, 100));
+    dsps_fft2r_deinit_fc32();
+}
+
+TEST_CASE("dsps_fft2r_fc32_rv32 benchmark", "[dsps]")
+{
+    esp_err_t ret = dsps_fft2r_init_fc32(NULL, CONFIG_DSP_MAX_FFT_SIZE);
+    TEST_ESP_OK(ret);
+
+    for (int i = 5 ; i < 10 ; i++) {
+        int N_check = 2 << i;
+        for (int i = 0 ; i < N_check ; i++) {
+            data[i * 2 + 0] = 4 * sinf(M_PI / N_check * 32 * 2 * i) / (N_check / 2);
+            data[i * 2 + 1] = 0;
+        }
+        memcpy(check_data, data, N_check * 2 * sizeof(float));
+
+        unsigned int start_b = dsp_get_cpu_cycle_count();
+        dsps_fft2r_fc32_rv32(data, N_check);
+        float cycles = dsp_get_cpu_cycle_count() - start_b;
+
+        start_b = dsp_get_cpu_cycle_count();
+        dsps_fft2r_fc32_ansi(check_data, N_check);
+        float cycles_ansi = dsp_get_cpu_cycle_count() - start_b;
+
+        ESP_LOGI(TAG, "Benchmark dsps_fft2r_fc32_rv32 - %6i cycles for %6i points FFT (ansi %6i).", (int)cycles, N_check, (int)cycles_ansi);
+        // Must not be slower than the ANSI version (10% margin for cache effects)
+        TEST_ASSERT_EXEC_IN_RANGE(3, cycles_ansi * 1.1f, cycles);
+    }
+    dsps_fft2r_deinit_fc32();
+}
+
+#endif // dsps_fft2r_fc32_rv32_enabled
@@ -0,0 +1,64 @@
+// Tests for the radix-2 FFT plans and the build time (flash) FFT tables.
+
+#include <string.h>
+#include <math.h>
+#include "unity.h"
+#include "esp_dsp.h"
+#include "dsp_platform.h"
+#include "esp_log.h"
+#include "esp_system.h"
+
+#include "dsps_fft2r.h"
+#include "dsp_tests.h"
+
+static const char *TAG = "fft2r_plan";
+
+static float data[1024 * 2];
+static float check_data[1024 * 2];
+
+TEST_CASE("dsps_fft2r_plan_fc32 functionality", "[dsps]")
+{
+    dsps_fft2r_plan_fc32_t plan;
+
+    TEST_ESP_OK(dsps_fft2r_init_fc32(NULL, CONFIG_DSP_MAX_FFT_SIZE));
+    for (int N = 4 ; N <= 1024 ; N <<= 1) {
+        for (int i = 0 ; i < N ; i++) {
+            data[i * 2 + 0] = (float)((i * 37) % 101) / 50.0f - 1.0f;
+            data[i * 2 + 1] = (float)((i * 53) % 97) / 48.0f - 1.0f;
+        }
+        memcpy(check_data, data, N * 2 * sizeof(float));
+
+        TEST_ESP_OK(dsps_fft2r_plan_init_fc32(&plan, N));
+        TEST_ESP_OK(dsps_fft2r_plan_fc32(&plan, data));
+        TEST_ESP_OK(dsps_bit_rev_plan_fc32(&plan, data));
+        dsps_fft2r_fc32(check_data, N);
+        dsps_bit_rev_fc32(check_data, N);
+
+        for (int i = 0 ; i < N * 2 ; i++) {
+            if (fabsf(check_data[i] - data[i]) > 1e-5f * N) {
+                ESP_LOGE(TAG, "N=%i Data[%i] =%f, %f", N, i, data[i], check_data[i]);
+                TEST_ASSERT_EQUAL(check_data[i], data[i]);
+            }
+        }
+    }
+    TEST_ASSERT_EQUAL(ESP_ERR_DSP_INVALID_LENGTH, dsps_fft2r_plan_init_fc32(&plan, 100));
+    dsps_fft2r_deinit_fc32();
+}
+
+#if CONFIG_DSP_FFT_CONST_TABLES
+TEST_CASE("dsps_fft2r_plan_fc32 const tables", "[dsps]")
+{
+    dsps_fft2r_plan_fc32_t plan;
+
+    // No heap and no global init needed
+    uint32_t heap = esp_get_free_heap_size();
+    unsigned int start_b = dsp_get_cpu_cycle_count();
+    TEST_ESP_OK(dsps_fft2r_plan_init_fc32(&plan, CONFIG_DSP_MAX_FFT_SIZE));
+    TEST_ESP_OK(dsps_fft2r_init_fc32(NULL, CONFIG_DSP_MAX_FFT_SIZE));
+    unsigned int cycles = dsp_get_cpu_cycle_count() - start_b;
+    ESP_LOGI(TAG, "FFT init (%i points): %u cycles", CONFIG_DSP_MAX_FFT_SIZE, cycles);
+    TEST_ASSERT_EQUAL(heap, esp_get_free_heap_size());
+    TEST_ASSERT_EQUAL_PTR(dsps_fft2r_w_table_fc32_const, plan.w);
+    dsps_fft2r_deinit_fc32();
+}
+#endif // CONFIG_DSP_FFT_CONST_TABLES
@@ -0,0 +1,104 @@
+#!/usr/bin/env python3
+#
+# Generates the constant (flash) tables of the radix-2 FFT:
+#
+#   - Twiddle table for max_fft_size points, in the same order as
+#     dsps_gen_w_r2_fc32() + dsps_bit_rev_fc32_ansi() build it at run time.
+#     A FFT of N <= max_fft_size points uses the first N floats of the table.
+#   - Bit reverse swap tables (byte offsets, as dsps_gen_bitrev2r_table()) for
+#     every power of two from 16 to max_fft_size points.
+#
+# Usage: gen_fft2r_tables_fc32.py max_fft_size output.c
+
+import math
+import struct
+import sys
+
+BITREV_MIN_SIZE = 16
+BYTES_PER_ITEM = 8          # complex float
+
+
+def to_float32(value):
+    return struct.unpack('f', struct.pack('f', value))[0]
+
+
+def bit_reverse(index, bits):
+    result = 0
+    for _ in range(bits):
+        result = (result << 1) | (index & 1)
+        index >>= 1
+    return result
+
+
+def twiddles(n):
+    # dsps_gen_w_r2_fc32(w, n): n / 2 complex values cos(2*pi*i/n), sin(2*pi*i/n)
+    w = [(math.cos(2 * math.pi * i / n), math.sin(2 * math.pi * i / n)) for i in range(n // 2)]
+    # dsps_bit_rev_fc32_ansi(w, n / 2)
+    bits = int(math.log2(n // 2))
+    return [w[bit_reverse(i, bits)] for i in range(n // 2)]
+
+
+def bitrev_pairs(n):
+    bits = int(math.log2(n))
+    pairs = []
+    for i in range(1, n - 1):
+        j = bit_reverse(i, bits)
+        if i < j:
+            pairs.append((i * BYTES_PER_ITEM, j * BYTES_PER_ITEM))
+    return pairs
+
+
+def format_values(values, per_line, fmt):
+    lines = []
+    for i in range(0, len(values), per_line):
+        lines.append('    ' + ' '.join(fmt(v) + ',' for v in values[i:i + per_line]))
+    return '\n'.join(lines)
+
+
+def main():
+    if len(sys.argv) != 3:
+        sys.exit('usage: gen_fft2r_tables_fc32.py max_fft_size output.c')
+    max_size = int(sys.argv[1])
+    if max_size < BITREV_MIN_SIZE or max_size & (max_size - 1) or max_size * BYTES_PER_ITEM > 0x10000:
+        sys.exit('max_fft_size must be a power of two from %d to %d' % (BITREV_MIN_SIZE, 0x10000 // BYTES_PER_ITEM))
+    log2_max = int(math.log2(max_size))
+
+    out = []
+    out.append('// Generated by gen_fft2r_tables_fc32.py for CONFIG_DSP_MAX_FFT_SIZE = %d, do not edit.\n' % max_size)
+    out.append('#include <stddef.h>')
+    out.append('#include <stdint.h>')
+    out.append('#include "dsps_fft_tables.h"\n')
+
+    w = [to_float32(v) for pair in twiddles(max_size) for v in pair]
+    out.append('const float dsps_fft2r_w_table_fc32_const[%d] = {' % max_size)
+    out.append(format_values(w, 4, lambda v: '%.9gf' % v if v != int(v) else '%.1ff' % v))
+    out.append('};')
+    out.append('const int dsps_fft2r_w_table_fc32_const_size = %d;\n' % max_size)
+
+    sizes = []
+    for bits in range(int(math.log2(BITREV_MIN_SIZE)), log2_max + 1):
+        n = 1 << bits
+        pairs = bitrev_pairs(n)
+        sizes.append((n, len(pairs)))
+        out.append('static const uint16_t bitrev2r_table_%d_fc32_const[] = {' % n)
+        out.append(format_values([v for p in pairs for v in p], 16, str))
+        out.append('};\n')
+
+    # Indexed by log2(N), NULL below BITREV_MIN_SIZE
+    out.append('const uint16_t *const dsps_fft2r_rev_tables_fc32_const[] = {')
+    for bits in range(log2_max + 1):
+        n = 1 << bits
+        out.append('    %s,' % ('bitrev2r_table_%d_fc32_const' % n if n >= BITREV_MIN_SIZE else 'NULL'))
+    out.append('};')
+    out.append('const uint16_t dsps_fft2r_rev_tables_fc32_const_size[] = {')
+    out.append('    ' + ' '.join('0,' for _ in range(int(math.log2(BITREV_MIN_SIZE))))
+               + ' ' + ' '.join('%d,' % s for _, s in sizes))
+    out.append('};')
+    out.append('const int dsps_fft2r_rev_tables_fc32_const_count = %d;' % (log2_max + 1))
+
+    with open(sys.argv[2], 'w') as f:
+        f.write('\n'.join(out) + '\n')
+
+
+if __name__ == '__main__':
+    main()
@@ -0,0 +1,50 @@
+// FIR filter for RISC-V cores (ESP32-C6).
+//
+// Filter state is kept in registers for the whole block and both halves of the
+// circular delay line are processed by an unrolled multiply-accumulate loop.
+// Products are accumulated in the same order as dsps_fir_f32_ansi().
+
+#include "dsps_fir.h"
+
+#if (dsps_fir_f32_rv32_enabled == 1)
+
+static inline float dsps_fir_f32_rv32_mac(const float *coeffs, const float *delay, int len, float acc)
+{
+    const float *end4 = delay + (len & ~3);
+    const float *end = delay + len;
+
+    while (delay < end4) {
+        acc += coeffs[0] * delay[0];
+        acc += coeffs[1] * delay[1];
+        acc += coeffs[2] * delay[2];
+        acc += coeffs[3] * delay[3];
+        coeffs += 4;
+        delay += 4;
+    }
+    while (delay < end) {
+        acc += *coeffs++ * *delay++;
+    }
+    return acc;
+}
+
+esp_err_t dsps_fir_f32_rv32(fir_f32_t *fir, const float *input, float *output, int len)
+{
+    const float *coeffs = fir->coeffs;
+    float *delay = fir->delay;
+    int N = fir->N;
+    int pos = fir->pos;
+
+    for (int i = 0 ; i < len ; i++) {
+        delay[pos] = input[i];
+        pos++;
+        if (pos >= N) {
+            pos = 0;
+        }
+        float acc = dsps_fir_f32_rv32_mac(coeffs, &delay[pos], N - pos, 0);
+        output[i] = dsps_fir_f32_rv32_mac(&coeffs[N - pos], delay, pos, acc);
+    }
+    fir->pos = pos;
+    return ESP_OK;
+}
+
+#endif // dsps_fir_f32_rv32_enabled
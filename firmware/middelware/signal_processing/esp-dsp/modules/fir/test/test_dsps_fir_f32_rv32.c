@@ -0,0 +1,81 @@
+// Tests for the RISC-V FIR filter (ESP32-C6).
+// The result must be bit exact with dsps_fir_f32_ansi().
+
+#include <string.h>
+#include "unity.h"
+#include "esp_dsp.h"
+#include "dsp_platform.h"
+#include "esp_log.h"
+
+#include "dsps_fir.h"
+#include "dsp_tests.h"
+
+#if (dsps_fir_f32_rv32_enabled == 1)
+
+static const char *TAG = "dsps_fir_f32_rv32";
+
+static float x[1024];
+static float y[1024];
+static float y_compare[1024];
+
+static float coeffs[35];
+static float delay[35];
+static float delay_compare[35];
+
+TEST_CASE("dsps_fir_f32_rv32 functionality", "[dsps]")
+{
+    int len = sizeof(x) / sizeof(float);
+    fir_f32_t fir1;
+    fir_f32_t fir2;
+
+    for (int i = 0 ; i < len ; i++) {
+        x[i] = (float)((i * 37) % 101) / 50.0f - 1.0f;
+    }
+    // Filter lengths with all the tails of the unrolled loop
+    for (int fir_len = 1 ; fir_len <= 35 ; fir_len++) {
+        for (int i = 0 ; i < fir_len ; i++) {
+            coeffs[i] = (float)(fir_len - i) / fir_len;
+        }
+        dsps_fir_init_f32(&fir1, coeffs, delay, fir_len);
+        dsps_fir_init_f32(&fir2, coeffs, delay_compare, fir_len);
+        // Odd block lengths move the delay line position between calls
+        for (int block = 0 ; block < len ; block += 97) {
+            int n = (len - block) < 97 ? (len - block) : 97;
+            TEST_ESP_OK(dsps_fir_f32_rv32(&fir1, &x[block], &y[block], n));
+            dsps_fir_f32_ansi(&fir2, &x[block], &y_compare[block], n);
+        }
+        TEST_ASSERT_EQUAL(fir2.pos, fir1.pos);
+        for (int i = 0 ; i < len ; i++) {
+            if (y[i] != y_compare[i]) {
+                TEST_ASSERT_EQUAL(y_compare[i], y[i]);
+            }
+        }
+    }
+}
+
+TEST_CASE("dsps_fir_f32_rv32 benchmark", "[dsps]")
+{
+    int len = sizeof(x) / sizeof(float);
+    int fir_len = 32;
+    fir_f32_t fir1;
+
+    for (int i = 0 ; i < fir_len ; i++) {
+        coeffs[i] = i;
+    }
+    dsps_fir_init_f32(&fir1, coeffs, delay, fir_len);
+
+    unsigned int start_b = dsp_get_cpu_cycle_count();
+    dsps_fir_f32_rv32(&fir1, x, y, len);
+    float cycles = (float)(dsp_get_cpu_cycle_count() - start_b) / len;
+
+    start_b = dsp_get_cpu_cycle_count();
+    dsps_fir_f32_ansi(&fir1, x, y, len);
+    float cycles_ansi = (float)(dsp_get_cpu_cycle_count() - start_b) / len;
+
+    ESP_LOGI(TAG, "dsps_fir_f32_rv32 - %f per sample for %i coefficients, %f per tap", cycles, fir_len, cycles / (float)fir_len);
+    ESP_LOGI(TAG, "dsps_fir_f32_ansi - %f per sample for %i coefficients, %f per tap", cycles_ansi, fir_len, cycles_ansi / (float)fir_len);
+    // Must not be slower than the ANSI version (10% margin for cache effects)
+    TEST_ASSERT_EXEC_IN_RANGE(fir_len, cycles_ansi * 1.1f, cycles);
+}
+
+#endif // dsps_fir_f32_rv32_enabled
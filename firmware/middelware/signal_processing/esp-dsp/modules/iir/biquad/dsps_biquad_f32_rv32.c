@@ -0,0 +1,32 @@
+// Biquad filter for RISC-V cores (ESP32-C6).
+//
+// Coefficients and delay line are loaded into registers once per block instead
+// of once per sample (the ANSI version has to reload them because output may
+// alias coef or w). Input and output can be the same buffer.
+
+#include "dsps_biquad.h"
+
+#if (dsps_biquad_f32_rv32_enabled == 1)
+
+esp_err_t dsps_biquad_f32_rv32(const float *input, float *output, int len, float *coef, float *w)
+{
+    const float b0 = coef[0];
+    const float b1 = coef[1];
+    const float b2 = coef[2];
+    const float a1 = coef[3];
+    const float a2 = coef[4];
+    float w0 = w[0];
+    float w1 = w[1];
+
+    for (int i = 0 ; i < len ; i++) {
+        float d0 = input[i] - a1 * w0 - a2 * w1;
+        output[i] = b0 * d0 + b1 * w0 + b2 * w1;
+        w1 = w0;
+        w0 = d0;
+    }
+    w[0] = w0;
+    w[1] = w1;
+    return ESP_OK;
+}
+
+#endif // dsps_biquad_f32_rv32_enabled
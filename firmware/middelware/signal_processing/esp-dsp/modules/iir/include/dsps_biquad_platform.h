@@ -21,5 +21,11 @@
 
 #endif // __XTENSA__
 
+#ifdef __riscv
+
+#define dsps_biquad_f32_rv32_enabled 1
+
+#endif // __riscv
+
 
 #endif // _dsps_biquad_platform_H_
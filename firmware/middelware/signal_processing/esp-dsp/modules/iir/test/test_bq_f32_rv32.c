@@ -0,0 +1,91 @@
+// Tests for the RISC-V biquad filter (ESP32-C6).
+// The result must be bit exact with dsps_biquad_f32_ansi().
+
+#include <string.h>
+#include "unity.h"
+#include "dsp_platform.h"
+#include "esp_log.h"
+
+#include "dsps_d_gen.h"
+#include "dsps_biquad_gen.h"
+#include "dsps_biquad.h"
+#include "dsp_tests.h"
+
+#if (dsps_biquad_f32_rv32_enabled == 1)
+
+static const char *TAG = "dsps_biquad_f32_rv32";
+static const int bq_len_rv32 = 1024;
+
+TEST_CASE("dsps_biquad_f32_rv32 functionality", "[dsps]")
+{
+    float *x = calloc(bq_len_rv32, sizeof(float));
+    float *y = calloc(bq_len_rv32, sizeof(float));
+    float *z = calloc(bq_len_rv32, sizeof(float));
+    int len = bq_len_rv32;
+    float coeffs[5];
+    float w1[2] = {0};
+    float w2[2] = {0};
+
+    dsps_d_gen_f32(x, len, 0);
+    dsps_biquad_gen_lpf_f32(coeffs, 0.1, 1);
+    // Two blocks: the delay line must be carried between calls
+    dsps_biquad_f32_rv32(x, y, len / 2, coeffs, w1);
+    dsps_biquad_f32_rv32(&x[len / 2], &y[len / 2], len / 2, coeffs, w1);
+    dsps_biquad_f32_ansi(x, z, len, coeffs, w2);
+    for (int i = 0 ; i < len ; i++) {
+        if (y[i] != z[i]) {
+            TEST_ASSERT_EQUAL(z[i], y[i]);
+        }
+    }
+    TEST_ASSERT_EQUAL(w2[0], w1[0]);
+    TEST_ASSERT_EQUAL(w2[1], w1[1]);
+
+    // In place, as used by iir_filter.c
+    w1[0] = w1[1] = 0;
+    memcpy(y, x, len * sizeof(float));
+    dsps_biquad_f32_rv32(y, y, len, coeffs, w1);
+    w2[0] = w2[1] = 0;
+    dsps_biquad_f32_ansi(x, z, len, coeffs, w2);
+    for (int i = 0 ; i < len ; i++) {
+        if (y[i] != z[i]) {
+            TEST_ASSERT_EQUAL(z[i], y[i]);
+        }
+    }
+    free(x);
+    free(y);
+    free(z);
+}
+
+TEST_CASE("dsps_biquad_f32_rv32 benchmark", "[dsps]")
+{
+    float *x = calloc(bq_len_rv32, sizeof(float));
+    float *y = calloc(bq_len_rv32, sizeof(float));
+    float w1[2] = {0};
+    int len = bq_len_rv32;
+    int repeat_count = 16;
+    float coeffs[5];
+
+    dsps_d_gen_f32(x, len, 0);
+    dsps_biquad_gen_lpf_f32(coeffs, 0.1, 1);
+
+    unsigned int start_b = dsp_get_cpu_cycle_count();
+    for (int i = 0 ; i < repeat_count ; i++) {
+        dsps_biquad_f32_rv32(x, y, len, coeffs, w1);
+    }
+    float cycles = (float)(dsp_get_cpu_cycle_count() - start_b) / (len * repeat_count);
+
+    start_b = dsp_get_cpu_cycle_count();
+    for (int i = 0 ; i < repeat_count ; i++) {
+        dsps_biquad_f32_ansi(x, y, len, coeffs, w1);
+    }
+    float cycles_ansi = (float)(dsp_get_cpu_cycle_count() - start_b) / (len * repeat_count);
+
+    ESP_LOGI(TAG, "dsps_biquad_f32_rv32 - %f per sample", cycles);
+    ESP_LOGI(TAG, "dsps_biquad_f32_ansi - %f per sample", cycles_ansi);
+    // Must not be slower than the ANSI version (10% margin for cache effects)
+    TEST_ASSERT_EXEC_IN_RANGE(5, cycles_ansi * 1.1f, cycles);
+    free(x);
+    free(y);
+}
+
+#endif // dsps_biquad_f32_rv32_enabled
@@ -14,6 +14,7 @@
 
 #include "ekf.h"
 #include <float.h>
+#include <string.h>
 
 ekf::ekf(int x, int w) : NUMX(x),
     NUMW(w),
@@ -29,12 +30,16 @@ ekf::ekf(int x, int w) : NUMX(x),
     this->Q *= 0;
     this->X *= 0;
     this->X.data[0] = 1; // direction to 0
+    this->joseph_form = false;
     this->HP = new float[this->NUMX];
     this->Km = new float[this->NUMX];
     for (size_t i = 0; i < this->NUMX; i++) {
         this->HP[i] = 0;
         this->Km[i] = 0;
     }
+    this->Xwork = new float[3 * this->NUMX];
+    this->FP = new float[this->NUMX * this->NUMX];
+    this->GQ = new float[this->NUMX * this->NUMW];
 }
 
 ekf::~ekf()
@@ -45,8 +50,11 @@ ekf::~ekf()
     delete &P;
     delete &Q;
 
-    delete this->HP;
-    delete this->Km;
+    delete[] this->HP;
+    delete[] this->Km;
+    delete[] this->Xwork;
+    delete[] this->FP;
+    delete[] this->GQ;
 }
 
 void ekf::Process(float *u, float dt)
@@ -60,89 +68,153 @@ void ekf::RungeKutta(dspm::Mat &x, float *U, float dt)
 {
 
     float dt2 = dt / 2.0f;
+    float *Xlast = this->Xwork;                 // working copy
+    float *K = &this->Xwork[this->NUMX];        // k1 .. k4
+    float *Ksum = &this->Xwork[2 * this->NUMX]; // k1 + 2 * k2 + 2 * k3 + k4
+
+    memcpy(Xlast, x.data, this->NUMX * sizeof(float));
+    StateXdot(x, U, K); // k1 = f(x, u)
+    for (int i = 0; i < this->NUMX; i++) {
+        Ksum[i] = K[i];
+        x.data[i] = Xlast[i] + K[i] * dt2;
+    }
 
-    dspm::Mat Xlast = x;          // make a working copy
-    dspm::Mat K1 = StateXdot(x, U); // k1 = f(x, u)
-    x = Xlast + (K1 * dt2);
-
-    dspm::Mat K2 = StateXdot(x, U); // k2 = f(x + 0.5*dT*k1, u)
-    x = Xlast + K2 * dt2;
+    StateXdot(x, U, K); // k2 = f(x + 0.5*dT*k1, u)
+    for (int i = 0; i < this->NUMX; i++) {
+        Ksum[i] += 2.0f * K[i];
+        x.data[i] = Xlast[i] + K[i] * dt2;
+    }
 
-    dspm::Mat K3 = StateXdot(x, U); // k3 = f(x + 0.5*dT*k2, u)
-    x = Xlast + K3 * dt;
+    StateXdot(x, U, K); // k3 = f(x + 0.5*dT*k2, u)
+    for (int i = 0; i < this->NUMX; i++) {
+        Ksum[i] += 2.0f * K[i];
+        x.data[i] = Xlast[i] + K[i] * dt;
+    }
 
-    dspm::Mat K4 = StateXdot(x, U); // k4 = f(x + dT * k3, u)
+    StateXdot(x, U, K); // k4 = f(x + dT * k3, u)
 
     // Xnew = X + dT * (k1 + 2 * k2 + 2 * k3 + k4) / 6
-    x = Xlast + (K1 + 2.0f * K2 + 2.0f * K3 + K4) * (dt / 6.0f);
+    for (int i = 0; i < this->NUMX; i++) {
+        x.data[i] = Xlast[i] + (Ksum[i] + K[i]) * (dt / 6.0f);
+    }
 }
 
 dspm::Mat ekf::SkewSym4x4(float w[3])
+{
+    dspm::Mat result(4, 4);
+    SkewSym4x4(w, result.data);
+    return result;
+}
+
+void ekf::SkewSym4x4(const float *w, float *result)
 {
     //={    0,  -w[0],  -w[1],  -w[2],
     //   w[0],      0,   w[2],  -w[1],
     //   w[1],  -w[2],      0,   w[0],
     //   w[2],   w[1],  -w[0],     0 };
 
-    dspm::Mat result(4, 4);
-    result.data[0] = 0;
-    result.data[1] = -w[0];
-    result.data[2] = -w[1];
-    result.data[3] = -w[2];
-
-    result.data[4] = w[0];
-    result.data[5] = 0;
-    result.data[6] = w[2];
-    result.data[7] = -w[1];
-
-    result.data[8] = w[1];
-    result.data[9] = -w[2];
-    result.data[10] = 0;
-    result.data[11] = w[0];
-
-    result.data[12] = w[2];
-    result.data[13] = w[1];
-    result.data[14] = -w[0];
-    result.data[15] = 0;
-
-    return result;
+    result[0] = 0;
+    result[1] = -w[0];
+    result[2] = -w[1];
+    result[3] = -w[2];
+
+    result[4] = w[0];
+    result[5] = 0;
+    result[6] = w[2];
+    result[7] = -w[1];
+
+    result[8] = w[1];
+    result[9] = -w[2];
+    result[10] = 0;
+    result[11] = w[0];
+
+    result[12] = w[2];
+    result[13] = w[1];
+    result[14] = -w[0];
+    result[15] = 0;
 }
 
 dspm::Mat ekf::qProduct(float *q)
 {
     dspm::Mat result(4, 4);
-
-    result.data[0] = q[0];
-    result.data[1] = -q[1];
-    result.data[2] = -q[2];
-    result.data[3] = -q[3];
-
-    result.data[4] = q[1];
-    result.data[5] = q[0];
-    result.data[6] = -q[3];
-    result.data[7] = q[2];
-
-    result.data[8] = q[2];
-    result.data[9] = q[3];
-    result.data[10] = q[0];
-    result.data[11] = -q[1];
-
-    result.data[12] = q[3];
-    result.data[13] = -q[2];
-    result.data[14] = q[1];
-    result.data[15] = q[0];
-
+    qProduct(q, result.data);
     return result;
 }
 
-void ekf::CovariancePrediction(float dt)
+void ekf::qProduct(const float *q, float *result)
 {
-    dspm::Mat f = this->F * dt;
-
-    f = f + dspm::Mat::eye(this->NUMX);
+    result[0] = q[0];
+    result[1] = -q[1];
+    result[2] = -q[2];
+    result[3] = -q[3];
+
+    result[4] = q[1];
+    result[5] = q[0];
+    result[6] = -q[3];
+    result[7] = q[2];
+
+    result[8] = q[2];
+    result[9] = q[3];
+    result[10] = q[0];
+    result[11] = -q[1];
+
+    result[12] = q[3];
+    result[13] = -q[2];
+    result[14] = q[1];
+    result[15] = q[0];
+}
 
-    dspm::Mat f_t = f.t();
-    this->P = ((f * this->P) * f_t) + (dt * dt) * ((G * Q) * G.t());
+void ekf::CovariancePrediction(float dt)
+{
+    // P = f*P*f' + dt^2*G*Q*G', f = I + F*dt
+    int n = this->NUMX;
+    int w = this->NUMW;
+    float dt2 = dt * dt;
+
+    // FP = f*P = P + dt*F*P
+    memcpy(this->FP, this->P.data, n * n * sizeof(float));
+    for (int i = 0; i < n; i++) {
+        for (int k = 0; k < n; k++) {
+            float f = F(i, k) * dt;
+            if (f == 0) {
+                continue;
+            }
+            for (int j = 0; j < n; j++) {
+                FP[i * n + j] += f * P(k, j);
+            }
+        }
+    }
+    // GQ = G*Q
+    memset(this->GQ, 0, n * w * sizeof(float));
+    for (int i = 0; i < n; i++) {
+        for (int k = 0; k < w; k++) {
+            float g = G(i, k);
+            if (g == 0) {
+                continue;
+            }
+            for (int j = 0; j < w; j++) {
+                GQ[i * w + j] += g * Q(k, j);
+            }
+        }
+    }
+    // P = FP*f' + dt^2*GQ*G' = FP + dt*FP*F' + dt^2*GQ*G', upper triangle
+    for (int i = 0; i < n; i++) {
+        for (int j = i; j < n; j++) {
+            float fpf = 0;
+            for (int k = 0; k < n; k++) {
+                if (F(j, k) != 0) {
+                    fpf += FP[i * n + k] * F(j, k);
+                }
+            }
+            float gqg = 0;
+            for (int k = 0; k < w; k++) {
+                if (G(j, k) != 0) {
+                    gqg += GQ[i * w + k] * G(j, k);
+                }
+            }
+            P(i, j) = P(j, i) = FP[i * n + j] + dt * fpf + dt2 * gqg;
+        }
+    }
 }
 
 void ekf::Update(dspm::Mat &H, float *measured, float *expected, float *R)
@@ -157,6 +229,9 @@ void ekf::Update(dspm::Mat &H, float *measured, float *expected, float *R)
             HP[j] = 0;
         }
         for (int k = 0; k < this->NUMX; k++) {
+            if (H(m, k) == 0) {
+                continue;
+            }
             for (int j = 0; j < this->NUMX; j++) {
                 // Find Hp = H*P
                 HP[j] += H(m, k) * P(k, j);
@@ -170,10 +245,43 @@ void ekf::Update(dspm::Mat &H, float *measured, float *expected, float *R)
         for (int k = 0; k < this->NUMX; k++) {
             Km[k] = HP[k] * invHPHR; // find K = HP/HPHR
         }
-        for (int i = 0; i < this->NUMX; i++) {
-            // Find P(m)= P(m-1) + K*HP
-            for (int j = i; j < NUMX; j++) {
-                P(i, j) = P(j, i) = P(i, j) - Km[i] * HP[j];
+        if (this->joseph_form) {
+            // P(m) = (I - K*H)*P(m-1)*(I - K*H)' + K*R*K', in P:
+            // M = P(m-1)*(I - K*H)' = P(m-1) - HP'*K'
+            for (int i = 0; i < this->NUMX; i++) {
+                for (int j = 0; j < this->NUMX; j++) {
+                    P(i, j) -= HP[i] * Km[j];
+                }
+            }
+            // Find H*M (in HP, not used anymore)
+            for (int j = 0; j < this->NUMX; j++) {
+                HP[j] = 0;
+            }
+            for (int k = 0; k < this->NUMX; k++) {
+                if (H(m, k) == 0) {
+                    continue;
+                }
+                for (int j = 0; j < this->NUMX; j++) {
+                    HP[j] += H(m, k) * P(k, j);
+                }
+            }
+            // P(m) = M - K*H*M + K*R*K', symmetric part
+            for (int i = 0; i < this->NUMX; i++) {
+                for (int j = 0; j < this->NUMX; j++) {
+                    P(i, j) += Km[i] * (Km[j] * R[m] - HP[j]);
+                }
+            }
+            for (int i = 0; i < this->NUMX; i++) {
+                for (int j = i + 1; j < this->NUMX; j++) {
+                    P(i, j) = P(j, i) = 0.5f * (P(i, j) + P(j, i));
+                }
+            }
+        } else {
+            for (int i = 0; i < this->NUMX; i++) {
+                // Find P(m)= P(m-1) + K*HP
+                for (int j = i; j < NUMX; j++) {
+                    P(i, j) = P(j, i) = P(i, j) - Km[i] * HP[j];
+                }
             }
         }
 
@@ -212,6 +320,17 @@ dspm::Mat ekf::quat2rotm(float q[4])
     float q2 = q[2];
     float q3 = q[3];
     dspm::Mat Rm(3, 3);
+    quat2rotm(q, Rm.data);
+    return Rm;
+}
+
+void ekf::quat2rotm(const float q[4], float *result)
+{
+    float q0 = q[0];
+    float q1 = q[1];
+    float q2 = q[2];
+    float q3 = q[3];
+    dspm::Mat Rm(result, 3, 3);
 
     Rm(0, 0) = q0 * q0 + q1 * q1 - q2 * q2 - q3 * q3;
     Rm(1, 0) = 2.0f * (q1 * q2 + q0 * q3);
@@ -222,8 +341,6 @@ dspm::Mat ekf::quat2rotm(float q[4])
     Rm(0, 2) = 2.0f * (q1 * q3 + q0 * q2);
     Rm(1, 2) = 2.0f * (q2 * q3 - q0 * q1);
     Rm(2, 2) = (q0 * q0 - q1 * q1 - q2 * q2 + q3 * q3);
-
-    return Rm;
 }
 
 dspm::Mat ekf::quat2eul(const float q[4])
@@ -388,23 +505,29 @@ dspm::Mat ekf::dFdq(dspm::Mat &vector, dspm::Mat &q)
 dspm::Mat ekf::dFdq_inv(dspm::Mat &vector, dspm::Mat &q)
 {
     dspm::Mat result(3, 4);
-    result(0, 0) = q.data[0] * vector.data[0] + q.data[3] * vector.data[1] - q.data[2] * vector.data[2];
-    result(0, 1) = q.data[1] * vector.data[0] + q.data[2] * vector.data[1] + q.data[3] * vector.data[2];
-    result(0, 2) = -q.data[2] * vector.data[0] + q.data[1] * vector.data[1] - q.data[0] * vector.data[2];
-    result(0, 3) = -q.data[3] * vector.data[0] + q.data[0] * vector.data[1] + q.data[1] * vector.data[2];
-
-    result(1, 0) = -q.data[3] * vector.data[0] + q.data[0] * vector.data[1] + q.data[1] * vector.data[2];
-    result(1, 1) = q.data[2] * vector.data[0] - q.data[1] * vector.data[1] + q.data[0] * vector.data[2];
-    result(1, 2) = q.data[1] * vector.data[0] + q.data[2] * vector.data[1] + q.data[3] * vector.data[2];
-    result(1, 3) = -q.data[0] * vector.data[0] - q.data[3] * vector.data[1] + q.data[2] * vector.data[2];
+    dFdq_inv(vector.data, q.data, result.data);
+    return result;
+}
 
-    result(2, 0) = q.data[2] * vector.data[0] - q.data[1] * vector.data[1] + q.data[0] * vector.data[2];
-    result(2, 1) = q.data[3] * vector.data[0] - q.data[0] * vector.data[1] - q.data[1] * vector.data[2];
-    result(2, 2) = q.data[0] * vector.data[0] + q.data[3] * vector.data[1] - q.data[2] * vector.data[2];
-    result(2, 3) = q.data[1] * vector.data[0] + q.data[2] * vector.data[1] + q.data[3] * vector.data[2];
+void ekf::dFdq_inv(const float *v, const float *q, float *data)
+{
+    dspm::Mat result(data, 3, 4);
+    result(0, 0) = q[0] * v[0] + q[3] * v[1] - q[2] * v[2];
+    result(0, 1) = q[1] * v[0] + q[2] * v[1] + q[3] * v[2];
+    result(0, 2) = -q[2] * v[0] + q[1] * v[1] - q[0] * v[2];
+    result(0, 3) = -q[3] * v[0] + q[0] * v[1] + q[1] * v[2];
+
+    result(1, 0) = -q[3] * v[0] + q[0] * v[1] + q[1] * v[2];
+    result(1, 1) = q[2] * v[0] - q[1] * v[1] + q[0] * v[2];
+    result(1, 2) = q[1] * v[0] + q[2] * v[1] + q[3] * v[2];
+    result(1, 3) = -q[0] * v[0] - q[3] * v[1] + q[2] * v[2];
+
+    result(2, 0) = q[2] * v[0] - q[1] * v[1] + q[0] * v[2];
+    result(2, 1) = q[3] * v[0] - q[0] * v[1] - q[1] * v[2];
+    result(2, 2) = q[0] * v[0] + q[3] * v[1] - q[2] * v[2];
+    result(2, 3) = q[1] * v[0] + q[2] * v[1] + q[3] * v[2];
 
     result *= 2;
-    return result;
 }
 
 dspm::Mat ekf::StateXdot(dspm::Mat &x, float *u)
@@ -413,3 +536,9 @@ dspm::Mat ekf::StateXdot(dspm::Mat &x, float *u)
     dspm::Mat Xdot = (this->F * x + this->G * U);
     return Xdot;
 }
+
+void ekf::StateXdot(dspm::Mat &x, float *u, float *xdot)
+{
+    dspm::Mat Xdot = StateXdot(x, u);
+    memcpy(xdot, Xdot.data, this->NUMX * sizeof(float));
+}
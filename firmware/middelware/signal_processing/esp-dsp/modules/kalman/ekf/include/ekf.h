@@ -25,13 +25,20 @@
 /**
  * The ekf is a base class for Extended Kalman Filter.
  * It contains main matrix operations and define the processing flow.
+ *
+ * All the memory used by Process() and Update() is allocated by the
+ * constructor, so the processing steps don't use the heap (if the derived
+ * class implements the allocation free StateXdot() and LinearizeFG()).
+ * The covariance matrix P is symmetric: only its upper triangle is
+ * calculated and then mirrored.
  */
 class ekf {
 public:
 
     /**
      * Constructor of EKF.
-     * THe constructor allocate main memory for the matrixes.
+     * THe constructor allocate main memory for the matrixes and the work
+     * memory of the processing steps.
      * @param[in] x: - amount of states in EKF. x[n] = F*x[n-1] + G*u + W. Size of matrix F
      * @param[in] w: - amount of control measurements and noise inputs. Size of matrix G
     */
@@ -112,6 +119,14 @@ public:
      *      - derivative of input vector x and u
      */
     virtual dspm::Mat StateXdot(dspm::Mat &x, float *u);
+    /**
+     * Derivative of state vector X, allocation free version used by RungeKutta().
+     * The default calls StateXdot(x, u), derived classes should override it.
+     * @param[in] x: state vector
+     * @param[in] u: control measurement
+     * @param[out] xdot: derivative of input vector x and u (NUMX values)
+     */
+    virtual void StateXdot(dspm::Mat &x, float *u, float *xdot);
     /**
      * Calculation of system state matrices F and G
      * @param[in] x: state vector
@@ -124,15 +139,19 @@ public:
 
     /**
      * Calculates covariance prediction matrux P.
-     * Update matrix P
+     * Update matrix P: P = f*P*f' + dt^2*G*Q*G', where f = I + F*dt.
+     * It's calculated as P + dt*(F*P + P*F') + ... so the terms added to P
+     * are small corrections, and the zeros of F and G are skipped.
      * @param[in] dt: time interval from last update
      */
     virtual void CovariancePrediction(float dt);
 
     /**
      * Update of current state by measured values.
-     * Optimized method for non correlated values
+     * Optimized method for non correlated values: one scalar update per
+     * measurement, no matrix inversion.
      * Calculate Kalman gain and update matrix P and vector X.
+     * P is updated in Joseph form if joseph_form is set.
      * @param[in] H: derivative matrix
      * @param[in] measured: array of measured values
      * @param[in] expected: array of expected values
@@ -150,6 +169,15 @@ public:
      */
     virtual void UpdateRef(dspm::Mat &H, float *measured, float *expected, float *R);
 
+    /**
+     * Update P in Joseph form: P = (I - K*H)*P*(I - K*H)' + K*R*K', calculated
+     * as written (expanded with the optimal K it is the standard form). It's
+     * valid for any gain, so an error in K gives a second order error in P
+     * instead of a first order one. Rounding errors of P itself are not
+     * removed. It takes ~3*NUMX^2 more operations per measurement: default false.
+    */
+    bool joseph_form;
+
     /**
      * Matrix for intermidieve calculations
     */
@@ -158,6 +186,18 @@ public:
      * Matrix for intermidieve calculations
     */
     float *Km;
+    /**
+     * Work memory of RungeKutta(): last state, derivative, sum of derivatives (3*NUMX)
+    */
+    float *Xwork;
+    /**
+     * Work memory of CovariancePrediction(): f*P (NUMX*NUMX)
+    */
+    float *FP;
+    /**
+     * Work memory of CovariancePrediction(): G*Q (NUMX*NUMW)
+    */
+    float *GQ;
 
 public:
     // Additional universal helper methods
@@ -169,6 +209,12 @@ public:
      *      - rotation matrix 3x3
      */
     static dspm::Mat quat2rotm(float q[4]);
+    /**
+     * Convert quaternion to rotation matrix (no memory allocation).
+     * @param[in] q: quaternion
+     * @param[out] result: rotation matrix 3x3 (9 values, row-major)
+     */
+    static void quat2rotm(const float q[4], float *result);
 
     /**
      * Convert rotation matrix to quaternion.
@@ -224,6 +270,13 @@ public:
      *      - Derivative matrix 3x4
      */
     static dspm::Mat dFdq_inv(dspm::Mat &vector, dspm::Mat &quat);
+    /**
+     * Df/dq: Derivative of vector by inverted quaternion (no memory allocation).
+     * @param[in] vector: input vector (3 values)
+     * @param[in] q: quaternion
+     * @param[out] result: derivative matrix 3x4 (12 values, row-major)
+     */
+    static void dFdq_inv(const float *vector, const float *q, float *result);
 
     /**
      * Make skew-symmetric matrix of vector.
@@ -233,6 +286,12 @@ public:
      *      - skew-symmetric matrix 4x4
      */
     static dspm::Mat SkewSym4x4(float *w);
+    /**
+     * Make skew-symmetric matrix of vector (no memory allocation).
+     * @param[in] w: source vector
+     * @param[out] result: skew-symmetric matrix 4x4 (16 values, row-major)
+     */
+    static void SkewSym4x4(const float *w, float *result);
 
     // q product
     // Rl = [q(1) - q(2) - q(3) - q(4); ...
@@ -248,6 +307,12 @@ public:
      *      - right quaternion-product matrix 4x4
      */
     static dspm::Mat qProduct(float *q);
+    /**
+     * Make right quaternion-product matrices (no memory allocation).
+     * @param[in] q: source quaternion
+     * @param[out] result: right quaternion-product matrix 4x4 (16 values, row-major)
+     */
+    static void qProduct(const float *q, float *result);
 
 };
 
@@ -16,7 +16,8 @@
 
 ekf_imu13states::ekf_imu13states() : ekf(13, 18),
     mag0(3, 1),
-    accel0(3, 1)
+    accel0(3, 1),
+    Hwork(10, 13)
 {
     this->NUMU = 3;
 }
@@ -51,53 +52,73 @@ void ekf_imu13states::Init()
 }
 
 dspm::Mat ekf_imu13states::StateXdot(dspm::Mat &x, float *u)
+{
+    dspm::Mat Xdot(this->NUMX, 1);
+    StateXdot(x, u, Xdot.data);
+    return Xdot;
+}
+
+void ekf_imu13states::StateXdot(dspm::Mat &x, float *u, float *xdot)
 {
     float wx = u[0] - x(4, 0); // subtract the biases on gyros
     float wy = u[1] - x(5, 0);
     float wz = u[2] - x(6, 0);
 
     float w[] = {wx, wy, wz};
-    dspm::Mat q = dspm::Mat(x.data, 4, 1);
+    float Omega[16];
 
     // qdot = Q * w
-    dspm::Mat Omega = 0.5 * SkewSym4x4(w);
-    dspm::Mat qdot = Omega * q;
-    dspm::Mat Xdot(this->NUMX, 1);
-    Xdot *= 0;
-    Xdot.Copy(qdot, 0, 0);
+    ekf::SkewSym4x4(w, Omega);
+    for (int i = 0; i < 4; i++) {
+        xdot[i] = 0;
+        for (int j = 0; j < 4; j++) {
+            xdot[i] += 0.5f * Omega[i * 4 + j] * x.data[j];
+        }
+    }
     // dwbias = 0
     // dMang_Ampl = 0
     // dMang_offset = 0
-    return Xdot;
+    for (int i = 4; i < this->NUMX; i++) {
+        xdot[i] = 0;
+    }
 }
 
 void ekf_imu13states::LinearizeFG(dspm::Mat &x, float *u)
 {
     float w[3] = {(u[0] - x(4, 0)), (u[1] - x(5, 0)), (u[2] - x(6, 0))}; // subtract the biases on gyros
     // float w[3] = {u[0], u[1], u[2]}; // subtract the biases on gyros
+    float m[16];
 
     this->F *= 0; // Initialize F and G matrixes.
     this->G *= 0;
 
     // dqdot / dq - skey matrix
-    F.Copy(0.5 * ekf::SkewSym4x4(w), 0, 0);
+    ekf::SkewSym4x4(w, m);
+    for (int i = 0; i < 4; i++) {
+        for (int j = 0; j < 4; j++) {
+            F(i, j) = 0.5f * m[i * 4 + j];
+        }
+    }
 
     // dqdot/dvector
-    dspm::Mat dq = -0.5 * qProduct(x.data);
-    dspm::Mat dq_q = dq.Get(0, 4, 1, 3);
-
-    // dqdot / dnw
-    G.Copy(dq_q, 0, 0);
-    // dqdot / dwbias
-    F.Copy(dq_q, 0, 4);
-
-    dspm::Mat rotm = -1 * this->quat2rotm(x.data); // Convert quat to rotation matrix
+    ekf::qProduct(x.data, m);
+    for (int i = 0; i < 4; i++) {
+        for (int j = 0; j < 3; j++) {
+            G(i, j) = -0.5f * m[i * 4 + j + 1]; // dqdot / dnw
+            F(i, j + 4) = G(i, j);              // dqdot / dwbias
+        }
+    }
 
-    G.Copy(rotm, 7, 6);
-    G.Copy(dspm::Mat::eye(3), 4, 3);   // random noise wbias
-    G.Copy(dspm::Mat::eye(3), 7, 12);  // random noise magnetometer amplitude
-    G.Copy(dspm::Mat::eye(3), 10, 9);  // magnetometer offset constant
-    G.Copy(dspm::Mat::eye(3), 10, 15); // random noise offset constant
+    ekf::quat2rotm(x.data, m); // Convert quat to rotation matrix
+    for (int i = 0; i < 3; i++) {
+        for (int j = 0; j < 3; j++) {
+            G(i + 7, j + 6) = -m[i * 3 + j];
+        }
+        G(i + 4, i + 3) = 1;   // random noise wbias
+        G(i + 7, i + 12) = 1;  // random noise magnetometer amplitude
+        G(i + 10, i + 9) = 1;  // magnetometer offset constant
+        G(i + 10, i + 15) = 1; // random noise offset constant
+    }
 }
 
 void ekf_imu13states::Test()
@@ -184,32 +205,55 @@ void ekf_imu13states::TestFull(bool enable_att)
     std::cout << "Final State data : " << this->X.t() << std::endl;
 }
 
-void ekf_imu13states::UpdateRefMeasurement(float *accel_data, float *magn_data, float R[6])
+void ekf_imu13states::RefMeasurement(dspm::Mat &H, float *expected_data, bool magn_states)
 {
-    dspm::Mat quat(this->X.data, 4, 1);
-    dspm::Mat H = 0 * dspm::Mat(6, this->NUMX);
-    dspm::Mat Re = this->quat2rotm(quat.data).t();
+    float *quat = this->X.data;
+    float *magn = &this->X.data[7];
+    float *magn_offset = &this->X.data[10];
+    float Rm[9];
+    float dF_dq[12];
+
+    ekf::quat2rotm(quat, Rm); // Re = Rm'
+    if (magn_states) {
+        for (int i = 0; i < 3; i++) {
+            for (int j = 0; j < 3; j++) {
+                H(i, j + 7) = Rm[j * 3 + i];
+            }
+            H(i, i + 10) = 1;
+        }
+    }
 
     // dAccel/dq
-    dspm::Mat dAccel_dq = ekf::dFdq_inv(this->accel0, quat);
-    H.Copy(dAccel_dq, 3, 0);
+    ekf::dFdq_inv(this->accel0.data, quat, dF_dq);
+    H.Copy(dspm::Mat(dF_dq, 3, 4), 3, 0);
 
     // dMagn/dq
-    dspm::Mat magn(&this->X.data[7], 3, 1);
-    dspm::Mat magn_offset(&this->X.data[10], 3, 1);
-    dspm::Mat dMagn_dq = ekf::dFdq_inv(magn, quat);
-    H.Copy(dMagn_dq, 0, 0);
-
-    dspm::Mat expected_magn = Re * magn + magn_offset;
-    dspm::Mat expected_accel = Re * this->accel0;
+    ekf::dFdq_inv(magn, quat, dF_dq);
+    H.Copy(dspm::Mat(dF_dq, 3, 4), 0, 0);
+
+    // expected_magn = Re * magn + magn_offset, expected_accel = Re * accel0
+    for (int i = 0; i < 3; i++) {
+        expected_data[i] = magn_offset[i];
+        expected_data[i + 3] = 0;
+        for (int j = 0; j < 3; j++) {
+            expected_data[i] += Rm[j * 3 + i] * magn[j];
+            expected_data[i + 3] += Rm[j * 3 + i] * this->accel0.data[j];
+        }
+    }
+}
 
+void ekf_imu13states::UpdateRefMeasurement(float *accel_data, float *magn_data, float R[6])
+{
+    dspm::Mat quat(this->X.data, 4, 1);
+    dspm::Mat H(this->Hwork.data, 6, this->NUMX);
     float measured_data[6];
     float expected_data[6];
+
+    H.clear();
+    RefMeasurement(H, expected_data, false);
     for (size_t i = 0; i < 3; i++) {
         measured_data[i] = magn_data[i];
-        expected_data[i] = expected_magn.data[i];
         measured_data[i + 3] = accel_data[i];
-        expected_data[i + 3] = expected_accel.data[i];
     }
 
     this->Update(H, measured_data, expected_data, R);
@@ -219,33 +263,16 @@ void ekf_imu13states::UpdateRefMeasurement(float *accel_data, float *magn_data,
 void ekf_imu13states::UpdateRefMeasurementMagn(float *accel_data, float *magn_data, float R[6])
 {
     dspm::Mat quat(this->X.data, 4, 1);
-    dspm::Mat H = 0 * dspm::Mat(6, this->NUMX);
-    dspm::Mat Re = this->quat2rotm(quat.data).t();
-
-    // We include these two line to update magnetometer initial state
-    H.Copy(Re, 0, 7);
-    H.Copy(dspm::Mat::eye(3), 0, 10);
-
-    // dAccel/dq
-    dspm::Mat dAccel_dq = ekf::dFdq_inv(this->accel0, quat);
-    H.Copy(dAccel_dq, 3, 0);
-
-    // dMagn/dq
-    dspm::Mat magn(&this->X.data[7], 3, 1);
-    dspm::Mat magn_offset(&this->X.data[10], 3, 1);
-    dspm::Mat dMagn_dq = ekf::dFdq_inv(magn, quat);
-    H.Copy(dMagn_dq, 0, 0);
-
-    dspm::Mat expected_magn = Re * magn + magn_offset;
-    dspm::Mat expected_accel = Re * this->accel0;
-
+    dspm::Mat H(this->Hwork.data, 6, this->NUMX);
     float measured_data[6];
     float expected_data[6];
+
+    // We include the magnetometer states to update magnetometer initial state
+    H.clear();
+    RefMeasurement(H, expected_data, true);
     for (size_t i = 0; i < 3; i++) {
         measured_data[i] = magn_data[i];
-        expected_data[i] = expected_magn.data[i];
         measured_data[i + 3] = accel_data[i];
-        expected_data[i + 3] = expected_accel.data[i];
     }
 
     this->Update(H, measured_data, expected_data, R);
@@ -255,33 +282,20 @@ void ekf_imu13states::UpdateRefMeasurementMagn(float *accel_data, float *magn_da
 void ekf_imu13states::UpdateRefMeasurement(float *accel_data, float *magn_data, float *attitude, float R[10])
 {
     dspm::Mat quat(this->X.data, 4, 1);
-    dspm::Mat H = 0 * dspm::Mat(10, this->NUMX);
-    dspm::Mat Re = this->quat2rotm(quat.data).t();
-
-    H.Copy(Re, 0, 7);
-    H.Copy(dspm::Mat::eye(3), 0, 10);
-    // dAccel/dq
-    dspm::Mat dAccel_dq = ekf::dFdq_inv(this->accel0, quat);
-    H.Copy(dAccel_dq, 3, 0);
-    // dMagn/dq
-    dspm::Mat magn(&this->X.data[7], 3, 1);
-    dspm::Mat magn_offset(&this->X.data[10], 3, 1);
-    dspm::Mat dMagn_dq = ekf::dFdq_inv(magn, quat);
-    H.Copy(dMagn_dq, 0, 0);
+    dspm::Mat H(this->Hwork.data, 10, this->NUMX);
+    float measured_data[10];
+    float expected_data[10];
 
+    H.clear();
+    RefMeasurement(H, expected_data, true);
     // dq/dq
-    H.Copy(dspm::Mat::eye(4), 6, 1);
-
-    dspm::Mat expected_magn = Re * magn + magn_offset;
-    dspm::Mat expected_accel = Re * this->accel0;
+    for (size_t i = 0; i < 4; i++) {
+        H(i + 6, i + 1) = 1;
+    }
 
-    float measured_data[10];
-    float expected_data[10];
     for (size_t i = 0; i < 3; i++) {
         measured_data[i] = magn_data[i];
-        expected_data[i] = expected_magn.data[i];
         measured_data[i + 3] = accel_data[i];
-        expected_data[i + 3] = expected_accel.data[i];
     }
     for (size_t i = 0; i < 4; i++) {
         measured_data[i + 6] = attitude[i];
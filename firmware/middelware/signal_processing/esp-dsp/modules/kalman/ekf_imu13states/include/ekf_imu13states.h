@@ -27,6 +27,8 @@
 *   X[10..12] - magnetometer offset value - magn_offset
 *
 *   where, reference magnetometer value = magn_ampl*rotation_matrix' + magn_offset
+*
+*   Process() and the UpdateRefMeasurement...() methods don't allocate memory.
 */
 class ekf_imu13states: public ekf {
 public:
@@ -37,6 +39,7 @@ public:
     // Method calculates Xdot values depends on U
     // U - gyroscope values in radian per seconds (rad/sec)
     virtual dspm::Mat StateXdot(dspm::Mat &x, float *u);
+    virtual void StateXdot(dspm::Mat &x, float *u, float *xdot);
     virtual void LinearizeFG(dspm::Mat &x, float *u);
 
     /**
@@ -93,6 +96,21 @@ public:
      */
     void UpdateRefMeasurement(float *accel_data, float *magn_data, float *attitude, float R[10]);
 
+protected:
+    /**
+    *     Work memory for the derivative matrix H of the measurements (10 x NUMX).
+    */
+    dspm::Mat Hwork;
+
+    /**
+     * Fill the accelerometer and magnetometer part of H (rows 0..5) and
+     * the expected accelerometer and magnetometer values.
+     *
+     * @param[in] H: derivative matrix, cleared
+     * @param[out] expected_data: expected magnetometer (0..2) and accelerometer (3..5) values
+     * @param[in] magn_states: include the magnetometer states (amplitude and offset) in H
+     */
+    void RefMeasurement(dspm::Mat &H, float *expected_data, bool magn_states);
 };
 
 #endif // _ekf_imu13states_H_
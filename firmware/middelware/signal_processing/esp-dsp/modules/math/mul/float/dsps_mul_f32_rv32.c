@@ -0,0 +1,47 @@
+// Element-wise multiplication for RISC-V cores (ESP32-C6).
+//
+// Strided accesses use pointer increments instead of index multiplications and
+// the common case (all steps equal to 1) is unrolled by 4.
+
+#include "dsps_mul.h"
+
+#if (dsps_mul_f32_rv32_enabled == 1)
+
+esp_err_t dsps_mul_f32_rv32(const float *input1, const float *input2, float *output, int len, int step1, int step2, int step_out)
+{
+    if (NULL == input1) {
+        return ESP_ERR_DSP_PARAM_OUTOFRANGE;
+    }
+    if (NULL == input2) {
+        return ESP_ERR_DSP_PARAM_OUTOFRANGE;
+    }
+    if (NULL == output) {
+        return ESP_ERR_DSP_PARAM_OUTOFRANGE;
+    }
+
+    int i = 0;
+    if ((step1 == 1) && (step2 == 1) && (step_out == 1)) {
+        for (; i < (len & ~3) ; i += 4) {
+            float x0 = input1[i] * input2[i];
+            float x1 = input1[i + 1] * input2[i + 1];
+            float x2 = input1[i + 2] * input2[i + 2];
+            float x3 = input1[i + 3] * input2[i + 3];
+            output[i] = x0;
+            output[i + 1] = x1;
+            output[i + 2] = x2;
+            output[i + 3] = x3;
+        }
+        input1 += i;
+        input2 += i;
+        output += i;
+    }
+    for (; i < len ; i++) {
+        *output = *input1 * *input2;
+        input1 += step1;
+        input2 += step2;
+        output += step_out;
+    }
+    return ESP_OK;
+}
+
+#endif // dsps_mul_f32_rv32_enabled
@@ -27,4 +27,10 @@
 
 #endif // __XTENSA__
 
+#ifdef __riscv
+
+#define dsps_mul_f32_rv32_enabled 1
+
+#endif // __riscv
+
 #endif // _dsps_mul_platform_H_
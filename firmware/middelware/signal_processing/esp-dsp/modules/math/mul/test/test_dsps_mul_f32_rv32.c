@@ -0,0 +1,76 @@
+// Tests for the RISC-V element-wise multiplication (ESP32-C6).
+
+#include <string.h>
+#include "unity.h"
+#include "dsp_platform.h"
+#include "esp_log.h"
+
+#include "dsps_mul.h"
+#include "dsp_tests.h"
+
+#if (dsps_mul_f32_rv32_enabled == 1)
+
+static const char *TAG = "dsps_mul_f32_rv32";
+
+TEST_CASE("dsps_mul_f32_rv32 functionality", "[dsps]")
+{
+    int n = 67;
+    float x[2 * n];
+    float y[2 * n];
+    float z[2 * n];
+    float z_ansi[2 * n];
+
+    for (int i = 0 ; i < 2 * n ; i++) {
+        x[i] = i;
+        y[i] = 0.5f * i - 3;
+    }
+    // Unit stride (unrolled path), every tail length
+    for (int len = 0 ; len <= n ; len++) {
+        TEST_ESP_OK(dsps_mul_f32_rv32(x, y, z, len, 1, 1, 1));
+        dsps_mul_f32_ansi(x, y, z_ansi, len, 1, 1, 1);
+        for (int i = 0 ; i < len ; i++) {
+            TEST_ASSERT_EQUAL(z_ansi[i], z[i]);
+        }
+    }
+    // Strided, as used by fft.c to fill the real part of a complex array
+    memset(z, 0, sizeof(z));
+    memset(z_ansi, 0, sizeof(z_ansi));
+    dsps_mul_f32_rv32(x, y, z, n, 1, 1, 2);
+    dsps_mul_f32_ansi(x, y, z_ansi, n, 1, 1, 2);
+    for (int i = 0 ; i < 2 * n ; i++) {
+        TEST_ASSERT_EQUAL(z_ansi[i], z[i]);
+    }
+    // In place
+    memcpy(z, x, n * sizeof(float));
+    dsps_mul_f32_rv32(z, z, z, n, 1, 1, 1);
+    for (int i = 0 ; i < n ; i++) {
+        TEST_ASSERT_EQUAL(x[i] * x[i], z[i]);
+    }
+    TEST_ASSERT_EQUAL(ESP_ERR_DSP_PARAM_OUTOFRANGE, dsps_mul_f32_rv32(NULL, y, z, n, 1, 1, 1));
+}
+
+TEST_CASE("dsps_mul_f32_rv32 benchmark", "[dsps]")
+{
+    int n = 256;
+    float x[n];
+    float z[n];
+
+    for (int i = 0 ; i < n ; i++) {
+        x[i] = i;
+    }
+
+    unsigned int start_b = dsp_get_cpu_cycle_count();
+    dsps_mul_f32_rv32(x, x, z, n, 1, 1, 1);
+    float cycles = (float)(dsp_get_cpu_cycle_count() - start_b) / n;
+
+    start_b = dsp_get_cpu_cycle_count();
+    dsps_mul_f32_ansi(x, x, z, n, 1, 1, 1);
+    float cycles_ansi = (float)(dsp_get_cpu_cycle_count() - start_b) / n;
+
+    ESP_LOGI(TAG, "dsps_mul_f32_rv32 - %f cycles per sample", cycles);
+    ESP_LOGI(TAG, "dsps_mul_f32_ansi - %f cycles per sample", cycles_ansi);
+    // Must not be slower than the ANSI version (10% margin for cache effects)
+    TEST_ASSERT_EXEC_IN_RANGE(1, cycles_ansi * 1.1f, cycles);
+}
+
+#endif // dsps_mul_f32_rv32_enabled
@@ -0,0 +1,140 @@
+// Factorizations of dspm::Mat matrices (Cholesky, LDL', LU), calculated
+// once and reused for many A*x = b solves.
+
+#ifndef _dspm_mat_factor_h_
+#define _dspm_mat_factor_h_
+#include "mat.h"
+#include "dsp_err.h"
+
+namespace dspm {
+
+/**
+ * @brief   Cholesky (L*L') or LDL' factorization of a symmetric matrix
+ *
+ * The memory is allocated by the constructor: factor() and solve() don't
+ * allocate. Use it for symmetric positive definite matrices (covariance,
+ * normal equations of a least squares calibration, ...). The LDL' version
+ * doesn't need square roots and also works with indefinite matrices that
+ * have no zero pivots.
+ */
+class Cholesky {
+public:
+    /**
+     * Constructor
+     * @param[in] n: matrix size [n]x[n]
+     * @param[in] ldlt: LDL' factorization instead of L*L'
+     */
+    Cholesky(int n, bool ldlt = false);
+
+    /**
+     * Factorize A (only its lower triangle is read). A is not modified.
+     * @param[in] A: symmetric matrix [n]x[n]
+     *
+     * @return
+     *      - ESP_OK on success
+     *      - ESP_ERR_DSP_INVALID_PARAM if A is not positive definite (L*L') or has a zero pivot (LDL')
+     *      - ESP_ERR_DSP_INVALID_LENGTH if A has a wrong size
+     */
+    esp_err_t factor(const Mat &A);
+
+    /**
+     * Solve A*x = b.
+     * @param[in] b: right-hand sides [n]x[m]
+     * @param[out] x: results [n]x[m] (can be b)
+     *
+     * @return
+     *      - ESP_OK on success
+     *      - One of the error codes from DSP library
+     */
+    esp_err_t solve(const Mat &b, Mat &x) const;
+
+    /**
+     * Solve A*x = b, new result matrix.
+     * @param[in] b: right-hand sides [n]x[m]
+     *
+     * @return
+     *      - matrix [n]x[m] with the results (0x0 if A is not factorized)
+     */
+    Mat solve(const Mat &b) const;
+
+    /**
+     * Determinant of A
+     */
+    float det() const;
+
+    Mat F;          /*!< Factors: L (lower triangle), or unit L (below the diagonal) and D (diagonal)*/
+    bool ldlt;      /*!< LDL' factorization*/
+    bool valid;     /*!< F holds the factors of a matrix*/
+};
+
+/**
+ * @brief   LU factorization with partial pivoting of a square matrix
+ *
+ * The memory is allocated by the constructor: factor() and solve() don't
+ * allocate.
+ */
+class LU {
+public:
+    /**
+     * Constructor
+     * @param[in] n: matrix size [n]x[n]
+     */
+    LU(int n);
+    ~LU();
+    LU(const LU &) = delete;
+    LU &operator=(const LU &) = delete;
+
+    /**
+     * Factorize A. A is not modified.
+     * @param[in] A: matrix [n]x[n]
+     *
+     * @return
+     *      - ESP_OK on success
+     *      - ESP_ERR_DSP_INVALID_PARAM if A is singular
+     *      - ESP_ERR_DSP_INVALID_LENGTH if A has a wrong size
+     */
+    esp_err_t factor(const Mat &A);
+
+    /**
+     * Solve A*x = b.
+     * @param[in] b: right-hand sides [n]x[m]
+     * @param[out] x: results [n]x[m] (can be b)
+     *
+     * @return
+     *      - ESP_OK on success
+     *      - One of the error codes from DSP library
+     */
+    esp_err_t solve(const Mat &b, Mat &x) const;
+
+    /**
+     * Solve A*x = b, new result matrix.
+     * @param[in] b: right-hand sides [n]x[m]
+     *
+     * @return
+     *      - matrix [n]x[m] with the results (0x0 if A is not factorized)
+     */
+    Mat solve(const Mat &b) const;
+
+    /**
+     * Determinant of A
+     */
+    float det() const;
+
+    /**
+     * Inverse of A.
+     * @param[out] result: matrix [n]x[n]
+     *
+     * @return
+     *      - ESP_OK on success
+     *      - One of the error codes from DSP library
+     */
+    esp_err_t inverse(Mat &result) const;
+
+    Mat F;          /*!< Factors: unit L (below the diagonal) and U*/
+    int *pivot;     /*!< Row swaps*/
+    int sign;       /*!< Determinant of the row swaps (+1 or -1)*/
+    bool valid;     /*!< F holds the factors of a matrix*/
+};
+
+} // namespace dspm
+#endif //_dspm_mat_factor_h_
@@ -0,0 +1,353 @@
+// Fixed size matrix, allocation free version of dspm::Mat for small
+// matrices (3x3, 4x4, filters with a known number of states).
+
+#ifndef _dspm_matn_h_
+#define _dspm_matn_h_
+#include <string.h>
+#include <math.h>
+#include "mat.h"
+#include "dspm_mult.h"
+
+namespace dspm {
+
+template <int R, int C> class MatN;
+
+/**
+ * @brief   Product A * B, not calculated yet
+ *
+ * operator* returns this expression, so A * B + C is calculated in one pass
+ * (dspm::mult_add) and A * B is calculated directly in the destination.
+ * It keeps references to A and B: assign it to a MatN, don't keep it
+ * (auto x = A * B;).
+ */
+template <int R, int K, int C>
+struct MatNMul {
+    const MatN<R, K> &A;    /*!< Left operand*/
+    const MatN<K, C> &B;    /*!< Right operand*/
+};
+
+/**
+ * @brief   Fixed size matrix
+ *
+ * The data is a member array (R x C floats, row-major, no padding), so the
+ * matrix never allocates memory: it can live on the stack, in a static
+ * variable or inside another object. Copies (and moves) copy R x C floats.
+ * The sizes are template parameters: operations with matrices of wrong
+ * sizes don't compile.
+ *
+ * The data array can be passed to the dspm_xxx_f32 functions, and view()
+ * gives a dspm::Mat that uses the same data (no copy, no allocation).
+ */
+template <int R, int C>
+class MatN {
+    static_assert((R > 0) && (C > 0), "Matrix sizes must be positive");
+public:
+    static constexpr int rows = R;          /*!< Amount of rows*/
+    static constexpr int cols = C;          /*!< Amount of columns*/
+    static constexpr int length = R * C;    /*!< Total amount of data*/
+    alignas(16) float data[R * C];          /*!< Matrix data (row-major)*/
+
+    /**
+     * Constructor, all elements 0.
+     */
+    MatN()
+    {
+        memset(data, 0, sizeof(data));
+    }
+
+    /**
+     * Constructor, copy of a row-major array of R x C values.
+     * @param[in] src: source data
+     */
+    explicit MatN(const float *src)
+    {
+        memcpy(data, src, sizeof(data));
+    }
+
+    /**
+     * Constructor, copy of a dspm::Mat with the same size (only the first
+     * R x C values are copied if the sizes are different).
+     * @param[in] src: source matrix
+     */
+    explicit MatN(const Mat &src)
+    {
+        memset(data, 0, sizeof(data));
+        for (int i = 0; (i < R) && (i < src.rows); i++) {
+            for (int j = 0; (j < C) && (j < src.cols); j++) {
+                (*this)(i, j) = src(i, j);
+            }
+        }
+    }
+
+    /**
+     * Constructor, result of a product.
+     * @param[in] expr: A * B
+     */
+    template <int K>
+    MatN(const MatNMul<R, K, C> &expr)
+    {
+        dspm_mult_f32(expr.A.data, expr.B.data, data, R, K, C);
+    }
+
+    MatN(const MatN &src) = default;
+    MatN &operator=(const MatN &src) = default;
+
+    /**
+     * Result of a product. The destination can be one of the operands.
+     * @param[in] expr: A * B
+     */
+    template <int K>
+    MatN &operator=(const MatNMul<R, K, C> &expr)
+    {
+        if (((const void *)&expr.A == this) || ((const void *)&expr.B == this)) {
+            MatN tmp(expr);
+            *this = tmp;
+        } else {
+            dspm_mult_f32(expr.A.data, expr.B.data, data, R, K, C);
+        }
+        return *this;
+    }
+
+    /**
+     * Access to the matrix elements.
+     * @param[in] row: row position
+     * @param[in] col: column position
+     *
+     * @return element of matrix M[row][col]
+     */
+    inline float &operator()(int row, int col)
+    {
+        return data[row * C + col];
+    }
+    inline const float &operator()(int row, int col) const
+    {
+        return data[row * C + col];
+    }
+
+    /**
+     * dspm::Mat that uses the data of this matrix (no copy, no allocation).
+     * The MatN must exist while the Mat is used.
+     */
+    Mat view()
+    {
+        return Mat(data, R, C);
+    }
+
+    /**
+     * Copy to a dspm::Mat (it must have the same size).
+     * @param[out] dest: destination matrix
+     */
+    void copyTo(Mat &dest) const
+    {
+        for (int i = 0; i < R; i++) {
+            for (int j = 0; j < C; j++) {
+                dest(i, j) = (*this)(i, j);
+            }
+        }
+    }
+
+    MatN &operator+=(const MatN &A)
+    {
+        for (int i = 0; i < R * C; i++) {
+            data[i] += A.data[i];
+        }
+        return *this;
+    }
+
+    /**
+     * += A * B, calculated in one pass (no temporary matrix). The destination
+     * can be one of the operands (P += P * Q), then A * B is calculated first.
+     */
+    template <int K>
+    MatN &operator+=(const MatNMul<R, K, C> &expr)
+    {
+        if (((const void *)&expr.A == this) || ((const void *)&expr.B == this)) {
+            MatN tmp(expr);
+            *this += tmp;
+        } else {
+            mult_add_to(expr.A, expr.B, *this);
+        }
+        return *this;
+    }
+
+    MatN &operator-=(const MatN &A)
+    {
+        for (int i = 0; i < R * C; i++) {
+            data[i] -= A.data[i];
+        }
+        return *this;
+    }
+
+    MatN &operator*=(float C_)
+    {
+        for (int i = 0; i < R * C; i++) {
+            data[i] *= C_;
+        }
+        return *this;
+    }
+
+    MatN &operator/=(float C_)
+    {
+        return *this *= 1.0f / C_;
+    }
+
+    /**
+     * Transposed matrix.
+     */
+    MatN<C, R> t() const
+    {
+        MatN<C, R> result;
+        for (int i = 0; i < R; i++) {
+            for (int j = 0; j < C; j++) {
+                result(j, i) = (*this)(i, j);
+            }
+        }
+        return result;
+    }
+
+    /**
+     * Identity matrix (square matrices only).
+     */
+    static MatN eye()
+    {
+        static_assert(R == C, "Identity matrix must be square");
+        MatN result;
+        for (int i = 0; i < R; i++) {
+            result(i, i) = 1;
+        }
+        return result;
+    }
+
+    /**
+     * Euclidean norm of the matrix (all elements).
+     */
+    float norm() const
+    {
+        float sum = 0;
+        for (int i = 0; i < R * C; i++) {
+            sum += data[i] * data[i];
+        }
+        return sqrtf(sum);
+    }
+};
+
+/**
+ * @brief   result += A * B, in one pass. result must not be A or B.
+ */
+template <int R, int K, int C>
+void mult_add_to(const MatN<R, K> &A, const MatN<K, C> &B, MatN<R, C> &result)
+{
+    for (int i = 0; i < R; i++) {
+        for (int j = 0; j < C; j++) {
+            float acc = result(i, j);
+            for (int k = 0; k < K; k++) {
+                acc += A(i, k) * B(k, j);
+            }
+            result(i, j) = acc;
+        }
+    }
+}
+
+/**
+ * @brief   result = A * B (dspm_mult_f32). result must not be A or B.
+ */
+template <int R, int K, int C>
+void mult(const MatN<R, K> &A, const MatN<K, C> &B, MatN<R, C> &result)
+{
+    dspm_mult_f32(A.data, B.data, result.data, R, K, C);
+}
+
+/**
+ * @brief   result = A * B + D, in one pass. result can be D, A or B.
+ */
+template <int R, int K, int C>
+void mult_add(const MatN<R, K> &A, const MatN<K, C> &B, const MatN<R, C> &D, MatN<R, C> &result)
+{
+    if (((const void *)&A == &result) || ((const void *)&B == &result)) {
+        MatN<R, C> tmp(D);
+        mult_add_to(A, B, tmp);
+        result = tmp;
+        return;
+    }
+    if (&result != &D) {
+        result = D;
+    }
+    mult_add_to(A, B, result);
+}
+
+/**
+ * @brief   result = A * B' (B not transposed in memory). result must not be A or B.
+ */
+template <int R, int K, int C>
+void mult_t(const MatN<R, K> &A, const MatN<C, K> &B, MatN<R, C> &result)
+{
+    for (int i = 0; i < R; i++) {
+        for (int j = 0; j < C; j++) {
+            float acc = 0;
+            for (int k = 0; k < K; k++) {
+                acc += A(i, k) * B(j, k);
+            }
+            result(i, j) = acc;
+        }
+    }
+}
+
+template <int R, int K, int C>
+MatNMul<R, K, C> operator*(const MatN<R, K> &A, const MatN<K, C> &B)
+{
+    return MatNMul<R, K, C> {A, B};
+}
+
+template <int R, int K, int C, int C2>
+MatN<R, C2> operator*(const MatNMul<R, K, C> &expr, const MatN<C, C2> &B)
+{
+    MatN<R, C> AB(expr);
+    return MatN<R, C2>(AB * B);
+}
+
+template <int R, int K, int C>
+MatN<R, C> operator+(const MatNMul<R, K, C> &expr, const MatN<R, C> &D)
+{
+    MatN<R, C> result(D);
+    mult_add_to(expr.A, expr.B, result);
+    return result;
+}
+
+template <int R, int K, int C>
+MatN<R, C> operator+(const MatN<R, C> &D, const MatNMul<R, K, C> &expr)
+{
+    return expr + D;
+}
+
+template <int R, int C>
+MatN<R, C> operator+(const MatN<R, C> &A, const MatN<R, C> &B)
+{
+    MatN<R, C> result(A);
+    result += B;
+    return result;
+}
+
+template <int R, int C>
+MatN<R, C> operator-(const MatN<R, C> &A, const MatN<R, C> &B)
+{
+    MatN<R, C> result(A);
+    result -= B;
+    return result;
+}
+
+template <int R, int C>
+MatN<R, C> operator*(const MatN<R, C> &A, float C_)
+{
+    MatN<R, C> result(A);
+    result *= C_;
+    return result;
+}
+
+template <int R, int C>
+MatN<R, C> operator*(float C_, const MatN<R, C> &A)
+{
+    return A * C_;
+}
+
+} // namespace dspm
+#endif //_dspm_matn_h_
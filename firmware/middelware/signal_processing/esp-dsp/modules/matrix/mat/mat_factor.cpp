@@ -0,0 +1,146 @@
+#include <string.h>
+#include "mat_factor.h"
+#include "dspm_solve.h"
+
+namespace dspm {
+
+// Copy of a square matrix (can be a sub-matrix) to the factors
+static esp_err_t factor_copy(Mat &F, const Mat &A)
+{
+    if ((A.rows != F.rows) || (A.cols != F.cols)) {
+        return ESP_ERR_DSP_INVALID_LENGTH;
+    }
+    for (int r = 0; r < A.rows; r++) {
+        memcpy(&F.data[r * F.cols], &A.data[r * A.stride], A.cols * sizeof(float));
+    }
+    return ESP_OK;
+}
+
+// The solves work on the data arrays: no sub-matrices
+static esp_err_t solve_check(const Mat &F, bool valid, const Mat &b, const Mat &x)
+{
+    if (!valid) {
+        return ESP_ERR_DSP_UNINITIALIZED;
+    }
+    if ((b.rows != F.rows) || (x.rows != b.rows) || (x.cols != b.cols)) {
+        return ESP_ERR_DSP_INVALID_LENGTH;
+    }
+    if ((b.stride != b.cols) || (x.stride != x.cols)) {
+        return ESP_ERR_DSP_PARAM_OUTOFRANGE;
+    }
+    return ESP_OK;
+}
+
+Cholesky::Cholesky(int n, bool ldlt) : F(n, n), ldlt(ldlt), valid(false)
+{
+}
+
+esp_err_t Cholesky::factor(const Mat &A)
+{
+    this->valid = false;
+    esp_err_t ret = factor_copy(this->F, A);
+    if (ret != ESP_OK) {
+        return ret;
+    }
+    ret = this->ldlt ? dspm_ldlt_f32(this->F.data, this->F.rows) : dspm_chol_f32(this->F.data, this->F.rows);
+    this->valid = (ret == ESP_OK);
+    return ret;
+}
+
+esp_err_t Cholesky::solve(const Mat &b, Mat &x) const
+{
+    esp_err_t ret = solve_check(this->F, this->valid, b, x);
+    if (ret != ESP_OK) {
+        return ret;
+    }
+    if (this->ldlt) {
+        return dspm_ldlt_solve_f32(this->F.data, this->F.rows, b.data, x.data, b.cols);
+    }
+    return dspm_chol_solve_f32(this->F.data, this->F.rows, b.data, x.data, b.cols);
+}
+
+Mat Cholesky::solve(const Mat &b) const
+{
+    Mat x(b.rows, b.cols);
+    if (this->solve(b, x) != ESP_OK) {
+        Mat err_result(0, 0);
+        return err_result;
+    }
+    return x;
+}
+
+float Cholesky::det() const
+{
+    float result = 1;
+    for (int i = 0; i < this->F.rows; i++) {
+        float d = this->F(i, i);
+        result *= this->ldlt ? d : d * d;
+    }
+    return result;
+}
+
+LU::LU(int n) : F(n, n), sign(1), valid(false)
+{
+    this->pivot = new int[n];
+}
+
+LU::~LU()
+{
+    delete[] this->pivot;
+}
+
+esp_err_t LU::factor(const Mat &A)
+{
+    this->valid = false;
+    esp_err_t ret = factor_copy(this->F, A);
+    if (ret != ESP_OK) {
+        return ret;
+    }
+    ret = dspm_lu_f32(this->F.data, this->F.rows, this->pivot, &this->sign);
+    this->valid = (ret == ESP_OK);
+    return ret;
+}
+
+esp_err_t LU::solve(const Mat &b, Mat &x) const
+{
+    esp_err_t ret = solve_check(this->F, this->valid, b, x);
+    if (ret != ESP_OK) {
+        return ret;
+    }
+    return dspm_lu_solve_f32(this->F.data, this->pivot, this->F.rows, b.data, x.data, b.cols);
+}
+
+Mat LU::solve(const Mat &b) const
+{
+    Mat x(b.rows, b.cols);
+    if (this->solve(b, x) != ESP_OK) {
+        Mat err_result(0, 0);
+        return err_result;
+    }
+    return x;
+}
+
+float LU::det() const
+{
+    float result = this->sign;
+    for (int i = 0; i < this->F.rows; i++) {
+        result *= this->F(i, i);
+    }
+    return result;
+}
+
+esp_err_t LU::inverse(Mat &result) const
+{
+    if ((result.rows != this->F.rows) || (result.cols != this->F.cols)) {
+        return ESP_ERR_DSP_INVALID_LENGTH;
+    }
+    // A * result = I
+    for (int i = 0; i < result.rows; i++) {
+        for (int j = 0; j < result.cols; j++) {
+            result(i, j) = (i == j) ? 1 : 0;
+        }
+    }
+    return this->solve(result, result);
+}
+
+} // namespace dspm
@@ -0,0 +1,111 @@
+// Cholesky (L*L') and LDL' factorizations and solves, in place.
+// L is stored in the lower triangle of the row-major matrix, so the inner
+// loops are dot products of two rows (contiguous data).
+
+#include <math.h>
+#include <string.h>
+#include "dspm_solve.h"
+
+esp_err_t dspm_chol_f32_ansi(float *A, int n)
+{
+    if (NULL == A) {
+        return ESP_ERR_DSP_PARAM_OUTOFRANGE;
+    }
+    if (n <= 0) {
+        return ESP_ERR_DSP_PARAM_OUTOFRANGE;
+    }
+
+    for (int j = 0; j < n; j++) {
+        float *Lj = &A[j * n];
+        float d = Lj[j];
+        for (int k = 0; k < j; k++) {
+            d -= Lj[k] * Lj[k];
+        }
+        if (!(d > 0)) {
+            // Not positive definite
+            return ESP_ERR_DSP_INVALID_PARAM;
+        }
+        d = sqrtf(d);
+        Lj[j] = d;
+        float inv_d = 1.0f / d;
+        for (int i = j + 1; i < n; i++) {
+            float *Li = &A[i * n];
+            float s = Li[j];
+            for (int k = 0; k < j; k++) {
+                s -= Li[k] * Lj[k];
+            }
+            Li[j] = s * inv_d;
+        }
+    }
+    return ESP_OK;
+}
+
+esp_err_t dspm_ldlt_f32_ansi(float *A, int n)
+{
+    if (NULL == A) {
+        return ESP_ERR_DSP_PARAM_OUTOFRANGE;
+    }
+    if (n <= 0) {
+        return ESP_ERR_DSP_PARAM_OUTOFRANGE;
+    }
+
+    for (int j = 0; j < n; j++) {
+        float *Lj = &A[j * n];
+        float d = Lj[j];
+        for (int k = 0; k < j; k++) {
+            d -= Lj[k] * Lj[k] * A[k * n + k];
+        }
+        if (d == 0) {
+            return ESP_ERR_DSP_INVALID_PARAM;
+        }
+        Lj[j] = d;
+        float inv_d = 1.0f / d;
+        for (int i = j + 1; i < n; i++) {
+            float *Li = &A[i * n];
+            float s = Li[j];
+            for (int k = 0; k < j; k++) {
+                s -= Li[k] * Lj[k] * A[k * n + k];
+            }
+            Li[j] = s * inv_d;
+        }
+    }
+    return ESP_OK;
+}
+
+esp_err_t dspm_chol_solve_f32_ansi(const float *L, int n, const float *b, float *x, int nrhs)
+{
+    if ((NULL == b) || (NULL == x)) {
+        return ESP_ERR_DSP_PARAM_OUTOFRANGE;
+    }
+    if (x != b) {
+        memcpy(x, b, n * nrhs * sizeof(float));
+    }
+    // L*y = b, L'*x = y
+    esp_err_t ret = dspm_solve_lower_f32_ansi(L, n, x, nrhs, false);
+    if (ret != ESP_OK) {
+        return ret;
+    }
+    return dspm_solve_lower_t_f32_ansi(L, n, x, nrhs, false);
+}
+
+esp_err_t dspm_ldlt_solve_f32_ansi(const float *LD, int n, const float *b, float *x, int nrhs)
+{
+    if ((NULL == b) || (NULL == x)) {
+        return ESP_ERR_DSP_PARAM_OUTOFRANGE;
+    }
+    if (x != b) {
+        memcpy(x, b, n * nrhs * sizeof(float));
+    }
+    // L*z = b, D*y = z, L'*x = y
+    esp_err_t ret = dspm_solve_lower_f32_ansi(LD, n, x, nrhs, true);
+    if (ret != ESP_OK) {
+        return ret;
+    }
+    for (int i = 0; i < n; i++) {
+        float inv_d = 1.0f / LD[i * n + i];
+        for (int c = 0; c < nrhs; c++) {
+            x[i * nrhs + c] *= inv_d;
+        }
+    }
+    return dspm_solve_lower_t_f32_ansi(LD, n, x, nrhs, true);
+}
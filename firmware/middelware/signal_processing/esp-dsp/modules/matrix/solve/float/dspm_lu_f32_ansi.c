@@ -0,0 +1,87 @@
+// LU factorization with partial pivoting and solve, in place.
+// The row swaps are kept as a list (as LAPACK getrf), so they can be
+// applied to the right-hand sides in place.
+
+#include <math.h>
+#include <string.h>
+#include "dspm_solve.h"
+
+static void dspm_lu_swap_rows(float *A, int cols, int r1, int r2)
+{
+    for (int j = 0; j < cols; j++) {
+        float t = A[r1 * cols + j];
+        A[r1 * cols + j] = A[r2 * cols + j];
+        A[r2 * cols + j] = t;
+    }
+}
+
+esp_err_t dspm_lu_f32_ansi(float *A, int n, int *pivot, int *sign)
+{
+    if ((NULL == A) || (NULL == pivot)) {
+        return ESP_ERR_DSP_PARAM_OUTOFRANGE;
+    }
+    if (n <= 0) {
+        return ESP_ERR_DSP_PARAM_OUTOFRANGE;
+    }
+
+    int s = 1;
+    for (int k = 0; k < n; k++) {
+        // Pivot: biggest value of the column
+        int p = k;
+        float max_val = fabsf(A[k * n + k]);
+        for (int i = k + 1; i < n; i++) {
+            float v = fabsf(A[i * n + k]);
+            if (v > max_val) {
+                max_val = v;
+                p = i;
+            }
+        }
+        if (max_val == 0) {
+            // Singular matrix
+            return ESP_ERR_DSP_INVALID_PARAM;
+        }
+        pivot[k] = p;
+        if (p != k) {
+            dspm_lu_swap_rows(A, n, k, p);
+            s = -s;
+        }
+        const float *Uk = &A[k * n];
+        float inv_pivot = 1.0f / Uk[k];
+        for (int i = k + 1; i < n; i++) {
+            float *Ai = &A[i * n];
+            float l = Ai[k] * inv_pivot;
+            Ai[k] = l;
+            if (l == 0) {
+                continue;
+            }
+            for (int j = k + 1; j < n; j++) {
+                Ai[j] -= l * Uk[j];
+            }
+        }
+    }
+    if (sign) {
+        *sign = s;
+    }
+    return ESP_OK;
+}
+
+esp_err_t dspm_lu_solve_f32_ansi(const float *LU, const int *pivot, int n, const float *b, float *x, int nrhs)
+{
+    if ((NULL == pivot) || (NULL == b) || (NULL == x)) {
+        return ESP_ERR_DSP_PARAM_OUTOFRANGE;
+    }
+    if (x != b) {
+        memcpy(x, b, n * nrhs * sizeof(float));
+    }
+    // x = P*b, L*y = x, U*x = y
+    for (int k = 0; k < n; k++) {
+        if (pivot[k] != k) {
+            dspm_lu_swap_rows(x, nrhs, k, pivot[k]);
+        }
+    }
+    esp_err_t ret = dspm_solve_lower_f32_ansi(LU, n, x, nrhs, true);
+    if (ret != ESP_OK) {
+        return ret;
+    }
+    return dspm_solve_upper_f32_ansi(LU, n, x, nrhs, false);
+}
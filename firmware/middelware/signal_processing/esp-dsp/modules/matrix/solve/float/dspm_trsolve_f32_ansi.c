@@ -0,0 +1,93 @@
+// Triangular solves in place, for any number of right-hand sides.
+// x is [n]x[nrhs] row-major: each step updates a full row of x with a row
+// of the solved ones.
+
+#include "dspm_solve.h"
+
+static esp_err_t dspm_trsolve_check(const float *T, int n, float *x, int nrhs)
+{
+    if ((NULL == T) || (NULL == x)) {
+        return ESP_ERR_DSP_PARAM_OUTOFRANGE;
+    }
+    if ((n <= 0) || (nrhs <= 0)) {
+        return ESP_ERR_DSP_PARAM_OUTOFRANGE;
+    }
+    return ESP_OK;
+}
+
+static void dspm_trsolve_div(float *xi, float d, int nrhs)
+{
+    float inv_d = 1.0f / d;
+    for (int c = 0; c < nrhs; c++) {
+        xi[c] *= inv_d;
+    }
+}
+
+// L*x = b, forward substitution
+esp_err_t dspm_solve_lower_f32_ansi(const float *T, int n, float *x, int nrhs, bool unit)
+{
+    esp_err_t ret = dspm_trsolve_check(T, n, x, nrhs);
+    if (ret != ESP_OK) {
+        return ret;
+    }
+    for (int i = 0; i < n; i++) {
+        float *xi = &x[i * nrhs];
+        for (int k = 0; k < i; k++) {
+            float l = T[i * n + k];
+            const float *xk = &x[k * nrhs];
+            for (int c = 0; c < nrhs; c++) {
+                xi[c] -= l * xk[c];
+            }
+        }
+        if (!unit) {
+            dspm_trsolve_div(xi, T[i * n + i], nrhs);
+        }
+    }
+    return ESP_OK;
+}
+
+// L'*x = b, backward substitution with the lower triangle (column i of L)
+esp_err_t dspm_solve_lower_t_f32_ansi(const float *T, int n, float *x, int nrhs, bool unit)
+{
+    esp_err_t ret = dspm_trsolve_check(T, n, x, nrhs);
+    if (ret != ESP_OK) {
+        return ret;
+    }
+    for (int i = n - 1; i >= 0; i--) {
+        float *xi = &x[i * nrhs];
+        for (int k = i + 1; k < n; k++) {
+            float l = T[k * n + i];
+            const float *xk = &x[k * nrhs];
+            for (int c = 0; c < nrhs; c++) {
+                xi[c] -= l * xk[c];
+            }
+        }
+        if (!unit) {
+            dspm_trsolve_div(xi, T[i * n + i], nrhs);
+        }
+    }
+    return ESP_OK;
+}
+
+// U*x = b, backward substitution
+esp_err_t dspm_solve_upper_f32_ansi(const float *T, int n, float *x, int nrhs, bool unit)
+{
+    esp_err_t ret = dspm_trsolve_check(T, n, x, nrhs);
+    if (ret != ESP_OK) {
+        return ret;
+    }
+    for (int i = n - 1; i >= 0; i--) {
+        float *xi = &x[i * nrhs];
+        for (int k = i + 1; k < n; k++) {
+            float u = T[i * n + k];
+            const float *xk = &x[k * nrhs];
+            for (int c = 0; c < nrhs; c++) {
+                xi[c] -= u * xk[c];
+            }
+        }
+        if (!unit) {
+            dspm_trsolve_div(xi, T[i * n + i], nrhs);
+        }
+    }
+    return ESP_OK;
+}
@@ -0,0 +1,155 @@
+#ifndef _dspm_solve_H_
+#define _dspm_solve_H_
+#include <stdbool.h>
+#include "dsp_err.h"
+
+#ifdef __cplusplus
+extern "C"
+{
+#endif
+
+// Factorizations of a square matrix A [n]x[n] (row-major, no padding),
+// calculated in place. The factors are kept in A and can be used for any
+// number of A*x = b solves, each one O(n^2) instead of the O(n^3) of a
+// new elimination.
+// The right-hand sides b and the results x are [n]x[nrhs] matrices
+// (row-major, one column per right-hand side).
+
+/**@{*/
+/**
+ * @brief   Cholesky factorization A = L*L' of a symmetric positive definite matrix
+ *
+ * Only the lower triangle of A is used. L is written to the lower triangle
+ * (diagonal included), the upper triangle is not modified.
+ * The implementation uses ANSI C and could be compiled and run on any platform
+ *
+ * @param[in,out] A: input matrix, L on output
+ * @param[in]     n: matrix size
+ *
+ * @return
+ *      - ESP_OK on success
+ *      - ESP_ERR_DSP_INVALID_PARAM if the matrix is not positive definite
+ *      - One of the error codes from DSP library
+ */
+esp_err_t dspm_chol_f32_ansi(float *A, int n);
+
+/**
+ * @brief   LDL' factorization A = L*D*L' of a symmetric matrix (no square roots)
+ *
+ * Only the lower triangle of A is used. The unit lower triangle L is written
+ * below the diagonal, D to the diagonal. The upper triangle is not modified.
+ * The implementation uses ANSI C and could be compiled and run on any platform
+ *
+ * @param[in,out] A: input matrix, L and D on output
+ * @param[in]     n: matrix size
+ *
+ * @return
+ *      - ESP_OK on success
+ *      - ESP_ERR_DSP_INVALID_PARAM if a pivot of D is 0
+ *      - One of the error codes from DSP library
+ */
+esp_err_t dspm_ldlt_f32_ansi(float *A, int n);
+
+/**
+ * @brief   LU factorization with partial pivoting P*A = L*U
+ *
+ * The unit lower triangle L is written below the diagonal, U to the
+ * diagonal and above. The rows of A are swapped in place: at step k, row k
+ * is swapped with row pivot[k] (pivot[k] >= k).
+ * The implementation uses ANSI C and could be compiled and run on any platform
+ *
+ * @param[in,out] A: input matrix, L and U on output
+ * @param[in]     n: matrix size
+ * @param[out]    pivot: row swaps (n values)
+ * @param[out]    sign: determinant of P, +1 or -1 (can be NULL)
+ *
+ * @return
+ *      - ESP_OK on success
+ *      - ESP_ERR_DSP_INVALID_PARAM if the matrix is singular
+ *      - One of the error codes from DSP library
+ */
+esp_err_t dspm_lu_f32_ansi(float *A, int n, int *pivot, int *sign);
+
+/**
+ * @brief   Solve A*x = b with the Cholesky factor L (dspm_chol_f32)
+ *
+ * @param[in]     L: factorization
+ * @param[in]     n: matrix size
+ * @param[in]     b: right-hand sides
+ * @param[out]    x: results (can be b)
+ * @param[in]     nrhs: number of right-hand sides
+ *
+ * @return
+ *      - ESP_OK on success
+ *      - One of the error codes from DSP library
+ */
+esp_err_t dspm_chol_solve_f32_ansi(const float *L, int n, const float *b, float *x, int nrhs);
+
+/**
+ * @brief   Solve A*x = b with the LDL' factorization (dspm_ldlt_f32)
+ *
+ * @param[in]     LD: factorization
+ * @param[in]     n: matrix size
+ * @param[in]     b: right-hand sides
+ * @param[out]    x: results (can be b)
+ * @param[in]     nrhs: number of right-hand sides
+ *
+ * @return
+ *      - ESP_OK on success
+ *      - One of the error codes from DSP library
+ */
+esp_err_t dspm_ldlt_solve_f32_ansi(const float *LD, int n, const float *b, float *x, int nrhs);
+
+/**
+ * @brief   Solve A*x = b with the LU factorization (dspm_lu_f32)
+ *
+ * @param[in]     LU: factorization
+ * @param[in]     pivot: row swaps
+ * @param[in]     n: matrix size
+ * @param[in]     b: right-hand sides
+ * @param[out]    x: results (can be b)
+ * @param[in]     nrhs: number of right-hand sides
+ *
+ * @return
+ *      - ESP_OK on success
+ *      - One of the error codes from DSP library
+ */
+esp_err_t dspm_lu_solve_f32_ansi(const float *LU, const int *pivot, int n, const float *b, float *x, int nrhs);
+
+/**
+ * @brief   Triangular solves in place: L*x = b, L'*x = b or U*x = b
+ *
+ * Only the needed triangle of the matrix is read, so the factors of the
+ * functions above can be used directly.
+ * The implementation uses ANSI C and could be compiled and run on any platform
+ *
+ * @param[in]     T: triangular matrix [n]x[n]
+ * @param[in]     n: matrix size
+ * @param[in,out] x: right-hand sides on input, results on output
+ * @param[in]     nrhs: number of right-hand sides
+ * @param[in]     unit: the diagonal is 1 (not read)
+ *
+ * @return
+ *      - ESP_OK on success
+ *      - One of the error codes from DSP library
+ */
+esp_err_t dspm_solve_lower_f32_ansi(const float *T, int n, float *x, int nrhs, bool unit);
+esp_err_t dspm_solve_lower_t_f32_ansi(const float *T, int n, float *x, int nrhs, bool unit);
+esp_err_t dspm_solve_upper_f32_ansi(const float *T, int n, float *x, int nrhs, bool unit);
+/**@}*/
+
+#ifdef __cplusplus
+}
+#endif
+
+#define dspm_chol_f32 dspm_chol_f32_ansi
+#define dspm_ldlt_f32 dspm_ldlt_f32_ansi
+#define dspm_lu_f32 dspm_lu_f32_ansi
+#define dspm_chol_solve_f32 dspm_chol_solve_f32_ansi
+#define dspm_ldlt_solve_f32 dspm_ldlt_solve_f32_ansi
+#define dspm_lu_solve_f32 dspm_lu_solve_f32_ansi
+#define dspm_solve_lower_f32 dspm_solve_lower_f32_ansi
+#define dspm_solve_lower_t_f32 dspm_solve_lower_t_f32_ansi
+#define dspm_solve_upper_f32 dspm_solve_upper_f32_ansi
+
+#endif // _dspm_solve_H_
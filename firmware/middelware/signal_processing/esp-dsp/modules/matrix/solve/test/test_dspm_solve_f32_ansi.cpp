@@ -0,0 +1,119 @@
+#include <string.h>
+#include <math.h>
+#include "unity.h"
+#include "esp_dsp.h"
+#include "dsp_platform.h"
+#include "esp_log.h"
+
+#include "dspm_solve.h"
+#include "mat_factor.h"
+#include "esp_attr.h"
+#include "dsp_tests.h"
+
+static const char *TAG = "dspm_solve_f32_ansi";
+
+// A*x = b, A symmetric positive definite, x = {1, 2, 3}
+static const float A_spd[9] = {4, 2, 0.6,
+                               2, 5, 1,
+                               0.6, 1, 3
+                              };
+static const float b_spd[3] = {9.8, 15, 11.6};
+
+TEST_CASE("dspm_chol_f32_ansi functionality", "[dspm]")
+{
+    float A[9];
+    float x[3];
+
+    memcpy(A, A_spd, sizeof(A));
+    TEST_ASSERT_EQUAL(ESP_OK, dspm_chol_f32_ansi(A, 3));
+    TEST_ASSERT_EQUAL(ESP_OK, dspm_chol_solve_f32_ansi(A, 3, b_spd, x, 1));
+    for (int i = 0 ; i < 3 ; i++) {
+        TEST_ASSERT_FLOAT_WITHIN(1e-5, i + 1, x[i]);
+    }
+
+    memcpy(A, A_spd, sizeof(A));
+    TEST_ASSERT_EQUAL(ESP_OK, dspm_ldlt_f32_ansi(A, 3));
+    memcpy(x, b_spd, sizeof(x));
+    TEST_ASSERT_EQUAL(ESP_OK, dspm_ldlt_solve_f32_ansi(A, 3, x, x, 1));
+    for (int i = 0 ; i < 3 ; i++) {
+        TEST_ASSERT_FLOAT_WITHIN(1e-5, i + 1, x[i]);
+    }
+
+    memcpy(A, A_spd, sizeof(A));
+    A[4] = -5;
+    TEST_ASSERT_EQUAL(ESP_ERR_DSP_INVALID_PARAM, dspm_chol_f32_ansi(A, 3));
+}
+
+TEST_CASE("dspm_lu_f32_ansi functionality", "[dspm]")
+{
+    // First pivot 0: needs a row swap
+    float A[9] = {0, 1, 2,
+                  3, 0, 1,
+                  1, 4, 0
+                 };
+    float b[3] = {8, 6, 9};
+    float x[3];
+    int pivot[3];
+    int sign;
+
+    TEST_ASSERT_EQUAL(ESP_OK, dspm_lu_f32_ansi(A, 3, pivot, &sign));
+    TEST_ASSERT_EQUAL(ESP_OK, dspm_lu_solve_f32_ansi(A, pivot, 3, b, x, 1));
+    for (int i = 0 ; i < 3 ; i++) {
+        TEST_ASSERT_FLOAT_WITHIN(1e-5, i + 1, x[i]);
+    }
+    float det = sign * A[0] * A[4] * A[8];
+    TEST_ASSERT_FLOAT_WITHIN(1e-4, 25, det);
+
+    float S[4] = {1, 2, 2, 4};
+    TEST_ASSERT_EQUAL(ESP_ERR_DSP_INVALID_PARAM, dspm_lu_f32_ansi(S, 2, pivot, NULL));
+}
+
+TEST_CASE("dspm::Cholesky and dspm::LU functionality", "[dspm]")
+{
+    dspm::Mat A((float *)A_spd, 3, 3);
+    dspm::Mat b((float *)b_spd, 3, 1);
+    dspm::Cholesky chol(3);
+    dspm::LU lu(3);
+
+    TEST_ASSERT_EQUAL(ESP_OK, chol.factor(A));
+    TEST_ASSERT_EQUAL(ESP_OK, lu.factor(A));
+    dspm::Mat x1 = chol.solve(b);
+    dspm::Mat x2 = lu.solve(b);
+    for (int i = 0 ; i < 3 ; i++) {
+        TEST_ASSERT_FLOAT_WITHIN(1e-5, i + 1, x1(i, 0));
+        TEST_ASSERT_FLOAT_WITHIN(1e-5, i + 1, x2(i, 0));
+    }
+    TEST_ASSERT_FLOAT_WITHIN(1e-3, chol.det(), lu.det());
+}
+
+TEST_CASE("dspm_chol_solve_f32_ansi benchmark", "[dspm]")
+{
+    const int n = 8;
+    float A[n * n];
+    float b[n];
+    float x[n];
+    for (int i = 0 ; i < n ; i++) {
+        for (int j = 0 ; j < n ; j++) {
+            A[i * n + j] = (i == j) ? n : 1.0f / (1 + i + j);
+        }
+        b[i] = i;
+    }
+    dspm_chol_f32_ansi(A, n);
+
+    portENTER_CRITICAL(&testnlock);
+
+    unsigned int start_b = dsp_get_cpu_cycle_count();
+    int repeat_count = 1024;
+    for (int i = 0 ; i < repeat_count ; i++) {
+        dspm_chol_solve_f32_ansi(A, n, b, x, 1);
+    }
+    unsigned int end_b = dsp_get_cpu_cycle_count();
+    portEXIT_CRITICAL(&testnlock);
+
+    float total_b = end_b - start_b;
+    float cycles = total_b / (repeat_count);
+    ESP_LOGI(TAG, "dspm_chol_solve_f32_ansi - %f cycles per 8x8 solve.", cycles);
+    float min_exec = 100;
+    float max_exec = 5000;
+    TEST_ASSERT_EXEC_IN_RANGE(min_exec, max_exec, cycles);
+}
@@ -0,0 +1,59 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <new>
+
+int test_matn(void);
+int test_ekf(void);
+int test_solve(void);
+
+// Memory allocations, counted by the global operator new
+int allocations;
+
+void *operator new(size_t size)
+{
+    allocations++;
+    void *ptr = malloc(size ? size : 1);
+    if (ptr == NULL) {
+        throw std::bad_alloc();
+    }
+    return ptr;
+}
+
+void *operator new[](size_t size)
+{
+    return operator new(size);
+}
+
+void operator delete(void *ptr) noexcept
+{
+    free(ptr);
+}
+
+void operator delete[](void *ptr) noexcept
+{
+    free(ptr);
+}
+
+void operator delete(void *ptr, size_t) noexcept
+{
+    free(ptr);
+}
+
+void operator delete[](void *ptr, size_t) noexcept
+{
+    free(ptr);
+}
+
+int main(void)
+{
+    printf("main starts!\n");
+    int errors = test_matn();
+    errors += test_ekf();
+    errors += test_solve();
+    if (errors) {
+        printf("Test FAIL: %i errors\n", errors);
+        return 1;
+    }
+    printf("Test done\n");
+    return 0;
+}
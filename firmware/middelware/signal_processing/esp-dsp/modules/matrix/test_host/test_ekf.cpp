@@ -0,0 +1,226 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <math.h>
+
+#include "dsp_common.h"
+#include "mat.h"
+#include "matn.h"
+#include "ekf_imu13states.h"
+
+#define SAMPLE_FREQ     200                 // Hz
+#define SIM_TIME        60                  // s
+#define STEPS           (SAMPLE_FREQ * SIM_TIME)
+#define MOTION_START    10.24f              // s, the gyro bias is observable when the sensor rotates
+#define HIST_BIN        1000                // ns
+#define HIST_BINS       32
+
+// Memory allocations (main.cpp)
+extern int allocations;
+
+static int errors;
+static uint32_t step_time[STEPS];
+
+static float frand(void)
+{
+    return (float)rand() / RAND_MAX - 0.5f;
+}
+
+// ekf::CovariancePrediction() (upper triangle, zeros skipped) against P = f*P*f' + dt^2*G*Q*G'
+static void test_prediction(void)
+{
+    ekf_imu13states *ekf13 = new ekf_imu13states();
+    ekf13->Init();
+    const float dt = 0.005f;
+    int n = ekf13->NUMX;
+
+    for (int i = 0 ; i < n ; i++) {
+        for (int j = 0 ; j < n ; j++) {
+            ekf13->F(i, j) = (rand() % 3) ? 0 : frand();
+        }
+        for (int j = 0 ; j < ekf13->NUMW ; j++) {
+            ekf13->G(i, j) = (rand() % 3) ? 0 : frand();
+        }
+        for (int j = i ; j < n ; j++) {
+            ekf13->P(i, j) = ekf13->P(j, i) = frand() + ((i == j) ? 2 : 0);
+        }
+    }
+    dspm::Mat f = ekf13->F * dt + dspm::Mat::eye(n);
+    dspm::Mat ref = ((f * ekf13->P) * f.t()) + (dt * dt) * ((ekf13->G * ekf13->Q) * ekf13->G.t());
+
+    ekf13->CovariancePrediction(dt);
+    for (int i = 0 ; i < n * n ; i++) {
+        if (fabsf(ekf13->P.data[i] - ref.data[i]) > 1e-5f * (1 + fabsf(ref.data[i]))) {
+            printf("CovariancePrediction: [%i] = %f, expected %f\n", i, ekf13->P.data[i], ref.data[i]);
+            errors++;
+            break;
+        }
+    }
+    delete ekf13;
+}
+
+// Values for test_update(), rand() is left to the other tests (same sequence as before)
+static float fixed_rand(int k)
+{
+    return 0.5f * sinf(1.37f * k + 0.5f);
+}
+
+// ekf::Update() against one K = P*h'/(h*P*h' + r) update per row of H:
+// P = (I - K*h)*P, or (I - K*h)*P*(I - K*h)' + K*r*K' in Joseph form
+static void test_update(bool joseph_form)
+{
+    ekf_imu13states *ekf13 = new ekf_imu13states();
+    ekf13->Init();
+    ekf13->joseph_form = joseph_form;
+    int n = ekf13->NUMX;
+    const int rows = 3;
+    dspm::Mat H(rows, n);
+    float measured[rows], expected[rows], R[rows];
+
+    dspm::Mat A(n, n);
+    for (int i = 0 ; i < n * n ; i++) {
+        A.data[i] = fixed_rand(i);
+    }
+    ekf13->P = A * A.t() + dspm::Mat::eye(n) * 0.1f;
+    for (int m = 0 ; m < rows ; m++) {
+        for (int j = 0 ; j < n ; j++) {
+            H(m, j) = ((m + j) % 3) ? 0 : fixed_rand(1000 + m * n + j);
+        }
+        measured[m] = fixed_rand(2000 + m);
+        expected[m] = fixed_rand(3000 + m);
+        R[m] = 0.01f * (m + 1);
+    }
+    dspm::Mat P = ekf13->P;
+    dspm::Mat X = ekf13->X;
+    for (int m = 0 ; m < rows ; m++) {
+        dspm::Mat h = H.Get(m, 1, 0, n);
+        dspm::Mat K = (P * h.t()) * (1.0f / ((h * P * h.t())(0, 0) + R[m]));
+        dspm::Mat IKH = dspm::Mat::eye(n) - K * h;
+        P = joseph_form ? IKH * P * IKH.t() + K * K.t() * R[m] : IKH * P;
+        X += K * (measured[m] - expected[m]);
+    }
+
+    ekf13->Update(H, measured, expected, R);
+    const char *name = joseph_form ? "Update (Joseph)" : "Update";
+    for (int i = 0 ; i < n * n ; i++) {
+        if (fabsf(ekf13->P.data[i] - P.data[i]) > 1e-4f * (1 + fabsf(P.data[i]))) {
+            printf("%s: P[%i] = %f, expected %f\n", name, i, ekf13->P.data[i], P.data[i]);
+            errors++;
+            break;
+        }
+        if (ekf13->P.data[i] != ekf13->P(i % n, i / n)) {
+            printf("%s: P not symmetric\n", name);
+            errors++;
+            break;
+        }
+    }
+    for (int i = 0 ; i < n ; i++) {
+        if (fabsf(ekf13->X.data[i] - X.data[i]) > 1e-4f * (1 + fabsf(X.data[i]))) {
+            printf("%s: X[%i] = %f, expected %f\n", name, i, ekf13->X.data[i], X.data[i]);
+            errors++;
+            break;
+        }
+    }
+    delete ekf13;
+}
+
+// 13 states EKF at SAMPLE_FREQ: rotating sensor with a constant gyro bias
+static void test_imu(bool joseph_form)
+{
+    ekf_imu13states *ekf13 = new ekf_imu13states();
+    ekf13->Init();
+    ekf13->joseph_form = joseph_form;
+
+    const float dt = 1.0f / SAMPLE_FREQ;
+    const float pi = 4 * atanf(1);
+    float gyro_err[3] = {0.1f, 0.2f, 0.3f};
+    float R[6];
+    for (int i = 0 ; i < 6 ; i++) {
+        R[i] = 0.01f;
+    }
+    dspm::MatN<3, 1> accel0, magn0;
+    accel0(2, 0) = 1;
+    magn0(0, 0) = 1;
+    dspm::MatN<3, 3> Rm = dspm::MatN<3, 3>::eye();
+
+    int alloc_steps = 0;
+    for (int n = 0 ; n < STEPS ; n++) {
+        float t = n * dt;
+        float w[3] = {0, 0, 0};
+        if (t >= MOTION_START) {
+            for (int i = 0 ; i < 3 ; i++) {
+                w[i] = (i + 1) / pi * cosf(-pi / 2 + pi * (t - MOTION_START) / 2.048f);
+            }
+        }
+        // Rotate the sensor, the references rotate to the opposite direction
+        float angle[3] = {w[0] * dt, w[1] * dt, w[2] * dt};
+        dspm::Mat Re = ekf::eul2rotm(angle);
+        Rm = Rm * dspm::MatN<3, 3>(Re);
+        dspm::MatN<3, 1> accel, magn;
+        dspm::mult_t(Rm.t(), accel0.t(), accel);
+        dspm::mult_t(Rm.t(), magn0.t(), magn);
+        accel /= accel.norm();
+        magn /= magn.norm();
+        float gyro[3] = {w[0] + gyro_err[0], w[1] + gyro_err[1], w[2] + gyro_err[2]};
+
+        int alloc_start = allocations;
+        uint32_t t_start = dsp_get_cpu_cycle_count();
+        ekf13->Process(gyro, dt);
+        ekf13->UpdateRefMeasurement(accel.data, magn.data, R);
+        step_time[n] = dsp_get_cpu_cycle_count() - t_start;
+        alloc_steps += allocations - alloc_start;
+    }
+
+    // Step time histogram
+    int hist[HIST_BINS + 1] = {0};
+    uint32_t t_min = step_time[0], t_max = 0;
+    uint64_t t_sum = 0;
+    for (int n = 0 ; n < STEPS ; n++) {
+        int bin = step_time[n] / HIST_BIN;
+        hist[(bin < HIST_BINS) ? bin : HIST_BINS]++;
+        t_min = (step_time[n] < t_min) ? step_time[n] : t_min;
+        t_max = (step_time[n] > t_max) ? step_time[n] : t_max;
+        t_sum += step_time[n];
+    }
+    printf("ekf_imu13states %i Hz, %s update: Process() + UpdateRefMeasurement()\n",
+           SAMPLE_FREQ, joseph_form ? "Joseph" : "standard");
+    printf("  allocations/step %.1f, time/step min %i ns, mean %i ns, max %i ns (%.2f%% of the period)\n",
+           (float)alloc_steps / STEPS, t_min, (int)(t_sum / STEPS), t_max, 100.0f * t_max * SAMPLE_FREQ / 1e9f);
+    for (int i = 0 ; i <= HIST_BINS ; i++) {
+        if (hist[i] == 0) {
+            continue;
+        }
+        int bar = (hist[i] * 50 + STEPS - 1) / STEPS;
+        printf("  %s%3i us %6i ", (i < HIST_BINS) ? " " : ">", i, hist[i]);
+        for (int b = 0 ; b < bar ; b++) {
+            printf("#");
+        }
+        printf("\n");
+    }
+    printf("  gyro bias %.3f %.3f %.3f, expected %.3f %.3f %.3f\n", ekf13->X.data[4], ekf13->X.data[5], ekf13->X.data[6],
+           gyro_err[0], gyro_err[1], gyro_err[2]);
+
+    if (alloc_steps != 0) {
+        printf("EKF: %i allocations\n", alloc_steps);
+        errors++;
+    }
+    for (int i = 0 ; i < 3 ; i++) {
+        // Same tolerance as the ekf_imu13states unit test
+        if (fabsf(ekf13->X.data[4 + i] - gyro_err[i]) > 0.1f) {
+            printf("EKF: gyro bias[%i] = %f, expected %f\n", i, ekf13->X.data[4 + i], gyro_err[i]);
+            errors++;
+        }
+    }
+    delete ekf13;
+}
+
+int test_ekf(void)
+{
+    errors = 0;
+    test_prediction();
+    test_update(false);
+    test_update(true);
+    test_imu(false);
+    test_imu(true);
+    return errors;
+}
@@ -0,0 +1,215 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <math.h>
+
+#include "dsp_common.h"
+#include "mat.h"
+#include "matn.h"
+
+#define NUMX        13
+#define NUMW        18
+#define STEPS       200
+
+// Memory allocations (main.cpp)
+extern int allocations;
+
+static int errors;
+
+static float frand(void)
+{
+    return (float)rand() / RAND_MAX - 0.5f;
+}
+
+template <int R, int C>
+static void check(const char *name, const dspm::MatN<R, C> &A, const dspm::Mat &ref)
+{
+    if ((ref.rows != R) || (ref.cols != C)) {
+        printf("%s: size %ix%i, expected %ix%i\n", name, R, C, ref.rows, ref.cols);
+        errors++;
+        return;
+    }
+    for (int i = 0 ; i < R ; i++) {
+        for (int j = 0 ; j < C ; j++) {
+            if (fabsf(A(i, j) - ref(i, j)) > 1e-4f * (1 + fabsf(ref(i, j)))) {
+                printf("%s: [%i][%i] = %f, expected %f\n", name, i, j, A(i, j), ref(i, j));
+                errors++;
+                return;
+            }
+        }
+    }
+}
+
+template <int R, int C>
+static void fill(dspm::MatN<R, C> &A)
+{
+    for (int i = 0 ; i < R * C ; i++) {
+        A.data[i] = frand();
+    }
+}
+
+// MatN operations against dspm::Mat
+static void test_ops(void)
+{
+    dspm::MatN<4, 3> A;
+    dspm::MatN<3, 5> B;
+    dspm::MatN<4, 5> D;
+    dspm::MatN<4, 4> S;
+    fill(A);
+    fill(B);
+    fill(D);
+    fill(S);
+    dspm::Mat a(A.data, 4, 3);
+    dspm::Mat b(B.data, 3, 5);
+    dspm::Mat d(D.data, 4, 5);
+    dspm::Mat s(S.data, 4, 4);
+
+    dspm::MatN<4, 5> AB = A * B;
+    check("A * B", AB, a * b);
+    dspm::MatN<4, 5> ABD = A * B + D;
+    check("A * B + D", ABD, a * b + d);
+    ABD = D + A * B;
+    check("D + A * B", ABD, a * b + d);
+    dspm::mult_add(A, B, D, ABD);
+    check("mult_add", ABD, a * b + d);
+    ABD = D;
+    ABD += A * B;
+    check("+= A * B", ABD, a * b + d);
+    check("A - B", D - AB, d - a * b);
+    check("A * c", 2.0f * D, d * 2.0f);
+    check("t()", A.t(), a.t());
+
+    dspm::MatN<4, 5> ABt;
+    dspm::MatN<5, 3> Bt = B.t();
+    dspm::mult_t(A, Bt, ABt);
+    check("mult_t", ABt, a * b);
+
+    // The destination is one of the operands
+    dspm::Mat ss = s * s;
+    S = S * S;
+    check("S = S * S", S, ss);
+    dspm::MatN<4, 4> I = dspm::MatN<4, 4>::eye();
+    check("eye", I, dspm::Mat::eye(4));
+    dspm::MatN<4, 4> SI = S * I * S;
+    check("S * I * S", SI, ss * ss);
+    dspm::MatN<4, 4> Q;
+    fill(Q);
+    dspm::Mat q(Q.data, 4, 4);
+    dspm::Mat sq = s + s * q;
+    S += S * Q;
+    check("S += S * Q", S, sq);
+    dspm::Mat qs = s + q * s;
+    S += Q * S;
+    check("S += Q * S", S, qs);
+    dspm::Mat ssq = s * q + s;
+    dspm::mult_add(S, Q, S, S);
+    check("mult_add(S, Q, S, S)", S, ssq);
+
+    // view() shares the data, no copy
+    dspm::Mat v = S.view();
+    v(1, 2) = 10;
+    if ((S(1, 2) != 10) || (v.data != S.data)) {
+        printf("view: data not shared\n");
+        errors++;
+    }
+    dspm::MatN<4, 4> S2(v);
+    check("MatN(Mat)", S2, v);
+    if (fabsf(S2.norm() - v.norm()) > 1e-4f) {
+        printf("norm: %f, expected %f\n", S2.norm(), v.norm());
+        errors++;
+    }
+}
+
+// Covariance prediction of ekf::CovariancePrediction(), dspm::Mat version
+static void cov_mat(dspm::Mat &P, dspm::Mat &F, dspm::Mat &G, dspm::Mat &Q, float dt)
+{
+    dspm::Mat f = F * dt;
+    f = f + dspm::Mat::eye(NUMX);
+    dspm::Mat f_t = f.t();
+    P = ((f * P) * f_t) + (dt * dt) * ((G * Q) * G.t());
+}
+
+// Same calculation with MatN, no allocations
+struct cov_work {
+    dspm::MatN<NUMX, NUMX> f;
+    dspm::MatN<NUMX, NUMX> fP;
+    dspm::MatN<NUMX, NUMW> GQ;
+    dspm::MatN<NUMX, NUMX> GQG;
+};
+
+static void cov_matn(dspm::MatN<NUMX, NUMX> &P, const dspm::MatN<NUMX, NUMX> &F, const dspm::MatN<NUMX, NUMW> &G,
+                     const dspm::MatN<NUMW, NUMW> &Q, float dt, cov_work &w)
+{
+    w.f = F;
+    w.f *= dt;
+    for (int i = 0 ; i < NUMX ; i++) {
+        w.f(i, i) += 1;
+    }
+    dspm::mult(w.f, P, w.fP);
+    dspm::mult(G, Q, w.GQ);
+    dspm::mult_t(w.GQ, G, w.GQG);
+    w.GQG *= dt * dt;
+    // P = fP * f' + dt^2 * G * Q * G'
+    dspm::mult_t(w.fP, w.f, P);
+    P += w.GQG;
+}
+
+static void test_covariance(void)
+{
+    static dspm::MatN<NUMX, NUMX> P, F;
+    static dspm::MatN<NUMX, NUMW> G;
+    static dspm::MatN<NUMW, NUMW> Q;
+    static cov_work work;
+    const float dt = 0.01f;
+
+    fill(F);
+    fill(G);
+    Q = dspm::MatN<NUMW, NUMW>::eye();
+    P = dspm::MatN<NUMX, NUMX>::eye();
+    dspm::Mat p(NUMX, NUMX), f(NUMX, NUMX), g(NUMX, NUMW), q(NUMW, NUMW);
+    P.copyTo(p);
+    F.copyTo(f);
+    G.copyTo(g);
+    Q.copyTo(q);
+
+    int alloc_start = allocations;
+    uint32_t t_start = dsp_get_cpu_cycle_count();
+    for (int i = 0 ; i < STEPS ; i++) {
+        cov_mat(p, f, g, q, dt);
+    }
+    uint32_t t_mat = dsp_get_cpu_cycle_count() - t_start;
+    int alloc_mat = allocations - alloc_start;
+
+    alloc_start = allocations;
+    t_start = dsp_get_cpu_cycle_count();
+    for (int i = 0 ; i < STEPS ; i++) {
+        cov_matn(P, F, G, Q, dt, work);
+    }
+    uint32_t t_matn = dsp_get_cpu_cycle_count() - t_start;
+    int alloc_matn = allocations - alloc_start;
+
+    // Compare relative to the size of P (it grows with F random)
+    float scale = p.norm();
+    for (int i = 0 ; i < NUMX * NUMX ; i++) {
+        if (fabsf(P.data[i] - p.data[i]) > 1e-4f * scale) {
+            printf("Covariance: [%i] = %f, expected %f\n", i, P.data[i], p.data[i]);
+            errors++;
+            break;
+        }
+    }
+    if (alloc_matn != 0) {
+        printf("Covariance MatN: %i allocations\n", alloc_matn);
+        errors++;
+    }
+    printf("Covariance prediction %ix%i   allocations/step   time/step (ns)\n", NUMX, NUMX);
+    printf("  dspm::Mat                %8.1f          %8i\n", (float)alloc_mat / STEPS, t_mat / STEPS);
+    printf("  dspm::MatN               %8.1f          %8i\n", (float)alloc_matn / STEPS, t_matn / STEPS);
+}
+
+int test_matn(void)
+{
+    errors = 0;
+    test_ops();
+    test_covariance();
+    return errors;
+}
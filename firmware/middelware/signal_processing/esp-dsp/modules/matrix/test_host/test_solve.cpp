@@ -0,0 +1,219 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <math.h>
+
+#include "dsp_common.h"
+#include "mat.h"
+#include "mat_factor.h"
+#include "dspm_solve.h"
+
+#define MAX_N       16
+#define NRHS        4
+#define REPEAT      100
+
+// Memory allocations (main.cpp)
+extern int allocations;
+
+static int errors;
+
+static float frand(void)
+{
+    return (float)rand() / RAND_MAX - 0.5f;
+}
+
+// Symmetric positive definite: M*M' + n*I
+static void spd_matrix(dspm::Mat &A)
+{
+    int n = A.rows;
+    dspm::Mat M(n, n);
+    for (int i = 0 ; i < n * n ; i++) {
+        M.data[i] = frand();
+    }
+    A = M * M.t();
+    for (int i = 0 ; i < n ; i++) {
+        A(i, i) += n;
+    }
+}
+
+// Determinant, Laplace expansion by the first row (double)
+static double det_ref(const float *A, int n, int stride)
+{
+    if (n == 1) {
+        return A[0];
+    }
+    float minor[MAX_N * MAX_N];
+    double result = 0;
+    for (int f = 0 ; f < n ; f++) {
+        int k = 0;
+        for (int r = 1 ; r < n ; r++) {
+            for (int c = 0 ; c < n ; c++) {
+                if (c != f) {
+                    minor[k++] = A[r * stride + c];
+                }
+            }
+        }
+        result += ((f & 1) ? -1 : 1) * A[f] * det_ref(minor, n - 1, n - 1);
+    }
+    return result;
+}
+
+// |A*x - b| / |b|
+static void check_residual(const char *name, dspm::Mat &A, dspm::Mat &x, dspm::Mat &b)
+{
+    dspm::Mat r = A * x - b;
+    float res = r.norm() / b.norm();
+    if (!(res < 1e-5f)) {
+        printf("%s n=%i: residual %g\n", name, A.rows, res);
+        errors++;
+    }
+}
+
+static void test_functions(void)
+{
+    for (int n = 1 ; n <= MAX_N ; n++) {
+        dspm::Mat A(n, n);
+        dspm::Mat b(n, NRHS);
+        dspm::Mat x(n, NRHS);
+        spd_matrix(A);
+        for (int i = 0 ; i < n * NRHS ; i++) {
+            b.data[i] = frand();
+        }
+
+        dspm::Cholesky chol(n);
+        dspm::Cholesky ldlt(n, true);
+        dspm::LU lu(n);
+        int alloc_start = allocations;
+        if ((chol.factor(A) != ESP_OK) || (ldlt.factor(A) != ESP_OK) || (lu.factor(A) != ESP_OK)) {
+            printf("factor n=%i: error\n", n);
+            errors++;
+            continue;
+        }
+        if (allocations != alloc_start) {
+            printf("factor n=%i: %i allocations\n", n, allocations - alloc_start);
+            errors++;
+        }
+        chol.solve(b, x);
+        check_residual("Cholesky", A, x, b);
+        ldlt.solve(b, x);
+        check_residual("LDL'", A, x, b);
+        // In place
+        x = b;
+        alloc_start = allocations;
+        lu.solve(x, x);
+        if (allocations != alloc_start) {
+            printf("solve n=%i: %i allocations\n", n, allocations - alloc_start);
+            errors++;
+        }
+        check_residual("LU in place", A, x, b);
+
+        // Non symmetric matrix: LU only
+        dspm::Mat N(n, n);
+        for (int i = 0 ; i < n * n ; i++) {
+            N.data[i] = frand();
+        }
+        lu.factor(N);
+        lu.solve(b, x);
+        check_residual("LU non symmetric", N, x, b);
+        dspm::Mat inv(n, n);
+        lu.inverse(inv);
+        dspm::Mat I = N * inv - dspm::Mat::eye(n);
+        if (!(I.norm() < 1e-4f * n)) {
+            printf("LU inverse n=%i: |A*inv - I| = %g\n", n, I.norm());
+            errors++;
+        }
+        if (n <= 6) {
+            float det = det_ref(N.data, n, n);
+            if (fabsf(lu.det() - det) > 1e-4f * (1 + fabsf(det))) {
+                printf("LU det n=%i: %f, expected %f\n", n, lu.det(), det);
+                errors++;
+            }
+            det = det_ref(A.data, n, n);
+            if ((fabsf(chol.det() - det) > 1e-4f * det) || (fabsf(ldlt.det() - det) > 1e-4f * det)) {
+                printf("Cholesky det n=%i: %f %f, expected %f\n", n, chol.det(), ldlt.det(), det);
+                errors++;
+            }
+        }
+    }
+
+    // Not positive definite, singular
+    dspm::Mat A = dspm::Mat::eye(3);
+    A(1, 1) = -1;
+    dspm::Cholesky chol(3);
+    dspm::Cholesky ldlt(3, true);
+    dspm::LU lu(3);
+    if ((chol.factor(A) != ESP_ERR_DSP_INVALID_PARAM) || (ldlt.factor(A) != ESP_OK)) {
+        printf("Cholesky: indefinite matrix not detected\n");
+        errors++;
+    }
+    A(1, 1) = 0;
+    if (lu.factor(A) != ESP_ERR_DSP_INVALID_PARAM) {
+        printf("LU: singular matrix not detected\n");
+        errors++;
+    }
+    dspm::Mat b(3, 1);
+    if (lu.solve(b, b) != ESP_ERR_DSP_UNINITIALIZED) {
+        printf("LU: solve without factors\n");
+        errors++;
+    }
+}
+
+// REPEAT solves with the same matrix: Mat::solve() against factor once + solve
+static void test_speed(void)
+{
+    static const int sizes[] = {3, 4, 6, 8, 12, 16};
+    printf("Repeated solves A*x = b (%i right-hand sides), time/solve (ns)\n", REPEAT);
+    printf("   n   Mat::solve    Cholesky        LDL'          LU\n");
+    for (size_t s = 0 ; s < sizeof(sizes) / sizeof(sizes[0]) ; s++) {
+        int n = sizes[s];
+        dspm::Mat A(n, n);
+        dspm::Mat b(n, 1);
+        dspm::Mat x(n, 1);
+        spd_matrix(A);
+        for (int i = 0 ; i < n ; i++) {
+            b.data[i] = frand();
+        }
+        dspm::Cholesky chol(n);
+        dspm::Cholesky ldlt(n, true);
+        dspm::LU lu(n);
+
+        uint32_t t_start = dsp_get_cpu_cycle_count();
+        for (int r = 0 ; r < REPEAT ; r++) {
+            x = dspm::Mat::solve(A, b);
+        }
+        uint32_t t_mat = dsp_get_cpu_cycle_count() - t_start;
+        check_residual("Mat::solve", A, x, b);
+
+        t_start = dsp_get_cpu_cycle_count();
+        chol.factor(A);
+        for (int r = 0 ; r < REPEAT ; r++) {
+            chol.solve(b, x);
+        }
+        uint32_t t_chol = dsp_get_cpu_cycle_count() - t_start;
+
+        t_start = dsp_get_cpu_cycle_count();
+        ldlt.factor(A);
+        for (int r = 0 ; r < REPEAT ; r++) {
+            ldlt.solve(b, x);
+        }
+        uint32_t t_ldlt = dsp_get_cpu_cycle_count() - t_start;
+
+        t_start = dsp_get_cpu_cycle_count();
+        lu.factor(A);
+        for (int r = 0 ; r < REPEAT ; r++) {
+            lu.solve(b, x);
+        }
+        uint32_t t_lu = dsp_get_cpu_cycle_count() - t_start;
+        check_residual("LU", A, x, b);
+
+        printf("%4i %12i %11i %11i %11i\n", n, t_mat / REPEAT, t_chol / REPEAT, t_ldlt / REPEAT, t_lu / REPEAT);
+    }
+}
+
+int test_solve(void)
+{
+    errors = 0;
+    test_functions();
+    test_speed();
+    return errors;
+}
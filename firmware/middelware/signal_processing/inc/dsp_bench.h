@@ -0,0 +1,128 @@
+#ifndef DSP_BENCH_H_
+#define DSP_BENCH_H_
+/** \addtogroup Drivers_Programable Drivers Programable
+ ** @{ */
+/** \addtogroup Middelware Middelware
+ ** @{ */
+/** \addtogroup DSP_Bench DSP benchmark suite
+ */
+
+/** \brief Benchmark suite of the signal processing functions
+ *
+ * The same cases run on the target (CPU cycles, dsp_get_cpu_cycle_count())
+ * and on the host (ns of the monotonic clock, bench_host/bench_dsp):
+ *
+ * | Case                  | Size                       | Items (per_item)          |
+ * |:----------------------|:---------------------------|:--------------------------|
+ * | dsps_fft2r_fc32       | complex points, 64 to max  | points (FFT + bit reverse)|
+ * | dsps_fft4r_fc32       | complex points (power of 4)| points (FFT + bit reverse)|
+ * | FFTMagnitude          | signal length              | samples                   |
+ * | FFTPlanMagnitude      | signal length              | samples                   |
+ * | dsps_biquad_f32       | biquads in cascade         | samples                   |
+ * | LowPassFilter         | filter order               | samples                   |
+ * | dsps_fir_f32          | taps                       | samples                   |
+ * | dsps_fird_f32         | taps (decimation 4)        | input samples             |
+ * | dsps_dotprod_f32      | length                     | products                  |
+ * | dsps_conv_f32         | kernel length              | signal samples            |
+ * | dsps_corr_f32         | pattern length             | signal samples            |
+ * | dsps_conv_fft_f32     | kernel length              | signal samples            |
+ * | dspm_mult_f32         | n (n x n matrices)         | multiply-adds (n^3)       |
+ * | dspm_chol_solve_f32   | n (n x n matrix)           | solves (factor + solve)   |
+ * | dspm_lu_solve_f32     | n (n x n matrix)           | solves (factor + solve)   |
+ * | ekf_imu13states       | states                     | steps (Process + update)  |
+ *
+ * Each case runs once to warm up and then DSP_BENCH_REPEAT times; every run
+ * is timed on its own and the result keeps the min, median and max. The
+ * min is the most stable figure (it has no interrupts nor cache misses).
+ *
+ * DspBenchCsvLine() and DspBenchJson() write the results, which
+ * tools/dsp_bench_compare.py compares against a stored baseline (it also
+ * reads the CSV lines from a serial monitor capture of the target).
+ *
+ * @note The suite uses the FFT tables (FFTInit()), the radix-4 tables
+ * (dsps_fft4r_init_fc32(), CONFIG_DSP_MAX_FFT_SIZE points if they are not
+ * initialized yet), arena_dsp / arena_scratch for the FFT plans and about
+ * 80 kB of static buffers.
+ *
+ * @section changelog
+ *
+ * |   Date	    | Description                                    						|
+ * |:----------:|:----------------------------------------------------------------------|
+ * | 19/10/2026 | Document creation		                         						|
+ *
+ **/
+
+/*==================[inclusions]=============================================*/
+#include <stdint.h>
+#include <stdio.h>
+/*==================[macros]=================================================*/
+#ifndef DSP_BENCH_REPEAT
+#define DSP_BENCH_REPEAT        21              /*!< Timed runs per case (odd: median) */
+#endif
+#define DSP_BENCH_MAX_RESULTS   96              /*!< Results of the full suite (upper bound) */
+/*==================[typedef]================================================*/
+/**
+ * @brief Result of a case
+ */
+typedef struct {
+    const char *name;           /*!< Function */
+    uint32_t size;              /*!< Size (meaning depends on the case) */
+    uint32_t items;             /*!< Work items per run */
+    uint32_t min;               /*!< Min time of a run (DspBenchUnit()) */
+    uint32_t median;            /*!< Median time of a run */
+    uint32_t max;               /*!< Max time of a run */
+} dsp_bench_result_t;
+
+/**
+ * @brief Function called after each case (e.g. to stream the results)
+ */
+typedef void (*dsp_bench_func_t)(const dsp_bench_result_t *result, void *param);
+/*==================[external data declaration]==============================*/
+
+/*==================[external functions declaration]=========================*/
+/**
+ * @brief Run the benchmark cases
+ * @note  Cases that can't run (tables or memory not available) are skipped.
+ * @param filter            Prefix of the cases to run (e.g. "dsps_fft"), NULL: all
+ * @param results           Array to store the results (NULL: only func_p)
+ * @param max_results       Lenght of results array
+ * @param func_p            Function called after each case (NULL: none)
+ * @param param_p           Parameter of func_p
+ * @return uint16_t         Number of cases run (results keeps the first max_results)
+ */
+uint16_t DspBenchRun(const char *filter, dsp_bench_result_t *results, uint16_t max_results,
+    dsp_bench_func_t func_p, void *param_p);
+
+/**
+ * @brief Unit of the times
+ * @return const char*      "cycles" (target) or "ns" (host)
+ */
+const char* DspBenchUnit(void);
+
+/**
+ * @brief Write the CSV header: name,size,items,unit,min,median,max,per_item
+ * @param f                 Output file (stdout: serial monitor)
+ */
+void DspBenchCsvHeader(FILE *f);
+
+/**
+ * @brief Write a result as a CSV line (per_item: median / items)
+ * @param f                 Output file
+ * @param result            Result
+ */
+void DspBenchCsvLine(FILE *f, const dsp_bench_result_t *result);
+
+/**
+ * @brief Write the results as a JSON document (platform, unit, cpu_mhz and results)
+ * @param f                 Output file
+ * @param results           Results
+ * @param count             Number of results
+ */
+void DspBenchJson(FILE *f, const dsp_bench_result_t *results, uint16_t count);
+
+/** @} doxygen end group definition */
+/** @} doxygen end group definition */
+/** @} doxygen end group definition */
+#endif /* DSP_BENCH_H_ */
+
+/*==================[end of file]============================================*/
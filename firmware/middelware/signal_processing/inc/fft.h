@@ -8,6 +8,12 @@
  */
 
 /** \brief Functionalities to calculate FFT
+ * 
+ * FFTMagnitude() calculates a complex radix-2 FFT of the signal. The FFT plan
+ * functions (FFTPlanInit(), FFTPlanMagnitude()) give the same result faster:
+ * the real signal is packed as a complex signal of half the length, which is
+ * transformed with radix-4 stages (plus one radix-2 stage when N/2 is not a
+ * power of 4), and the window and output order are calculated only once.
  * 
  * @author Peñalva Albano
  *
@@ -16,6 +22,9 @@
  * |   Date	    | Description                                    						|
  * |:----------:|:----------------------------------------------------------------------|
  * | 15/03/2024 | Document creation		                         						|
+ * | 19/10/2026 | FFT plans (radix-4 and mixed radix)	         						|
+ * | 19/10/2026 | FFTMagnitude uses a radix-2 plan (flash tables)						|
+ * | 19/10/2026 | Plan tables and work buffers from the memory arenas					|
  * 
  **/
 
@@ -25,6 +34,34 @@
 /*==================[macros]=================================================*/
 #define MAX_SIGNAL_LENGHT   2048
 /*==================[typedef]================================================*/
+/**
+ * @brief FFT algorithm used by a plan
+ */
+typedef enum {
+    FFT_PLAN_RADIX_4 = 0,       /*!< N/2 is a power of 4: radix-4 stages only */
+    FFT_PLAN_RADIX_4_2,         /*!< One radix-2 stage followed by radix-4 stages */
+} fft_plan_radix_t;
+
+/**
+ * @brief FFT plan: everything that only depends on the signal length
+ *
+ * The tables are allocated from arena_dsp (arena_mcu.h) for the plan length.
+ * A plan must be zero initialized (static or = {0}) before the first
+ * FFTPlanInit(); initializing it again with the same or a shorter length
+ * reuses its tables. With a longer length, the tables are given back if
+ * nothing was allocated from arena_dsp after them; otherwise they stay
+ * allocated and the new ones are taken for MAX_SIGNAL_LENGHT, so a plan
+ * leaves at most one set of tables behind.
+ */
+typedef struct {
+    uint16_t signal_lenght;                     /*!< Signal length (N) */
+    uint16_t capacity;                          /*!< Signal length the tables were allocated for */
+    fft_plan_radix_t radix;                     /*!< FFT algorithm */
+    float *wind;                                /*!< Hann window (N) */
+    uint16_t *bin_index;                        /*!< Position of each bin in the FFT output (digit reversal, N / 2) */
+    uint32_t arena_start;                       /*!< arena_dsp mark before the tables */
+    uint32_t arena_end;                         /*!< arena_dsp mark after the tables */
+} fft_plan_t;
 
 /*==================[external data declaration]==============================*/
 
@@ -32,6 +69,9 @@
 /**
  * @brief Initialize the FFT calculation module
  * 
+ * @note With CONFIG_DSP_FFT_CONST_TABLES the FFT tables are in flash and
+ * this function takes no time and no heap.
+ * 
  * @return true     FFT initialized
  * @return false    Not possible to initialize FFT
  */
@@ -42,12 +82,38 @@ bool FFTInit(void);
  * 
  * @note  Lenght of signal array must be a power of two (with maximun value = MAX_SIGNAL_LENGHT)
  * 
+ * @note  Work buffers (3 * signal_lenght floats) are taken from arena_scratch
+ * during the call. If they don't fit, or signal_lenght is not a valid FFT
+ * length, the magnitude is all zeros.
+ * 
  * @param signal            Array with signal values (of lenght = signal_lenght)
  * @param fft               Array to store FFT magnitude values (of lenght = signal_lenght / 2)
  * @param signal_lenght     Lenght of signal arrays
  */
 void FFTMagnitude(float * signal, float * fft, uint16_t signal_lenght);
 
+/**
+ * @brief Initialize a FFT plan for a given signal length
+ * 
+ * @param plan              Plan to initialize (zero initialized the first time)
+ * @param signal_lenght     Lenght of signal array (power of two, from 4 to MAX_SIGNAL_LENGHT)
+ * @return true     Plan initialized
+ * @return false    Invalid length, arena_dsp full or not possible to initialize FFT
+ */
+bool FFTPlanInit(fft_plan_t * plan, uint16_t signal_lenght);
+
+/**
+ * @brief Calculates the FFT magnitude of a given signal using a plan (same result as FFTMagnitude)
+ * 
+ * @note  Work buffers (2 * signal_lenght floats) are taken from arena_scratch
+ * during the call. If they don't fit the magnitude is all zeros.
+ * 
+ * @param plan              Plan initialized with FFTPlanInit()
+ * @param signal            Array with signal values (of lenght = plan->signal_lenght)
+ * @param fft               Array to store FFT magnitude values (of lenght = plan->signal_lenght / 2)
+ */
+void FFTPlanMagnitude(const fft_plan_t * plan, const float * signal, float * fft);
+
 /**
  * @brief Return the FFT frequency axis vector
  * 
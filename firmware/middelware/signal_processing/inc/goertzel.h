@@ -0,0 +1,151 @@
+#ifndef GOERTZEL_H_
+#define GOERTZEL_H_
+/** \addtogroup Drivers_Programable Drivers Programable
+ ** @{ */
+/** \addtogroup Middelware Middelware
+ ** @{ */
+/** \addtogroup Goertzel Goertzel / sliding DFT
+ */
+
+/** \brief Amplitude of a few frequencies of a signal, sample by sample
+ *
+ * A bank of up to GOERTZEL_MAX_FREQS frequencies (any value, they don't need
+ * to be FFT bin centres) is updated with each new sample at a cost of O(K)
+ * for K frequencies, instead of calculating a full FFT. E.g. mains
+ * interference (50 / 100 Hz) or tone detection.
+ *
+ * - GOERTZEL_BLOCK: Goertzel algorithm, one result every window_lenght
+ *   samples. Uses the Reinsch recursion, stable even for frequencies close
+ *   to 0 or to sample_frec / 2.
+ * - GOERTZEL_SLIDING: sliding DFT, one result per sample (window of the last
+ *   window_lenght samples). The recursion is damped by
+ *   GOERTZEL_SLIDING_DAMPING per sample so rounding errors don't accumulate.
+ *
+ * The results are amplitudes (in input units) of a sinusoid at each
+ * frequency: 2 * |DFT| / window_lenght, rectangular window (at 0 Hz it's
+ * twice the mean).
+ *
+ * GoertzelProcessAdc() takes raw ADC frames, so it can be called from the
+ * callback of the ADC continuous mode (analog_io_mcu) with each frame.
+ *
+ * @section changelog
+ *
+ * |   Date	    | Description                                    						|
+ * |:----------:|:----------------------------------------------------------------------|
+ * | 19/10/2026 | Document creation		                         						|
+ *
+ **/
+
+/*==================[inclusions]=============================================*/
+#include <stdint.h>
+#include <stdbool.h>
+/*==================[macros]=================================================*/
+#define GOERTZEL_MAX_FREQS          8               /*!< Max frequencies of a bank */
+#define GOERTZEL_SLIDING_DAMPING    0.99999f        /*!< Damping per sample of the sliding DFT */
+/*==================[typedef]================================================*/
+/**
+ * @brief Output rate of a bank
+ */
+typedef enum {
+    GOERTZEL_BLOCK = 0,         /*!< One result every window_lenght samples (Goertzel) */
+    GOERTZEL_SLIDING,           /*!< One result per sample (sliding DFT) */
+} goertzel_mode_t;
+
+/**
+ * @brief Coefficients and state of one frequency
+ */
+typedef struct {
+    float cos_w;                /*!< cos(2 pi f / fs) */
+    float sin_w;                /*!< sin(2 pi f / fs) */
+    float k;                    /*!< Block: Reinsch coefficient. Sliding: unused */
+    bool low;                   /*!< Block: cos_w >= 0 (difference recursion) */
+    float rot_re;               /*!< Sliding: damping * e^(jw) */
+    float rot_im;
+    float out_re;               /*!< Sliding: damping^N * e^(jwN), for the sample leaving the window */
+    float out_im;
+    float s;                    /*!< State (block: s[n], sliding: DFT real part) */
+    float d;                    /*!< State (block: s[n] -/+ s[n-1], sliding: DFT imaginary part) */
+    float last;                 /*!< Block: amplitude of the last completed window */
+} goertzel_freq_t;
+
+/**
+ * @brief Bank of frequencies
+ */
+typedef struct {
+    goertzel_mode_t mode;                       /*!< Output rate */
+    uint8_t freqs_qty;                          /*!< Number of frequencies */
+    uint16_t window_lenght;                     /*!< Samples per DFT (N) */
+    uint16_t count;                             /*!< Block: samples of the current block. Sliding: delay line position */
+    float *delay;                               /*!< Sliding: last window_lenght samples */
+    float scale;                                /*!< Amplitude = scale * |DFT| */
+    goertzel_freq_t freqs[GOERTZEL_MAX_FREQS];  /*!< Frequencies */
+} goertzel_t;
+/*==================[external data declaration]==============================*/
+
+/*==================[external functions declaration]=========================*/
+/**
+ * @brief Initialize a bank of frequencies
+ *
+ * @param bank          Bank to initialize
+ * @param freqs         Frequencies (Hz, from 0 to sample_frec / 2)
+ * @param freqs_qty     Number of frequencies (up to GOERTZEL_MAX_FREQS)
+ * @param sample_frec   Signal's sample frequency
+ * @param window_lenght Samples per DFT (frequency resolution = sample_frec / window_lenght)
+ * @param mode          GOERTZEL_BLOCK or GOERTZEL_SLIDING
+ * @param delay         Array of window_lenght samples (only for GOERTZEL_SLIDING, NULL otherwise)
+ * @return true Bank initialized
+ * @return false Invalid parameters
+ */
+bool GoertzelInit(goertzel_t *bank, const float *freqs, uint8_t freqs_qty, float sample_frec,
+    uint16_t window_lenght, goertzel_mode_t mode, float *delay);
+
+/**
+ * @brief Clear the state of a bank (start a new signal)
+ *
+ * @param bank          Bank
+ */
+void GoertzelReset(goertzel_t *bank);
+
+/**
+ * @brief Process a block of samples. The block can have any length.
+ *
+ * Each result is a row of freqs_qty amplitudes. GOERTZEL_BLOCK gives a
+ * result each time a window is completed, GOERTZEL_SLIDING one per sample.
+ *
+ * @param bank          Bank
+ * @param signal        Input samples
+ * @param signal_lenght Number of samples
+ * @param amplitude     Array for the results (rows * freqs_qty), NULL to keep only the last one
+ * @return uint16_t Number of results (rows) written
+ */
+uint16_t GoertzelProcess(goertzel_t *bank, const float *signal, uint16_t signal_lenght, float *amplitude);
+
+/**
+ * @brief Process a raw ADC frame (e.g. from the ADC continuous mode callback)
+ *
+ * Same as GoertzelProcess() with the samples in ADC counts: signal = adc - offset.
+ *
+ * @param bank          Bank
+ * @param adc           Raw ADC frame
+ * @param signal_lenght Number of samples
+ * @param offset        Counts subtracted to each sample (e.g. 2048: mid scale)
+ * @param amplitude     Array for the results (rows * freqs_qty), NULL to keep only the last one
+ * @return uint16_t Number of results (rows) written
+ */
+uint16_t GoertzelProcessAdc(goertzel_t *bank, const uint16_t *adc, uint16_t signal_lenght, uint16_t offset, float *amplitude);
+
+/**
+ * @brief Amplitudes of the last result: last completed window (GOERTZEL_BLOCK)
+ * or last sample (GOERTZEL_SLIDING)
+ *
+ * @param bank          Bank
+ * @param amplitude     Array for freqs_qty amplitudes
+ */
+void GoertzelAmplitude(const goertzel_t *bank, float *amplitude);
+
+/** @} doxygen end group definition */
+/** @} doxygen end group definition */
+/** @} doxygen end group definition */
+#endif /* GOERTZEL_H_ */
+
+/*==================[end of file]============================================*/
@@ -0,0 +1,201 @@
+#ifndef MULTIRATE_H_
+#define MULTIRATE_H_
+/** \addtogroup Drivers_Programable Drivers Programable
+ ** @{ */
+/** \addtogroup Middelware Middelware
+ ** @{ */
+/** \addtogroup Multirate Multirate filters
+ */
+
+/** \brief Decimation and interpolation of streaming signals
+ *
+ * Signals sampled fast (to relax the analog anti-aliasing filter) can be
+ * decimated before the rest of the processing, so later filters and FFTs
+ * work at the lower rate.
+ *
+ * - MultirateLowPassDesign(): windowed-sinc FIR low pass (esp-dsp windows).
+ * - Decimator by any integer factor: dsps_fird_f32, only the kept outputs are
+ *   calculated (polyphase cost: coeffs_lenght MACs per output sample).
+ * - Interpolator by any integer factor: polyphase, one dsps_dotprod_f32 of
+ *   coeffs_lenght / interp taps per output sample.
+ * - CIC decimator (no multiplications) for big ratios, followed by a
+ *   decimator with MultirateCicCompDesign() coefficients that flattens the
+ *   CIC droop in the pass band.
+ *
+ * All stages keep their state between calls, so blocks of any length can be
+ * processed. Decimators can work in place (output = input).
+ *
+ * @section changelog
+ *
+ * |   Date	    | Description                                    						|
+ * |:----------:|:----------------------------------------------------------------------|
+ * | 19/10/2026 | Document creation		                         						|
+ *
+ **/
+
+/*==================[inclusions]=============================================*/
+#include <stdint.h>
+#include <stdbool.h>
+#include "dsps_fir.h"
+/*==================[macros]=================================================*/
+#define MULTIRATE_CIC_MAX_ORDER     6       /*!< Max CIC stages */
+/*==================[typedef]================================================*/
+/**
+ * @brief Window used by the FIR design functions
+ */
+typedef enum {
+    MULTIRATE_WIND_HANN = 0,            /*!< ~44 dB stop band */
+    MULTIRATE_WIND_BLACKMAN,            /*!< ~74 dB stop band */
+    MULTIRATE_WIND_BLACKMAN_HARRIS,     /*!< ~92 dB stop band, wider transition */
+    MULTIRATE_WIND_NUTTALL,             /*!< ~93 dB stop band, wider transition */
+} multirate_wind_t;
+
+/**
+ * @brief Decimator (FIR low pass + keep one sample every decim)
+ */
+typedef struct {
+    fir_f32_t fir;              /*!< esp-dsp decimating filter */
+    uint8_t decim;              /*!< Decimation factor */
+    uint8_t phase;              /*!< Input samples since the last output */
+} multirate_decim_t;
+
+/**
+ * @brief Polyphase interpolator (interp outputs per input sample)
+ */
+typedef struct {
+    float *phase_coeffs;        /*!< interp sub filters of taps coefficients (reversed, gain interp) */
+    float *delay;               /*!< Last taps input samples, stored twice (2 * taps) */
+    uint16_t taps;              /*!< Coefficients per sub filter */
+    uint16_t pos;               /*!< Oldest sample of the delay line */
+    uint8_t interp;             /*!< Interpolation factor */
+} multirate_interp_t;
+
+/**
+ * @brief CIC decimator
+ */
+typedef struct {
+    uint64_t integ[MULTIRATE_CIC_MAX_ORDER];    /*!< Integrators (modulo 2^64 arithmetic) */
+    uint64_t comb[MULTIRATE_CIC_MAX_ORDER];     /*!< Comb delays */
+    uint8_t order;                              /*!< Number of integrator / comb stages */
+    uint16_t ratio;                             /*!< Decimation factor */
+    uint16_t count;                             /*!< Input samples since the last output */
+    float scale;                                /*!< 1 / ratio^order (DC gain 1) */
+} multirate_cic_t;
+/*==================[external data declaration]==============================*/
+
+/*==================[external functions declaration]=========================*/
+/**
+ * @brief Design a windowed-sinc FIR low pass filter (linear phase, DC gain 1)
+ *
+ * For a decimator or interpolator by M, cut_frec = sample_frec / (2 * M)
+ * or a bit lower. The transition band is ~4 (Hann) to ~8 (Blackman-Harris)
+ * times sample_frec / coeffs_lenght wide.
+ *
+ * @param coeffs        Array for the coefficients
+ * @param coeffs_lenght Number of coefficients
+ * @param cut_frec      Cut-off frequency (-6 dB)
+ * @param sample_frec   Sample frequency of the filter input
+ * @param wind          Window
+ * @return true Filter designed
+ * @return false Invalid parameters
+ */
+bool MultirateLowPassDesign(float *coeffs, uint16_t coeffs_lenght, float cut_frec, float sample_frec, multirate_wind_t wind);
+
+/**
+ * @brief Design a CIC compensation FIR low pass filter (DC gain 1)
+ *
+ * Same as MultirateLowPassDesign() with a pass band gain that is the
+ * inverse of the CIC response, so CIC + compensator is flat up to cut_frec.
+ *
+ * @param coeffs        Array for the coefficients
+ * @param coeffs_lenght Number of coefficients
+ * @param cut_frec      Cut-off frequency
+ * @param sample_frec   Sample frequency of the CIC output
+ * @param cic_order     CIC order
+ * @param cic_ratio     CIC decimation factor
+ * @param wind          Window
+ * @return true Filter designed
+ * @return false Invalid parameters
+ */
+bool MultirateCicCompDesign(float *coeffs, uint16_t coeffs_lenght, float cut_frec, float sample_frec,
+    uint8_t cic_order, uint16_t cic_ratio, multirate_wind_t wind);
+
+/**
+ * @brief Initialize a decimator
+ *
+ * @param decimator     Decimator to initialize
+ * @param coeffs        Low pass coefficients (kept by the decimator)
+ * @param delay         Array for the delay line (coeffs_lenght)
+ * @param coeffs_lenght Number of coefficients
+ * @param decim         Decimation factor
+ * @return true Decimator initialized
+ * @return false Invalid parameters
+ */
+bool MultirateDecimInit(multirate_decim_t *decimator, float *coeffs, float *delay, uint16_t coeffs_lenght, uint8_t decim);
+
+/**
+ * @brief Filter and decimate a block of any length
+ *
+ * @param decimator     Decimator
+ * @param input         Input samples
+ * @param output        Output samples (can be the same array as input)
+ * @param signal_lenght Number of input samples
+ * @return uint16_t Number of output samples
+ */
+uint16_t MultirateDecim(multirate_decim_t *decimator, const float *input, float *output, uint16_t signal_lenght);
+
+/**
+ * @brief Initialize a polyphase interpolator
+ *
+ * @param interpolator  Interpolator to initialize
+ * @param coeffs        Low pass coefficients designed at the output rate (DC gain 1)
+ * @param coeffs_lenght Number of coefficients
+ * @param interp        Interpolation factor
+ * @param phase_coeffs  Array for the sub filters (interp * ceil(coeffs_lenght / interp))
+ * @param delay         Array for the delay line (2 * ceil(coeffs_lenght / interp))
+ * @return true Interpolator initialized
+ * @return false Invalid parameters
+ */
+bool MultirateInterpInit(multirate_interp_t *interpolator, const float *coeffs, uint16_t coeffs_lenght, uint8_t interp,
+    float *phase_coeffs, float *delay);
+
+/**
+ * @brief Interpolate a block of any length
+ *
+ * @param interpolator  Interpolator
+ * @param input         Input samples
+ * @param output        Output samples (signal_lenght * interp, not the input array)
+ * @param signal_lenght Number of input samples
+ * @return uint16_t Number of output samples
+ */
+uint16_t MultirateInterp(multirate_interp_t *interpolator, const float *input, float *output, uint16_t signal_lenght);
+
+/**
+ * @brief Initialize a CIC decimator
+ *
+ * @param cic           CIC to initialize
+ * @param order         Number of stages (1 to MULTIRATE_CIC_MAX_ORDER)
+ * @param ratio         Decimation factor (16 + order * log2(ratio) must be up to 64 bits)
+ * @return true CIC initialized
+ * @return false Invalid parameters
+ */
+bool MultirateCicInit(multirate_cic_t *cic, uint8_t order, uint16_t ratio);
+
+/**
+ * @brief CIC decimation of a block of any length (e.g. a Q15 frame or ADC
+ * counts minus the mid scale)
+ *
+ * @param cic           CIC
+ * @param input         Input samples
+ * @param output        Output samples (DC gain 1)
+ * @param signal_lenght Number of input samples
+ * @return uint16_t Number of output samples
+ */
+uint16_t MultirateCicDecim(multirate_cic_t *cic, const int16_t *input, float *output, uint16_t signal_lenght);
+
+/** @} doxygen end group definition */
+/** @} doxygen end group definition */
+/** @} doxygen end group definition */
+#endif /* MULTIRATE_H_ */
+
+/*==================[end of file]============================================*/
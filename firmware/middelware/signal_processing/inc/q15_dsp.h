@@ -0,0 +1,184 @@
+#ifndef Q15_DSP_H_
+#define Q15_DSP_H_
+/** \addtogroup Drivers_Programable Drivers Programable
+ ** @{ */
+/** \addtogroup Middelware Middelware
+ ** @{ */
+/** \addtogroup Q15_DSP Q15 Signal Processing
+ */
+
+/** \brief Fixed point (Q15) signal chain: ADC frames, IIR and FIR filters and FFT
+ *
+ * Fixed point version of iir_filter and fft for CPUs without FPU (ESP32-C6).
+ * Samples are int16_t in Q15, so buffers take half the memory of the float
+ * version and the raw ADC frames are converted without float operations.
+ *
+ * Every frame has a block exponent (block floating point): the value of a
+ * sample in ADC counts is sample * 2^exponent. Q15FromAdc() scales the frame
+ * to use the whole int16_t range and each stage updates the exponent instead
+ * of losing resolution or overflowing. Samples clipped to the int16_t range
+ * are counted in q15_block_t.saturations.
+ *
+ * @section changelog
+ *
+ * |   Date	    | Description                                    						|
+ * |:----------:|:----------------------------------------------------------------------|
+ * | 19/10/2026 | Document creation		                         						|
+ *
+ **/
+
+/*==================[inclusions]=============================================*/
+#include <stdint.h>
+#include <stdbool.h>
+#include "iir_filter.h"
+#include "dsps_fir.h"
+/*==================[macros]=================================================*/
+#define Q15_MAX_SIGNAL_LENGHT   2048        /*!< Max FFT length */
+#define Q15_MAX_SECTIONS        4           /*!< Max biquad sections (8th order) */
+#define Q15_OFFSET_MEAN         0xFFFF      /*!< Q15FromAdc() offset: remove the frame mean */
+/*==================[typedef]================================================*/
+/**
+ * @brief Block floating point state of a frame
+ */
+typedef struct {
+    int8_t exponent;            /*!< Sample value (in ADC counts) = sample * 2^exponent */
+    uint32_t saturations;       /*!< Samples clipped to the int16_t range */
+} q15_block_t;
+
+/**
+ * @brief Biquad cascade. Samples are Q15, coefficients Q30 (int32_t) so low
+ * cut-off frequencies keep their poles inside the unit circle.
+ */
+typedef struct {
+    int32_t coeffs[Q15_MAX_SECTIONS][5];    /*!< b0, b1, b2, a1, a2 (Q30) */
+    int32_t delay[Q15_MAX_SECTIONS][4];     /*!< x[n-1], x[n-2], y[n-1], y[n-2] */
+    uint8_t sections;                       /*!< Number of sections (order / 2) */
+} q15_biquad_t;
+
+/**
+ * @brief Decimating FIR filter (esp-dsp dsps_fird_s16)
+ */
+typedef struct {
+    fir_s16_t fir;              /*!< esp-dsp filter */
+    uint8_t headroom;           /*!< Output scaling (2^-headroom) so it can't overflow */
+} q15_fir_t;
+/*==================[external data declaration]==============================*/
+
+/*==================[external functions declaration]=========================*/
+/**
+ * @brief Convert a frame of raw ADC counts to Q15, using all the int16_t range
+ *
+ * @param adc           Raw ADC frame (12 bits)
+ * @param output        Q15 frame
+ * @param signal_lenght Number of samples
+ * @param offset        Counts subtracted to each sample (2048: mid scale, Q15_OFFSET_MEAN: frame mean)
+ * @param block         Block state of the frame (exponent is set, saturations are kept)
+ */
+void Q15FromAdc(const uint16_t *adc, int16_t *output, uint16_t signal_lenght, uint16_t offset, q15_block_t *block);
+
+/**
+ * @brief Initialize a Butterworth low pass biquad cascade
+ *
+ * @param filter        Filter to initialize
+ * @param sample_frec   Signal's sample frequency
+ * @param cut_frec      Filter's cut-off frequency
+ * @param order         Filter's order (2, 4, 6 or 8)
+ */
+void Q15LowPassInit(q15_biquad_t *filter, float sample_frec, float cut_frec, filter_order_t order);
+
+/**
+ * @brief Initialize a Butterworth hi pass biquad cascade
+ *
+ * @param filter        Filter to initialize
+ * @param sample_frec   Signal's sample frequency
+ * @param cut_frec      Filter's cut-off frequency
+ * @param order         Filter's order (2, 4, 6 or 8)
+ */
+void Q15HiPassInit(q15_biquad_t *filter, float sample_frec, float cut_frec, filter_order_t order);
+
+/**
+ * @brief Apply a biquad cascade to a Q15 frame. Input and output can be the same array.
+ *
+ * @param filter        Filter
+ * @param input_signal  Input frame
+ * @param output_signal Filtered frame (same block exponent as the input)
+ * @param signal_lenght Number of samples
+ * @param block         Block state (clipped samples are added to saturations)
+ */
+void Q15BiquadFilter(q15_biquad_t *filter, const int16_t *input_signal, int16_t *output_signal, uint16_t signal_lenght, q15_block_t *block);
+
+/**
+ * @brief Initialize a decimating FIR filter
+ *
+ * @note The output is scaled down by 2^headroom if the sum of the absolute
+ * values of the coefficients is bigger than 1, so it never overflows.
+ *
+ * @param filter        Filter to initialize
+ * @param coeffs        Filter coefficients (float)
+ * @param coeffs_q15    Array for the Q15 coefficients (coeffs_lenght)
+ * @param delay         Array for the delay line (coeffs_lenght)
+ * @param coeffs_lenght Number of coefficients (at least 2)
+ * @param decim         Decimation factor
+ * @return true Filter initialized
+ * @return false Invalid parameters
+ */
+bool Q15FirDecimInit(q15_fir_t *filter, const float *coeffs, int16_t *coeffs_q15, int16_t *delay, uint16_t coeffs_lenght, uint8_t decim);
+
+/**
+ * @brief Filter and decimate a Q15 frame
+ *
+ * @param filter        Filter
+ * @param input_signal  Input frame
+ * @param output_signal Output frame (signal_lenght / decim samples)
+ * @param signal_lenght Number of input samples (multiple of decim)
+ * @param block         Block state (exponent is increased by the filter headroom)
+ * @return uint16_t Number of output samples
+ */
+uint16_t Q15FirDecim(q15_fir_t *filter, const int16_t *input_signal, int16_t *output_signal, uint16_t signal_lenght, q15_block_t *block);
+
+/**
+ * @brief Free the memory allocated by Q15FirDecimInit()
+ *
+ * @param filter        Filter
+ */
+void Q15FirDecimDeinit(q15_fir_t *filter);
+
+/**
+ * @brief Initialize the Q15 FFT tables
+ *
+ * @return true Tables initialized
+ * @return false Not enough memory
+ */
+bool Q15FFTInit(void);
+
+/**
+ * @brief FFT magnitude of a Q15 frame (Hann window)
+ *
+ * @note The complex work buffer (2 * signal_lenght samples) is taken from
+ * arena_scratch during the call. If it doesn't fit the magnitude is all zeros.
+ * The window is calculated on the fly (integer rotation): no RAM is kept
+ * between calls.
+ *
+ * @param signal        Input frame (not modified)
+ * @param fft           FFT magnitude (signal_lenght / 2 bins), same units as FFTMagnitude()
+ * @param signal_lenght Number of samples (power of 2, up to Q15_MAX_SIGNAL_LENGHT)
+ * @param block         Block state: input exponent in, exponent of fft out
+ */
+void Q15FFTMagnitude(const int16_t *signal, int16_t *fft, uint16_t signal_lenght, q15_block_t *block);
+
+/**
+ * @brief Convert a Q15 frame to float (ADC counts), e.g. to compare with the float chain
+ *
+ * @param input         Q15 frame
+ * @param output        Float frame
+ * @param signal_lenght Number of samples
+ * @param block         Block state of the frame
+ */
+void Q15ToFloat(const int16_t *input, float *output, uint16_t signal_lenght, const q15_block_t *block);
+
+/** @} doxygen end group definition */
+/** @} doxygen end group definition */
+/** @} doxygen end group definition */
+#endif /* Q15_DSP_H_ */
+
+/*==================[end of file]============================================*/
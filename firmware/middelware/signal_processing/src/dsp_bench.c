@@ -0,0 +1,389 @@
+/**
+ * @file dsp_bench.c
+ * @brief Benchmark suite of the signal processing functions (target and host)
+ * @version 0.1
+ * @date 2026-10-19
+ *
+ * @copyright Copyright (c) 2026
+ *
+ */
+
+/*==================[inclusions]=============================================*/
+#include <string.h>
+#include <stdbool.h>
+#include <math.h>
+#include "dsp_bench.h"
+#include "fft.h"
+#include "iir_filter.h"
+#include "esp_dsp.h"
+#include "dsps_fconv.h"
+#include "dspm_solve.h"
+#include "esp_log.h"
+#include "arena_mcu.h"
+#ifndef MCU_HOST
+#include "sdkconfig.h"
+#endif
+/*==================[macros and definitions]=================================*/
+#define TAG "DSP Bench"
+#define SIGNAL_LENGHT       1024                        /*!< Samples of the filter and convolution cases */
+#define FFT_MAX             CONFIG_DSP_MAX_FFT_SIZE     /*!< Biggest complex FFT */
+#define KERNEL_MAX          256                         /*!< Biggest FIR / convolution kernel */
+#define MATRIX_MAX          32                          /*!< Biggest matrix */
+#define BIQUAD_MAX          8                           /*!< Longest biquad cascade */
+#define FIRD_DECIM          4                           /*!< Decimation of dsps_fird_f32 */
+#define SIZES_MAX           8                           /*!< Sizes per case */
+
+/**
+ * @brief Benchmark case: run() is timed, prepare() (untimed) restores its
+ * input before each run
+ */
+typedef struct {
+    const char *name;
+    uint32_t (*setup)(uint32_t size);       /*!< Prepares the case, returns the items per run (0: skip) */
+    void (*prepare)(uint32_t size);         /*!< Before each run (NULL: none) */
+    void (*run)(uint32_t size);             /*!< Timed function */
+    void (*cleanup)(void);                  /*!< After the runs of a size (NULL: none) */
+    uint32_t sizes[SIZES_MAX];              /*!< Sizes (0 terminated) */
+} dsp_bench_case_t;
+/*==================[internal data declaration]==============================*/
+
+/*==================[internal functions declaration]=========================*/
+/* EKF case (dsp_bench_ekf.cpp) */
+uint32_t DspBenchEkfSetup(uint32_t size);
+void DspBenchEkfRun(uint32_t size);
+/*==================[internal data definition]===============================*/
+/* Work buffers shared by the cases: input, kernel / second operand, output */
+static float bench_in[2 * FFT_MAX];
+static float bench_work[2 * FFT_MAX];
+static float bench_out[SIGNAL_LENGHT + KERNEL_MAX];
+static float bench_coeffs[KERNEL_MAX];
+static float bench_delay[KERNEL_MAX];
+static float bench_biquad[BIQUAD_MAX][5];
+static float bench_biquad_w[BIQUAD_MAX][2];
+static int bench_pivot[MATRIX_MAX];
+static fir_f32_t bench_fir;
+static fconv_f32_t bench_fconv;
+static dsps_fft2r_plan_fc32_t bench_fft2r;
+static fft_plan_t bench_plan;
+static uint32_t bench_arena_mark;
+/*==================[external data definition]===============================*/
+
+/*==================[internal functions definition]==========================*/
+/* Deterministic test signal in [-1, 1] */
+static void DspBenchSignal(float *x, uint32_t len, uint32_t seed){
+    for (uint32_t i = 0; i < len; i++){
+        seed = seed * 1664525 + 1013904223;
+        x[i] = 0.5f * sinf(0.01f * i) + (int32_t)(seed >> 8) / 16777216.0f / 2;
+    }
+}
+
+/* FFT cases: input restored before each run (the transforms are in place) */
+static void DspBenchFftPrepare(uint32_t size){
+    memcpy(bench_work, bench_in, 2 * size * sizeof(float));
+}
+
+static uint32_t DspBenchFft2rSetup(uint32_t size){
+    if (dsps_fft2r_plan_init_fc32(&bench_fft2r, size) != ESP_OK){
+        return 0;
+    }
+    DspBenchSignal(bench_in, 2 * size, size);
+    return size;
+}
+
+static void DspBenchFft2rRun(uint32_t size){
+    dsps_fft2r_plan_fc32(&bench_fft2r, bench_work);
+    dsps_bit_rev_plan_fc32(&bench_fft2r, bench_work);
+}
+
+static uint32_t DspBenchFft4rSetup(uint32_t size){
+    // The radix-4 tables may have been initialized for less points (FFTPlanInit())
+    if ((dsps_fft4r_init_fc32(NULL, FFT_MAX) != ESP_OK) || (size > (uint32_t)dsps_fft4r_w_table_size / 2)){
+        return 0;
+    }
+    DspBenchSignal(bench_in, 2 * size, size);
+    return size;
+}
+
+static void DspBenchFft4rRun(uint32_t size){
+    dsps_fft4r_fc32(bench_work, size);
+    dsps_bit_rev4r_fc32(bench_work, size);
+}
+
+static uint32_t DspBenchFFTMagnitudeSetup(uint32_t size){
+    DspBenchSignal(bench_in, size, size);
+    return size;
+}
+
+static void DspBenchFFTMagnitudeRun(uint32_t size){
+    FFTMagnitude(bench_in, bench_out, size);
+}
+
+static uint32_t DspBenchFFTPlanSetup(uint32_t size){
+    // One plan at a time: the tables are given back to arena_dsp by the cleanup
+    bench_arena_mark = ArenaMark(&arena_dsp);
+    bench_plan = (fft_plan_t){0};
+    if (!FFTPlanInit(&bench_plan, size)){
+        ArenaReset(&arena_dsp, bench_arena_mark);
+        return 0;
+    }
+    DspBenchSignal(bench_in, size, size);
+    return size;
+}
+
+static void DspBenchFFTPlanRun(uint32_t size){
+    FFTPlanMagnitude(&bench_plan, bench_in, bench_out);
+}
+
+static void DspBenchFFTPlanCleanup(void){
+    ArenaReset(&arena_dsp, bench_arena_mark);
+}
+
+/* Filters: the state is kept between runs, as in a stream */
+static uint32_t DspBenchBiquadSetup(uint32_t size){
+    for (uint32_t i = 0; i < size; i++){
+        dsps_biquad_gen_lpf_f32(bench_biquad[i], 0.05f + 0.01f * i, 0.7f);
+        bench_biquad_w[i][0] = bench_biquad_w[i][1] = 0;
+    }
+    DspBenchSignal(bench_in, SIGNAL_LENGHT, size);
+    return SIGNAL_LENGHT;
+}
+
+static void DspBenchBiquadRun(uint32_t size){
+    dsps_biquad_f32(bench_in, bench_out, SIGNAL_LENGHT, bench_biquad[0], bench_biquad_w[0]);
+    for (uint32_t i = 1; i < size; i++){
+        dsps_biquad_f32(bench_out, bench_out, SIGNAL_LENGHT, bench_biquad[i], bench_biquad_w[i]);
+    }
+}
+
+static uint32_t DspBenchLowPassSetup(uint32_t size){
+    LowPassInit(1000, 50, size);
+    DspBenchSignal(bench_in, SIGNAL_LENGHT, size);
+    return SIGNAL_LENGHT;
+}
+
+static void DspBenchLowPassRun(uint32_t size){
+    LowPassFilter(bench_in, bench_out, SIGNAL_LENGHT);
+}
+
+static uint32_t DspBenchFirSetup(uint32_t size){
+    DspBenchSignal(bench_coeffs, size, 1);
+    DspBenchSignal(bench_in, SIGNAL_LENGHT, size);
+    return (dsps_fir_init_f32(&bench_fir, bench_coeffs, bench_delay, size) == ESP_OK) ? SIGNAL_LENGHT : 0;
+}
+
+static void DspBenchFirRun(uint32_t size){
+    dsps_fir_f32(&bench_fir, bench_in, bench_out, SIGNAL_LENGHT);
+}
+
+static uint32_t DspBenchFirdSetup(uint32_t size){
+    DspBenchSignal(bench_coeffs, size, 1);
+    DspBenchSignal(bench_in, SIGNAL_LENGHT, size);
+    return (dsps_fird_init_f32(&bench_fir, bench_coeffs, bench_delay, size, FIRD_DECIM) == ESP_OK) ? SIGNAL_LENGHT : 0;
+}
+
+static void DspBenchFirdRun(uint32_t size){
+    dsps_fird_f32(&bench_fir, bench_in, bench_out, SIGNAL_LENGHT / FIRD_DECIM);
+}
+
+static uint32_t DspBenchDotprodSetup(uint32_t size){
+    DspBenchSignal(bench_in, size, 1);
+    DspBenchSignal(bench_work, size, 2);
+    return size;
+}
+
+static void DspBenchDotprodRun(uint32_t size){
+    dsps_dotprod_f32(bench_in, bench_work, bench_out, size);
+}
+
+/* Convolution and correlation of SIGNAL_LENGHT samples with a kernel of size samples */
+static uint32_t DspBenchConvSetup(uint32_t size){
+    DspBenchSignal(bench_in, SIGNAL_LENGHT, 1);
+    DspBenchSignal(bench_coeffs, size, 2);
+    return SIGNAL_LENGHT;
+}
+
+static void DspBenchConvRun(uint32_t size){
+    dsps_conv_f32(bench_in, SIGNAL_LENGHT, bench_coeffs, size, bench_out);
+}
+
+static void DspBenchCorrRun(uint32_t size){
+    dsps_corr_f32(bench_in, SIGNAL_LENGHT, bench_coeffs, size, bench_out);
+}
+
+static uint32_t DspBenchConvFftSetup(uint32_t size){
+    DspBenchConvSetup(size);
+    return (dsps_fconv_init_f32(&bench_fconv, bench_coeffs, size, DSPS_FCONV_OVERLAP_ADD, 0) == ESP_OK) ? SIGNAL_LENGHT : 0;
+}
+
+static void DspBenchConvFftRun(uint32_t size){
+    dsps_conv_fft_f32(&bench_fconv, bench_in, SIGNAL_LENGHT, bench_out);
+}
+
+static void DspBenchConvFftCleanup(void){
+    dsps_fconv_free_f32(&bench_fconv);
+}
+
+/* Matrices: A in bench_in, B in bench_work, C in bench_out */
+static uint32_t DspBenchMultSetup(uint32_t size){
+    DspBenchSignal(bench_in, size * size, 1);
+    DspBenchSignal(bench_work, size * size, 2);
+    return size * size * size;
+}
+
+static void DspBenchMultRun(uint32_t size){
+    dspm_mult_f32(bench_in, bench_work, bench_out, size, size, size);
+}
+
+/* Solves: symmetric positive definite A = M * M' + n * I in bench_in, factored
+ * in a copy (bench_work), right hand side and solution in bench_out */
+static uint32_t DspBenchSolveSetup(uint32_t size){
+    DspBenchSignal(bench_work, size * size, 1);
+    for (uint32_t i = 0; i < size; i++){
+        for (uint32_t j = 0; j < size; j++){
+            dsps_dotprod_f32(&bench_work[i * size], &bench_work[j * size], &bench_in[i * size + j], size);
+        }
+        bench_in[i * size + i] += size;
+    }
+    DspBenchSignal(&bench_in[size * size], size, 2);
+    return 1;
+}
+
+static void DspBenchSolvePrepare(uint32_t size){
+    memcpy(bench_work, bench_in, size * size * sizeof(float));
+}
+
+static void DspBenchCholRun(uint32_t size){
+    dspm_chol_f32(bench_work, size);
+    dspm_chol_solve_f32(bench_work, size, &bench_in[size * size], bench_out, 1);
+}
+
+static void DspBenchLuRun(uint32_t size){
+    int sign;
+
+    dspm_lu_f32(bench_work, size, bench_pivot, &sign);
+    dspm_lu_solve_f32(bench_work, bench_pivot, size, &bench_in[size * size], bench_out, 1);
+}
+
+static const dsp_bench_case_t bench_cases[] = {
+    {"dsps_fft2r_fc32", DspBenchFft2rSetup, DspBenchFftPrepare, DspBenchFft2rRun, NULL, {64, 128, 256, 512, 1024, 2048, 4096}},
+    {"dsps_fft4r_fc32", DspBenchFft4rSetup, DspBenchFftPrepare, DspBenchFft4rRun, NULL, {64, 256, 1024, 4096}},
+    {"FFTMagnitude", DspBenchFFTMagnitudeSetup, NULL, DspBenchFFTMagnitudeRun, NULL, {64, 128, 256, 512, 1024, 2048}},
+    {"FFTPlanMagnitude", DspBenchFFTPlanSetup, NULL, DspBenchFFTPlanRun, DspBenchFFTPlanCleanup, {64, 128, 256, 512, 1024, 2048}},
+    {"dsps_biquad_f32", DspBenchBiquadSetup, NULL, DspBenchBiquadRun, NULL, {1, 2, 4, 8}},
+    {"LowPassFilter", DspBenchLowPassSetup, NULL, DspBenchLowPassRun, NULL, {ORDER_2, ORDER_4, ORDER_6, ORDER_8}},
+    {"dsps_fir_f32", DspBenchFirSetup, NULL, DspBenchFirRun, NULL, {16, 64, 256}},
+    {"dsps_fird_f32", DspBenchFirdSetup, NULL, DspBenchFirdRun, NULL, {16, 64, 256}},
+    {"dsps_dotprod_f32", DspBenchDotprodSetup, NULL, DspBenchDotprodRun, NULL, {64, 256, 1024, 4096}},
+    {"dsps_conv_f32", DspBenchConvSetup, NULL, DspBenchConvRun, NULL, {16, 64, 256}},
+    {"dsps_corr_f32", DspBenchConvSetup, NULL, DspBenchCorrRun, NULL, {16, 64, 256}},
+    {"dsps_conv_fft_f32", DspBenchConvFftSetup, NULL, DspBenchConvFftRun, DspBenchConvFftCleanup, {16, 64, 256}},
+    {"dspm_mult_f32", DspBenchMultSetup, NULL, DspBenchMultRun, NULL, {4, 8, 16, 32}},
+    {"dspm_chol_solve_f32", DspBenchSolveSetup, DspBenchSolvePrepare, DspBenchCholRun, NULL, {4, 8, 16, 32}},
+    {"dspm_lu_solve_f32", DspBenchSolveSetup, DspBenchSolvePrepare, DspBenchLuRun, NULL, {4, 8, 16, 32}},
+    {"ekf_imu13states", DspBenchEkfSetup, NULL, DspBenchEkfRun, NULL, {13}},
+};
+
+/* Runs a case for one size: a warm up run and DSP_BENCH_REPEAT timed runs */
+static bool DspBenchCase(const dsp_bench_case_t *bench, uint32_t size, dsp_bench_result_t *result){
+    uint32_t times[DSP_BENCH_REPEAT];
+    uint32_t start, time, items;
+    int32_t j;
+
+    items = bench->setup(size);
+    if (items == 0){
+        ESP_LOGW(TAG, "%s(%lu) skipped", bench->name, (unsigned long)size);
+        return false;
+    }
+    for (uint32_t i = 0; i <= DSP_BENCH_REPEAT; i++){
+        if (bench->prepare != NULL){
+            bench->prepare(size);
+        }
+        start = dsp_get_cpu_cycle_count();
+        bench->run(size);
+        time = dsp_get_cpu_cycle_count() - start;
+        if (i == 0){
+            continue;
+        }
+        // Insertion in order
+        for (j = (int32_t)i - 2; (j >= 0) && (times[j] > time); j--){
+            times[j + 1] = times[j];
+        }
+        times[j + 1] = time;
+    }
+    if (bench->cleanup != NULL){
+        bench->cleanup();
+    }
+    *result = (dsp_bench_result_t){
+        .name = bench->name,
+        .size = size,
+        .items = items,
+        .min = times[0],
+        .median = times[DSP_BENCH_REPEAT / 2],
+        .max = times[DSP_BENCH_REPEAT - 1],
+    };
+    return true;
+}
+/*==================[external functions definition]==========================*/
+uint16_t DspBenchRun(const char *filter, dsp_bench_result_t *results, uint16_t max_results,
+    dsp_bench_func_t func_p, void *param_p){
+    dsp_bench_result_t result;
+    uint16_t count = 0;
+
+    if (!FFTInit()){
+        ESP_LOGE(TAG, "No FFT tables");
+    }
+    for (uint16_t c = 0; c < sizeof(bench_cases) / sizeof(bench_cases[0]); c++){
+        if ((filter != NULL) && (strncmp(bench_cases[c].name, filter, strlen(filter)) != 0)){
+            continue;
+        }
+        for (uint8_t s = 0; (s < SIZES_MAX) && (bench_cases[c].sizes[s] != 0); s++){
+            if (!DspBenchCase(&bench_cases[c], bench_cases[c].sizes[s], &result)){
+                continue;
+            }
+            if ((results != NULL) && (count < max_results)){
+                results[count] = result;
+            }
+            count++;
+            if (func_p != NULL){
+                func_p(&result, param_p);
+            }
+        }
+    }
+    return count;
+}
+
+const char* DspBenchUnit(void){
+#ifdef MCU_HOST
+    return "ns";
+#else
+    return "cycles";
+#endif
+}
+
+void DspBenchCsvHeader(FILE *f){
+    fprintf(f, "name,size,items,unit,min,median,max,per_item\n");
+}
+
+void DspBenchCsvLine(FILE *f, const dsp_bench_result_t *result){
+    fprintf(f, "%s,%lu,%lu,%s,%lu,%lu,%lu,%.3f\n", result->name, (unsigned long)result->size,
+        (unsigned long)result->items, DspBenchUnit(), (unsigned long)result->min, (unsigned long)result->median,
+        (unsigned long)result->max, (double)result->median / result->items);
+}
+
+void DspBenchJson(FILE *f, const dsp_bench_result_t *results, uint16_t count){
+#ifdef MCU_HOST
+    fprintf(f, "{\n  \"platform\": \"host\",\n  \"unit\": \"%s\",\n  \"cpu_mhz\": 0,\n  \"results\": [\n", DspBenchUnit());
+#else
+    fprintf(f, "{\n  \"platform\": \"%s\",\n  \"unit\": \"%s\",\n  \"cpu_mhz\": %d,\n  \"results\": [\n",
+        CONFIG_IDF_TARGET, DspBenchUnit(), CONFIG_ESP_DEFAULT_CPU_FREQ_MHZ);
+#endif
+    for (uint16_t i = 0; i < count; i++){
+        fprintf(f, "    {\"name\": \"%s\", \"size\": %lu, \"items\": %lu, \"min\": %lu, \"median\": %lu, \"max\": %lu, \"per_item\": %.3f}%s\n",
+            results[i].name, (unsigned long)results[i].size, (unsigned long)results[i].items,
+            (unsigned long)results[i].min, (unsigned long)results[i].median, (unsigned long)results[i].max,
+            (double)results[i].median / results[i].items, (i + 1 < count) ? "," : "");
+    }
+    fprintf(f, "  ]\n}\n");
+}
+
+/*==================[end of file]============================================*/
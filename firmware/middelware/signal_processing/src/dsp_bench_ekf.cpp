@@ -0,0 +1,41 @@
+/**
+ * @file dsp_bench_ekf.cpp
+ * @brief EKF case of the benchmark suite (dsp_bench.c): one 200 Hz step of
+ * ekf_imu13states, Process() + UpdateRefMeasurement()
+ * @version 0.1
+ * @date 2026-10-19
+ *
+ * @copyright Copyright (c) 2026
+ *
+ */
+
+/*==================[inclusions]=============================================*/
+#include <stdint.h>
+#include "ekf_imu13states.h"
+/*==================[macros and definitions]=================================*/
+#define EKF_DT      0.005f      /*!< 200 Hz */
+/*==================[internal data definition]===============================*/
+static ekf_imu13states *bench_ekf = NULL;
+/* Sensor turning slowly around z, accelerometer and magnetometer references */
+static float bench_gyro[3] = {0.0f, 0.0f, 0.1f};
+static float bench_accel[3] = {0.0f, 0.0f, 1.0f};
+static float bench_magn[3] = {1.0f, 0.0f, 0.0f};
+static float bench_r[6] = {0.01f, 0.01f, 0.01f, 0.01f, 0.01f, 0.01f};
+/*==================[external functions definition]==========================*/
+extern "C" uint32_t DspBenchEkfSetup(uint32_t size)
+{
+    // Created once, Process() and UpdateRefMeasurement() don't allocate
+    if (bench_ekf == NULL) {
+        bench_ekf = new ekf_imu13states();
+        bench_ekf->Init();
+    }
+    return (size == (uint32_t)bench_ekf->NUMX) ? 1 : 0;
+}
+
+extern "C" void DspBenchEkfRun(uint32_t size)
+{
+    bench_ekf->Process(bench_gyro, EKF_DT);
+    bench_ekf->UpdateRefMeasurement(bench_accel, bench_magn, bench_r);
+}
+
+/*==================[end of file]============================================*/
@@ -15,11 +15,10 @@
 #include "fft.h"
 #include "esp_dsp.h"
 #include "esp_log.h"
+#include "arena_mcu.h"
 /*==================[macros and definitions]=================================*/
 #define TAG "FFT Module"
 /*==================[internal data declaration]==============================*/
-static float fft_complex[2 * MAX_SIGNAL_LENGHT];
-static float wind[MAX_SIGNAL_LENGHT];
 /*==================[internal functions declaration]=========================*/
 
 /*==================[internal data definition]===============================*/
@@ -27,6 +26,38 @@ static float wind[MAX_SIGNAL_LENGHT];
 /*==================[external data definition]===============================*/
 
 /*==================[internal functions definition]==========================*/
+/* Base 4 digit reversal of index (digits: number of base 4 digits) */
+static uint16_t FFTDigitReverse4(uint16_t index, uint8_t digits){
+    uint16_t reversed = 0;
+    for(uint8_t i = 0; i < digits; i++){
+        reversed = (reversed << 2) | (index & 0x3);
+        index >>= 2;
+    }
+    return reversed;
+}
+
+/* Decimation in frequency radix-2 stage over n complex points: the first
+ * half gets the even bins and the second half the odd bins */
+static void FFTRadix2Stage(float * data, uint16_t n){
+    uint16_t half = n / 2;
+    int step = dsps_fft4r_w_table_size / n;
+    float a_re, a_im, b_re, b_im, c, s;
+
+    for(uint16_t i = 0; i < half; i++){
+        a_re = data[2 * i];
+        a_im = data[2 * i + 1];
+        b_re = data[2 * (i + half)];
+        b_im = data[2 * (i + half) + 1];
+        c = dsps_fft4r_w_table_fc32[2 * i * step];
+        s = dsps_fft4r_w_table_fc32[2 * i * step + 1];
+        data[2 * i] = a_re + b_re;
+        data[2 * i + 1] = a_im + b_im;
+        b_re = a_re - b_re;
+        b_im = a_im - b_im;
+        data[2 * (i + half)] = b_re * c + b_im * s;
+        data[2 * (i + half) + 1] = b_im * c - b_re * s;
+    }
+}
 
 /*==================[external functions definition]==========================*/
 bool FFTInit(void){
@@ -38,16 +69,34 @@ bool FFTInit(void){
 }
 
 void FFTMagnitude(float * signal, float * fft, uint16_t signal_lenght){
+    dsps_fft2r_plan_fc32_t plan;
+    uint32_t mark = ArenaMark(&arena_scratch);
+    float * fft_complex = ArenaAlloc(&arena_scratch, 2 * signal_lenght * sizeof(float));
+    float * wind = ArenaAlloc(&arena_scratch, signal_lenght * sizeof(float));
+
+    if ((fft_complex == NULL) || (wind == NULL)){
+        ESP_LOGE(TAG, "No scratch memory for a %u point FFT", signal_lenght);
+        memset(fft, 0, (signal_lenght / 2) * sizeof(float));
+        ArenaReset(&arena_scratch, mark);
+        return;
+    }
+    // Own plan: doesn't depend on the global FFT tables
+    if (dsps_fft2r_plan_init_fc32(&plan, signal_lenght) != ESP_OK){
+        ESP_LOGE(TAG, "No FFT plan for %u points", signal_lenght);
+        memset(fft, 0, (signal_lenght / 2) * sizeof(float));
+        ArenaReset(&arena_scratch, mark);
+        return;
+    }
     // Generate Hann window
     dsps_wind_hann_f32(wind, signal_lenght);
     // Clear fft array
-    memset(fft_complex, 0, 2 * MAX_SIGNAL_LENGHT * sizeof(float));
+    memset(fft_complex, 0, 2 * signal_lenght * sizeof(float));
     // Multiply input array with window and store as real part
     dsps_mul_f32(signal, wind, fft_complex, signal_lenght, 1, 1, 2);    
     // Calculate FFT  
-    dsps_fft2r_fc32(fft_complex, signal_lenght);
-    // Bit reverse
-    dsps_bit_rev_fc32(fft_complex, signal_lenght);
+    dsps_fft2r_plan_fc32(&plan, fft_complex);
+    // Bit reverse (table driven)
+    dsps_bit_rev_plan_fc32(&plan, fft_complex);
     // Convert one complex vector to two complex vectors
     dsps_cplx2reC_fc32(fft_complex, signal_lenght);
     // Calculate FFT magnitude 
@@ -57,6 +106,103 @@ void FFTMagnitude(float * signal, float * fft, uint16_t signal_lenght){
     fft_complex[0] = fft_complex[0] / 2;
     // Copy result in fft array
     memcpy(fft, fft_complex, (signal_lenght / 2) * sizeof(float));
+    ArenaReset(&arena_scratch, mark);
+}
+
+bool FFTPlanInit(fft_plan_t * plan, uint16_t signal_lenght){
+    uint16_t n = signal_lenght / 2;
+    uint16_t capacity;
+    uint8_t digits;
+
+    if((signal_lenght < 4) || (signal_lenght > MAX_SIGNAL_LENGHT) || !dsp_is_power_of_two(signal_lenght)){
+        return false;
+    }
+    // Twiddle table for the biggest complex FFT (MAX_SIGNAL_LENGHT / 2 points)
+    if (dsps_fft4r_init_fc32(NULL, MAX_SIGNAL_LENGHT / 2) != ESP_OK){
+        return false;
+    }
+    // Tables from arena_dsp, reused when they are big enough
+    if ((plan->wind == NULL) || (plan->capacity < signal_lenght)){
+        capacity = signal_lenght;
+        if (plan->wind != NULL){
+            if (ArenaMark(&arena_dsp) == plan->arena_end){
+                // Last tables of the arena: give them back
+                ArenaReset(&arena_dsp, plan->arena_start);
+            } else{
+                // Can't be given back: grow only once
+                capacity = MAX_SIGNAL_LENGHT;
+            }
+        }
+        plan->arena_start = ArenaMark(&arena_dsp);
+        plan->wind = ArenaAlloc(&arena_dsp, capacity * sizeof(float));
+        plan->bin_index = ArenaAlloc(&arena_dsp, (capacity / 2) * sizeof(uint16_t));
+        plan->arena_end = ArenaMark(&arena_dsp);
+        plan->capacity = capacity;
+        if ((plan->wind == NULL) || (plan->bin_index == NULL)){
+            ESP_LOGE(TAG, "No DSP memory for a %u point FFT plan", signal_lenght);
+            ArenaReset(&arena_dsp, plan->arena_start);
+            plan->wind = NULL;
+            plan->capacity = 0;
+            return false;
+        }
+    }
+    plan->signal_lenght = signal_lenght;
+    dsps_wind_hann_f32(plan->wind, signal_lenght);
+    // Output order of the complex FFT (n = N/2 points)
+    if (dsp_power_of_two(n) & 0x01){
+        plan->radix = FFT_PLAN_RADIX_4_2;
+        digits = dsp_power_of_two(n / 2) / 2;
+        for(uint16_t k = 0; k < n / 2; k++){
+            plan->bin_index[2 * k] = FFTDigitReverse4(k, digits);
+            plan->bin_index[2 * k + 1] = n / 2 + FFTDigitReverse4(k, digits);
+        }
+    } else{
+        plan->radix = FFT_PLAN_RADIX_4;
+        digits = dsp_power_of_two(n) / 2;
+        for(uint16_t k = 0; k < n; k++){
+            plan->bin_index[k] = FFTDigitReverse4(k, digits);
+        }
+    }
+    return true;
+}
+
+void FFTPlanMagnitude(const fft_plan_t * plan, const float * signal, float * fft){
+    uint16_t n = plan->signal_lenght / 2;
+    uint32_t mark = ArenaMark(&arena_scratch);
+    float * data = ArenaAlloc(&arena_scratch, 2 * plan->signal_lenght * sizeof(float));
+    float * ordered = data + plan->signal_lenght;
+    uint16_t index;
+
+    if (data == NULL){
+        ESP_LOGE(TAG, "No scratch memory for a %u point FFT", plan->signal_lenght);
+        memset(fft, 0, n * sizeof(float));
+        return;
+    }
+
+    // Multiply input array with window, the real signal is packed as n complex samples
+    dsps_mul_f32(signal, plan->wind, data, plan->signal_lenght, 1, 1, 1);
+    // Calculate complex FFT (output in digit reversed order)
+    if (plan->radix == FFT_PLAN_RADIX_4_2){
+        FFTRadix2Stage(data, n);
+        dsps_fft4r_fc32(data, n / 2);
+        dsps_fft4r_fc32(data + n, n / 2);
+    } else{
+        dsps_fft4r_fc32(data, n);
+    }
+    // Reorder with the plan table
+    for (uint16_t k = 0; k < n; k++){
+        index = plan->bin_index[k];
+        ordered[2 * k] = data[2 * index];
+        ordered[2 * k + 1] = data[2 * index + 1];
+    }
+    // Spectrum of the real signal (bin 0 holds DC and Nyquist)
+    dsps_cplx2real_fc32(ordered, n);
+    // Calculate FFT magnitude (same scale as FFTMagnitude)
+    fft[0] = 2 * fabsf(ordered[0]) / plan->signal_lenght;
+    for (uint16_t j = 1; j < n; j++){
+        fft[j] = 8 * sqrtf(ordered[j*2+0]*ordered[j*2+0] + ordered[j*2+1]*ordered[j*2+1]) / plan->signal_lenght;
+    }
+    ArenaReset(&arena_scratch, mark);
 }
 
 void FFTFrequency(float sample_freq, uint16_t signal_lenght, float * f){
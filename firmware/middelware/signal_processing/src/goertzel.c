@@ -0,0 +1,205 @@
+/**
+ * @file goertzel.c
+ * @brief
+ * @version 0.1
+ * @date 2026-10-19
+ *
+ * @copyright Copyright (c) 2026
+ *
+ */
+
+/*==================[inclusions]=============================================*/
+#include <string.h>
+#include <math.h>
+#include "goertzel.h"
+/*==================[macros and definitions]=================================*/
+
+/*==================[internal data declaration]==============================*/
+
+/*==================[internal functions declaration]=========================*/
+
+/*==================[internal data definition]===============================*/
+
+/*==================[external data definition]===============================*/
+
+/*==================[internal functions definition]==========================*/
+/* |DFT| of a completed window. With s1 = s[N-1] and s2 = s[N-2], the DFT is
+ * s1 - e^(-jw) * s2, written with the Reinsch state so there is no
+ * cancellation when cos(w) is close to +-1 */
+static float GoertzelBlockMagnitude(const goertzel_freq_t *f){
+    float re, im;
+
+    if(f->low){
+        re = 0.5f * f->k * f->s + f->cos_w * f->d;
+        im = f->sin_w * (f->s - f->d);
+    } else{
+        re = 0.5f * f->k * f->s - f->cos_w * f->d;
+        im = f->sin_w * (f->d - f->s);
+    }
+    return sqrtf(re * re + im * im);
+}
+
+/* (re + j im)^n, in double */
+static void GoertzelPower(float re, float im, uint16_t n, float *out_re, float *out_im){
+    double p_re = 1, p_im = 0, b_re = re, b_im = im, t;
+
+    while(n){
+        if(n & 1){
+            t = p_re * b_re - p_im * b_im;
+            p_im = p_re * b_im + p_im * b_re;
+            p_re = t;
+        }
+        t = b_re * b_re - b_im * b_im;
+        b_im = 2 * b_re * b_im;
+        b_re = t;
+        n >>= 1;
+    }
+    *out_re = p_re;
+    *out_im = p_im;
+}
+
+/* Feeds one sample to every frequency. Returns true if there is a new result */
+static bool GoertzelSample(goertzel_t *bank, float x){
+    goertzel_freq_t *f;
+    float old, re, im;
+
+    if(bank->mode == GOERTZEL_SLIDING){
+        /* X[n] = r e^(jw) X[n-1] + x[n] - r^N e^(jwN) x[n-N] */
+        old = bank->delay[bank->count];
+        bank->delay[bank->count] = x;
+        if(++bank->count >= bank->window_lenght){
+            bank->count = 0;
+        }
+        for(uint8_t i = 0; i < bank->freqs_qty; i++){
+            f = &bank->freqs[i];
+            re = f->rot_re * f->s - f->rot_im * f->d + x - f->out_re * old;
+            im = f->rot_re * f->d + f->rot_im * f->s - f->out_im * old;
+            f->s = re;
+            f->d = im;
+        }
+        return true;
+    }
+    /* Reinsch: cos(w) >= 0 -> d[n] = s[n] - s[n-1], else d[n] = s[n] + s[n-1] */
+    for(uint8_t i = 0; i < bank->freqs_qty; i++){
+        f = &bank->freqs[i];
+        if(f->low){
+            f->d = f->d + x - f->k * f->s;
+            f->s = f->s + f->d;
+        } else{
+            f->d = -f->d + x + f->k * f->s;
+            f->s = f->d - f->s;
+        }
+    }
+    if(++bank->count < bank->window_lenght){
+        return false;
+    }
+    bank->count = 0;
+    for(uint8_t i = 0; i < bank->freqs_qty; i++){
+        f = &bank->freqs[i];
+        f->last = bank->scale * GoertzelBlockMagnitude(f);
+        f->s = 0;
+        f->d = 0;
+    }
+    return true;
+}
+/*==================[external functions definition]==========================*/
+bool GoertzelInit(goertzel_t *bank, const float *freqs, uint8_t freqs_qty, float sample_frec,
+    uint16_t window_lenght, goertzel_mode_t mode, float *delay){
+    goertzel_freq_t *f;
+    double w, r_n;
+
+    if((freqs_qty == 0) || (freqs_qty > GOERTZEL_MAX_FREQS) || (window_lenght < 2) || (sample_frec <= 0)){
+        return false;
+    }
+    if((mode == GOERTZEL_SLIDING) && (delay == NULL)){
+        return false;
+    }
+    for(uint8_t i = 0; i < freqs_qty; i++){
+        if((freqs[i] < 0) || (freqs[i] > sample_frec / 2)){
+            return false;
+        }
+    }
+    memset(bank, 0, sizeof(goertzel_t));
+    bank->mode = mode;
+    bank->freqs_qty = freqs_qty;
+    bank->window_lenght = window_lenght;
+    bank->delay = delay;
+    r_n = pow(GOERTZEL_SLIDING_DAMPING, window_lenght);
+    if(mode == GOERTZEL_SLIDING){
+        /* Gain of the damped window: sum(r^m), m = 0 .. N-1 */
+        bank->scale = 2 * (1 - GOERTZEL_SLIDING_DAMPING) / (1 - r_n);
+    } else{
+        bank->scale = 2.0f / window_lenght;
+    }
+    for(uint8_t i = 0; i < freqs_qty; i++){
+        f = &bank->freqs[i];
+        w = 2 * M_PI * freqs[i] / sample_frec;
+        f->cos_w = cos(w);
+        f->sin_w = sin(w);
+        f->low = (f->cos_w >= 0);
+        /* 2 - 2cos(w) and 2 + 2cos(w) without cancellation */
+        f->k = f->low ? 4 * sin(w / 2) * sin(w / 2) : 4 * cos(w / 2) * cos(w / 2);
+        f->rot_re = GOERTZEL_SLIDING_DAMPING * cos(w);
+        f->rot_im = GOERTZEL_SLIDING_DAMPING * sin(w);
+        /* rot^N with the rounded rot (not r^N e^(jwN)): the sample leaving
+         * the window is removed exactly as it was rotated */
+        GoertzelPower(f->rot_re, f->rot_im, window_lenght, &f->out_re, &f->out_im);
+    }
+    GoertzelReset(bank);
+    return true;
+}
+
+void GoertzelReset(goertzel_t *bank){
+    bank->count = 0;
+    for(uint8_t i = 0; i < bank->freqs_qty; i++){
+        bank->freqs[i].s = 0;
+        bank->freqs[i].d = 0;
+        bank->freqs[i].last = 0;
+    }
+    if(bank->mode == GOERTZEL_SLIDING){
+        memset(bank->delay, 0, bank->window_lenght * sizeof(float));
+    }
+}
+
+uint16_t GoertzelProcess(goertzel_t *bank, const float *signal, uint16_t signal_lenght, float *amplitude){
+    uint16_t results = 0;
+
+    for(uint16_t i = 0; i < signal_lenght; i++){
+        if(GoertzelSample(bank, signal[i])){
+            if(amplitude != NULL){
+                GoertzelAmplitude(bank, &amplitude[results * bank->freqs_qty]);
+            }
+            results++;
+        }
+    }
+    return results;
+}
+
+uint16_t GoertzelProcessAdc(goertzel_t *bank, const uint16_t *adc, uint16_t signal_lenght, uint16_t offset, float *amplitude){
+    uint16_t results = 0;
+
+    for(uint16_t i = 0; i < signal_lenght; i++){
+        if(GoertzelSample(bank, (float)((int32_t)adc[i] - offset))){
+            if(amplitude != NULL){
+                GoertzelAmplitude(bank, &amplitude[results * bank->freqs_qty]);
+            }
+            results++;
+        }
+    }
+    return results;
+}
+
+void GoertzelAmplitude(const goertzel_t *bank, float *amplitude){
+    const goertzel_freq_t *f;
+
+    for(uint8_t i = 0; i < bank->freqs_qty; i++){
+        f = &bank->freqs[i];
+        if(bank->mode == GOERTZEL_SLIDING){
+            amplitude[i] = bank->scale * sqrtf(f->s * f->s + f->d * f->d);
+        } else{
+            amplitude[i] = f->last;
+        }
+    }
+}
+
+/*==================[end of file]============================================*/
@@ -0,0 +1,228 @@
+/**
+ * @file multirate.c
+ * @brief
+ * @version 0.1
+ * @date 2026-10-19
+ *
+ * @copyright Copyright (c) 2026
+ *
+ */
+
+/*==================[inclusions]=============================================*/
+#include <string.h>
+#include <math.h>
+#include "multirate.h"
+#include "esp_dsp.h"
+/*==================[macros and definitions]=================================*/
+#define CIC_COMP_STEPS      256         /*!< Integration steps of the compensator design */
+/*==================[internal data declaration]==============================*/
+
+/*==================[internal functions declaration]=========================*/
+
+/*==================[internal data definition]===============================*/
+
+/*==================[external data definition]===============================*/
+
+/*==================[internal functions definition]==========================*/
+static void MultirateWindow(float *coeffs, uint16_t coeffs_lenght, multirate_wind_t wind){
+    switch(wind){
+        case MULTIRATE_WIND_BLACKMAN:
+            dsps_wind_blackman_f32(coeffs, coeffs_lenght);
+        break;
+        case MULTIRATE_WIND_BLACKMAN_HARRIS:
+            dsps_wind_blackman_harris_f32(coeffs, coeffs_lenght);
+        break;
+        case MULTIRATE_WIND_NUTTALL:
+            dsps_wind_nuttall_f32(coeffs, coeffs_lenght);
+        break;
+        case MULTIRATE_WIND_HANN:
+        default:
+            dsps_wind_hann_f32(coeffs, coeffs_lenght);
+        break;
+    }
+}
+
+/* Inverse of the CIC response at f (cycles per CIC output sample) */
+static double MultirateCicInverse(double f, uint8_t order, uint16_t ratio){
+    if(f == 0){
+        return 1;
+    }
+    return pow(ratio * sin(M_PI * f / ratio) / sin(M_PI * f), order);
+}
+
+/* Windowed ideal low pass with gain response(f) in the pass band:
+ * h[n] = w[n] * 2 * integral(response(f) * cos(2 pi f (n - c)), 0, fc) */
+static bool MultirateDesign(float *coeffs, uint16_t coeffs_lenght, float cut_frec, float sample_frec,
+    uint8_t cic_order, uint16_t cic_ratio, multirate_wind_t wind){
+    double fc = cut_frec / sample_frec;
+    double center = (coeffs_lenght - 1) / 2.0;
+    double t, h, f, sum = 0;
+
+    if((coeffs_lenght < 2) || (fc <= 0) || (fc >= 0.5)){
+        return false;
+    }
+    MultirateWindow(coeffs, coeffs_lenght, wind);
+    for(uint16_t n = 0; n < coeffs_lenght; n++){
+        t = n - center;
+        if(cic_order == 0){
+            /* Sinc */
+            h = (t == 0) ? 2 * fc : sin(2 * M_PI * fc * t) / (M_PI * t);
+        } else{
+            /* Midpoint rule */
+            h = 0;
+            for(uint16_t i = 0; i < CIC_COMP_STEPS; i++){
+                f = fc * (i + 0.5) / CIC_COMP_STEPS;
+                h += MultirateCicInverse(f, cic_order, cic_ratio) * cos(2 * M_PI * f * t);
+            }
+            h *= 2 * fc / CIC_COMP_STEPS;
+        }
+        coeffs[n] *= h;
+        sum += coeffs[n];
+    }
+    /* DC gain 1 */
+    for(uint16_t n = 0; n < coeffs_lenght; n++){
+        coeffs[n] /= sum;
+    }
+    return true;
+}
+/*==================[external functions definition]==========================*/
+bool MultirateLowPassDesign(float *coeffs, uint16_t coeffs_lenght, float cut_frec, float sample_frec, multirate_wind_t wind){
+    return MultirateDesign(coeffs, coeffs_lenght, cut_frec, sample_frec, 0, 1, wind);
+}
+
+bool MultirateCicCompDesign(float *coeffs, uint16_t coeffs_lenght, float cut_frec, float sample_frec,
+    uint8_t cic_order, uint16_t cic_ratio, multirate_wind_t wind){
+    if((cic_order == 0) || (cic_ratio < 2)){
+        return false;
+    }
+    return MultirateDesign(coeffs, coeffs_lenght, cut_frec, sample_frec, cic_order, cic_ratio, wind);
+}
+
+bool MultirateDecimInit(multirate_decim_t *decimator, float *coeffs, float *delay, uint16_t coeffs_lenght, uint8_t decim){
+    if((coeffs_lenght < 2) || (decim == 0)){
+        return false;
+    }
+    decimator->decim = decim;
+    decimator->phase = 0;
+    return dsps_fird_init_f32(&decimator->fir, coeffs, delay, coeffs_lenght, decim) == ESP_OK;
+}
+
+uint16_t MultirateDecim(multirate_decim_t *decimator, const float *input, float *output, uint16_t signal_lenght){
+    fir_f32_t *fir = &decimator->fir;
+    uint16_t results = 0;
+    uint16_t blocks;
+
+    /* Output pending from the previous block: dsps_fird_f32 reads the
+     * missing samples and calculates it */
+    if(decimator->phase && (signal_lenght >= decimator->decim - decimator->phase)){
+        fir->decim = decimator->decim - decimator->phase;
+        dsps_fird_f32(fir, input, output, 1);
+        fir->decim = decimator->decim;
+        input += decimator->decim - decimator->phase;
+        signal_lenght -= decimator->decim - decimator->phase;
+        decimator->phase = 0;
+        results = 1;
+    }
+    if(decimator->phase == 0){
+        blocks = signal_lenght / decimator->decim;
+        results += dsps_fird_f32(fir, input, &output[results], blocks);
+        input += blocks * decimator->decim;
+        signal_lenght -= blocks * decimator->decim;
+    }
+    /* Remaining samples only go to the delay line */
+    for(uint16_t i = 0; i < signal_lenght; i++){
+        fir->delay[fir->pos++] = input[i];
+        if(fir->pos >= fir->N){
+            fir->pos = 0;
+        }
+        decimator->phase++;
+    }
+    return results;
+}
+
+bool MultirateInterpInit(multirate_interp_t *interpolator, const float *coeffs, uint16_t coeffs_lenght, uint8_t interp,
+    float *phase_coeffs, float *delay){
+    uint16_t taps, index;
+
+    if((coeffs_lenght < 2) || (interp == 0)){
+        return false;
+    }
+    taps = (coeffs_lenght + interp - 1) / interp;
+    /* Sub filter p: coeffs[p + k * interp], reversed for the dot product
+     * with the delay line (oldest sample first) */
+    for(uint8_t p = 0; p < interp; p++){
+        for(uint16_t j = 0; j < taps; j++){
+            index = p + (taps - 1 - j) * interp;
+            phase_coeffs[p * taps + j] = (index < coeffs_lenght) ? coeffs[index] * interp : 0;
+        }
+    }
+    memset(delay, 0, 2 * taps * sizeof(float));
+    interpolator->phase_coeffs = phase_coeffs;
+    interpolator->delay = delay;
+    interpolator->taps = taps;
+    interpolator->pos = 0;
+    interpolator->interp = interp;
+    return true;
+}
+
+uint16_t MultirateInterp(multirate_interp_t *interpolator, const float *input, float *output, uint16_t signal_lenght){
+    uint16_t taps = interpolator->taps;
+    const float *window;
+
+    for(uint16_t i = 0; i < signal_lenght; i++){
+        /* Each sample is written twice, so the last taps samples are
+         * always contiguous (delay[pos] .. delay[pos + taps - 1]) */
+        interpolator->delay[interpolator->pos] = input[i];
+        interpolator->delay[interpolator->pos + taps] = input[i];
+        if(++interpolator->pos >= taps){
+            interpolator->pos = 0;
+        }
+        window = &interpolator->delay[interpolator->pos];
+        for(uint8_t p = 0; p < interpolator->interp; p++){
+            dsps_dotprod_f32(window, &interpolator->phase_coeffs[p * taps], output++, taps);
+        }
+    }
+    return signal_lenght * interpolator->interp;
+}
+
+bool MultirateCicInit(multirate_cic_t *cic, uint8_t order, uint16_t ratio){
+    if((order == 0) || (order > MULTIRATE_CIC_MAX_ORDER) || (ratio < 2)){
+        return false;
+    }
+    /* Register growth: order * log2(ratio) bits over the 16 bits input */
+    if(16 + order * ceil(log2(ratio)) > 64){
+        return false;
+    }
+    memset(cic, 0, sizeof(multirate_cic_t));
+    cic->order = order;
+    cic->ratio = ratio;
+    cic->scale = 1.0 / pow(ratio, order);
+    return true;
+}
+
+uint16_t MultirateCicDecim(multirate_cic_t *cic, const int16_t *input, float *output, uint16_t signal_lenght){
+    uint16_t results = 0;
+    uint64_t acc, prev;
+
+    for(uint16_t i = 0; i < signal_lenght; i++){
+        /* Integrators: wrap around is fine, the combs undo it */
+        acc = (uint64_t)(int64_t)input[i];
+        for(uint8_t s = 0; s < cic->order; s++){
+            cic->integ[s] += acc;
+            acc = cic->integ[s];
+        }
+        if(++cic->count < cic->ratio){
+            continue;
+        }
+        cic->count = 0;
+        for(uint8_t s = 0; s < cic->order; s++){
+            prev = cic->comb[s];
+            cic->comb[s] = acc;
+            acc -= prev;
+        }
+        output[results++] = (int64_t)acc * cic->scale;
+    }
+    return results;
+}
+
+/*==================[end of file]============================================*/
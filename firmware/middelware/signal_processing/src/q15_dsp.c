@@ -0,0 +1,275 @@
+/**
+ * @file q15_dsp.c
+ * @brief
+ * @version 0.1
+ * @date 2026-10-19
+ *
+ * @copyright Copyright (c) 2026
+ *
+ */
+
+/*==================[inclusions]=============================================*/
+#include <string.h>
+#include <stdlib.h>
+#include <math.h>
+#include "q15_dsp.h"
+#include "esp_dsp.h"
+#include "arena_mcu.h"
+/*==================[macros and definitions]=================================*/
+#define Q15_MAX     32767
+#define Q15_MIN     (-32768)
+#define Q30_ONE     (1L << 30)
+#define STATE_BITS  12          /*!< Extra fractional bits of the biquad state */
+/*==================[internal data declaration]==============================*/
+/*==================[internal functions declaration]=========================*/
+
+/*==================[internal data definition]===============================*/
+/* Q of each 2nd order section of the Butterworth filters (same as iir_filter.c) */
+static const float butterworth_q[4][Q15_MAX_SECTIONS] = {
+    {1 / 1.414},
+    {1 / 0.765, 1 / 1.848},
+    {1 / 0.518, 1 / 1.414, 1 / 1.932},
+    {1 / 0.390, 1 / 1.111, 1 / 1.663, 1 / 1.962},
+};
+/*==================[external data definition]===============================*/
+
+/*==================[internal functions definition]==========================*/
+static inline int16_t Q15Saturate(int32_t value, uint32_t *saturations){
+    if(value > Q15_MAX){
+        (*saturations)++;
+        return Q15_MAX;
+    }
+    if(value < Q15_MIN){
+        (*saturations)++;
+        return Q15_MIN;
+    }
+    return value;
+}
+
+/* Left shift that takes max_abs up to the int16_t range */
+static uint8_t Q15Headroom(uint32_t max_abs){
+    uint8_t shift = 0;
+    if(max_abs == 0){
+        return 0;
+    }
+    while((max_abs << (shift + 1)) <= Q15_MAX){
+        shift++;
+    }
+    return shift;
+}
+
+static uint32_t Q15Sqrt(uint32_t value){
+    uint32_t root = 0;
+    uint32_t bit = 1UL << 30;
+
+    while(bit > value){
+        bit >>= 2;
+    }
+    while(bit){
+        if(value >= root + bit){
+            value -= root + bit;
+            root = (root >> 1) + bit;
+        } else{
+            root >>= 1;
+        }
+        bit >>= 2;
+    }
+    return root;
+}
+
+static void Q15BiquadInit(q15_biquad_t *filter, float sample_frec, float cut_frec, filter_order_t order, bool hi_pass){
+    float f = cut_frec / sample_frec;
+    float coeffs[5];
+
+    filter->sections = order / 2;
+    memset(filter->delay, 0, sizeof(filter->delay));
+    for(uint8_t s = 0; s < filter->sections; s++){
+        if(hi_pass){
+            dsps_biquad_gen_hpf_f32(coeffs, f, butterworth_q[filter->sections - 1][s]);
+        } else{
+            dsps_biquad_gen_lpf_f32(coeffs, f, butterworth_q[filter->sections - 1][s]);
+        }
+        for(uint8_t i = 0; i < 5; i++){
+            filter->coeffs[s][i] = lrint((double)coeffs[i] * Q30_ONE);
+        }
+    }
+}
+/*==================[external functions definition]==========================*/
+void Q15FromAdc(const uint16_t *adc, int16_t *output, uint16_t signal_lenght, uint16_t offset, q15_block_t *block){
+    uint32_t max_abs = 0;
+    int32_t value;
+    int8_t shift;
+
+    if(offset == Q15_OFFSET_MEAN){
+        uint32_t sum = 0;
+        for(uint16_t i = 0; i < signal_lenght; i++){
+            sum += adc[i];
+        }
+        offset = signal_lenght ? (sum + signal_lenght / 2) / signal_lenght : 0;
+    }
+    for(uint16_t i = 0; i < signal_lenght; i++){
+        value = (int32_t)adc[i] - offset;
+        if((uint32_t)abs(value) > max_abs){
+            max_abs = abs(value);
+        }
+    }
+    /* Scaled to the int16_t range, so there are no saturations here */
+    if(max_abs > Q15_MAX){
+        shift = 0;
+        while((max_abs >> -shift) > Q15_MAX){
+            shift--;
+        }
+    } else{
+        shift = Q15Headroom(max_abs);
+    }
+    for(uint16_t i = 0; i < signal_lenght; i++){
+        value = (int32_t)adc[i] - offset;
+        output[i] = (shift >= 0) ? value * (1 << shift) : value >> -shift;
+    }
+    block->exponent = -shift;
+}
+
+void Q15LowPassInit(q15_biquad_t *filter, float sample_frec, float cut_frec, filter_order_t order){
+    Q15BiquadInit(filter, sample_frec, cut_frec, order, false);
+}
+
+void Q15HiPassInit(q15_biquad_t *filter, float sample_frec, float cut_frec, filter_order_t order){
+    Q15BiquadInit(filter, sample_frec, cut_frec, order, true);
+}
+
+void Q15BiquadFilter(q15_biquad_t *filter, const int16_t *input_signal, int16_t *output_signal, uint16_t signal_lenght, q15_block_t *block){
+    int64_t acc;
+    int32_t x, y;
+    int32_t *c, *d;
+
+    for(uint16_t i = 0; i < signal_lenght; i++){
+        x = (int32_t)input_signal[i] * (1 << STATE_BITS);
+        /* Direct form I, 64 bit accumulator. The state keeps STATE_BITS extra
+         * fractional bits: rounding the feedback to Q15 adds noise amplified by
+         * 1/(1 - pole)^2, too much for low cut-off frequencies. Intermediate
+         * sections are not clipped (Butterworth sections can have gain > 1,
+         * the cascade can't) */
+        for(uint8_t s = 0; s < filter->sections; s++){
+            c = filter->coeffs[s];
+            d = filter->delay[s];
+            acc = (int64_t)c[0] * x + (int64_t)c[1] * d[0] + (int64_t)c[2] * d[1]
+                - (int64_t)c[3] * d[2] - (int64_t)c[4] * d[3];
+            y = (acc + (Q30_ONE >> 1)) >> 30;
+            d[1] = d[0];
+            d[0] = x;
+            d[3] = d[2];
+            d[2] = y;
+            x = y;
+        }
+        output_signal[i] = Q15Saturate((x + (1 << (STATE_BITS - 1))) >> STATE_BITS, &block->saturations);
+    }
+}
+
+bool Q15FirDecimInit(q15_fir_t *filter, const float *coeffs, int16_t *coeffs_q15, int16_t *delay, uint16_t coeffs_lenght, uint8_t decim){
+    float max_abs = 0, sum_abs = 0;
+    uint8_t coeffs_shift = 0;
+    uint32_t clipped = 0;
+
+    if((coeffs_lenght < 2) || (decim == 0)){
+        return false;
+    }
+    for(uint16_t i = 0; i < coeffs_lenght; i++){
+        sum_abs += fabsf(coeffs[i]);
+        if(fabsf(coeffs[i]) > max_abs){
+            max_abs = fabsf(coeffs[i]);
+        }
+    }
+    /* Coefficients must fit in Q15 */
+    while(max_abs >= 1.0f){
+        max_abs /= 2;
+        coeffs_shift++;
+    }
+    /* Worst case output is sum(|coeffs|) * full scale */
+    filter->headroom = 0;
+    while(sum_abs * 1.0001f > (float)(1 << filter->headroom)){
+        filter->headroom++;
+    }
+    for(uint16_t i = 0; i < coeffs_lenght; i++){
+        coeffs_q15[i] = Q15Saturate(lrintf(ldexpf(coeffs[i], 15 - coeffs_shift)), &clipped);
+    }
+    memset(delay, 0, coeffs_lenght * sizeof(int16_t));
+    /* Output = acc >> (15 - shift) */
+    return dsps_fird_init_s16(&filter->fir, coeffs_q15, delay, coeffs_lenght, decim, 0,
+        coeffs_shift - filter->headroom) == ESP_OK;
+}
+
+uint16_t Q15FirDecim(q15_fir_t *filter, const int16_t *input_signal, int16_t *output_signal, uint16_t signal_lenght, q15_block_t *block){
+    block->exponent += filter->headroom;
+    return dsps_fird_s16(&filter->fir, input_signal, output_signal, signal_lenght / filter->fir.decim);
+}
+
+void Q15FirDecimDeinit(q15_fir_t *filter){
+    dsps_fird_s16_aexx_free(&filter->fir);
+}
+
+bool Q15FFTInit(void){
+    esp_err_t ret = dsps_fft2r_init_sc16(NULL, CONFIG_DSP_MAX_FFT_SIZE);
+    if (ret != ESP_OK){
+        return false;
+    }
+    return true;
+}
+
+void Q15FFTMagnitude(const int16_t *signal, int16_t *fft, uint16_t signal_lenght, q15_block_t *block){
+    uint32_t max_abs = 0;
+    uint8_t shift;
+    int32_t re, im, wind;
+    // Hann window: cos(2 pi i / N) by a Q30 rotation, no table kept between calls
+    int64_t c = Q30_ONE, sn = 0, c_next;
+    int32_t step_c = lrintf(Q30_ONE * cosf(2 * M_PI / signal_lenght));
+    int32_t step_s = lrintf(Q30_ONE * sinf(2 * M_PI / signal_lenght));
+    uint32_t mark = ArenaMark(&arena_scratch);
+    int16_t *fft_complex = ArenaAlloc(&arena_scratch, 2 * signal_lenght * sizeof(int16_t));
+
+    if(fft_complex == NULL){
+        memset(fft, 0, (signal_lenght / 2) * sizeof(int16_t));
+        return;
+    }
+    // Multiply input array with window and store as real part
+    for(uint16_t i = 0; i < signal_lenght; i++){
+        // 0.5 * (1 - cos) from Q30 to Q15
+        wind = (Q30_ONE - c + (1 << 15)) >> 16;
+        wind = (wind > Q15_MAX) ? Q15_MAX : wind;
+        c_next = (c * step_c - sn * step_s + (1 << 29)) >> 30;
+        sn = (sn * step_c + c * step_s + (1 << 29)) >> 30;
+        c = c_next;
+        re = ((int32_t)signal[i] * wind + (1 << 14)) >> 15;
+        fft_complex[2 * i] = re;
+        fft_complex[2 * i + 1] = 0;
+        if((uint32_t)abs(re) > max_abs){
+            max_abs = abs(re);
+        }
+    }
+    // Use the whole int16_t range before the FFT (it scales by 1/2 each stage)
+    shift = Q15Headroom(max_abs);
+    for(uint16_t i = 0; i < signal_lenght; i++){
+        fft_complex[2 * i] *= (1 << shift);
+    }
+    // Calculate FFT
+    dsps_fft2r_sc16(fft_complex, signal_lenght);
+    // Bit reverse
+    dsps_bit_rev_sc16_ansi(fft_complex, signal_lenght);
+    // Calculate FFT magnitude: |X| / N, scaled by 8 through the exponent (same units as FFTMagnitude)
+    for(uint16_t j = 0; j < signal_lenght / 2; j++){
+        re = fft_complex[2 * j];
+        im = fft_complex[2 * j + 1];
+        fft[j] = Q15Saturate(Q15Sqrt((uint32_t)(re * re) + (uint32_t)(im * im)), &block->saturations);
+    }
+    fft[0] = fft[0] / 2;
+    block->exponent = block->exponent - shift + 3;
+    ArenaReset(&arena_scratch, mark);
+}
+
+void Q15ToFloat(const int16_t *input, float *output, uint16_t signal_lenght, const q15_block_t *block){
+    float scale = ldexpf(1.0f, block->exponent);
+    for(uint16_t i = 0; i < signal_lenght; i++){
+        output[i] = input[i] * scale;
+    }
+}
+
+/*==================[end of file]============================================*/
@@ -0,0 +1,108 @@
+#!/usr/bin/env python3
+#
+# Compares two runs of the DSP benchmark suite (dsp_bench.h) and flags the
+# regressions: cases that got slower than the baseline by more than the
+# threshold (%).
+#
+# Each run can be the CSV or JSON written by bench_host/bench_dsp, or a
+# serial monitor capture of the target (projects/bench_dsp): the lines after
+# the CSV header are read, console logs in between are skipped. Both runs must
+# have the same unit (ns on the host, cycles on the target).
+#
+# The min time of each case is compared by default: it is the most stable
+# figure (no interrupts nor cache misses). --metric median uses the median.
+#
+# Exit status: 0 no regressions, 1 regressions, 2 wrong input.
+#
+# Usage: dsp_bench_compare.py [--threshold PCT] [--metric min|median|max] baseline current
+
+import argparse
+import json
+import sys
+
+HEADER = 'name,size,items,unit,min,median,max,per_item'
+METRICS = ('min', 'median', 'max')
+
+
+def read_csv(text):
+    lines = text.splitlines()
+    start = next((i for i, line in enumerate(lines) if line.strip() == HEADER), None)
+    if start is None:
+        raise ValueError('no "%s" header' % HEADER)
+    keys = HEADER.split(',')
+    results = []
+    for line in lines[start + 1:]:
+        fields = line.strip().split(',')
+        if len(fields) != len(keys) or not fields[1].isdigit():
+            continue
+        row = dict(zip(keys, fields))
+        for key in ('size', 'items') + METRICS:
+            row[key] = int(row[key])
+        results.append(row)
+    units = {row['unit'] for row in results}
+    if len(units) > 1:
+        raise ValueError('mixed units %s' % ', '.join(sorted(units)))
+    return (units.pop() if units else None), results
+
+
+def read_json(text):
+    data = json.loads(text)
+    return data['unit'], data['results']
+
+
+def read(path):
+    with open(path, errors='replace') as f:
+        text = f.read()
+    unit, results = read_json(text) if text.lstrip().startswith('{') else read_csv(text)
+    if not results:
+        raise ValueError('no results')
+    return unit, {(r['name'], r['size']): r for r in results}
+
+
+def main():
+    parser = argparse.ArgumentParser(description='Compare two runs of the DSP benchmark suite')
+    parser.add_argument('--threshold', type=float, default=10, help='regression threshold (%%, default 10)')
+    parser.add_argument('--metric', choices=METRICS, default='min', help='time compared (default min)')
+    parser.add_argument('baseline')
+    parser.add_argument('current')
+    args = parser.parse_args()
+
+    try:
+        base_unit, base = read(args.baseline)
+        cur_unit, cur = read(args.current)
+    except (OSError, ValueError, KeyError) as e:
+        sys.stderr.write('dsp_bench_compare: %s\n' % e)
+        return 2
+    if base_unit != cur_unit:
+        sys.stderr.write('dsp_bench_compare: baseline in %s, current run in %s\n' % (base_unit, cur_unit))
+        return 2
+
+    regressions = improvements = 0
+    print('%-20s %5s %12s %12s %8s' % ('case', 'size', 'baseline', 'current', 'change'))
+    for key, b in base.items():
+        if key not in cur:
+            continue
+        old, new = b[args.metric], cur[key][args.metric]
+        change = 100.0 * (new - old) / old if old else 0.0
+        flag = ''
+        if change > args.threshold:
+            flag = 'REGRESSION'
+            regressions += 1
+        elif change < -args.threshold:
+            flag = 'faster'
+            improvements += 1
+        print('%-20s %5d %12d %12d %+7.1f%% %s' % (key[0], key[1], old, new, change, flag))
+    missing = [key for key in base if key not in cur]
+    new_cases = [key for key in cur if key not in base]
+    for name, size in missing:
+        print('%-20s %5d missing in the current run' % (name, size))
+    for name, size in new_cases:
+        print('%-20s %5d new (not in the baseline)' % (name, size))
+    print('%d cases (%s %s, threshold %.1f%%): %d regressions, %d faster, %d missing, %d new' %
+          (len(base) - len(missing), args.metric, base_unit, args.threshold, regressions, improvements,
+           len(missing), len(new_cases)))
+    return 1 if regressions else 0
+
+
+if __name__ == '__main__':
+    sys.exit(main())
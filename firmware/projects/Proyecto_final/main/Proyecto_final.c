@@ -18,6 +18,7 @@
  * |   Date	    | Description                                    |
  * |:----------:|:-----------------------------------------------|
  * | 12/09/2023 | Document creation		                         |
+ * | 19/10/2026 | Tareas reemplazadas por handlers del event loop (event_loop_mcu.h), un solo stack |
  *
  * @author Lucas Alarcon (lucasalarcon872@gmail.com)
  * @author Joaquin Machado (joaquin.machado@ingenieria.uner.edu.ar)
@@ -27,21 +28,18 @@
 /*==================[inclusions]=============================================*/
 #include <stdio.h>
 #include <stdint.h>
-#include "freertos/FreeRTOS.h"
-#include "freertos/task.h"
 #include "led.h"
 #include "hc_sr04.h"
 #include "lcditse0803.h"
 #include "switch.h"
-#include "timer_mcu.h"
 #include "uart_mcu.h"
+#include "event_loop_mcu.h"
 /*==================[macros and definitions]=================================*/
 #define TIEMPO_REFRESCO_PANTALLA 50000 // VER TIEMPOS
 #define TIEMPO_MEDICION 50000
 
-TaskHandle_t interfaz_task_handle = NULL;
-TaskHandle_t controlador_task_handle = NULL;
 /*==================[internal data definition]===============================*/
+event_loop_t loop_principal;
 
 /*==================[internal functions declaration]=========================*/
 static void manejoDeLEDs(){
@@ -54,56 +52,41 @@ static void medir(){
 	
 }
 
-void funcTimerInterfaz(){
-    vTaskNotifyGiveFromISR(interfaz_task_handle, pdFALSE);
+static void controlar(event_loop_handler_t *handler, const event_loop_event_t *evento){
+	medir();
+	manejoDeLEDs();
+	manejoDeBuzzers();
 }
 
-void funcTimerControlador(){
-    vTaskNotifyGiveFromISR(controlador_task_handle, pdFALSE);
-}
+static void manejarInterfaz(event_loop_handler_t *handler, const event_loop_event_t *evento){
 
-static void controlar(void *pvParameter){
-    while(1){
-		ulTaskNotifyTake(pdTRUE, portMAX_DELAY);
-		
-		medir();
-		manejoDeLEDs();
-		manejoDeBuzzers();
-	}
 }
 
-static void manejarInterfaz(void *pvParameter){
-    while(1){
-		ulTaskNotifyTake(pdTRUE, portMAX_DELAY);
-	}
-}
+event_loop_handler_t controlador_handler = {
+	.name = "Controlador",
+	.func = controlar,
+	.param = NULL,
+	.period_us = TIEMPO_MEDICION,
+	.deadline_us = 0
+};
+
+event_loop_handler_t interfaz_handler = {
+	.name = "Interfaz",
+	.func = manejarInterfaz,
+	.param = NULL,
+	.period_us = TIEMPO_REFRESCO_PANTALLA,
+	.deadline_us = 0
+};
 
 /*==================[external functions definition]==========================*/
 void app_main(void){
 
-	// Inicialización de timers 
-    timer_config_t timer_controlador = {
-        .timer = TIMER_A,
-        .period = TIEMPO_MEDICION,
-        .func_p = funcTimerControlador,
-        .param_p = NULL
-    };
-    TimerInit(&timer_controlador);
-
-    timer_config_t timer_interfaz = {
-        .timer = TIMER_B,
-        .period = TIEMPO_REFRESCO_PANTALLA,
-        .func_p = funcTimerInterfaz,
-        .param_p = NULL
-    };
-    TimerInit(&timer_interfaz);
-
-    // Creacion de tareas
-    xTaskCreate(&controlar, "Controlador", 2048, NULL, 5, &controlador_task_handle);
-    xTaskCreate(&manejarInterfaz, "Interfaz", 512, NULL, 5, &interfaz_task_handle);
+	// Handlers del event loop: reemplazan a las tareas y a los timers
+    EventLoopInit(&loop_principal);
+    EventLoopAdd(&loop_principal, &controlador_handler);
+    EventLoopAdd(&loop_principal, &interfaz_handler);
 
-    // Inicio de los timers
-    TimerStart(timer_interfaz.timer);
-    TimerStart(timer_controlador.timer);
+    // Una sola tarea (y un solo stack) para los dos handlers
+    EventLoopStart(&loop_principal, EVENT_LOOP_TASK_STACK, EVENT_LOOP_TASK_PRIORITY);
 }
 /*==================[end of file]============================================*/
\ No newline at end of file
@@ -0,0 +1,66 @@
+/*! @mainpage Benchmark DSP
+ *
+ * @section genDesc General Description
+ *
+ * Corre la suite de benchmarks de procesamiento de señales (dsp_bench.h):
+ * FFT (radix-2, radix-4 y planes de fft.h), filtros IIR y FIR, producto
+ * punto, convolución / correlación, matrices y un paso del EKF de 13
+ * estados. Los tiempos (ciclos de CPU) se imprimen por el monitor serie:
+ * - Una línea CSV por caso, a medida que se completan.
+ * - Al final, todos los resultados en JSON.
+ *
+ * La salida del monitor se compara contra una corrida anterior con
+ * middelware/signal_processing/tools/dsp_bench_compare.py.
+ *
+ * @section hardConn Hardware Connection
+ *
+ * |    Peripheral  |   ESP32   	|
+ * |:--------------:|:--------------|
+ * | 	-		 	| 	-			|
+ *
+ *
+ * @section changelog Changelog
+ *
+ * |   Date	    | Description                                    |
+ * |:----------:|:-----------------------------------------------|
+ * | 19/10/2026 | Document creation		                         |
+ *
+ */
+
+/*==================[inclusions]=============================================*/
+#include <stdio.h>
+#include <stdint.h>
+#include "freertos/FreeRTOS.h"
+#include "freertos/task.h"
+#include "dsp_bench.h"
+/*==================[macros and definitions]=================================*/
+/** @brief Stack de la tarea de benchmark (bytes) */
+#define STACK_BENCHMARK		8192
+/*==================[internal data definition]===============================*/
+static dsp_bench_result_t resultados[DSP_BENCH_MAX_RESULTS];
+/*==================[internal functions declaration]=========================*/
+/**
+ * @brief Imprime el resultado de un caso y cede la CPU (watchdog de la tarea
+ * idle)
+ */
+static void imprimirResultado(const dsp_bench_result_t *resultado, void *param){
+	DspBenchCsvLine(stdout, resultado);
+	vTaskDelay(1);
+}
+
+/**
+ * @brief Tarea que realiza las mediciones
+ */
+static void benchmark(void *pvParameter){
+	uint16_t cantidad;
+
+	DspBenchCsvHeader(stdout);
+	cantidad = DspBenchRun(NULL, resultados, DSP_BENCH_MAX_RESULTS, imprimirResultado, NULL);
+	DspBenchJson(stdout, resultados, cantidad);
+	vTaskDelete(NULL);
+}
+/*==================[external functions definition]==========================*/
+void app_main(void){
+	xTaskCreate(&benchmark, "benchmark", STACK_BENCHMARK, NULL, 5, NULL);
+}
+/*==================[end of file]============================================*/
@@ -0,0 +1,127 @@
+/*! @mainpage Benchmark ring buffer
+ *
+ * @section genDesc General Description
+ *
+ * Mide el costo por elemento de los ring buffers de ring_buffer_mcu.h frente
+ * a las colas de FreeRTOS, para lotes de 1 a 256 elementos de 32 bits:
+ * - xQueueSend() / xQueueReceive() sin espera, un elemento por llamada.
+ * - RingBufferPush() / RingBufferPop() (SPSC) y RingBufferMpPush() /
+ *   RingBufferMpPop() (MPSC), un elemento por llamada.
+ * - RingBufferWrite() / RingBufferRead() (SPSC), el lote en una llamada.
+ *
+ * Cada lote se escribe y luego se lee desde la misma tarea: se mide el costo
+ * de las operaciones, sin cambios de contexto. Los resultados (ns por
+ * elemento, escritura + lectura) se imprimen por el monitor serie.
+ *
+ * @section hardConn Hardware Connection
+ *
+ * |    Peripheral  |   ESP32   	|
+ * |:--------------:|:--------------|
+ * | 	-		 	| 	-			|
+ *
+ *
+ * @section changelog Changelog
+ *
+ * |   Date	    | Description                                    |
+ * |:----------:|:-----------------------------------------------|
+ * | 19/10/2026 | Document creation		                         |
+ *
+ */
+
+/*==================[inclusions]=============================================*/
+#include <stdio.h>
+#include <stdint.h>
+#include <inttypes.h>
+#include "freertos/FreeRTOS.h"
+#include "freertos/task.h"
+#include "freertos/queue.h"
+#include "esp_timer.h"
+#include "ring_buffer_mcu.h"
+/*==================[macros and definitions]=================================*/
+/** @brief Capacidad de la cola y de los ring buffers (elementos) */
+#define CAPACIDAD		256
+/** @brief Elementos escritos y leidos en cada medicion */
+#define ELEMENTOS		65536
+/** @brief Lote maximo */
+#define LOTE_MAX		256
+/*==================[internal data definition]===============================*/
+static uint32_t almacenamiento[CAPACIDAD];
+static uint32_t almacenamiento_mp[CAPACIDAD];
+static uint32_t secuencia_mp[CAPACIDAD];
+static uint32_t lote[LOTE_MAX];
+/*==================[internal functions declaration]=========================*/
+/**
+ * @brief Convierte una medicion en ns por elemento
+ * @param inicio Tiempo inicial (us, esp_timer_get_time())
+ * @return Nanosegundos por elemento
+ */
+static float nsPorElemento(int64_t inicio){
+	return (esp_timer_get_time() - inicio) * 1000.0f / ELEMENTOS;
+}
+
+/**
+ * @brief Tarea que realiza las mediciones
+ */
+static void benchmark(void *pvParameter){
+	QueueHandle_t cola = xQueueCreate(CAPACIDAD, sizeof(uint32_t));
+	ring_buffer_t spsc;
+	ring_buffer_mp_t mpsc;
+	float t_cola, t_spsc, t_mpsc, t_bloque;
+	int64_t inicio;
+
+	configASSERT(cola);
+	RingBufferInit(&spsc, almacenamiento, CAPACIDAD, sizeof(uint32_t));
+	RingBufferMpInit(&mpsc, almacenamiento_mp, secuencia_mp, CAPACIDAD, sizeof(uint32_t));
+
+	printf("lote,xQueue_ns,spsc_ns,mpsc_ns,spsc_bloque_ns\n");
+	for(uint32_t n = 1; n <= LOTE_MAX; n *= 2){
+		inicio = esp_timer_get_time();
+		for(uint32_t k = 0; k < ELEMENTOS; k += n){
+			for(uint32_t j = 0; j < n; j++){
+				xQueueSend(cola, &lote[j], 0);
+			}
+			for(uint32_t j = 0; j < n; j++){
+				xQueueReceive(cola, &lote[j], 0);
+			}
+		}
+		t_cola = nsPorElemento(inicio);
+
+		inicio = esp_timer_get_time();
+		for(uint32_t k = 0; k < ELEMENTOS; k += n){
+			for(uint32_t j = 0; j < n; j++){
+				RingBufferPush(&spsc, &lote[j]);
+			}
+			for(uint32_t j = 0; j < n; j++){
+				RingBufferPop(&spsc, &lote[j]);
+			}
+		}
+		t_spsc = nsPorElemento(inicio);
+
+		inicio = esp_timer_get_time();
+		for(uint32_t k = 0; k < ELEMENTOS; k += n){
+			for(uint32_t j = 0; j < n; j++){
+				RingBufferMpPush(&mpsc, &lote[j]);
+			}
+			for(uint32_t j = 0; j < n; j++){
+				RingBufferMpPop(&mpsc, &lote[j]);
+			}
+		}
+		t_mpsc = nsPorElemento(inicio);
+
+		inicio = esp_timer_get_time();
+		for(uint32_t k = 0; k < ELEMENTOS; k += n){
+			RingBufferWrite(&spsc, lote, n);
+			RingBufferRead(&spsc, lote, n);
+		}
+		t_bloque = nsPorElemento(inicio);
+
+		printf("%" PRIu32 ",%.1f,%.1f,%.1f,%.1f\n", n, t_cola, t_spsc, t_mpsc, t_bloque);
+	}
+	vQueueDelete(cola);
+	vTaskDelete(NULL);
+}
+/*==================[external functions definition]==========================*/
+void app_main(void){
+	xTaskCreate(&benchmark, "benchmark", 4096, NULL, 5, NULL);
+}
+/*==================[end of file]============================================*/
@@ -43,6 +43,10 @@
  * |   Date	    | Description                                    |
  * |:----------:|:-----------------------------------------------|
  * | 04/11/2024 | Document creation		                         |
+ * | 19/10/2026 | Acelerometro leido con AnalogInputScan (en mV)	 |
+ * | 19/10/2026 | Eventos de traza (trace_mcu.h) en tareas y timers |
+ * | 19/10/2026 | Tareas reemplazadas por handlers del event loop (event_loop_mcu.h), un solo stack |
+ * | 19/10/2026 | Eco del HC-SR04 medido con los tiempos de los flancos (gpio_event_mcu.h), sin muestreo |
  *
  * @author Joaquin Machado (joaquin.machado@ingenieria.uner.edu.ar)
  *
@@ -51,16 +55,16 @@
 /*==================[inclusions]=============================================*/
 #include <stdio.h>
 #include <stdint.h>
-#include "freertos/FreeRTOS.h"
-#include "freertos/task.h"
 #include "led.h"
 #include "hc_sr04.h"
 #include "lcditse0803.h"
 #include "switch.h"
-#include "timer_mcu.h"
 #include "uart_mcu.h"
 #include "buzzer.h"
 #include <analog_io_mcu.h> 
+#include "trace_mcu.h"
+#include "gpio_event_mcu.h"
+#include "event_loop_mcu.h"
 /*==================[macros and definitions]=================================*/
 /** @def TIEMPO_MUESTREO_DISTANCIA
  *  @brief Frecuencia de muestreo para el sensor ultrasonido, expresada en milisegundos.
@@ -78,25 +82,36 @@
 #define CH_Y CH2
 /** @brief Variable que almacena el pin al que se conecta la aceleracion en Z del acelerometro */
 #define CH_Z CH3
+/** @brief Pin ECHO del HC-SR04 */
+#define GPIO_ECHO GPIO_3
+/** @brief Pin TRIGGER del HC-SR04 */
+#define GPIO_TRIGGER GPIO_2
+/** @brief Tiempo de eco por centimetro [us] */
+#define US_POR_CM 59
+/** @brief Duracion del pulso de TRIGGER [us] */
+#define TRIGGER_US 10
+/** @brief Ventana de rebote del eco [ms]: ecos mas cortos (menos de 17 cm) se ignoran */
+#define REBOTE_ECO_MS 1
+/** @brief Ids de los handlers en la traza */
+#define TRACE_TAREA_DISTANCIA	0
+#define TRACE_TAREA_ACELERACION	1
 /*==================[internal data definition]===============================*/
-/** @brief Handle de la tarea medir distancia */
-TaskHandle_t distancia_task_handle = NULL;
-/** @brief Handle de la tarea obtener aceleracion */
-TaskHandle_t aceleracion_task_handle = NULL;
+/** @brief Event loop que corre todos los handlers en una sola tarea */
+event_loop_t loop_principal;
+/** @brief Flanco de subida del eco [us] */
+static uint32_t inicio_eco;
 /** @brief Variable que almacena la aceleracion umbral a la que se considera una caida */
 uint8_t aceleracionDeCaida = 4; // [G]
-/** @brief Variable que almacena la tension devuelta por el acelerometro en X */
-uint8_t tension_X;	
-/** @brief Variable que almacena la tension devuelta por el acelerometro en Y */
-uint8_t tension_Y;
-/** @brief Variable que almacena la tension devuelta por el acelerometro en Z */
-uint8_t tension_Z;
-/** @brief Variable que almacena la suma de tensiones devueltas por el acelerometro */
-uint8_t tension_XYZ;
+/** @brief Canales del acelerometro, leidos en un solo barrido */
+const adc_ch_t canales_XYZ[3] = {CH_X, CH_Y, CH_Z};
+/** @brief Variable que almacena las tensiones devueltas por el acelerometro en X, Y y Z [mV] */
+uint16_t tension[3];
+/** @brief Variable que almacena la suma de tensiones devueltas por el acelerometro [mV] */
+uint16_t tension_XYZ;
 /** @brief  Distancia medida de la bicicleta al auto*/	
-uint8_t distance2car;	
-/** @brief  Sensibilidad del acelerometro en [V/G]*/	
-uint8_t sensibilidad = 0.3;
+uint16_t distance2car;	
+/** @brief  Sensibilidad del acelerometro en [mV/G]*/	
+uint16_t sensibilidad = 300;
 /** @brief variable que sabe si hay caida */	
 bool hayCaida = false;
 /** @brief  Variable que sabe si hay que tener precaucion */	
@@ -104,24 +119,6 @@ bool precaucion = false;
 /** @brief  variable que sabe si hay peligro*/	
 bool peligro = false;
 /*==================[internal functions declaration]=========================*/
-/**
- * @brief Notifica a la tarea medir distancia desde la interrupción del temporizador.
- * @details Esta función se llama desde una rutina de interrupción y
- *          notifica a la tarea medir distancia para que procese la siguiente lectura.
- */
-void funcTimerDistancia(){
-    vTaskNotifyGiveFromISR(distancia_task_handle, pdFALSE); 
-}
-
-/**
- * @brief Notifica a la tarea obtener aceleracion desde la interrupción del temporizador.
- * @details Esta función se llama desde una rutina de interrupción y
- *          notifica a la tarea obtener aceleracion para que procese la siguiente lectura.
- */
-void funcTimerAceleracion(){
-    vTaskNotifyGiveFromISR(aceleracion_task_handle, pdFALSE);
-}
-
 /** @brief  Funcion que envia advertencia a traves del modulo BT */	
 static void enviarAdvertencia(){	
 	if (precaucion){
@@ -140,44 +137,91 @@ static void enviarAdvertencia(){
 	}
 }
 
+/**
+ * @brief Registra en la traza los periodos perdidos por un handler.
+ * @details Si el loop salteo periodos del handler (overruns) se marca,
+ *          se congela la traza y se envia por UART_PC.
+ * @param handler Handler del event loop
+ * @param tarea Id del handler en la traza
+ * @param perdidos Periodos perdidos hasta la ejecucion anterior
+ */
+static void registrarPeriodo(event_loop_handler_t *handler, uint8_t tarea, uint32_t *perdidos){
+	if (handler->stats.overruns != *perdidos){
+		TraceMark(tarea, handler->stats.overruns - *perdidos);
+		TraceStop();
+		TraceFlush(UART_PC);
+		*perdidos = handler->stats.overruns;
+	}
+}
+
 /** @brief  Funcion que maneja el prendido y apagado de los buzzer */
 static void prenderBuzzer(){
 	// Me quede sin tiempo para pensar como prender el buzzer
 }
 
 /**
- * @brief Tarea que mide la distancia usando el sensor ultrasónico HC-SR04 y maneja los estados del LEDs, buzzer y envios de advertencia.
- * La tarea espera una notificación antes de realizar la medición.
- * @param pvParameter Parámetro de entrada (no utilizado).
+ * @brief Flancos del eco (tarea de gpio_event_mcu.h). Los tiempos son los de la
+ * interrupcion de cada flanco: al final del eco se envia su duracion al handler.
+ * @param evento Flanco de subida (GPIO_EVENT_PRESS) o de bajada (GPIO_EVENT_RELEASE)
+ * @param param Handler de la distancia
  */
-static void medirDistancia (void *pvParameter){		
-    while(1){
-        ulTaskNotifyTake(pdTRUE, portMAX_DELAY);    
-		distance2car = HcSr04ReadDistanceInCentimeters();	// en cm
+static void flancoEco(gpio_event_t *evento, void *param){
+	if (evento->type == GPIO_EVENT_PRESS){
+		inicio_eco = evento->time;
+	} else if (evento->type == GPIO_EVENT_RELEASE){
+		EventLoopPost(param, EVENT_LOOP_USER, evento->time - inicio_eco);
+	}
+}
 
-		if (distance2car > 500) {
-            LedOn(LED_1);
-            LedOff(LED_2);
-            LedOff(LED_3);
-            } else 
-		if (distance2car < 500 && distance2car > 300) {
-            precaucion = true;
-			LedOn(LED_1);
-            LedOn(LED_2);
-            LedOff(LED_3);
-			enviarAdvertencia();
-			prenderBuzzer();
-            } else 
-		if (distance2car < 300){
-			peligro = true;
-            LedOn(LED_1);
-            LedOn(LED_2);
-            LedOn(LED_3);
-			enviarAdvertencia();
-			prenderBuzzer();
-            }
-        }
+/**
+ * @brief Handler que mide la distancia usando el sensor ultrasónico HC-SR04 y maneja los estados del LEDs, buzzer y envios de advertencia.
+ * Corre hasta terminar: el timer dispara la medicion y la duracion del eco llega como evento, sin esperas.
+ * @param handler Handler del event loop
+ * @param evento Evento que lo desperto (timer, fin del pulso de trigger o duracion del eco)
+ */
+static void medirDistancia(event_loop_handler_t *handler, const event_loop_event_t *evento){
+	static uint32_t perdidos = 0;
+
+	switch (evento->type){
+		case EVENT_LOOP_TIMER:
+			registrarPeriodo(handler, TRACE_TAREA_DISTANCIA, &perdidos);
+			GPIOOn(GPIO_TRIGGER);
+			EventLoopSleep(handler, TRIGGER_US);
+			return;
+		case EVENT_LOOP_WAKE:
+			GPIOOff(GPIO_TRIGGER);
+			return;
+		case EVENT_LOOP_USER:
+			break;
+		default:
+			return;
 	}
+	TraceSpanStart(TRACE_TAREA_DISTANCIA);
+	distance2car = evento->data / US_POR_CM;	// en cm
+
+	if (distance2car > 500) {
+		LedOn(LED_1);
+		LedOff(LED_2);
+		LedOff(LED_3);
+		} else 
+	if (distance2car < 500 && distance2car > 300) {
+		precaucion = true;
+		LedOn(LED_1);
+		LedOn(LED_2);
+		LedOff(LED_3);
+		enviarAdvertencia();
+		prenderBuzzer();
+		} else 
+	if (distance2car < 300){
+		peligro = true;
+		LedOn(LED_1);
+		LedOn(LED_2);
+		LedOn(LED_3);
+		enviarAdvertencia();
+		prenderBuzzer();
+		}
+	TraceSpanEnd(TRACE_TAREA_DISTANCIA);
+}
 
 /**
  * @brief Convierte la suma de tensiones obtenidas por el acelerometro en un dato de aceleracion
@@ -187,30 +231,49 @@ uint8_t tension2AcelerationConversion(){
 }
 
 /**
- * @brief Tarea que mide la tensiones del acelerometro y detecta si hubo caida.
- * @param pvParameter Parámetro de entrada (no utilizado).
+ * @brief Handler que mide la tensiones del acelerometro y detecta si hubo caida (corre hasta terminar).
+ * @param handler Handler del event loop
+ * @param evento Evento que lo desperto (timer)
  */
-static void obtenerAceleracion (void *pvParameter){		
-    while(1){
-        ulTaskNotifyTake(pdTRUE, portMAX_DELAY);   
-		
-		AnalogInputReadSingle(CH_X, &tension_X);
-		AnalogInputReadSingle(CH_Y, &tension_Y);
-		AnalogInputReadSingle(CH_Z, &tension_Z);
+static void obtenerAceleracion(event_loop_handler_t *handler, const event_loop_event_t *evento){
+	static uint32_t perdidos = 0;
 
-		tension_XYZ = tension_X + tension_Y + tension_Z;
+	registrarPeriodo(handler, TRACE_TAREA_ACELERACION, &perdidos);
+	TraceSpanStart(TRACE_TAREA_ACELERACION);
+	
+	AnalogInputScan(canales_XYZ, 3, tension);
+	AnalogScanToMv(canales_XYZ, 3, tension);
 
-		if (tension2AcelerationConversion() >= aceleracionDeCaida){
-			hayCaida = true;
-			enviarAdvertencia();
-		}
+	tension_XYZ = tension[0] + tension[1] + tension[2];
+
+	if (tension2AcelerationConversion() >= aceleracionDeCaida){
+		hayCaida = true;
+		enviarAdvertencia();
 	}
+	TraceSpanEnd(TRACE_TAREA_ACELERACION);
 }
 
+/** @brief Handler medir distancia, cada TIEMPO_MUESTREO_DISTANCIA */
+event_loop_handler_t distancia_handler = {
+	.name = "distancia",
+	.func = medirDistancia,
+	.param = NULL,
+	.period_us = TIEMPO_MUESTREO_DISTANCIA * 1000,
+	.deadline_us = 0
+};
+/** @brief Handler obtener aceleracion, cada TIEMPO_MUESTREO_ACELEROMETRO */
+event_loop_handler_t aceleracion_handler = {
+	.name = "aceleracion",
+	.func = obtenerAceleracion,
+	.param = NULL,
+	.period_us = TIEMPO_MUESTREO_ACELEROMETRO * 1000,
+	.deadline_us = 0
+};
+
 /*==================[external functions definition]==========================*/
 void app_main(void){
 	// Inicializacion de periféricos
-    HcSr04Init(GPIO_3, GPIO_2);
+    HcSr04Init(GPIO_ECHO, GPIO_TRIGGER);
     LedsInit();
 	GPIOInit(GPIO_BUZZER, GPIO_OUTPUT);
 
@@ -241,30 +304,34 @@ void app_main(void){
         .param_p = NULL
     };
     UartInit(&uart);
-
-    // Inicialización de timers 
-    timer_config_t timer_HCSR04 = {
-        .timer = TIMER_A,
-        .period = TIEMPO_MUESTREO_DISTANCIA,
-        .func_p = funcTimerDistancia,
+#ifdef MCU_TRACE
+    // Puerto de la traza binaria (tools/trace_to_json.py)
+    serial_config_t uart_traza = {
+        .port = UART_PC,
+        .baud_rate = 921600,
+        .func_p = NULL,
         .param_p = NULL
     };
-    TimerInit(&timer_HCSR04);
+    UartInit(&uart_traza);
+    TraceStart();
+#endif
 
-    timer_config_t timer_acelerometro = {
-        .timer = TIMER_B,
-        .period = TIEMPO_MUESTREO_ACELEROMETRO,
-        .func_p = funcTimerAceleracion,
-        .param_p = NULL
-    };
-    TimerInit(&timer_acelerometro);
+    // Handlers del event loop: reemplazan a las tareas y a los timers
+    EventLoopInit(&loop_principal);
+    EventLoopAdd(&loop_principal, &aceleracion_handler);
+    EventLoopAdd(&loop_principal, &distancia_handler);
 
-    // Creacion de tareas
-    xTaskCreate(&medirDistancia, "Medicion de distancia", 2048, NULL, 5, &distancia_task_handle);
-    xTaskCreate(&obtenerAceleracion, "Obtencion de aceleracion", 2048, NULL, 5, &aceleracion_task_handle);
+    // Flancos del eco con el tiempo de su interrupcion
+    gpio_event_config_t eco = {
+        .pin = GPIO_ECHO,
+        .active_low = false,
+        .debounce_ms = REBOTE_ECO_MS,
+        .func_p = flancoEco,
+        .param_p = &distancia_handler
+    };
+    GPIOEventSubscribe(&eco);
 
-	// Inicio de los timers
-    TimerStart(timer_acelerometro.timer);
-    TimerStart(timer_HCSR04.timer);
+    // Una sola tarea (y un solo stack) para los dos handlers
+    EventLoopStart(&loop_principal, EVENT_LOOP_TASK_STACK, EVENT_LOOP_TASK_PRIORITY);
 }
 /*==================[end of file]============================================*/
\ No newline at end of file
@@ -18,6 +18,8 @@
  * |   Date	    | Description                                    |
  * |:----------:|:-----------------------------------------------|
  * | 12/09/2023 | Document creation		                         |
+ * | 19/10/2026 | voltaje local a la tarea ADC (no compartido)   |
+ * | 19/10/2026 | Monitor de carga, stack y deadlines de tareas  |
  *
  * @author Joaquin Machado (joaquin.machado@ingenieria.uner.edu.ar)
  *
@@ -31,6 +33,7 @@
 #include "freertos/FreeRTOS.h"
 #include "freertos/task.h"
 #include "timer_mcu.h"
+#include "monitor_mcu.h"
 /*==================[macros and definitions]=================================*/
 /** @def BUFFER_SIZE
  *  @brief Tamaño del buffer para almacenar la señal de ECG.
@@ -49,10 +52,20 @@
  */
 #define FREC_DE_MUESTREO_PLOTTER 10000
 
-/** @var voltaje
- *  @brief Valor del voltaje leído del canal analógico en milivoltios.
+/** @def MONITOR_ADC
+ *  @brief Id de la tarea ADC en el monitor de tareas.
  */
-uint16_t voltaje;
+#define MONITOR_ADC 0
+
+/** @def MONITOR_DAC
+ *  @brief Id de la tarea DAC en el monitor de tareas.
+ */
+#define MONITOR_DAC 1
+
+/** @def PERIODO_MONITOR
+ *  @brief Período del reporte del monitor por UART, en milisegundos.
+ */
+#define PERIODO_MONITOR 5000
 
 /*==================[internal data definition]===============================*/
 
@@ -101,6 +114,7 @@ const char ecg[BUFFER_SIZE] = {
  * @brief Notifica a la tarea ADC desde la interrupción del temporizador.
  */
 void funcTimerADC(){
+    MonitorNotify(MONITOR_ADC);
     vTaskNotifyGiveFromISR(ADC_task_handle, pdFALSE);
 }
 
@@ -108,6 +122,7 @@ void funcTimerADC(){
  * @brief Notifica a la tarea DAC desde la interrupción del temporizador.
  */
 void funcTimerDAC(){
+    MonitorNotify(MONITOR_DAC);
     vTaskNotifyGiveFromISR(DAC_task_handle, pdFALSE);
 }
 
@@ -120,11 +135,13 @@ void funcTimerDAC(){
 static void DAC_convert(void *pvParameter){ 
     while(1){
         ulTaskNotifyTake(pdTRUE, portMAX_DELAY);
+        MonitorBegin(MONITOR_DAC);
         AnalogOutputWrite((uint8_t) ecg[i]);
         i = i + 1;
 
         if (i == BUFFER_SIZE)
             i = 0;
+        MonitorEnd(MONITOR_DAC);
     }
 }
 
@@ -135,8 +152,11 @@ static void DAC_convert(void *pvParameter){
  *          por un ploter descargado desde VS Code.
  */
 static void ADC_convert(void *pvParameter){ 
+    uint16_t voltaje;   // Valor leído del canal analógico en milivoltios (solo lo usa esta tarea)
+
     while(1){
         ulTaskNotifyTake(pdTRUE, portMAX_DELAY);
+        MonitorBegin(MONITOR_ADC);
 
         AnalogInputReadSingle(CH1, &voltaje);
 
@@ -144,6 +164,7 @@ static void ADC_convert(void *pvParameter){
         UartSendString(UART_PC, ">ECG: ");
         UartSendString(UART_PC, (char*)UartItoa(voltaje, 10));
         UartSendString(UART_PC, "\r\n");
+        MonitorEnd(MONITOR_ADC);
     }
 }
 
@@ -187,6 +208,12 @@ void app_main(void){
     };
     UartInit(&uart);
 
+	// Monitor de tareas: reporte periódico por UART (el ploter ignora las
+	// líneas que no empiezan con '>')
+	MonitorInit(MONITOR_ADC, "ADC", FREC_DE_MUESTREO_PLOTTER);
+	MonitorInit(MONITOR_DAC, "DAC", FREC_DE_MUESTREO_DAC);
+	MonitorStart(UART_PC, PERIODO_MONITOR);
+
 	// Creacion de tareas
 	xTaskCreate(&ADC_convert, "Conversion ADC", 4096, NULL, 5, &ADC_task_handle);
     xTaskCreate(&DAC_convert, "Conversion DAC", 2048, NULL, 5, &DAC_task_handle);